@@ -6,6 +6,14 @@ dnl Function to detect if libwtcdb dependencies are available
 AC_DEFUN([AX_LIBWTCDB_CHECK_LOCAL],
   [dnl Check for internationalization functions in libwtcdb/libwtcdb_i18n.c
   AC_CHECK_FUNCS([bindtextdomain])
+
+  dnl Check for time functions in libwtcdb/libwtcdb_progress.c
+  AC_CHECK_HEADERS([time.h])
+  AC_CHECK_FUNCS([clock_gettime])
+
+  dnl Check for positional read functions in libwtcdb/libwtcdb_io_backend.c
+  AC_CHECK_HEADERS([errno.h fcntl.h unistd.h])
+  AC_CHECK_FUNCS([pread])
 ])
 
 dnl Function to check if DLL support is needed
@@ -27,6 +27,7 @@
 #include "libwtcdb_crc.h"
 #include "libwtcdb_debug.h"
 #include "libwtcdb_definitions.h"
+#include "libwtcdb_io_backend.h"
 #include "libwtcdb_io_handle.h"
 #include "libwtcdb_libbfio.h"
 #include "libwtcdb_libcerror.h"
@@ -143,6 +144,128 @@ int libwtcdb_cache_entry_free(
 	return( 1 );
 }
 
+/* Clones a cache entry
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_cache_entry_clone(
+     libwtcdb_cache_entry_t **destination_cache_entry,
+     libwtcdb_cache_entry_t *source_cache_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_cache_entry_clone";
+
+	if( destination_cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_cache_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination cache entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_cache_entry == NULL )
+	{
+		*destination_cache_entry = NULL;
+
+		return( 1 );
+	}
+	*destination_cache_entry = memory_allocate_structure(
+	                            libwtcdb_cache_entry_t );
+
+	if( *destination_cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create destination cache entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     *destination_cache_entry,
+	     source_cache_entry,
+	     sizeof( libwtcdb_cache_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy source to destination cache entry.",
+		 function );
+
+		memory_free(
+		 *destination_cache_entry );
+
+		*destination_cache_entry = NULL;
+
+		return( -1 );
+	}
+	( *destination_cache_entry )->identifier = NULL;
+
+	if( source_cache_entry->identifier != NULL )
+	{
+		( *destination_cache_entry )->identifier = (uint8_t *) memory_allocate(
+		                                                        sizeof( uint8_t ) * source_cache_entry->identifier_size );
+
+		if( ( *destination_cache_entry )->identifier == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create destination identifier.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     ( *destination_cache_entry )->identifier,
+		     source_cache_entry->identifier,
+		     source_cache_entry->identifier_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy identifier.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *destination_cache_entry != NULL )
+	{
+		if( ( *destination_cache_entry )->identifier != NULL )
+		{
+			memory_free(
+			 ( *destination_cache_entry )->identifier );
+		}
+		memory_free(
+		 *destination_cache_entry );
+
+		*destination_cache_entry = NULL;
+	}
+	return( -1 );
+}
+
 /* Reads a cache entry header
  * Returns 1 if successful or -1 on error
  */
@@ -531,6 +654,179 @@ int libwtcdb_cache_entry_header_read_data(
 	return( 1 );
 }
 
+/* Reads a cache entry from data that starts with the cache entry header
+ * The padding and cached data are not read, only their bounds are checked
+ * Returns 1 if successful, 0 if the data is too small to contain the identifier string or -1 on error
+ */
+int libwtcdb_cache_entry_read_data(
+     libwtcdb_cache_entry_t *cache_entry,
+     libwtcdb_io_handle_t *io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	static char *function          = "libwtcdb_cache_entry_read_data";
+	size_t cache_entry_header_size = 0;
+	size_t data_offset             = 0;
+
+	if( cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_entry->identifier != NULL )
+	{
+		memory_free(
+		 cache_entry->identifier );
+
+		cache_entry->identifier = NULL;
+	}
+	if( libwtcdb_cache_entry_header_read_data(
+	     cache_entry,
+	     io_handle,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read cache entry header.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->format_version == 20 )
+	{
+		cache_entry_header_size = sizeof( wtcdb_cache_entry_v20_t );
+	}
+	else if( io_handle->format_version == 21 )
+	{
+		cache_entry_header_size = sizeof( wtcdb_cache_entry_v21_t );
+	}
+	else
+	{
+		cache_entry_header_size = sizeof( wtcdb_cache_entry_v30_t );
+	}
+	data_offset = cache_entry_header_size;
+
+	if( cache_entry->identifier_size > 0 )
+	{
+		if( ( cache_entry->identifier_size > cache_entry->data_size )
+		 || ( data_offset > ( cache_entry->data_size - cache_entry->identifier_size ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid identifier size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( cache_entry->identifier_size > ( data_size - data_offset ) )
+		{
+			return( 0 );
+		}
+		cache_entry->identifier = (uint8_t *) memory_allocate(
+		                                       sizeof( uint8_t ) * cache_entry->identifier_size );
+
+		if( cache_entry->identifier == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create identifier string.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     cache_entry->identifier,
+		     &( data[ data_offset ] ),
+		     (size_t) cache_entry->identifier_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy identifier string.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: identifier string data:\n",
+			 function );
+			libcnotify_print_data(
+			 cache_entry->identifier,
+			 cache_entry->identifier_size,
+			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+		}
+#endif
+		data_offset += cache_entry->identifier_size;
+	}
+	if( cache_entry->padding_size > 0 )
+	{
+		if( ( cache_entry->padding_size > cache_entry->data_size )
+		 || ( data_offset > ( cache_entry->data_size - cache_entry->padding_size ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid padding size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		data_offset += cache_entry->padding_size;
+	}
+	/* A cached data size that exceeds the entry is treated as no cached data
+	 * so that the rest of the file remains readable
+	 */
+	if( ( cache_entry->cached_data_size > cache_entry->data_size )
+	 || ( data_offset > ( cache_entry->data_size - cache_entry->cached_data_size ) ) )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: cached data size: %" PRIu32 " value out of bounds.\n",
+			 function,
+			 cache_entry->cached_data_size );
+		}
+#endif
+		cache_entry->cached_data_size = 0;
+	}
+	cache_entry->file_offset        = file_offset;
+	cache_entry->cached_data_offset = file_offset + data_offset;
+
+	return( 1 );
+
+on_error:
+	if( cache_entry->identifier != NULL )
+	{
+		memory_free(
+		 cache_entry->identifier );
+
+		cache_entry->identifier = NULL;
+	}
+	return( -1 );
+}
+
 /* Reads a cache entry
  * Returns 1 if successful or -1 on error
  */
@@ -632,7 +928,8 @@ int libwtcdb_cache_entry_read_file_io_handle(
 		 file_offset );
 	}
 #endif
-	read_count = libbfio_handle_read_buffer_at_offset(
+	read_count = libwtcdb_io_backend_read_buffer_at_offset(
+	              io_handle->io_backend,
 	              file_io_handle,
 	              cache_entry_data,
 	              cache_entry_header_size,
@@ -709,10 +1006,12 @@ int libwtcdb_cache_entry_read_file_io_handle(
 
 			goto on_error;
 		}
-		read_count = libbfio_handle_read_buffer(
+		read_count = libwtcdb_io_backend_read_buffer_at_offset(
+		              io_handle->io_backend,
 		              file_io_handle,
 		              cache_entry->identifier,
 		              cache_entry->identifier_size,
+		              file_offset + data_offset,
 		              error );
 
 		if( read_count != (ssize_t) cache_entry->identifier_size )
@@ -721,8 +1020,10 @@ int libwtcdb_cache_entry_read_file_io_handle(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read cache entry identifier string.",
-			 function );
+			 "%s: unable to read cache entry identifier string at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset + data_offset,
+			 file_offset + data_offset );
 
 			goto on_error;
 		}
@@ -805,10 +1106,12 @@ int libwtcdb_cache_entry_read_file_io_handle(
 
 				goto on_error;
 			}
-			read_count = libbfio_handle_read_buffer(
+			read_count = libwtcdb_io_backend_read_buffer_at_offset(
+			              io_handle->io_backend,
 			              file_io_handle,
 			              padding_data,
 			              cache_entry->padding_size,
+			              file_offset + data_offset,
 			              error );
 
 			if( read_count != (ssize_t) cache_entry->padding_size )
@@ -817,8 +1120,10 @@ int libwtcdb_cache_entry_read_file_io_handle(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_IO,
 				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read cache entry padding data.",
-				 function );
+				 "%s: unable to read cache entry padding data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 file_offset + data_offset,
+				 file_offset + data_offset );
 
 				goto on_error;
 			}
@@ -829,10 +1134,15 @@ int libwtcdb_cache_entry_read_file_io_handle(
 			 padding_data,
 			 cache_entry->padding_size,
 			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-		}
-		data_offset += cache_entry->padding_size;
 
+			memory_free(
+			 padding_data );
+
+			padding_data = NULL;
+		}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+		data_offset += cache_entry->padding_size;
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	else if( libcnotify_verbose != 0 )
@@ -841,9 +1151,36 @@ int libwtcdb_cache_entry_read_file_io_handle(
 		 "\n" );
 	}
 #endif
+	/* A cached data size that exceeds the entry is treated as no cached data
+	 * so that the rest of the file remains readable
+	 */
+	if( ( cache_entry->cached_data_size > cache_entry->data_size )
+	 || ( data_offset > ( cache_entry->data_size - cache_entry->cached_data_size ) ) )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: cached data size: %" PRIu32 " value out of bounds.\n",
+			 function,
+			 cache_entry->cached_data_size );
+		}
+#endif
+		cache_entry->cached_data_size = 0;
+	}
+	cache_entry->file_offset        = file_offset;
+	cache_entry->cached_data_offset = file_offset + data_offset;
+
 	return( 1 );
 
 on_error:
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( padding_data != NULL )
+	{
+		memory_free(
+		 padding_data );
+	}
+#endif
 	if( cache_entry->identifier != NULL )
 	{
 		memory_free(
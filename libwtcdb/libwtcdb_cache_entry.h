@@ -37,6 +37,10 @@ typedef struct libwtcdb_cache_entry libwtcdb_cache_entry_t;
 
 struct libwtcdb_cache_entry
 {
+	/* The file offset
+	 */
+	off64_t file_offset;
+
 	/* The data size
 	 */
 	uint32_t data_size;
@@ -57,6 +61,10 @@ struct libwtcdb_cache_entry
 	 */
 	uint32_t cached_data_size;
 
+	/* The cached data offset
+	 */
+	off64_t cached_data_offset;
+
 	/* The identifier
 	 */
 	uint8_t *identifier;
@@ -74,6 +82,11 @@ int libwtcdb_cache_entry_free(
      libwtcdb_cache_entry_t **cache_entry,
      libcerror_error_t **error );
 
+int libwtcdb_cache_entry_clone(
+     libwtcdb_cache_entry_t **destination_cache_entry,
+     libwtcdb_cache_entry_t *source_cache_entry,
+     libcerror_error_t **error );
+
 int libwtcdb_cache_entry_header_read_data(
      libwtcdb_cache_entry_t *cache_entry,
      libwtcdb_io_handle_t *io_handle,
@@ -81,6 +94,14 @@ int libwtcdb_cache_entry_header_read_data(
      size_t data_size,
      libcerror_error_t **error );
 
+int libwtcdb_cache_entry_read_data(
+     libwtcdb_cache_entry_t *cache_entry,
+     libwtcdb_io_handle_t *io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     off64_t file_offset,
+     libcerror_error_t **error );
+
 int libwtcdb_cache_entry_read_file_io_handle(
      libwtcdb_cache_entry_t *cache_entry,
      libwtcdb_io_handle_t *io_handle,
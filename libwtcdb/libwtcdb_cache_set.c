@@ -0,0 +1,4984 @@
+/*
+ * Cache set functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#include "libwtcdb_cache_entry.h"
+#include "libwtcdb_cache_set.h"
+#include "libwtcdb_definitions.h"
+#include "libwtcdb_file.h"
+#include "libwtcdb_hash_index.h"
+#include "libwtcdb_index_entry.h"
+#include "libwtcdb_item.h"
+#include "libwtcdb_libbfio.h"
+#include "libwtcdb_libcdata.h"
+#include "libwtcdb_libcerror.h"
+#include "libwtcdb_libcnotify.h"
+#include "libwtcdb_libcthreads.h"
+#include "libwtcdb_unused.h"
+
+/* The names of the files of a thumbcache directory, the index file followed
+ * by the cache files in order of their cache type, where the Windows 7 and 8
+ * only sizes are included at their position in the Windows 8 order
+ */
+static const char *libwtcdb_cache_set_filenames[] = {
+	"thumbcache_idx.db",
+	"thumbcache_16.db",
+	"thumbcache_32.db",
+	"thumbcache_48.db",
+	"thumbcache_96.db",
+	"thumbcache_256.db",
+	"thumbcache_768.db",
+	"thumbcache_1024.db",
+	"thumbcache_1280.db",
+	"thumbcache_1600.db",
+	"thumbcache_1920.db",
+	"thumbcache_2560.db",
+	"thumbcache_sr.db",
+	"thumbcache_wide.db",
+	"thumbcache_exif.db",
+	"thumbcache_wide_alternate.db",
+	"thumbcache_custom_stream.db",
+	NULL };
+
+/* The cache files that correspond with the cache entry offsets of an index entry
+ * per format version, as index into libwtcdb_cache_set_filenames
+ */
+static const int libwtcdb_cache_set_cache_entry_offset_filenames_v20[] = {
+	2, 4, 5, 7, 12, -1 };
+
+static const int libwtcdb_cache_set_cache_entry_offset_filenames_v30[] = {
+	1, 2, 3, 4, 5, 7, 12, 13, 14, -1 };
+
+static const int libwtcdb_cache_set_cache_entry_offset_filenames_v31[] = {
+	1, 2, 3, 4, 5, 7, 9, 12, 13, 14, 15, -1 };
+
+static const int libwtcdb_cache_set_cache_entry_offset_filenames_v32[] = {
+	1, 2, 3, 4, 5, 6, 8, 10, 11, 12, 13, 14, 15, 16, -1 };
+
+/* Creates a cache set
+ * Make sure the value cache_set is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_cache_set_initialize(
+     libwtcdb_cache_set_t **cache_set,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_cache_set_t *internal_cache_set = NULL;
+	static char *function                             = "libwtcdb_cache_set_initialize";
+
+	if( cache_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache set.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cache_set != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid cache set value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache_set = memory_allocate_structure(
+	                      libwtcdb_internal_cache_set_t );
+
+	if( internal_cache_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cache set.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_cache_set,
+	     0,
+	     sizeof( libwtcdb_internal_cache_set_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear cache set.",
+		 function );
+
+		memory_free(
+		 internal_cache_set );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_cache_set->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_initialize(
+	     &( internal_cache_set->open_tasks_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize open tasks mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_cache_set->maximum_number_of_threads      = 1;
+	internal_cache_set->maximum_number_of_open_threads = 1;
+
+	*cache_set = (libwtcdb_cache_set_t *) internal_cache_set;
+
+	return( 1 );
+
+on_error:
+	if( internal_cache_set != NULL )
+	{
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+		if( internal_cache_set->read_write_lock != NULL )
+		{
+			libcthreads_read_write_lock_free(
+			 &( internal_cache_set->read_write_lock ),
+			 NULL );
+		}
+#endif
+		memory_free(
+		 internal_cache_set );
+	}
+	return( -1 );
+}
+
+/* Frees a cache set
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_cache_set_free(
+     libwtcdb_cache_set_t **cache_set,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_cache_set_t *internal_cache_set = NULL;
+	static char *function                             = "libwtcdb_cache_set_free";
+	int result                                        = 1;
+
+	if( cache_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache set.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cache_set != NULL )
+	{
+		internal_cache_set = (libwtcdb_internal_cache_set_t *) *cache_set;
+
+		if( internal_cache_set->files != NULL )
+		{
+			if( libwtcdb_cache_set_close(
+			     *cache_set,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close cache set.",
+				 function );
+
+				result = -1;
+			}
+		}
+		*cache_set = NULL;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_cache_set->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( internal_cache_set->open_tasks_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free open tasks mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 internal_cache_set );
+	}
+	return( result );
+}
+
+/* Signals the cache set to abort opening its files
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_cache_set_signal_abort(
+     libwtcdb_cache_set_t *cache_set,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_cache_set_t *internal_cache_set = NULL;
+	libwtcdb_file_t *opening_file                     = NULL;
+	static char *function                             = "libwtcdb_cache_set_signal_abort";
+	int open_task_index                               = 0;
+	int result                                        = 1;
+
+	if( cache_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache_set = (libwtcdb_internal_cache_set_t *) cache_set;
+
+	internal_cache_set->abort = 1;
+
+	/* The open tasks mutex is held while the files are signalled, a file is
+	 * only freed after it was removed from its open task under the same mutex
+	 */
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_cache_set->open_tasks_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab open tasks mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_cache_set->open_tasks != NULL )
+	{
+		/* Signal every file that is currently being opened
+		 */
+		for( open_task_index = 0;
+		     open_task_index < internal_cache_set->number_of_open_tasks;
+		     open_task_index++ )
+		{
+			opening_file = internal_cache_set->open_tasks[ open_task_index ].opening_file;
+
+			if( opening_file == NULL )
+			{
+				continue;
+			}
+			if( libwtcdb_file_signal_abort(
+			     opening_file,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to signal file: %d to abort.",
+				 function,
+				 internal_cache_set->open_tasks[ open_task_index ].filename_index );
+
+				result = -1;
+
+				break;
+			}
+		}
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_cache_set->open_tasks_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release open tasks mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the maximum number of threads used to read the entries of the files
+ * More than 1 thread is only used when compiled with multi-thread support
+ * The value is used the next time the cache set is opened
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_cache_set_set_maximum_number_of_threads(
+     libwtcdb_cache_set_t *cache_set,
+     int maximum_number_of_threads,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_cache_set_t *internal_cache_set = NULL;
+	static char *function                             = "libwtcdb_cache_set_set_maximum_number_of_threads";
+
+	if( cache_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache_set = (libwtcdb_internal_cache_set_t *) cache_set;
+
+	if( ( maximum_number_of_threads < 1 )
+	 || ( maximum_number_of_threads > LIBWTCDB_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_cache_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_cache_set->maximum_number_of_threads = maximum_number_of_threads;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_cache_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the maximum number of open threads used to open the files
+ * More than 1 thread is only used when compiled with multi-thread support
+ * The index file is always opened before the cache files
+ * The value is used the next time the cache set is opened
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_cache_set_set_maximum_number_of_open_threads(
+     libwtcdb_cache_set_t *cache_set,
+     int maximum_number_of_open_threads,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_cache_set_t *internal_cache_set = NULL;
+	static char *function                             = "libwtcdb_cache_set_set_maximum_number_of_open_threads";
+
+	if( cache_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache_set = (libwtcdb_internal_cache_set_t *) cache_set;
+
+	if( ( maximum_number_of_open_threads < 1 )
+	 || ( maximum_number_of_open_threads > LIBWTCDB_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of open threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_cache_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_cache_set->maximum_number_of_open_threads = maximum_number_of_open_threads;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_cache_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the requested IO backend of the files
+ * The value is used the next time the cache set is opened
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_cache_set_set_io_backend(
+     libwtcdb_cache_set_t *cache_set,
+     int io_backend,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_cache_set_t *internal_cache_set = NULL;
+	static char *function                             = "libwtcdb_cache_set_set_io_backend";
+
+	if( cache_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache_set = (libwtcdb_internal_cache_set_t *) cache_set;
+
+	if( ( io_backend != LIBWTCDB_IO_BACKEND_DEFAULT )
+	 && ( io_backend != LIBWTCDB_IO_BACKEND_BFIO )
+	 && ( io_backend != LIBWTCDB_IO_BACKEND_IO_URING )
+	 && ( io_backend != LIBWTCDB_IO_BACKEND_PREAD ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported IO backend: %d.",
+		 function,
+		 io_backend );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_cache_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_cache_set->requested_io_backend = io_backend;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_cache_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the handle pool of the files
+ * The handle pool bounds the number of file IO handles of the files that are open at the same time
+ * The handle pool is removed if handle_pool is NULL
+ * The value is used the next time the cache set is opened
+ * and the handle pool must remain valid until the cache set is closed
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_cache_set_set_handle_pool(
+     libwtcdb_cache_set_t *cache_set,
+     libwtcdb_handle_pool_t *handle_pool,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_cache_set_t *internal_cache_set = NULL;
+	static char *function                             = "libwtcdb_cache_set_set_handle_pool";
+
+	if( cache_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache_set = (libwtcdb_internal_cache_set_t *) cache_set;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_cache_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_cache_set->handle_pool = handle_pool;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_cache_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the read mode
+ * In the indexed read mode only the cache entries referenced by the entries
+ * of the index file are read, instead of all the cache entries of the cache files
+ * The value is used the next time the cache set is opened
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_cache_set_set_read_mode(
+     libwtcdb_cache_set_t *cache_set,
+     int read_mode,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_cache_set_t *internal_cache_set = NULL;
+	static char *function                             = "libwtcdb_cache_set_set_read_mode";
+
+	if( cache_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache_set = (libwtcdb_internal_cache_set_t *) cache_set;
+
+	if( ( read_mode != LIBWTCDB_CACHE_SET_READ_MODE_ALL )
+	 && ( read_mode != LIBWTCDB_CACHE_SET_READ_MODE_INDEXED ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported read mode: %d.",
+		 function,
+		 read_mode );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_cache_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_cache_set->read_mode = read_mode;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_cache_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Opens the thumbcache files of a directory
+ * The index file and the cache files are opened in order of their cache type,
+ * files that are not present in the directory are skipped
+ * The filename index of a file that could not be opened is the index of its
+ * name in the names of the files of a thumbcache directory
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_cache_set_open(
+     libwtcdb_cache_set_t *cache_set,
+     const char *directory_name,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libwtcdb_cache_set_open_task_t *open_tasks        = NULL;
+	libwtcdb_internal_cache_set_t *internal_cache_set = NULL;
+	char *filename                                    = NULL;
+	char *filenames                                   = NULL;
+	static char *function                             = "libwtcdb_cache_set_open";
+	size_t directory_name_length                      = 0;
+	size_t filename_index                             = 0;
+	size_t filename_size                              = 0;
+	size_t name_length                                = 0;
+	size_t maximum_name_length                        = 0;
+	int filename_table_index                          = 0;
+	int number_of_filenames                           = 0;
+	int number_of_open_tasks                          = 0;
+	int result                                        = 0;
+
+	if( cache_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache_set = (libwtcdb_internal_cache_set_t *) cache_set;
+
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	if( libwtcdb_cache_set_check_access_flags(
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	directory_name_length = narrow_string_length(
+	                         directory_name );
+
+	if( directory_name_length == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( filename_table_index = 0;
+	     libwtcdb_cache_set_filenames[ filename_table_index ] != NULL;
+	     filename_table_index++ )
+	{
+		name_length = narrow_string_length(
+		               libwtcdb_cache_set_filenames[ filename_table_index ] );
+
+		if( name_length > maximum_name_length )
+		{
+			maximum_name_length = name_length;
+		}
+	}
+	number_of_filenames = filename_table_index;
+
+	filename_size = directory_name_length + maximum_name_length + 2;
+
+	/* Every file has its own filename since the files can be opened concurrently
+	 */
+	filenames = narrow_string_allocate(
+	             filename_size * number_of_filenames );
+
+	if( filenames == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filenames.",
+		 function );
+
+		goto on_error;
+	}
+	open_tasks = (libwtcdb_cache_set_open_task_t *) memory_allocate(
+	                                                 sizeof( libwtcdb_cache_set_open_task_t ) * number_of_filenames );
+
+	if( open_tasks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create open tasks.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     open_tasks,
+	     0,
+	     sizeof( libwtcdb_cache_set_open_task_t ) * number_of_filenames ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear open tasks.",
+		 function );
+
+		goto on_error;
+	}
+	for( filename_table_index = 0;
+	     filename_table_index < number_of_filenames;
+	     filename_table_index++ )
+	{
+		filename = &( filenames[ number_of_open_tasks * filename_size ] );
+
+		if( narrow_string_copy(
+		     filename,
+		     directory_name,
+		     directory_name_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy directory name.",
+			 function );
+
+			goto on_error;
+		}
+		filename_index = directory_name_length;
+
+		if( directory_name[ directory_name_length - 1 ] != (char) LIBWTCDB_SEPARATOR )
+		{
+			filename[ filename_index++ ] = (char) LIBWTCDB_SEPARATOR;
+		}
+		name_length = narrow_string_length(
+		               libwtcdb_cache_set_filenames[ filename_table_index ] );
+
+		if( narrow_string_copy(
+		     &( filename[ filename_index ] ),
+		     libwtcdb_cache_set_filenames[ filename_table_index ],
+		     name_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy name: %s.",
+			 function,
+			 libwtcdb_cache_set_filenames[ filename_table_index ] );
+
+			goto on_error;
+		}
+		filename[ filename_index + name_length ] = 0;
+
+		result = libwtcdb_cache_set_file_exists(
+		          filename,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: unable to determine if file: %s exists.",
+			 function,
+			 filename );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		open_tasks[ number_of_open_tasks ].filename             = filename;
+		open_tasks[ number_of_open_tasks ].filename_table_index = filename_table_index;
+		open_tasks[ number_of_open_tasks ].filename_index       = filename_table_index;
+
+		number_of_open_tasks++;
+	}
+	if( number_of_open_tasks == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: no thumbcache files found in directory: %s.",
+		 function,
+		 directory_name );
+
+		goto on_error;
+	}
+	if( libwtcdb_cache_set_run_open_tasks(
+	     internal_cache_set,
+	     open_tasks,
+	     number_of_open_tasks,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open files in directory: %s.",
+		 function,
+		 directory_name );
+
+		goto on_error;
+	}
+	memory_free(
+	 open_tasks );
+
+	memory_free(
+	 filenames );
+
+	return( 1 );
+
+on_error:
+	if( open_tasks != NULL )
+	{
+		memory_free(
+		 open_tasks );
+	}
+	if( filenames != NULL )
+	{
+		memory_free(
+		 filenames );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Opens the thumbcache files of a directory
+ * The index file and the cache files are opened in order of their cache type,
+ * files that are not present in the directory are skipped
+ * The filename index of a file that could not be opened is the index of its
+ * name in the names of the files of a thumbcache directory
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_cache_set_open_wide(
+     libwtcdb_cache_set_t *cache_set,
+     const wchar_t *directory_name,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libwtcdb_cache_set_open_task_t *open_tasks        = NULL;
+	libwtcdb_internal_cache_set_t *internal_cache_set = NULL;
+	const char *name                                  = NULL;
+	wchar_t *filename                                 = NULL;
+	wchar_t *filenames                                = NULL;
+	static char *function                             = "libwtcdb_cache_set_open_wide";
+	size_t directory_name_length                      = 0;
+	size_t filename_index                             = 0;
+	size_t filename_size                              = 0;
+	size_t name_index                                 = 0;
+	size_t name_length                                = 0;
+	size_t maximum_name_length                        = 0;
+	int filename_table_index                          = 0;
+	int number_of_filenames                           = 0;
+	int number_of_open_tasks                          = 0;
+	int result                                        = 0;
+
+	if( cache_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache_set = (libwtcdb_internal_cache_set_t *) cache_set;
+
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	if( libwtcdb_cache_set_check_access_flags(
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	directory_name_length = wide_string_length(
+	                         directory_name );
+
+	if( directory_name_length == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( filename_table_index = 0;
+	     libwtcdb_cache_set_filenames[ filename_table_index ] != NULL;
+	     filename_table_index++ )
+	{
+		name_length = narrow_string_length(
+		               libwtcdb_cache_set_filenames[ filename_table_index ] );
+
+		if( name_length > maximum_name_length )
+		{
+			maximum_name_length = name_length;
+		}
+	}
+	number_of_filenames = filename_table_index;
+
+	filename_size = directory_name_length + maximum_name_length + 2;
+
+	/* Every file has its own filename since the files can be opened concurrently
+	 */
+	filenames = wide_string_allocate(
+	             filename_size * number_of_filenames );
+
+	if( filenames == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filenames.",
+		 function );
+
+		goto on_error;
+	}
+	open_tasks = (libwtcdb_cache_set_open_task_t *) memory_allocate(
+	                                                 sizeof( libwtcdb_cache_set_open_task_t ) * number_of_filenames );
+
+	if( open_tasks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create open tasks.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     open_tasks,
+	     0,
+	     sizeof( libwtcdb_cache_set_open_task_t ) * number_of_filenames ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear open tasks.",
+		 function );
+
+		goto on_error;
+	}
+	for( filename_table_index = 0;
+	     filename_table_index < number_of_filenames;
+	     filename_table_index++ )
+	{
+		filename = &( filenames[ number_of_open_tasks * filename_size ] );
+
+		if( wide_string_copy(
+		     filename,
+		     directory_name,
+		     directory_name_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy directory name.",
+			 function );
+
+			goto on_error;
+		}
+		filename_index = directory_name_length;
+
+		if( directory_name[ directory_name_length - 1 ] != (wchar_t) LIBWTCDB_SEPARATOR )
+		{
+			filename[ filename_index++ ] = (wchar_t) LIBWTCDB_SEPARATOR;
+		}
+		name = libwtcdb_cache_set_filenames[ filename_table_index ];
+
+		/* The names only contain ASCII characters
+		 */
+		for( name_index = 0;
+		     name[ name_index ] != 0;
+		     name_index++ )
+		{
+			filename[ filename_index + name_index ] = (wchar_t) name[ name_index ];
+		}
+		filename[ filename_index + name_index ] = 0;
+
+		result = libwtcdb_cache_set_file_exists_wide(
+		          filename,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: unable to determine if file: %s exists.",
+			 function,
+			 name );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		open_tasks[ number_of_open_tasks ].filename_wide        = filename;
+		open_tasks[ number_of_open_tasks ].filename_table_index = filename_table_index;
+		open_tasks[ number_of_open_tasks ].filename_index       = filename_table_index;
+
+		number_of_open_tasks++;
+	}
+	if( number_of_open_tasks == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: no thumbcache files found in directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( libwtcdb_cache_set_run_open_tasks(
+	     internal_cache_set,
+	     open_tasks,
+	     number_of_open_tasks,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open files in directory.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 open_tasks );
+
+	memory_free(
+	 filenames );
+
+	return( 1 );
+
+on_error:
+	if( open_tasks != NULL )
+	{
+		memory_free(
+		 open_tasks );
+	}
+	if( filenames != NULL )
+	{
+		memory_free(
+		 filenames );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Opens the files of a cache set
+ * The type of every file is determined from its signature
+ * The filename index of a file that could not be opened is the index of its
+ * filename in filenames
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_cache_set_open_files(
+     libwtcdb_cache_set_t *cache_set,
+     char * const filenames[],
+     int number_of_filenames,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libwtcdb_cache_set_open_task_t *open_tasks        = NULL;
+	libwtcdb_internal_cache_set_t *internal_cache_set = NULL;
+	static char *function                             = "libwtcdb_cache_set_open_files";
+	int filename_index                                = 0;
+
+	if( cache_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache_set = (libwtcdb_internal_cache_set_t *) cache_set;
+
+	if( filenames == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filenames.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_filenames <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of filenames value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	for( filename_index = 0;
+	     filename_index < number_of_filenames;
+	     filename_index++ )
+	{
+		if( filenames[ filename_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid filename: %d.",
+			 function,
+			 filename_index );
+
+			return( -1 );
+		}
+	}
+	if( libwtcdb_cache_set_check_access_flags(
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	open_tasks = (libwtcdb_cache_set_open_task_t *) memory_allocate(
+	                                                 sizeof( libwtcdb_cache_set_open_task_t ) * number_of_filenames );
+
+	if( open_tasks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create open tasks.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     open_tasks,
+	     0,
+	     sizeof( libwtcdb_cache_set_open_task_t ) * number_of_filenames ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear open tasks.",
+		 function );
+
+		goto on_error;
+	}
+	for( filename_index = 0;
+	     filename_index < number_of_filenames;
+	     filename_index++ )
+	{
+		open_tasks[ filename_index ].filename             = filenames[ filename_index ];
+		open_tasks[ filename_index ].filename_table_index = -1;
+		open_tasks[ filename_index ].filename_index       = filename_index;
+	}
+	if( libwtcdb_cache_set_run_open_tasks(
+	     internal_cache_set,
+	     open_tasks,
+	     number_of_filenames,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open files.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 open_tasks );
+
+	return( 1 );
+
+on_error:
+	if( open_tasks != NULL )
+	{
+		memory_free(
+		 open_tasks );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Opens the files of a cache set
+ * The type of every file is determined from its signature
+ * The filename index of a file that could not be opened is the index of its
+ * filename in filenames
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_cache_set_open_files_wide(
+     libwtcdb_cache_set_t *cache_set,
+     wchar_t * const filenames[],
+     int number_of_filenames,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libwtcdb_cache_set_open_task_t *open_tasks        = NULL;
+	libwtcdb_internal_cache_set_t *internal_cache_set = NULL;
+	static char *function                             = "libwtcdb_cache_set_open_files_wide";
+	int filename_index                                = 0;
+
+	if( cache_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache_set = (libwtcdb_internal_cache_set_t *) cache_set;
+
+	if( filenames == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filenames.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_filenames <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of filenames value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	for( filename_index = 0;
+	     filename_index < number_of_filenames;
+	     filename_index++ )
+	{
+		if( filenames[ filename_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid filename: %d.",
+			 function,
+			 filename_index );
+
+			return( -1 );
+		}
+	}
+	if( libwtcdb_cache_set_check_access_flags(
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	open_tasks = (libwtcdb_cache_set_open_task_t *) memory_allocate(
+	                                                 sizeof( libwtcdb_cache_set_open_task_t ) * number_of_filenames );
+
+	if( open_tasks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create open tasks.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     open_tasks,
+	     0,
+	     sizeof( libwtcdb_cache_set_open_task_t ) * number_of_filenames ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear open tasks.",
+		 function );
+
+		goto on_error;
+	}
+	for( filename_index = 0;
+	     filename_index < number_of_filenames;
+	     filename_index++ )
+	{
+		open_tasks[ filename_index ].filename_wide        = filenames[ filename_index ];
+		open_tasks[ filename_index ].filename_table_index = -1;
+		open_tasks[ filename_index ].filename_index       = filename_index;
+	}
+	if( libwtcdb_cache_set_run_open_tasks(
+	     internal_cache_set,
+	     open_tasks,
+	     number_of_filenames,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open files.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 open_tasks );
+
+	return( 1 );
+
+on_error:
+	if( open_tasks != NULL )
+	{
+		memory_free(
+		 open_tasks );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Closes a cache set
+ * Returns 0 if successful or -1 on error
+ */
+int libwtcdb_cache_set_close(
+     libwtcdb_cache_set_t *cache_set,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *files_array                     = NULL;
+	libwtcdb_cache_set_failed_file_t *failed_files    = NULL;
+	libwtcdb_hash_index_t *hash_index                 = NULL;
+	libwtcdb_internal_cache_set_t *internal_cache_set = NULL;
+	static char *function                             = "libwtcdb_cache_set_close";
+	int number_of_failed_files                        = 0;
+
+	if( cache_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache_set = (libwtcdb_internal_cache_set_t *) cache_set;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_cache_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	files_array            = internal_cache_set->files;
+	hash_index             = internal_cache_set->hash_index;
+	failed_files           = internal_cache_set->failed_files;
+	number_of_failed_files = internal_cache_set->number_of_failed_files;
+
+	internal_cache_set->files                  = NULL;
+	internal_cache_set->hash_index             = NULL;
+	internal_cache_set->failed_files           = NULL;
+	internal_cache_set->number_of_failed_files = 0;
+	internal_cache_set->abort                  = 0;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_cache_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		internal_cache_set->files                  = files_array;
+		internal_cache_set->hash_index             = hash_index;
+		internal_cache_set->failed_files           = failed_files;
+		internal_cache_set->number_of_failed_files = number_of_failed_files;
+
+		return( -1 );
+	}
+#endif
+	if( failed_files != NULL )
+	{
+		if( libwtcdb_cache_set_free_failed_files(
+		     &failed_files,
+		     number_of_failed_files,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free failed files.",
+			 function );
+
+			libwtcdb_hash_index_free(
+			 &hash_index,
+			 NULL );
+
+			libcdata_array_free(
+			 &files_array,
+			 (int (*)(intptr_t **, libcerror_error_t **)) &libwtcdb_file_free,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	if( hash_index != NULL )
+	{
+		if( libwtcdb_hash_index_free(
+		     &hash_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free hash index.",
+			 function );
+
+			libcdata_array_free(
+			 &files_array,
+			 (int (*)(intptr_t **, libcerror_error_t **)) &libwtcdb_file_free,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	if( files_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cache set - missing files.",
+		 function );
+
+		return( -1 );
+	}
+	/* Freeing a file closes it
+	 */
+	if( libcdata_array_free(
+	     &files_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libwtcdb_file_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free files array.",
+		 function );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+/* Checks the access flags
+ * Returns 1 if supported or -1 on error
+ */
+int libwtcdb_cache_set_check_access_flags(
+     int access_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_cache_set_check_access_flags";
+
+	if( ( ( access_flags & LIBWTCDB_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBWTCDB_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBWTCDB_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Determines if a file exists
+ * Returns 1 if the file exists, 0 if not or -1 on error
+ */
+int libwtcdb_cache_set_file_exists(
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libwtcdb_cache_set_file_exists";
+	size_t filename_length           = 0;
+	int result                       = 0;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	result = libbfio_handle_exists(
+	          file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to determine if file exists.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Determines if a file exists
+ * Returns 1 if the file exists, 0 if not or -1 on error
+ */
+int libwtcdb_cache_set_file_exists_wide(
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libwtcdb_cache_set_file_exists_wide";
+	size_t filename_length           = 0;
+	int result                       = 0;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	result = libbfio_handle_exists(
+	          file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to determine if file exists.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Sets the file that is being opened by an open task
+ * The file is set and cleared under the open tasks mutex so that signal abort
+ * never accesses a file that is being freed
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_cache_set_set_opening_file(
+     libwtcdb_internal_cache_set_t *internal_cache_set,
+     libwtcdb_file_t **opening_file,
+     libwtcdb_file_t *file,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_cache_set_set_opening_file";
+
+	if( internal_cache_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache set.",
+		 function );
+
+		return( -1 );
+	}
+	if( opening_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid opening file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_cache_set->open_tasks_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab open tasks mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*opening_file = file;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_cache_set->open_tasks_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release open tasks mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the open tasks of the files that are being opened
+ * The open tasks are set and cleared under the open tasks mutex so that signal
+ * abort never accesses open tasks that are being freed
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_cache_set_set_open_tasks(
+     libwtcdb_internal_cache_set_t *internal_cache_set,
+     libwtcdb_cache_set_open_task_t *open_tasks,
+     int number_of_open_tasks,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_cache_set_set_open_tasks";
+
+	if( internal_cache_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_cache_set->open_tasks_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab open tasks mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_cache_set->open_tasks           = open_tasks;
+	internal_cache_set->number_of_open_tasks = number_of_open_tasks;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_cache_set->open_tasks_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release open tasks mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Opens a file
+ * The filename table index is the index of the name of the file in the names
+ * of the files of a thumbcache directory, or -1 if any file type is supported
+ * The opening file is set while the file is being opened so that it can be
+ * signalled to abort
+ * Make sure the value file is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_cache_set_open_file(
+     libwtcdb_internal_cache_set_t *internal_cache_set,
+     libcdata_array_t *files_array,
+     const char *filename,
+     int access_flags,
+     int filename_table_index,
+     libwtcdb_file_t **opening_file,
+     libwtcdb_file_t **file,
+     libcerror_error_t **error )
+{
+	libwtcdb_file_t *safe_file = NULL;
+	static char *function      = "libwtcdb_cache_set_open_file";
+	int result                 = 0;
+
+	if( internal_cache_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache set.",
+		 function );
+
+		return( -1 );
+	}
+	if( opening_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid opening file.",
+		 function );
+
+		return( -1 );
+	}
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libwtcdb_cache_set_initialize_file(
+	     internal_cache_set,
+	     &safe_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file.",
+		 function );
+
+		goto on_error;
+	}
+	if( filename_table_index > 0 )
+	{
+		if( libwtcdb_cache_set_select_cache_entries(
+		     internal_cache_set,
+		     files_array,
+		     filename_table_index,
+		     safe_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to select cache entries.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libwtcdb_cache_set_set_opening_file(
+	     internal_cache_set,
+	     opening_file,
+	     safe_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set opening file.",
+		 function );
+
+		goto on_error;
+	}
+	result = libwtcdb_file_open(
+	          safe_file,
+	          filename,
+	          access_flags,
+	          error );
+
+	/* The file is only freed after it is no longer set as the opening file
+	 */
+	if( libwtcdb_cache_set_set_opening_file(
+	     internal_cache_set,
+	     opening_file,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to clear opening file.",
+		 function );
+
+		if( result == 1 )
+		{
+			libwtcdb_file_close(
+			 safe_file,
+			 NULL );
+		}
+		/* The file cannot be freed safely, hence it is leaked
+		 */
+		return( -1 );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	*file = safe_file;
+
+	return( 1 );
+
+on_error:
+	if( safe_file != NULL )
+	{
+		libwtcdb_file_free(
+		 &safe_file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Opens a file
+ * The filename table index is the index of the name of the file in the names
+ * of the files of a thumbcache directory, or -1 if any file type is supported
+ * The opening file is set while the file is being opened so that it can be
+ * signalled to abort
+ * Make sure the value file is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_cache_set_open_file_wide(
+     libwtcdb_internal_cache_set_t *internal_cache_set,
+     libcdata_array_t *files_array,
+     const wchar_t *filename,
+     int access_flags,
+     int filename_table_index,
+     libwtcdb_file_t **opening_file,
+     libwtcdb_file_t **file,
+     libcerror_error_t **error )
+{
+	libwtcdb_file_t *safe_file = NULL;
+	static char *function      = "libwtcdb_cache_set_open_file_wide";
+	int result                 = 0;
+
+	if( internal_cache_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache set.",
+		 function );
+
+		return( -1 );
+	}
+	if( opening_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid opening file.",
+		 function );
+
+		return( -1 );
+	}
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libwtcdb_cache_set_initialize_file(
+	     internal_cache_set,
+	     &safe_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file.",
+		 function );
+
+		goto on_error;
+	}
+	if( filename_table_index > 0 )
+	{
+		if( libwtcdb_cache_set_select_cache_entries(
+		     internal_cache_set,
+		     files_array,
+		     filename_table_index,
+		     safe_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to select cache entries.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libwtcdb_cache_set_set_opening_file(
+	     internal_cache_set,
+	     opening_file,
+	     safe_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set opening file.",
+		 function );
+
+		goto on_error;
+	}
+	result = libwtcdb_file_open_wide(
+	          safe_file,
+	          filename,
+	          access_flags,
+	          error );
+
+	/* The file is only freed after it is no longer set as the opening file
+	 */
+	if( libwtcdb_cache_set_set_opening_file(
+	     internal_cache_set,
+	     opening_file,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to clear opening file.",
+		 function );
+
+		if( result == 1 )
+		{
+			libwtcdb_file_close(
+			 safe_file,
+			 NULL );
+		}
+		/* The file cannot be freed safely, hence it is leaked
+		 */
+		return( -1 );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	*file = safe_file;
+
+	return( 1 );
+
+on_error:
+	if( safe_file != NULL )
+	{
+		libwtcdb_file_free(
+		 &safe_file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Opens the file of an open task
+ * The result and error are stored in the open task
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_cache_set_open_task_function(
+     libwtcdb_cache_set_open_task_t *open_task )
+{
+	static char *function = "libwtcdb_cache_set_open_task_function";
+	int result            = 0;
+
+	if( open_task == NULL )
+	{
+		return( -1 );
+	}
+	if( open_task->internal_cache_set == NULL )
+	{
+		libcerror_error_set(
+		 &( open_task->error ),
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid open task - missing cache set.",
+		 function );
+
+		result = -1;
+	}
+	else if( open_task->internal_cache_set->abort != 0 )
+	{
+		libcerror_error_set(
+		 &( open_task->error ),
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+		 "%s: abort requested.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+	else if( open_task->filename_wide != NULL )
+	{
+		result = libwtcdb_cache_set_open_file_wide(
+		          open_task->internal_cache_set,
+		          open_task->files_array,
+		          open_task->filename_wide,
+		          open_task->access_flags,
+		          open_task->filename_table_index,
+		          &( open_task->opening_file ),
+		          &( open_task->file ),
+		          &( open_task->error ) );
+	}
+#endif
+	else
+	{
+		result = libwtcdb_cache_set_open_file(
+		          open_task->internal_cache_set,
+		          open_task->files_array,
+		          open_task->filename,
+		          open_task->access_flags,
+		          open_task->filename_table_index,
+		          &( open_task->opening_file ),
+		          &( open_task->file ),
+		          &( open_task->error ) );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 &( open_task->error ),
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %d.",
+		 function,
+		 open_task->filename_index );
+
+		result = -1;
+	}
+	open_task->result = result;
+
+	return( result );
+}
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+
+/* Runs the open task as a thread pool callback
+ * The result and error are stored in the open task
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_cache_set_open_task_thread_pool_callback(
+     libwtcdb_cache_set_open_task_t *open_task,
+     void *arguments LIBWTCDB_ATTRIBUTE_UNUSED )
+{
+	LIBWTCDB_UNREFERENCED_PARAMETER( arguments )
+
+	if( open_task == NULL )
+	{
+		return( -1 );
+	}
+	libwtcdb_cache_set_open_task_function(
+	 open_task );
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT ) */
+
+/* Runs the open tasks and sets the files of the cache set
+ * The index file is opened before the cache files, since the cache entries
+ * that are selected in the indexed read mode depend on it, the cache files
+ * are opened concurrently when more than 1 open thread is allowed
+ * A file that could not be opened is stored as a failed file, only when none
+ * of the files could be opened or abort was signalled opening fails
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_cache_set_run_open_tasks(
+     libwtcdb_internal_cache_set_t *internal_cache_set,
+     libwtcdb_cache_set_open_task_t *open_tasks,
+     int number_of_open_tasks,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *files_array                  = NULL;
+	libwtcdb_cache_set_failed_file_t *failed_files = NULL;
+	static char *function                          = "libwtcdb_cache_set_run_open_tasks";
+	int first_open_task_index                      = 0;
+	int number_of_failed_files                     = 0;
+	int number_of_files                            = 0;
+	int open_task_index                            = 0;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *thread_pool         = NULL;
+	int maximum_number_of_open_threads             = 0;
+	int number_of_threads                          = 0;
+#endif
+
+	if( internal_cache_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache set.",
+		 function );
+
+		return( -1 );
+	}
+	if( open_tasks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid open tasks.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_open_tasks <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of open tasks value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_cache_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+	maximum_number_of_open_threads = internal_cache_set->maximum_number_of_open_threads;
+
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_cache_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_array_initialize(
+	     &files_array,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create files array.",
+		 function );
+
+		goto on_error;
+	}
+	for( open_task_index = 0;
+	     open_task_index < number_of_open_tasks;
+	     open_task_index++ )
+	{
+		open_tasks[ open_task_index ].internal_cache_set = internal_cache_set;
+		open_tasks[ open_task_index ].files_array        = files_array;
+		open_tasks[ open_task_index ].access_flags       = access_flags;
+	}
+	internal_cache_set->abort = 0;
+
+	if( libwtcdb_cache_set_set_open_tasks(
+	     internal_cache_set,
+	     open_tasks,
+	     number_of_open_tasks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set open tasks.",
+		 function );
+
+		goto on_error;
+	}
+
+	if( open_tasks[ 0 ].filename_table_index == 0 )
+	{
+		libwtcdb_cache_set_open_task_function(
+		 &( open_tasks[ 0 ] ) );
+
+		libwtcdb_cache_set_append_open_task_file(
+		 &( open_tasks[ 0 ] ),
+		 files_array );
+
+		first_open_task_index = 1;
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	number_of_threads = number_of_open_tasks - first_open_task_index;
+
+	if( number_of_threads > maximum_number_of_open_threads )
+	{
+		number_of_threads = maximum_number_of_open_threads;
+	}
+	if( number_of_threads > 1 )
+	{
+		if( libcthreads_thread_pool_create(
+		     &thread_pool,
+		     NULL,
+		     number_of_threads,
+		     number_of_open_tasks - first_open_task_index,
+		     (int (*)(intptr_t *, void *)) &libwtcdb_cache_set_open_task_thread_pool_callback,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		for( open_task_index = first_open_task_index;
+		     open_task_index < number_of_open_tasks;
+		     open_task_index++ )
+		{
+			if( libcthreads_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) &( open_tasks[ open_task_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to push open task: %d onto queue.",
+				 function,
+				 open_task_index );
+
+				goto on_error;
+			}
+		}
+		if( libcthreads_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+#endif /* defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT ) */
+	{
+		for( open_task_index = first_open_task_index;
+		     open_task_index < number_of_open_tasks;
+		     open_task_index++ )
+		{
+			libwtcdb_cache_set_open_task_function(
+			 &( open_tasks[ open_task_index ] ) );
+		}
+	}
+	if( libwtcdb_cache_set_set_open_tasks(
+	     internal_cache_set,
+	     NULL,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to clear open tasks.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_cache_set->abort != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+		 "%s: abort requested.",
+		 function );
+
+		goto on_error;
+	}
+	/* The cache files are appended in order after they all have been opened
+	 */
+	for( open_task_index = first_open_task_index;
+	     open_task_index < number_of_open_tasks;
+	     open_task_index++ )
+	{
+		libwtcdb_cache_set_append_open_task_file(
+		 &( open_tasks[ open_task_index ] ),
+		 files_array );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     files_array,
+	     &number_of_files,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of files.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_files == 0 )
+	{
+		/* Pass the error of the first file so that it is not lost
+		 */
+		if( ( error != NULL )
+		 && ( *error == NULL ) )
+		{
+			*error                = open_tasks[ 0 ].error;
+			open_tasks[ 0 ].error = NULL;
+		}
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open any file.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_files < number_of_open_tasks )
+	{
+		failed_files = (libwtcdb_cache_set_failed_file_t *) memory_allocate(
+		                                                     sizeof( libwtcdb_cache_set_failed_file_t ) * ( number_of_open_tasks - number_of_files ) );
+
+		if( failed_files == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create failed files.",
+			 function );
+
+			goto on_error;
+		}
+		for( open_task_index = 0;
+		     open_task_index < number_of_open_tasks;
+		     open_task_index++ )
+		{
+			if( open_tasks[ open_task_index ].result == 1 )
+			{
+				continue;
+			}
+			failed_files[ number_of_failed_files ].filename_index = open_tasks[ open_task_index ].filename_index;
+			failed_files[ number_of_failed_files ].error          = open_tasks[ open_task_index ].error;
+
+			open_tasks[ open_task_index ].error = NULL;
+
+			number_of_failed_files++;
+		}
+	}
+	if( libwtcdb_cache_set_set_files(
+	     internal_cache_set,
+	     &files_array,
+	     &failed_files,
+	     number_of_failed_files,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set files.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+#endif
+	libwtcdb_cache_set_set_open_tasks(
+	 internal_cache_set,
+	 NULL,
+	 0,
+	 NULL );
+
+	if( failed_files != NULL )
+	{
+		libwtcdb_cache_set_free_failed_files(
+		 &failed_files,
+		 number_of_failed_files,
+		 NULL );
+	}
+	for( open_task_index = 0;
+	     open_task_index < number_of_open_tasks;
+	     open_task_index++ )
+	{
+		if( open_tasks[ open_task_index ].file != NULL )
+		{
+			libwtcdb_file_free(
+			 &( open_tasks[ open_task_index ].file ),
+			 NULL );
+		}
+		if( open_tasks[ open_task_index ].error != NULL )
+		{
+			libcerror_error_free(
+			 &( open_tasks[ open_task_index ].error ) );
+		}
+	}
+	if( files_array != NULL )
+	{
+		libcdata_array_free(
+		 &files_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libwtcdb_file_free,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Creates a file with the settings of the cache set
+ * Make sure the value file is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_cache_set_initialize_file(
+     libwtcdb_internal_cache_set_t *internal_cache_set,
+     libwtcdb_file_t **file,
+     libcerror_error_t **error )
+{
+	libwtcdb_handle_pool_t *handle_pool = NULL;
+	static char *function               = "libwtcdb_cache_set_initialize_file";
+	int maximum_number_of_threads       = 0;
+	int requested_io_backend            = 0;
+
+	if( internal_cache_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_cache_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	maximum_number_of_threads = internal_cache_set->maximum_number_of_threads;
+	requested_io_backend      = internal_cache_set->requested_io_backend;
+	handle_pool               = internal_cache_set->handle_pool;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_cache_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libwtcdb_file_initialize(
+	     file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libwtcdb_file_set_maximum_number_of_threads(
+	     *file,
+	     maximum_number_of_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set maximum number of threads.",
+		 function );
+
+		goto on_error;
+	}
+	if( libwtcdb_file_set_io_backend(
+	     *file,
+	     requested_io_backend,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set IO backend.",
+		 function );
+
+		goto on_error;
+	}
+	if( libwtcdb_file_set_handle_pool(
+	     *file,
+	     handle_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set handle pool.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( ( file != NULL )
+	 && ( *file != NULL ) )
+	{
+		libwtcdb_file_free(
+		 file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the cache entry offset index of the entries of an index file that corresponds with a cache file
+ * Returns 1 if successful, 0 if the cache file does not correspond with a cache entry offset or -1 on error
+ */
+int libwtcdb_cache_set_get_cache_entry_offset_index(
+     uint32_t format_version,
+     int filename_table_index,
+     int *cache_entry_offset_index,
+     libcerror_error_t **error )
+{
+	const int *cache_entry_offset_filenames = NULL;
+	static char *function                   = "libwtcdb_cache_set_get_cache_entry_offset_index";
+	int offset_index                        = 0;
+
+	if( cache_entry_offset_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache entry offset index.",
+		 function );
+
+		return( -1 );
+	}
+	switch( format_version )
+	{
+		case 20:
+		case 21:
+			cache_entry_offset_filenames = libwtcdb_cache_set_cache_entry_offset_filenames_v20;
+			break;
+
+		case 30:
+			cache_entry_offset_filenames = libwtcdb_cache_set_cache_entry_offset_filenames_v30;
+			break;
+
+		case 31:
+			cache_entry_offset_filenames = libwtcdb_cache_set_cache_entry_offset_filenames_v31;
+			break;
+
+		case 32:
+			cache_entry_offset_filenames = libwtcdb_cache_set_cache_entry_offset_filenames_v32;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported format version: %" PRIu32 ".",
+			 function,
+			 format_version );
+
+			return( -1 );
+	}
+	for( offset_index = 0;
+	     cache_entry_offset_filenames[ offset_index ] != -1;
+	     offset_index++ )
+	{
+		if( cache_entry_offset_filenames[ offset_index ] == filename_table_index )
+		{
+			*cache_entry_offset_index = offset_index;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Selects the cache entries of a cache file that are referenced by the entries of the index file
+ * The index file must be the first file in the files array, if the index file
+ * is missing or could not be opened all the cache entries are read
+ * The cache entries are only selected in the indexed read mode
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_cache_set_select_cache_entries(
+     libwtcdb_internal_cache_set_t *internal_cache_set,
+     libcdata_array_t *files_array,
+     int filename_table_index,
+     libwtcdb_file_t *file,
+     libcerror_error_t **error )
+{
+	libwtcdb_index_entry_t *index_entry           = NULL;
+	libwtcdb_internal_file_t *internal_index_file = NULL;
+	uint32_t *cache_entry_offsets                 = NULL;
+	static char *function                         = "libwtcdb_cache_set_select_cache_entries";
+	int cache_entry_offset_index                  = 0;
+	int entry_index                               = 0;
+	int number_of_cache_entry_offsets             = 0;
+	int number_of_entries                         = 0;
+	int number_of_files                           = 0;
+	int read_mode                                 = 0;
+	int result                                    = 0;
+
+	if( internal_cache_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_cache_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	read_mode = internal_cache_set->read_mode;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_cache_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( read_mode != LIBWTCDB_CACHE_SET_READ_MODE_INDEXED )
+	{
+		return( 1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     files_array,
+	     &number_of_files,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of files.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_files > 0 )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     files_array,
+		     0,
+		     (intptr_t **) &internal_index_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file: 0.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* If the index file is missing or could not be opened all the cache entries
+	 * of the cache file are read
+	 */
+	if( ( internal_index_file == NULL )
+	 || ( internal_index_file->snapshot == NULL )
+	 || ( internal_index_file->snapshot->file_type == LIBWTCDB_FILE_TYPE_CACHE ) )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: missing index file, reading all cache entries.\n",
+			 function );
+		}
+#endif
+		return( 1 );
+	}
+	result = libwtcdb_cache_set_get_cache_entry_offset_index(
+	          internal_index_file->snapshot->format_version,
+	          filename_table_index,
+	          &cache_entry_offset_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache entry offset index.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_index_file->snapshot->entries,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of index entries.",
+		 function );
+
+		goto on_error;
+	}
+	/* Allocate at least one offset so that a cache file that is not referenced
+	 * by the index file is opened without cache entries
+	 */
+	cache_entry_offsets = (uint32_t *) memory_allocate(
+	                                    sizeof( uint32_t ) * ( (size_t) number_of_entries + 1 ) );
+
+	if( cache_entry_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cache entry offsets.",
+		 function );
+
+		goto on_error;
+	}
+	if( result != 0 )
+	{
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     internal_index_file->snapshot->entries,
+			     entry_index,
+			     (intptr_t **) &index_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve index entry: %d.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+			if( ( index_entry != NULL )
+			 && ( cache_entry_offset_index < index_entry->number_of_cache_entry_offsets ) )
+			{
+				cache_entry_offsets[ number_of_cache_entry_offsets++ ] = index_entry->cache_entry_offsets[ cache_entry_offset_index ];
+			}
+		}
+	}
+	if( libwtcdb_file_set_cache_entry_offsets(
+	     file,
+	     cache_entry_offsets,
+	     number_of_cache_entry_offsets,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set cache entry offsets.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 cache_entry_offsets );
+
+	return( 1 );
+
+on_error:
+	if( cache_entry_offsets != NULL )
+	{
+		memory_free(
+		 cache_entry_offsets );
+	}
+	return( -1 );
+}
+
+/* Appends an opened file to the files array
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_cache_set_append_file(
+     libwtcdb_internal_cache_set_t *internal_cache_set,
+     libcdata_array_t *files_array,
+     libwtcdb_file_t **file,
+     uint8_t expected_file_type,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_cache_set_append_file";
+	uint8_t file_type     = 0;
+	int entry_index       = 0;
+
+	if( internal_cache_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libwtcdb_file_get_type(
+	     *file,
+	     &file_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file type.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( expected_file_type == LIBWTCDB_FILE_TYPE_CACHE )
+	  &&  ( file_type != LIBWTCDB_FILE_TYPE_CACHE ) )
+	 || ( ( expected_file_type == LIBWTCDB_FILE_TYPE_INDEX )
+	  &&  ( file_type == LIBWTCDB_FILE_TYPE_CACHE ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported file type: 0x%02" PRIx8 ".",
+		 function,
+		 file_type );
+
+		return( -1 );
+	}
+	if( libcdata_array_append_entry(
+	     files_array,
+	     &entry_index,
+	     (intptr_t *) *file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append file to array.",
+		 function );
+
+		return( -1 );
+	}
+	*file = NULL;
+
+	return( 1 );
+}
+
+/* Appends the file of an open task to the files array
+ * If the file could not be appended the result and error are stored in
+ * the open task
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_cache_set_append_open_task_file(
+     libwtcdb_cache_set_open_task_t *open_task,
+     libcdata_array_t *files_array )
+{
+	static char *function      = "libwtcdb_cache_set_append_open_task_file";
+	uint8_t expected_file_type = 0;
+
+	if( open_task == NULL )
+	{
+		return( -1 );
+	}
+	if( open_task->result != 1 )
+	{
+		return( -1 );
+	}
+	if( open_task->filename_table_index == 0 )
+	{
+		expected_file_type = LIBWTCDB_FILE_TYPE_INDEX;
+	}
+	else if( open_task->filename_table_index > 0 )
+	{
+		expected_file_type = LIBWTCDB_FILE_TYPE_CACHE;
+	}
+	if( libwtcdb_cache_set_append_file(
+	     open_task->internal_cache_set,
+	     files_array,
+	     &( open_task->file ),
+	     expected_file_type,
+	     &( open_task->error ) ) != 1 )
+	{
+		libcerror_error_set(
+		 &( open_task->error ),
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append file: %d to array.",
+		 function,
+		 open_task->filename_index );
+
+		libwtcdb_file_free(
+		 &( open_task->file ),
+		 NULL );
+
+		open_task->result = -1;
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Frees failed files
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_cache_set_free_failed_files(
+     libwtcdb_cache_set_failed_file_t **failed_files,
+     int number_of_failed_files,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_cache_set_free_failed_files";
+	int failed_file_index = 0;
+
+	if( failed_files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid failed files.",
+		 function );
+
+		return( -1 );
+	}
+	if( *failed_files != NULL )
+	{
+		for( failed_file_index = 0;
+		     failed_file_index < number_of_failed_files;
+		     failed_file_index++ )
+		{
+			if( ( *failed_files )[ failed_file_index ].error != NULL )
+			{
+				libcerror_error_free(
+				 &( ( *failed_files )[ failed_file_index ].error ) );
+			}
+		}
+		memory_free(
+		 *failed_files );
+
+		*failed_files = NULL;
+	}
+	return( 1 );
+}
+
+/* Builds the hash index of the entries of the cache files in the files array
+ * Make sure the value hash_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_cache_set_build_hash_index(
+     libcdata_array_t *files_array,
+     libwtcdb_hash_index_t **hash_index,
+     libcerror_error_t **error )
+{
+	libwtcdb_cache_entry_t *cache_entry     = NULL;
+	libwtcdb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libwtcdb_cache_set_build_hash_index";
+	int entry_index                         = 0;
+	int file_index                          = 0;
+	int maximum_number_of_records           = 0;
+	int number_of_entries                   = 0;
+	int number_of_files                     = 0;
+	int pass                                = 0;
+
+	if( hash_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     files_array,
+	     &number_of_files,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of files.",
+		 function );
+
+		goto on_error;
+	}
+	/* The first pass determines the number of records and the second pass
+	 * appends them, so that the records are allocated once
+	 */
+	for( pass = 0;
+	     pass < 2;
+	     pass++ )
+	{
+		if( pass == 1 )
+		{
+			if( libwtcdb_hash_index_initialize(
+			     hash_index,
+			     maximum_number_of_records,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create hash index.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		for( file_index = 0;
+		     file_index < number_of_files;
+		     file_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     files_array,
+			     file_index,
+			     (intptr_t **) &internal_file,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve file: %d.",
+				 function,
+				 file_index );
+
+				goto on_error;
+			}
+			/* Only the items of cache files contain the cached data
+			 */
+			if( ( internal_file == NULL )
+			 || ( internal_file->snapshot == NULL )
+			 || ( internal_file->snapshot->file_type != LIBWTCDB_FILE_TYPE_CACHE ) )
+			{
+				continue;
+			}
+			if( libcdata_array_get_number_of_entries(
+			     internal_file->snapshot->entries,
+			     &number_of_entries,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of entries of file: %d.",
+				 function,
+				 file_index );
+
+				goto on_error;
+			}
+			if( pass == 0 )
+			{
+				if( number_of_entries > ( INT_MAX - maximum_number_of_records ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid number of entries value out of bounds.",
+					 function );
+
+					goto on_error;
+				}
+				maximum_number_of_records += number_of_entries;
+
+				continue;
+			}
+			for( entry_index = 0;
+			     entry_index < number_of_entries;
+			     entry_index++ )
+			{
+				if( libcdata_array_get_entry_by_index(
+				     internal_file->snapshot->entries,
+				     entry_index,
+				     (intptr_t **) &cache_entry,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve entry: %d of file: %d.",
+					 function,
+					 entry_index,
+					 file_index );
+
+					goto on_error;
+				}
+				if( cache_entry == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+					 "%s: missing entry: %d of file: %d.",
+					 function,
+					 entry_index,
+					 file_index );
+
+					goto on_error;
+				}
+				if( libwtcdb_hash_index_append_record(
+				     *hash_index,
+				     cache_entry->hash,
+				     file_index,
+				     entry_index,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append entry: %d of file: %d to hash index.",
+					 function,
+					 entry_index,
+					 file_index );
+
+					goto on_error;
+				}
+			}
+		}
+	}
+	if( libwtcdb_hash_index_sort(
+	     *hash_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to sort hash index.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *hash_index != NULL )
+	{
+		libwtcdb_hash_index_free(
+		 hash_index,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Sets the files of the cache set
+ * The hash index of the entries of the cache files is built before the files are set
+ * On success the cache set takes over the files array and the failed files
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_cache_set_set_files(
+     libwtcdb_internal_cache_set_t *internal_cache_set,
+     libcdata_array_t **files_array,
+     libwtcdb_cache_set_failed_file_t **failed_files,
+     int number_of_failed_files,
+     libcerror_error_t **error )
+{
+	libwtcdb_hash_index_t *hash_index = NULL;
+	static char *function             = "libwtcdb_cache_set_set_files";
+	int result                        = 1;
+
+	if( internal_cache_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache set.",
+		 function );
+
+		return( -1 );
+	}
+	if( files_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid files array.",
+		 function );
+
+		return( -1 );
+	}
+	if( failed_files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid failed files.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_failed_files < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of failed files value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( libwtcdb_cache_set_build_hash_index(
+	     *files_array,
+	     &hash_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build hash index.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_cache_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		libwtcdb_hash_index_free(
+		 &hash_index,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	if( internal_cache_set->files != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid cache set - files already set.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		internal_cache_set->files                  = *files_array;
+		internal_cache_set->hash_index             = hash_index;
+		internal_cache_set->failed_files           = *failed_files;
+		internal_cache_set->number_of_failed_files = number_of_failed_files;
+
+		*files_array  = NULL;
+		*failed_files = NULL;
+		hash_index    = NULL;
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_cache_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	if( hash_index != NULL )
+	{
+		libwtcdb_hash_index_free(
+		 &hash_index,
+		 NULL );
+	}
+	return( result );
+}
+
+/* Retrieves the number of files
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_cache_set_get_number_of_files(
+     libwtcdb_cache_set_t *cache_set,
+     int *number_of_files,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_cache_set_t *internal_cache_set = NULL;
+	static char *function                             = "libwtcdb_cache_set_get_number_of_files";
+	int result                                        = 1;
+
+	if( cache_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache_set = (libwtcdb_internal_cache_set_t *) cache_set;
+
+	if( number_of_files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of files.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_cache_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_cache_set->files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cache set - missing files.",
+		 function );
+
+		result = -1;
+	}
+	else if( libcdata_array_get_number_of_entries(
+	          internal_cache_set->files,
+	          number_of_files,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of files.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_cache_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a specific file
+ * The file is managed by the cache set and should not be freed or closed
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_cache_set_get_file_by_index(
+     libwtcdb_cache_set_t *cache_set,
+     int file_index,
+     libwtcdb_file_t **file,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_cache_set_t *internal_cache_set = NULL;
+	static char *function                             = "libwtcdb_cache_set_get_file_by_index";
+	int result                                        = 1;
+
+	if( cache_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache_set = (libwtcdb_internal_cache_set_t *) cache_set;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_cache_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_cache_set->files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cache set - missing files.",
+		 function );
+
+		result = -1;
+	}
+	else if( libcdata_array_get_entry_by_index(
+	          internal_cache_set->files,
+	          file_index,
+	          (intptr_t **) file,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file: %d.",
+		 function,
+		 file_index );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_cache_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the number of files that could not be opened
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_cache_set_get_number_of_failed_files(
+     libwtcdb_cache_set_t *cache_set,
+     int *number_of_failed_files,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_cache_set_t *internal_cache_set = NULL;
+	static char *function                             = "libwtcdb_cache_set_get_number_of_failed_files";
+	int result                                        = 1;
+
+	if( cache_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache_set = (libwtcdb_internal_cache_set_t *) cache_set;
+
+	if( number_of_failed_files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of failed files.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_cache_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_cache_set->files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cache set - missing files.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		*number_of_failed_files = internal_cache_set->number_of_failed_files;
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_cache_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a specific file that could not be opened
+ * The filename index is the index of the filename passed to open files, or
+ * the index of the name of the file in the names of the files of a thumbcache
+ * directory when the cache set was opened from a directory
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_cache_set_get_failed_file(
+     libwtcdb_cache_set_t *cache_set,
+     int failed_file_index,
+     int *filename_index,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_cache_set_t *internal_cache_set = NULL;
+	static char *function                             = "libwtcdb_cache_set_get_failed_file";
+	int result                                        = 1;
+
+	if( cache_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache_set = (libwtcdb_internal_cache_set_t *) cache_set;
+
+	if( filename_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename index.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_cache_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_cache_set->files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cache set - missing files.",
+		 function );
+
+		result = -1;
+	}
+	else if( ( failed_file_index < 0 )
+	      || ( failed_file_index >= internal_cache_set->number_of_failed_files ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid failed file index value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		*filename_index = internal_cache_set->failed_files[ failed_file_index ].filename_index;
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_cache_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Prints a backtrace of the error of a specific file that could not be opened to the string
+ * The end-of-string character is not included in the return value
+ * Returns the number of printed characters if successful or -1 on error
+ */
+int libwtcdb_cache_set_failed_file_error_backtrace_sprint(
+     libwtcdb_cache_set_t *cache_set,
+     int failed_file_index,
+     char *string,
+     size_t size,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_cache_set_t *internal_cache_set = NULL;
+	static char *function                             = "libwtcdb_cache_set_failed_file_error_backtrace_sprint";
+	int result                                        = 0;
+
+	if( cache_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache_set = (libwtcdb_internal_cache_set_t *) cache_set;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_cache_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_cache_set->files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cache set - missing files.",
+		 function );
+
+		result = -1;
+	}
+	else if( ( failed_file_index < 0 )
+	      || ( failed_file_index >= internal_cache_set->number_of_failed_files ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid failed file index value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		result = libcerror_error_backtrace_sprint(
+		          internal_cache_set->failed_files[ failed_file_index ].error,
+		          string,
+		          size );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print error of failed file: %d.",
+			 function,
+			 failed_file_index );
+		}
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_cache_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the number of items of all the files
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_cache_set_get_number_of_items(
+     libwtcdb_cache_set_t *cache_set,
+     int *number_of_items,
+     libcerror_error_t **error )
+{
+	libwtcdb_file_t *file                             = NULL;
+	libwtcdb_internal_cache_set_t *internal_cache_set = NULL;
+	static char *function                             = "libwtcdb_cache_set_get_number_of_items";
+	int file_index                                    = 0;
+	int file_number_of_items                          = 0;
+	int number_of_files                               = 0;
+	int result                                        = 1;
+	int safe_number_of_items                          = 0;
+
+	if( cache_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache_set = (libwtcdb_internal_cache_set_t *) cache_set;
+
+	if( number_of_items == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of items.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_cache_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_cache_set->files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cache set - missing files.",
+		 function );
+
+		result = -1;
+	}
+	else if( libcdata_array_get_number_of_entries(
+	          internal_cache_set->files,
+	          &number_of_files,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of files.",
+		 function );
+
+		result = -1;
+	}
+	for( file_index = 0;
+	     ( result == 1 ) && ( file_index < number_of_files );
+	     file_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_cache_set->files,
+		     file_index,
+		     (intptr_t **) &file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file: %d.",
+			 function,
+			 file_index );
+
+			result = -1;
+		}
+		else if( libwtcdb_file_get_number_of_items(
+		          file,
+		          &file_number_of_items,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of items of file: %d.",
+			 function,
+			 file_index );
+
+			result = -1;
+		}
+		else if( file_number_of_items > ( INT_MAX - safe_number_of_items ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of items value out of bounds.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			safe_number_of_items += file_number_of_items;
+		}
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_cache_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result == 1 )
+	{
+		*number_of_items = safe_number_of_items;
+	}
+	return( result );
+}
+
+/* Retrieves a specific item
+ * The item index is relative to the items of all the files in order of the files,
+ * the item index of the item itself is relative to its file
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_cache_set_get_item(
+     libwtcdb_cache_set_t *cache_set,
+     int item_index,
+     libwtcdb_item_t **item,
+     libcerror_error_t **error )
+{
+	libwtcdb_file_t *file                             = NULL;
+	libwtcdb_internal_cache_set_t *internal_cache_set = NULL;
+	static char *function                             = "libwtcdb_cache_set_get_item";
+	int file_index                                    = 0;
+	int file_item_index                               = 0;
+	int file_number_of_items                          = 0;
+	int number_of_files                               = 0;
+	int result                                        = 1;
+
+	if( cache_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache_set = (libwtcdb_internal_cache_set_t *) cache_set;
+
+	if( item_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid item index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_cache_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_cache_set->files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cache set - missing files.",
+		 function );
+
+		result = -1;
+	}
+	else if( libcdata_array_get_number_of_entries(
+	          internal_cache_set->files,
+	          &number_of_files,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of files.",
+		 function );
+
+		result = -1;
+	}
+	file_item_index = item_index;
+
+	for( file_index = 0;
+	     ( result == 1 ) && ( file_index < number_of_files );
+	     file_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_cache_set->files,
+		     file_index,
+		     (intptr_t **) &file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file: %d.",
+			 function,
+			 file_index );
+
+			result = -1;
+		}
+		else if( libwtcdb_file_get_number_of_items(
+		          file,
+		          &file_number_of_items,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of items of file: %d.",
+			 function,
+			 file_index );
+
+			result = -1;
+		}
+		else if( file_item_index < file_number_of_items )
+		{
+			break;
+		}
+		else
+		{
+			file_item_index -= file_number_of_items;
+		}
+	}
+	if( result == 1 )
+	{
+		if( file_index >= number_of_files )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid item index value out of bounds.",
+			 function );
+
+			result = -1;
+		}
+		else if( libwtcdb_file_get_item(
+		          file,
+		          file_item_index,
+		          item,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve item: %d from file: %d.",
+			 function,
+			 file_item_index,
+			 file_index );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_cache_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the number of items of a specific hash
+ * The items of all the cache files are looked up using the hash index
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_cache_set_get_number_of_items_by_hash(
+     libwtcdb_cache_set_t *cache_set,
+     uint64_t hash,
+     int *number_of_items,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_cache_set_t *internal_cache_set = NULL;
+	static char *function                             = "libwtcdb_cache_set_get_number_of_items_by_hash";
+	int first_record_index                            = 0;
+	int number_of_records                             = 0;
+	int result                                        = 1;
+
+	if( cache_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache_set = (libwtcdb_internal_cache_set_t *) cache_set;
+
+	if( number_of_items == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of items.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_cache_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_cache_set->hash_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cache set - missing hash index.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		result = libwtcdb_hash_index_get_records_by_hash(
+		          internal_cache_set->hash_index,
+		          hash,
+		          &first_record_index,
+		          &number_of_records,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve records from hash index.",
+			 function );
+		}
+		else
+		{
+			result = 1;
+		}
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_cache_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result == 1 )
+	{
+		*number_of_items = number_of_records;
+	}
+	return( result );
+}
+
+/* Retrieves the items of a specific hash
+ * The items of all the cache files are looked up using the hash index,
+ * which contains one item per resolution the thumbnail is stored in
+ * The items are stored in order of the files and must be freed by the caller
+ * Returns 1 if successful, 0 if no such hash or -1 on error
+ */
+int libwtcdb_cache_set_get_items_by_hash(
+     libwtcdb_cache_set_t *cache_set,
+     uint64_t hash,
+     libwtcdb_item_t **items,
+     int items_size,
+     int *number_of_items,
+     libcerror_error_t **error )
+{
+	libwtcdb_file_t *file                             = NULL;
+	libwtcdb_hash_index_record_t *record              = NULL;
+	libwtcdb_internal_cache_set_t *internal_cache_set = NULL;
+	static char *function                             = "libwtcdb_cache_set_get_items_by_hash";
+	int first_record_index                            = 0;
+	int item_index                                    = 0;
+	int number_of_records                             = 0;
+	int result                                        = 0;
+
+	if( cache_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache_set = (libwtcdb_internal_cache_set_t *) cache_set;
+
+	if( items == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid items.",
+		 function );
+
+		return( -1 );
+	}
+	if( items_size < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid items size value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_items == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of items.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_cache_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( internal_cache_set->files == NULL )
+	 || ( internal_cache_set->hash_index == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cache set - missing files.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		result = libwtcdb_hash_index_get_records_by_hash(
+		          internal_cache_set->hash_index,
+		          hash,
+		          &first_record_index,
+		          &number_of_records,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve records from hash index.",
+			 function );
+		}
+		else if( ( result == 1 )
+		      && ( number_of_records > items_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid items size value too small.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		for( item_index = 0;
+		     item_index < number_of_records;
+		     item_index++ )
+		{
+			record = &( internal_cache_set->hash_index->records[ first_record_index + item_index ] );
+
+			if( libcdata_array_get_entry_by_index(
+			     internal_cache_set->files,
+			     record->file_index,
+			     (intptr_t **) &file,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve file: %d.",
+				 function,
+				 record->file_index );
+
+				result = -1;
+
+				break;
+			}
+			items[ item_index ] = NULL;
+
+			if( libwtcdb_file_get_item(
+			     file,
+			     record->entry_index,
+			     &( items[ item_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve item: %d from file: %d.",
+				 function,
+				 record->entry_index,
+				 record->file_index );
+
+				result = -1;
+
+				break;
+			}
+		}
+		if( result == -1 )
+		{
+			while( item_index > 0 )
+			{
+				item_index--;
+
+				libwtcdb_item_free(
+				 &( items[ item_index ] ),
+				 NULL );
+			}
+		}
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_cache_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result == 0 )
+	{
+		*number_of_items = 0;
+	}
+	else if( result == 1 )
+	{
+		*number_of_items = number_of_records;
+	}
+	return( result );
+}
+
@@ -0,0 +1,445 @@
+/*
+ * Cache set functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBWTCDB_INTERNAL_CACHE_SET_H )
+#define _LIBWTCDB_INTERNAL_CACHE_SET_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libwtcdb_extern.h"
+#include "libwtcdb_hash_index.h"
+#include "libwtcdb_libcdata.h"
+#include "libwtcdb_libcerror.h"
+#include "libwtcdb_libcthreads.h"
+#include "libwtcdb_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libwtcdb_cache_set_failed_file libwtcdb_cache_set_failed_file_t;
+
+/* A file of the cache set that could not be opened
+ */
+struct libwtcdb_cache_set_failed_file
+{
+	/* The filename index
+	 */
+	int filename_index;
+
+	/* The error
+	 */
+	libcerror_error_t *error;
+};
+
+typedef struct libwtcdb_cache_set_open_task libwtcdb_cache_set_open_task_t;
+
+typedef struct libwtcdb_internal_cache_set libwtcdb_internal_cache_set_t;
+
+/* A task that opens a single file of the cache set
+ */
+struct libwtcdb_cache_set_open_task
+{
+	/* The cache set
+	 */
+	libwtcdb_internal_cache_set_t *internal_cache_set;
+
+	/* The files array
+	 */
+	libcdata_array_t *files_array;
+
+	/* The filename
+	 */
+	const char *filename;
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+	/* The wide character filename
+	 */
+	const wchar_t *filename_wide;
+#endif
+
+	/* The access flags
+	 */
+	int access_flags;
+
+	/* The filename table index
+	 */
+	int filename_table_index;
+
+	/* The filename index
+	 */
+	int filename_index;
+
+	/* The file that is being opened
+	 */
+	libwtcdb_file_t *opening_file;
+
+	/* The opened file
+	 */
+	libwtcdb_file_t *file;
+
+	/* The result
+	 */
+	int result;
+
+	/* The error
+	 */
+	libcerror_error_t *error;
+};
+
+/* The cache set contains the files of a thumbcache directory
+ * The settings of the cache set are applied to every file when it is opened
+ */
+struct libwtcdb_internal_cache_set
+{
+	/* The files array
+	 */
+	libcdata_array_t *files;
+
+	/* The hash index of the entries of the cache files
+	 */
+	libwtcdb_hash_index_t *hash_index;
+
+	/* The files that could not be opened
+	 */
+	libwtcdb_cache_set_failed_file_t *failed_files;
+
+	/* The number of files that could not be opened
+	 */
+	int number_of_failed_files;
+
+	/* The tasks of the files that are currently being opened
+	 */
+	libwtcdb_cache_set_open_task_t *open_tasks;
+
+	/* The number of tasks of the files that are currently being opened
+	 */
+	int number_of_open_tasks;
+
+	/* The maximum number of threads used to read the entries of a file
+	 */
+	int maximum_number_of_threads;
+
+	/* The maximum number of threads used to open the files
+	 */
+	int maximum_number_of_open_threads;
+
+	/* The requested IO backend
+	 */
+	int requested_io_backend;
+
+	/* The handle pool used by the files, NULL if not used
+	 */
+	libwtcdb_handle_pool_t *handle_pool;
+
+	/* The read mode
+	 */
+	int read_mode;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+
+	/* The mutex that protects the open tasks and the files that are being opened
+	 */
+	libcthreads_mutex_t *open_tasks_mutex;
+#endif
+};
+
+LIBWTCDB_EXTERN \
+int libwtcdb_cache_set_initialize(
+     libwtcdb_cache_set_t **cache_set,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_cache_set_free(
+     libwtcdb_cache_set_t **cache_set,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_cache_set_signal_abort(
+     libwtcdb_cache_set_t *cache_set,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_cache_set_set_maximum_number_of_threads(
+     libwtcdb_cache_set_t *cache_set,
+     int maximum_number_of_threads,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_cache_set_set_maximum_number_of_open_threads(
+     libwtcdb_cache_set_t *cache_set,
+     int maximum_number_of_open_threads,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_cache_set_set_io_backend(
+     libwtcdb_cache_set_t *cache_set,
+     int io_backend,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_cache_set_set_handle_pool(
+     libwtcdb_cache_set_t *cache_set,
+     libwtcdb_handle_pool_t *handle_pool,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_cache_set_set_read_mode(
+     libwtcdb_cache_set_t *cache_set,
+     int read_mode,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_cache_set_open(
+     libwtcdb_cache_set_t *cache_set,
+     const char *directory_name,
+     int access_flags,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBWTCDB_EXTERN \
+int libwtcdb_cache_set_open_wide(
+     libwtcdb_cache_set_t *cache_set,
+     const wchar_t *directory_name,
+     int access_flags,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBWTCDB_EXTERN \
+int libwtcdb_cache_set_open_files(
+     libwtcdb_cache_set_t *cache_set,
+     char * const filenames[],
+     int number_of_filenames,
+     int access_flags,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBWTCDB_EXTERN \
+int libwtcdb_cache_set_open_files_wide(
+     libwtcdb_cache_set_t *cache_set,
+     wchar_t * const filenames[],
+     int number_of_filenames,
+     int access_flags,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBWTCDB_EXTERN \
+int libwtcdb_cache_set_close(
+     libwtcdb_cache_set_t *cache_set,
+     libcerror_error_t **error );
+
+int libwtcdb_cache_set_check_access_flags(
+     int access_flags,
+     libcerror_error_t **error );
+
+int libwtcdb_cache_set_file_exists(
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+int libwtcdb_cache_set_file_exists_wide(
+     const wchar_t *filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+int libwtcdb_cache_set_set_opening_file(
+     libwtcdb_internal_cache_set_t *internal_cache_set,
+     libwtcdb_file_t **opening_file,
+     libwtcdb_file_t *file,
+     libcerror_error_t **error );
+
+int libwtcdb_cache_set_set_open_tasks(
+     libwtcdb_internal_cache_set_t *internal_cache_set,
+     libwtcdb_cache_set_open_task_t *open_tasks,
+     int number_of_open_tasks,
+     libcerror_error_t **error );
+
+int libwtcdb_cache_set_open_file(
+     libwtcdb_internal_cache_set_t *internal_cache_set,
+     libcdata_array_t *files_array,
+     const char *filename,
+     int access_flags,
+     int filename_table_index,
+     libwtcdb_file_t **opening_file,
+     libwtcdb_file_t **file,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+int libwtcdb_cache_set_open_file_wide(
+     libwtcdb_internal_cache_set_t *internal_cache_set,
+     libcdata_array_t *files_array,
+     const wchar_t *filename,
+     int access_flags,
+     int filename_table_index,
+     libwtcdb_file_t **opening_file,
+     libwtcdb_file_t **file,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+int libwtcdb_cache_set_open_task_function(
+     libwtcdb_cache_set_open_task_t *open_task );
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+
+int libwtcdb_cache_set_open_task_thread_pool_callback(
+     libwtcdb_cache_set_open_task_t *open_task,
+     void *arguments );
+
+#endif /* defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT ) */
+
+int libwtcdb_cache_set_run_open_tasks(
+     libwtcdb_internal_cache_set_t *internal_cache_set,
+     libwtcdb_cache_set_open_task_t *open_tasks,
+     int number_of_open_tasks,
+     int access_flags,
+     libcerror_error_t **error );
+
+int libwtcdb_cache_set_initialize_file(
+     libwtcdb_internal_cache_set_t *internal_cache_set,
+     libwtcdb_file_t **file,
+     libcerror_error_t **error );
+
+int libwtcdb_cache_set_get_cache_entry_offset_index(
+     uint32_t format_version,
+     int filename_table_index,
+     int *cache_entry_offset_index,
+     libcerror_error_t **error );
+
+int libwtcdb_cache_set_select_cache_entries(
+     libwtcdb_internal_cache_set_t *internal_cache_set,
+     libcdata_array_t *files_array,
+     int filename_table_index,
+     libwtcdb_file_t *file,
+     libcerror_error_t **error );
+
+int libwtcdb_cache_set_append_file(
+     libwtcdb_internal_cache_set_t *internal_cache_set,
+     libcdata_array_t *files_array,
+     libwtcdb_file_t **file,
+     uint8_t expected_file_type,
+     libcerror_error_t **error );
+
+int libwtcdb_cache_set_append_open_task_file(
+     libwtcdb_cache_set_open_task_t *open_task,
+     libcdata_array_t *files_array );
+
+int libwtcdb_cache_set_free_failed_files(
+     libwtcdb_cache_set_failed_file_t **failed_files,
+     int number_of_failed_files,
+     libcerror_error_t **error );
+
+int libwtcdb_cache_set_build_hash_index(
+     libcdata_array_t *files_array,
+     libwtcdb_hash_index_t **hash_index,
+     libcerror_error_t **error );
+
+int libwtcdb_cache_set_set_files(
+     libwtcdb_internal_cache_set_t *internal_cache_set,
+     libcdata_array_t **files_array,
+     libwtcdb_cache_set_failed_file_t **failed_files,
+     int number_of_failed_files,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_cache_set_get_number_of_files(
+     libwtcdb_cache_set_t *cache_set,
+     int *number_of_files,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_cache_set_get_file_by_index(
+     libwtcdb_cache_set_t *cache_set,
+     int file_index,
+     libwtcdb_file_t **file,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_cache_set_get_number_of_failed_files(
+     libwtcdb_cache_set_t *cache_set,
+     int *number_of_failed_files,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_cache_set_get_failed_file(
+     libwtcdb_cache_set_t *cache_set,
+     int failed_file_index,
+     int *filename_index,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_cache_set_failed_file_error_backtrace_sprint(
+     libwtcdb_cache_set_t *cache_set,
+     int failed_file_index,
+     char *string,
+     size_t size,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_cache_set_get_number_of_items(
+     libwtcdb_cache_set_t *cache_set,
+     int *number_of_items,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_cache_set_get_item(
+     libwtcdb_cache_set_t *cache_set,
+     int item_index,
+     libwtcdb_item_t **item,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_cache_set_get_number_of_items_by_hash(
+     libwtcdb_cache_set_t *cache_set,
+     uint64_t hash,
+     int *number_of_items,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_cache_set_get_items_by_hash(
+     libwtcdb_cache_set_t *cache_set,
+     uint64_t hash,
+     libwtcdb_item_t **items,
+     int items_size,
+     int *number_of_items,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBWTCDB_INTERNAL_CACHE_SET_H ) */
+
@@ -0,0 +1,2052 @@
+/*
+ * Chunk cache functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libwtcdb_cache_entry.h"
+#include "libwtcdb_chunk_cache.h"
+#include "libwtcdb_io_backend.h"
+#include "libwtcdb_libbfio.h"
+#include "libwtcdb_libcdata.h"
+#include "libwtcdb_libcerror.h"
+#include "libwtcdb_libcthreads.h"
+#include "libwtcdb_snapshot.h"
+
+/* Creates a chunk cache source
+ * Make sure the value source is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_chunk_cache_source_initialize(
+     libwtcdb_chunk_cache_source_t **source,
+     size64_t file_size,
+     size_t chunk_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libwtcdb_chunk_cache_source_initialize";
+	size64_t number_of_chunks = 0;
+	size_t fingerprints_size  = 0;
+	size_t sources_size       = 0;
+
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	if( *source != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid source value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid chunk size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_chunks = file_size / chunk_size;
+
+	if( ( file_size % chunk_size ) != 0 )
+	{
+		number_of_chunks += 1;
+	}
+	if( number_of_chunks > (size64_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( uint64_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of chunks value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*source = memory_allocate_structure(
+	           libwtcdb_chunk_cache_source_t );
+
+	if( *source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create source.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *source,
+	     0,
+	     sizeof( libwtcdb_chunk_cache_source_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear source.",
+		 function );
+
+		memory_free(
+		 *source );
+
+		*source = NULL;
+
+		return( -1 );
+	}
+	if( number_of_chunks > 0 )
+	{
+		fingerprints_size = (size_t) number_of_chunks * 2 * sizeof( uint64_t );
+
+		( *source )->fingerprints = (uint64_t *) memory_allocate(
+		                                          fingerprints_size );
+
+		if( ( *source )->fingerprints == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create fingerprints.",
+			 function );
+
+			goto on_error;
+		}
+		sources_size = (size_t) number_of_chunks * sizeof( libwtcdb_chunk_cache_source_t * );
+
+		( *source )->matching_sources = (libwtcdb_chunk_cache_source_t **) memory_allocate(
+		                                                                    sources_size );
+
+		if( ( *source )->matching_sources == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create matching sources.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     ( *source )->matching_sources,
+		     0,
+		     sources_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear matching sources.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	( *source )->file_size        = file_size;
+	( *source )->chunk_size       = chunk_size;
+	( *source )->number_of_chunks = (int) number_of_chunks;
+
+	return( 1 );
+
+on_error:
+	if( *source != NULL )
+	{
+		if( ( *source )->matching_sources != NULL )
+		{
+			memory_free(
+			 ( *source )->matching_sources );
+		}
+		if( ( *source )->fingerprints != NULL )
+		{
+			memory_free(
+			 ( *source )->fingerprints );
+		}
+		memory_free(
+		 *source );
+
+		*source = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a chunk cache source
+ * Releases the reference to the snapshot
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_chunk_cache_source_free(
+     libwtcdb_chunk_cache_source_t **source,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_chunk_cache_source_free";
+	int result            = 1;
+
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	if( *source != NULL )
+	{
+		if( ( *source )->snapshot != NULL )
+		{
+			if( libwtcdb_snapshot_free(
+			     (libwtcdb_snapshot_t **) &( ( *source )->snapshot ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free snapshot.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *source )->cache_entries != NULL )
+		{
+			memory_free(
+			 ( *source )->cache_entries );
+		}
+		if( ( *source )->matching_sources != NULL )
+		{
+			memory_free(
+			 ( *source )->matching_sources );
+		}
+		if( ( *source )->fingerprints != NULL )
+		{
+			memory_free(
+			 ( *source )->fingerprints );
+		}
+		memory_free(
+		 *source );
+
+		*source = NULL;
+	}
+	return( result );
+}
+
+/* Calculates the fingerprint of the data of a chunk
+ * The fingerprint consists of 2 independent 64-bit hashes of the data and its size
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_chunk_cache_source_calculate_fingerprint(
+     const uint8_t *data,
+     size_t data_size,
+     uint64_t *fingerprint,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_chunk_cache_source_calculate_fingerprint";
+	size_t data_offset    = 0;
+	uint64_t first_hash   = 0;
+	uint64_t second_hash  = 0;
+	uint64_t value_64bit  = 0;
+	uint8_t byte_index    = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( fingerprint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid fingerprint.",
+		 function );
+
+		return( -1 );
+	}
+	first_hash  = 0x9e3779b97f4a7c15ULL ^ (uint64_t) data_size;
+	second_hash = 0xc2b2ae3d27d4eb4fULL + (uint64_t) data_size;
+
+	while( ( data_offset + 8 ) <= data_size )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ data_offset ] ),
+		 value_64bit );
+
+		first_hash  = ( first_hash ^ value_64bit ) * 0x100000001b3ULL;
+		first_hash  = ( first_hash << 31 ) | ( first_hash >> 33 );
+		second_hash = ( second_hash + value_64bit ) * 0xff51afd7ed558ccdULL;
+		second_hash = ( second_hash << 27 ) | ( second_hash >> 37 );
+
+		data_offset += 8;
+	}
+	if( data_offset < data_size )
+	{
+		value_64bit = 0;
+
+		for( byte_index = 0;
+		     data_offset < data_size;
+		     byte_index++ )
+		{
+			value_64bit |= (uint64_t) data[ data_offset++ ] << ( byte_index * 8 );
+		}
+		first_hash  = ( first_hash ^ value_64bit ) * 0x100000001b3ULL;
+		second_hash = ( second_hash + value_64bit ) * 0xff51afd7ed558ccdULL;
+	}
+	/* Mix the bits of the hashes so that every input bit affects all the output bits
+	 */
+	first_hash ^= first_hash >> 33;
+	first_hash *= 0xff51afd7ed558ccdULL;
+	first_hash ^= first_hash >> 33;
+
+	second_hash ^= second_hash >> 29;
+	second_hash *= 0xc4ceb9fe1a85ec53ULL;
+	second_hash ^= second_hash >> 32;
+
+	fingerprint[ 0 ] = first_hash;
+	fingerprint[ 1 ] = second_hash;
+
+	return( 1 );
+}
+
+/* Reads the data of a file and calculates the fingerprints of its chunks
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_chunk_cache_source_read_fingerprints(
+     libwtcdb_chunk_cache_source_t *source,
+     libwtcdb_io_backend_t *io_backend,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	uint8_t *chunk_data   = NULL;
+	static char *function = "libwtcdb_chunk_cache_source_read_fingerprints";
+	off64_t chunk_offset  = 0;
+	size_t read_size      = 0;
+	ssize_t read_count    = 0;
+	int chunk_index       = 0;
+
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( source->chunk_size == 0 )
+	 || ( source->chunk_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source - chunk size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( source->number_of_chunks == 0 )
+	{
+		return( 1 );
+	}
+	chunk_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * source->chunk_size );
+
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunk data.",
+		 function );
+
+		goto on_error;
+	}
+	for( chunk_index = 0;
+	     chunk_index < source->number_of_chunks;
+	     chunk_index++ )
+	{
+		read_size = source->chunk_size;
+
+		if( (size64_t) read_size > ( source->file_size - (size64_t) chunk_offset ) )
+		{
+			read_size = (size_t) ( source->file_size - (size64_t) chunk_offset );
+		}
+		read_count = libwtcdb_io_backend_read_buffer_at_offset(
+		              io_backend,
+		              file_io_handle,
+		              chunk_data,
+		              read_size,
+		              chunk_offset,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunk: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 chunk_index,
+			 chunk_offset,
+			 chunk_offset );
+
+			goto on_error;
+		}
+		if( libwtcdb_chunk_cache_source_calculate_fingerprint(
+		     chunk_data,
+		     read_size,
+		     &( source->fingerprints[ chunk_index * 2 ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate fingerprint of chunk: %d.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		chunk_offset += (off64_t) read_size;
+	}
+	memory_free(
+	 chunk_data );
+
+	return( 1 );
+
+on_error:
+	if( chunk_data != NULL )
+	{
+		memory_free(
+		 chunk_data );
+	}
+	return( -1 );
+}
+
+/* Compares a chunk of a source with the same chunk of another source
+ * Returns 1 if the chunks have the same fingerprint or 0 if not
+ */
+int libwtcdb_chunk_cache_source_compare_chunk(
+     libwtcdb_chunk_cache_source_t *source,
+     libwtcdb_chunk_cache_source_t *other_source,
+     int chunk_index )
+{
+	if( ( source == NULL )
+	 || ( other_source == NULL ) )
+	{
+		return( 0 );
+	}
+	if( ( source->file_type != other_source->file_type )
+	 || ( source->format_version != other_source->format_version )
+	 || ( source->chunk_size != other_source->chunk_size ) )
+	{
+		return( 0 );
+	}
+	if( ( chunk_index < 0 )
+	 || ( chunk_index >= source->number_of_chunks )
+	 || ( chunk_index >= other_source->number_of_chunks ) )
+	{
+		return( 0 );
+	}
+	if( ( source->fingerprints[ chunk_index * 2 ] != other_source->fingerprints[ chunk_index * 2 ] )
+	 || ( source->fingerprints[ ( chunk_index * 2 ) + 1 ] != other_source->fingerprints[ ( chunk_index * 2 ) + 1 ] ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a previously read cache entry that can be reused for the cache entry at a specific offset
+ * The cache entry can be reused if a previously appended source contains a cache entry at
+ * the same offset and all the chunks that contain its header, identifier and padding have
+ * the same fingerprint
+ * The entry index hint is the expected index of the cache entry in the matching source,
+ * which is the case when no cache entries were added or removed before it
+ * The cache entry is owned by the snapshot of the matching source and must not be freed
+ * Returns 1 if successful, 0 if no reusable cache entry was found or -1 on error
+ */
+int libwtcdb_chunk_cache_source_get_entry(
+     libwtcdb_chunk_cache_source_t *source,
+     off64_t file_offset,
+     int entry_index_hint,
+     libwtcdb_cache_entry_t **cache_entry,
+     libcerror_error_t **error )
+{
+	libwtcdb_cache_entry_t *safe_cache_entry       = NULL;
+	libwtcdb_chunk_cache_source_t *matching_source = NULL;
+	static char *function                          = "libwtcdb_chunk_cache_source_get_entry";
+	off64_t last_offset                            = 0;
+	int chunk_index                                = 0;
+	int entry_index                                = 0;
+	int first_chunk_index                          = 0;
+	int last_chunk_index                           = 0;
+	int lower_entry_index                          = 0;
+	int upper_entry_index                          = 0;
+
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	if( source->chunk_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source - chunk size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( source->matching_sources == NULL )
+	 || ( (size64_t) file_offset >= source->file_size ) )
+	{
+		return( 0 );
+	}
+	first_chunk_index = (int) ( file_offset / source->chunk_size );
+
+	matching_source = source->matching_sources[ first_chunk_index ];
+
+	if( ( matching_source == NULL )
+	 || ( matching_source->cache_entries == NULL ) )
+	{
+		return( 0 );
+	}
+	if( ( entry_index_hint >= 0 )
+	 && ( entry_index_hint < matching_source->number_of_cache_entries )
+	 && ( matching_source->cache_entries[ entry_index_hint ]->file_offset == file_offset ) )
+	{
+		safe_cache_entry = matching_source->cache_entries[ entry_index_hint ];
+	}
+	/* The cache entries are stored in the order of their file offset
+	 */
+	lower_entry_index = 0;
+	upper_entry_index = matching_source->number_of_cache_entries;
+
+	while( ( safe_cache_entry == NULL )
+	    && ( lower_entry_index < upper_entry_index ) )
+	{
+		entry_index = lower_entry_index + ( ( upper_entry_index - lower_entry_index ) / 2 );
+
+		safe_cache_entry = matching_source->cache_entries[ entry_index ];
+
+		if( safe_cache_entry->file_offset == file_offset )
+		{
+			break;
+		}
+		else if( safe_cache_entry->file_offset < file_offset )
+		{
+			lower_entry_index = entry_index + 1;
+		}
+		else
+		{
+			upper_entry_index = entry_index;
+		}
+		safe_cache_entry = NULL;
+	}
+	if( safe_cache_entry == NULL )
+	{
+		return( 0 );
+	}
+	if( safe_cache_entry->cached_data_offset <= file_offset )
+	{
+		return( 0 );
+	}
+	/* The cache entry is only reused if all the chunks that contain its header,
+	 * identifier and padding are the same
+	 */
+	last_offset = safe_cache_entry->cached_data_offset - 1;
+
+	if( (size64_t) last_offset >= source->file_size )
+	{
+		return( 0 );
+	}
+	/* The cached data of the cache entry is read from the file of the source
+	 * and therefore must be stored within it
+	 */
+	if( (size64_t) safe_cache_entry->cached_data_size > ( source->file_size - (size64_t) safe_cache_entry->cached_data_offset ) )
+	{
+		return( 0 );
+	}
+	last_chunk_index = (int) ( last_offset / source->chunk_size );
+
+	for( chunk_index = first_chunk_index;
+	     chunk_index <= last_chunk_index;
+	     chunk_index++ )
+	{
+		if( libwtcdb_chunk_cache_source_compare_chunk(
+		     source,
+		     matching_source,
+		     chunk_index ) != 1 )
+		{
+			return( 0 );
+		}
+	}
+	*cache_entry = safe_cache_entry;
+
+	return( 1 );
+}
+
+/* Creates a chunk cache
+ * Make sure the value chunk_cache is referencing, is set to NULL
+ * A chunk size of 0 represents the default chunk size
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_chunk_cache_initialize(
+     libwtcdb_chunk_cache_t **chunk_cache,
+     size_t chunk_size,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_chunk_cache_t *internal_chunk_cache = NULL;
+	static char *function                                 = "libwtcdb_chunk_cache_initialize";
+
+	if( chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid chunk cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_size == 0 )
+	{
+		chunk_size = LIBWTCDB_CHUNK_CACHE_DEFAULT_CHUNK_SIZE;
+	}
+	if( ( chunk_size < LIBWTCDB_CHUNK_CACHE_MINIMUM_CHUNK_SIZE )
+	 || ( chunk_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_chunk_cache = memory_allocate_structure(
+	                        libwtcdb_internal_chunk_cache_t );
+
+	if( internal_chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunk cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_chunk_cache,
+	     0,
+	     sizeof( libwtcdb_internal_chunk_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear chunk cache.",
+		 function );
+
+		memory_free(
+		 internal_chunk_cache );
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &( internal_chunk_cache->sources ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sources array.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_chunk_cache->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_chunk_cache->chunk_size                = chunk_size;
+	internal_chunk_cache->maximum_number_of_sources = LIBWTCDB_CHUNK_CACHE_DEFAULT_MAXIMUM_NUMBER_OF_SOURCES;
+
+	*chunk_cache = (libwtcdb_chunk_cache_t *) internal_chunk_cache;
+
+	return( 1 );
+
+on_error:
+	if( internal_chunk_cache != NULL )
+	{
+		if( internal_chunk_cache->sources != NULL )
+		{
+			libcdata_array_free(
+			 &( internal_chunk_cache->sources ),
+			 NULL,
+			 NULL );
+		}
+		memory_free(
+		 internal_chunk_cache );
+	}
+	return( -1 );
+}
+
+/* Frees a chunk cache
+ * Releases the references to the snapshots of the sources
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_chunk_cache_free(
+     libwtcdb_chunk_cache_t **chunk_cache,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_chunk_cache_t *internal_chunk_cache = NULL;
+	static char *function                                 = "libwtcdb_chunk_cache_free";
+	int result                                            = 1;
+
+	if( chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_cache != NULL )
+	{
+		internal_chunk_cache = (libwtcdb_internal_chunk_cache_t *) *chunk_cache;
+		*chunk_cache         = NULL;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_chunk_cache->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( libcdata_array_free(
+		     &( internal_chunk_cache->sources ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libwtcdb_chunk_cache_source_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sources array.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_chunk_cache );
+	}
+	return( result );
+}
+
+/* Retrieves the chunk size
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_chunk_cache_get_chunk_size(
+     libwtcdb_chunk_cache_t *chunk_cache,
+     size_t *chunk_size,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_chunk_cache_t *internal_chunk_cache = NULL;
+	static char *function                                 = "libwtcdb_chunk_cache_get_chunk_size";
+
+	if( chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_chunk_cache = (libwtcdb_internal_chunk_cache_t *) chunk_cache;
+
+	if( chunk_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_chunk_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*chunk_size = internal_chunk_cache->chunk_size;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_chunk_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the number of sources
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_chunk_cache_get_number_of_sources(
+     libwtcdb_chunk_cache_t *chunk_cache,
+     int *number_of_sources,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_chunk_cache_t *internal_chunk_cache = NULL;
+	static char *function                                 = "libwtcdb_chunk_cache_get_number_of_sources";
+	int result                                            = 1;
+
+	if( chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_chunk_cache = (libwtcdb_internal_chunk_cache_t *) chunk_cache;
+
+	if( number_of_sources == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of sources.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_chunk_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_array_get_number_of_entries(
+	     internal_chunk_cache->sources,
+	     number_of_sources,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sources.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_chunk_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the maximum number of sources
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_chunk_cache_get_maximum_number_of_sources(
+     libwtcdb_chunk_cache_t *chunk_cache,
+     int *maximum_number_of_sources,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_chunk_cache_t *internal_chunk_cache = NULL;
+	static char *function                                 = "libwtcdb_chunk_cache_get_maximum_number_of_sources";
+
+	if( chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_chunk_cache = (libwtcdb_internal_chunk_cache_t *) chunk_cache;
+
+	if( maximum_number_of_sources == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum number of sources.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_chunk_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*maximum_number_of_sources = internal_chunk_cache->maximum_number_of_sources;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_chunk_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the maximum number of sources
+ * The oldest sources are removed when a source is appended and the maximum is exceeded
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_chunk_cache_set_maximum_number_of_sources(
+     libwtcdb_chunk_cache_t *chunk_cache,
+     int maximum_number_of_sources,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_chunk_cache_t *internal_chunk_cache = NULL;
+	static char *function                                 = "libwtcdb_chunk_cache_set_maximum_number_of_sources";
+
+	if( chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_chunk_cache = (libwtcdb_internal_chunk_cache_t *) chunk_cache;
+
+	if( maximum_number_of_sources <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum number of sources value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_chunk_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_chunk_cache->maximum_number_of_sources = maximum_number_of_sources;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_chunk_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the number of read entries
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_chunk_cache_get_number_of_read_entries(
+     libwtcdb_chunk_cache_t *chunk_cache,
+     int *number_of_read_entries,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_chunk_cache_t *internal_chunk_cache = NULL;
+	static char *function                                 = "libwtcdb_chunk_cache_get_number_of_read_entries";
+
+	if( chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_chunk_cache = (libwtcdb_internal_chunk_cache_t *) chunk_cache;
+
+	if( number_of_read_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of read entries.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_chunk_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_read_entries = internal_chunk_cache->number_of_read_entries;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_chunk_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the number of reused entries
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_chunk_cache_get_number_of_reused_entries(
+     libwtcdb_chunk_cache_t *chunk_cache,
+     int *number_of_reused_entries,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_chunk_cache_t *internal_chunk_cache = NULL;
+	static char *function                                 = "libwtcdb_chunk_cache_get_number_of_reused_entries";
+
+	if( chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_chunk_cache = (libwtcdb_internal_chunk_cache_t *) chunk_cache;
+
+	if( number_of_reused_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of reused entries.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_chunk_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_reused_entries = internal_chunk_cache->number_of_reused_entries;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_chunk_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Creates a source for a file that is about to be read
+ * The fingerprints of the chunks of the file are calculated and compared with
+ * those of the previously appended sources to determine the matching sources
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_chunk_cache_create_source(
+     libwtcdb_chunk_cache_t *chunk_cache,
+     libwtcdb_io_backend_t *io_backend,
+     libbfio_handle_t *file_io_handle,
+     uint8_t file_type,
+     uint32_t format_version,
+     libwtcdb_chunk_cache_source_t **source,
+     libcerror_error_t **error )
+{
+	libwtcdb_chunk_cache_source_t *other_source           = NULL;
+	libwtcdb_chunk_cache_source_t *safe_source            = NULL;
+	libwtcdb_internal_chunk_cache_t *internal_chunk_cache = NULL;
+	static char *function                                 = "libwtcdb_chunk_cache_create_source";
+	size64_t file_size                                    = 0;
+	int chunk_index                                       = 0;
+	int number_of_sources                                 = 0;
+	int source_index                                      = 0;
+
+	if( chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_chunk_cache = (libwtcdb_internal_chunk_cache_t *) chunk_cache;
+
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	if( *source != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid source value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libwtcdb_chunk_cache_source_initialize(
+	     &safe_source,
+	     file_size,
+	     internal_chunk_cache->chunk_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create source.",
+		 function );
+
+		goto on_error;
+	}
+	safe_source->file_type      = file_type;
+	safe_source->format_version = format_version;
+
+	if( libwtcdb_chunk_cache_source_read_fingerprints(
+	     safe_source,
+	     io_backend,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read fingerprints.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_chunk_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( libcdata_array_get_number_of_entries(
+	     internal_chunk_cache->sources,
+	     &number_of_sources,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sources.",
+		 function );
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+		libcthreads_read_write_lock_release_for_write(
+		 internal_chunk_cache->read_write_lock,
+		 NULL );
+#endif
+		goto on_error;
+	}
+	/* The most recently appended sources are compared first, since consecutive
+	 * versions of a file are most likely to be the same
+	 */
+	for( source_index = number_of_sources - 1;
+	     source_index >= 0;
+	     source_index-- )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_chunk_cache->sources,
+		     source_index,
+		     (intptr_t **) &other_source,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve source: %d.",
+			 function,
+			 source_index );
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+			libcthreads_read_write_lock_release_for_write(
+			 internal_chunk_cache->read_write_lock,
+			 NULL );
+#endif
+			goto on_error;
+		}
+		for( chunk_index = 0;
+		     chunk_index < safe_source->number_of_chunks;
+		     chunk_index++ )
+		{
+			if( safe_source->matching_sources[ chunk_index ] != NULL )
+			{
+				continue;
+			}
+			if( libwtcdb_chunk_cache_source_compare_chunk(
+			     safe_source,
+			     other_source,
+			     chunk_index ) == 1 )
+			{
+				safe_source->matching_sources[ chunk_index ] = other_source;
+
+				safe_source->number_of_matching_chunks += 1;
+			}
+		}
+	}
+	/* The source is pending until it is appended or released, which prevents
+	 * the sources it references from being removed
+	 */
+	internal_chunk_cache->number_of_pending_sources += 1;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_chunk_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	*source = safe_source;
+
+	return( 1 );
+
+on_error:
+	if( safe_source != NULL )
+	{
+		libwtcdb_chunk_cache_source_free(
+		 &safe_source,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Appends a source after the file has been read
+ * The chunk cache takes over the source and keeps a reference to the snapshot
+ * The oldest sources are removed when the maximum number of sources is exceeded
+ * and no other sources are pending
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_chunk_cache_append_source(
+     libwtcdb_chunk_cache_t *chunk_cache,
+     libwtcdb_chunk_cache_source_t **source,
+     libwtcdb_internal_snapshot_t *snapshot,
+     int number_of_reused_entries,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_chunk_cache_t *internal_chunk_cache = NULL;
+	static char *function                                 = "libwtcdb_chunk_cache_append_source";
+	int entry_index                                       = 0;
+	int number_of_entries                                 = 0;
+	int result                                            = 1;
+
+	if( chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_chunk_cache = (libwtcdb_internal_chunk_cache_t *) chunk_cache;
+
+	if( ( source == NULL )
+	 || ( *source == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( *source )->snapshot != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid source - snapshot value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( snapshot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid snapshot.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     snapshot->entries,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_reused_entries < 0 )
+	 || ( number_of_reused_entries > number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of reused entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_entries < 0 )
+	 || ( (size_t) number_of_entries > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libwtcdb_cache_entry_t * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libwtcdb_snapshot_add_reference(
+	     snapshot,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to add reference to snapshot.",
+		 function );
+
+		return( -1 );
+	}
+	( *source )->snapshot = snapshot;
+
+	/* The cache entries are copied from the entries array so that they
+	 * can be looked up without the overhead of the array functions
+	 */
+	if( number_of_entries > 0 )
+	{
+		( *source )->cache_entries = (libwtcdb_cache_entry_t **) memory_allocate(
+		                                                          sizeof( libwtcdb_cache_entry_t * ) * number_of_entries );
+
+		if( ( *source )->cache_entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create cache entries.",
+			 function );
+
+			goto on_error;
+		}
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     snapshot->entries,
+			     entry_index,
+			     (intptr_t **) &( ( *source )->cache_entries[ entry_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve cache entry: %d.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+			if( ( *source )->cache_entries[ entry_index ] == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing cache entry: %d.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+		}
+		( *source )->number_of_cache_entries = number_of_entries;
+	}
+
+	/* The matching sources are no longer needed once the file has been read
+	 */
+	if( ( *source )->matching_sources != NULL )
+	{
+		memory_free(
+		 ( *source )->matching_sources );
+
+		( *source )->matching_sources = NULL;
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_chunk_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( libcdata_array_append_entry(
+	     internal_chunk_cache->sources,
+	     &entry_index,
+	     (intptr_t *) *source,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append source to array.",
+		 function );
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+		libcthreads_read_write_lock_release_for_write(
+		 internal_chunk_cache->read_write_lock,
+		 NULL );
+#endif
+		goto on_error;
+	}
+	*source = NULL;
+
+	internal_chunk_cache->number_of_read_entries   += number_of_entries - number_of_reused_entries;
+	internal_chunk_cache->number_of_reused_entries += number_of_reused_entries;
+
+	if( internal_chunk_cache->number_of_pending_sources > 0 )
+	{
+		internal_chunk_cache->number_of_pending_sources -= 1;
+	}
+	if( internal_chunk_cache->number_of_pending_sources == 0 )
+	{
+		if( libwtcdb_chunk_cache_remove_oldest_sources(
+		     internal_chunk_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove oldest sources.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_chunk_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+	if( ( *source )->cache_entries != NULL )
+	{
+		memory_free(
+		 ( *source )->cache_entries );
+
+		( *source )->cache_entries = NULL;
+	}
+	( *source )->number_of_cache_entries = 0;
+
+	libwtcdb_snapshot_free(
+	 (libwtcdb_snapshot_t **) &( ( *source )->snapshot ),
+	 NULL );
+
+	return( -1 );
+}
+
+/* Releases a source that was created but not appended, such as when reading the file failed
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_chunk_cache_release_source(
+     libwtcdb_chunk_cache_t *chunk_cache,
+     libwtcdb_chunk_cache_source_t **source,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_chunk_cache_t *internal_chunk_cache = NULL;
+	static char *function                                 = "libwtcdb_chunk_cache_release_source";
+	int result                                            = 1;
+
+	if( chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_chunk_cache = (libwtcdb_internal_chunk_cache_t *) chunk_cache;
+
+	if( ( source == NULL )
+	 || ( *source == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	if( libwtcdb_chunk_cache_source_free(
+	     source,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free source.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_chunk_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_chunk_cache->number_of_pending_sources > 0 )
+	{
+		internal_chunk_cache->number_of_pending_sources -= 1;
+	}
+	if( internal_chunk_cache->number_of_pending_sources == 0 )
+	{
+		if( libwtcdb_chunk_cache_remove_oldest_sources(
+		     internal_chunk_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove oldest sources.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_chunk_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Removes the oldest sources until the number of sources no longer exceeds the maximum
+ * This function needs to be called with the read/write lock grabbed for writing
+ * and no sources pending
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_chunk_cache_remove_oldest_sources(
+     libwtcdb_internal_chunk_cache_t *internal_chunk_cache,
+     libcerror_error_t **error )
+{
+	libwtcdb_chunk_cache_source_t *source = NULL;
+	static char *function                 = "libwtcdb_chunk_cache_remove_oldest_sources";
+	int number_of_removed_sources         = 0;
+	int number_of_sources                 = 0;
+	int result                            = 1;
+	int source_index                      = 0;
+
+	if( internal_chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_chunk_cache->sources,
+	     &number_of_sources,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sources.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sources <= internal_chunk_cache->maximum_number_of_sources )
+	{
+		return( 1 );
+	}
+	number_of_removed_sources = number_of_sources - internal_chunk_cache->maximum_number_of_sources;
+
+	/* The sources are stored in the order they were appended, hence the oldest
+	 * sources are at the start of the array and the other sources are moved
+	 * to the start of the array before it is resized
+	 */
+	for( source_index = 0;
+	     source_index < number_of_sources;
+	     source_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_chunk_cache->sources,
+		     source_index,
+		     (intptr_t **) &source,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve source: %d.",
+			 function,
+			 source_index );
+
+			return( -1 );
+		}
+		if( libcdata_array_set_entry_by_index(
+		     internal_chunk_cache->sources,
+		     source_index,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set source: %d.",
+			 function,
+			 source_index );
+
+			return( -1 );
+		}
+		if( source_index < number_of_removed_sources )
+		{
+			if( libwtcdb_chunk_cache_source_free(
+			     &source,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free source: %d.",
+				 function,
+				 source_index );
+
+				result = -1;
+			}
+		}
+		else if( libcdata_array_set_entry_by_index(
+		          internal_chunk_cache->sources,
+		          source_index - number_of_removed_sources,
+		          (intptr_t *) source,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set source: %d.",
+			 function,
+			 source_index - number_of_removed_sources );
+
+			return( -1 );
+		}
+	}
+	if( libcdata_array_resize(
+	     internal_chunk_cache->sources,
+	     internal_chunk_cache->maximum_number_of_sources,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize sources array.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
@@ -0,0 +1,261 @@
+/*
+ * Chunk cache functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBWTCDB_CHUNK_CACHE_H )
+#define _LIBWTCDB_CHUNK_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libwtcdb_cache_entry.h"
+#include "libwtcdb_extern.h"
+#include "libwtcdb_io_backend.h"
+#include "libwtcdb_libbfio.h"
+#include "libwtcdb_libcdata.h"
+#include "libwtcdb_libcerror.h"
+#include "libwtcdb_libcthreads.h"
+#include "libwtcdb_snapshot.h"
+#include "libwtcdb_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default chunk size
+ */
+#define LIBWTCDB_CHUNK_CACHE_DEFAULT_CHUNK_SIZE		( 1024 * 1024 )
+
+/* The minimum chunk size
+ */
+#define LIBWTCDB_CHUNK_CACHE_MINIMUM_CHUNK_SIZE		4096
+
+/* The default maximum number of sources
+ */
+#define LIBWTCDB_CHUNK_CACHE_DEFAULT_MAXIMUM_NUMBER_OF_SOURCES	16
+
+typedef struct libwtcdb_chunk_cache_source libwtcdb_chunk_cache_source_t;
+
+/* The chunk cache source contains the chunk fingerprints of a file
+ * The source is not modified after it has been appended to the chunk cache
+ */
+struct libwtcdb_chunk_cache_source
+{
+	/* The file type
+	 */
+	uint8_t file_type;
+
+	/* The format version
+	 */
+	uint32_t format_version;
+
+	/* The file size
+	 */
+	size64_t file_size;
+
+	/* The chunk size
+	 */
+	size_t chunk_size;
+
+	/* The fingerprints, 2 values per chunk
+	 */
+	uint64_t *fingerprints;
+
+	/* The number of chunks
+	 */
+	int number_of_chunks;
+
+	/* The previously appended source with the same fingerprint per chunk or NULL if not available
+	 * Only used before the source is appended to the chunk cache
+	 */
+	libwtcdb_chunk_cache_source_t **matching_sources;
+
+	/* The number of chunks with a matching source
+	 */
+	int number_of_matching_chunks;
+
+	/* The snapshot that contains the entries read from the file
+	 */
+	libwtcdb_internal_snapshot_t *snapshot;
+
+	/* The cache entries of the snapshot, stored in the order of their file offset
+	 */
+	libwtcdb_cache_entry_t **cache_entries;
+
+	/* The number of cache entries
+	 */
+	int number_of_cache_entries;
+};
+
+typedef struct libwtcdb_internal_chunk_cache libwtcdb_internal_chunk_cache_t;
+
+/* The chunk cache allows the entries read from a file to be reused when reading another
+ * version of the file, such as the same file from a different volume snapshot
+ * The files are divided in fixed-size chunks and entries stored in chunks with the same
+ * fingerprint at the same offset are copied instead of read
+ */
+struct libwtcdb_internal_chunk_cache
+{
+	/* The chunk size
+	 */
+	size_t chunk_size;
+
+	/* The sources array
+	 */
+	libcdata_array_t *sources;
+
+	/* The maximum number of sources
+	 */
+	int maximum_number_of_sources;
+
+	/* The number of sources that were created but not yet appended or released
+	 * The sources in the array are not removed while sources are pending,
+	 * since pending sources reference the chunks of the sources in the array
+	 */
+	int number_of_pending_sources;
+
+	/* The number of entries read
+	 */
+	int number_of_read_entries;
+
+	/* The number of entries reused
+	 */
+	int number_of_reused_entries;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+int libwtcdb_chunk_cache_source_initialize(
+     libwtcdb_chunk_cache_source_t **source,
+     size64_t file_size,
+     size_t chunk_size,
+     libcerror_error_t **error );
+
+int libwtcdb_chunk_cache_source_free(
+     libwtcdb_chunk_cache_source_t **source,
+     libcerror_error_t **error );
+
+int libwtcdb_chunk_cache_source_calculate_fingerprint(
+     const uint8_t *data,
+     size_t data_size,
+     uint64_t *fingerprint,
+     libcerror_error_t **error );
+
+int libwtcdb_chunk_cache_source_read_fingerprints(
+     libwtcdb_chunk_cache_source_t *source,
+     libwtcdb_io_backend_t *io_backend,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libwtcdb_chunk_cache_source_compare_chunk(
+     libwtcdb_chunk_cache_source_t *source,
+     libwtcdb_chunk_cache_source_t *other_source,
+     int chunk_index );
+
+int libwtcdb_chunk_cache_source_get_entry(
+     libwtcdb_chunk_cache_source_t *source,
+     off64_t file_offset,
+     int entry_index_hint,
+     libwtcdb_cache_entry_t **cache_entry,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_chunk_cache_initialize(
+     libwtcdb_chunk_cache_t **chunk_cache,
+     size_t chunk_size,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_chunk_cache_free(
+     libwtcdb_chunk_cache_t **chunk_cache,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_chunk_cache_get_chunk_size(
+     libwtcdb_chunk_cache_t *chunk_cache,
+     size_t *chunk_size,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_chunk_cache_get_number_of_sources(
+     libwtcdb_chunk_cache_t *chunk_cache,
+     int *number_of_sources,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_chunk_cache_get_maximum_number_of_sources(
+     libwtcdb_chunk_cache_t *chunk_cache,
+     int *maximum_number_of_sources,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_chunk_cache_set_maximum_number_of_sources(
+     libwtcdb_chunk_cache_t *chunk_cache,
+     int maximum_number_of_sources,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_chunk_cache_get_number_of_read_entries(
+     libwtcdb_chunk_cache_t *chunk_cache,
+     int *number_of_read_entries,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_chunk_cache_get_number_of_reused_entries(
+     libwtcdb_chunk_cache_t *chunk_cache,
+     int *number_of_reused_entries,
+     libcerror_error_t **error );
+
+int libwtcdb_chunk_cache_create_source(
+     libwtcdb_chunk_cache_t *chunk_cache,
+     libwtcdb_io_backend_t *io_backend,
+     libbfio_handle_t *file_io_handle,
+     uint8_t file_type,
+     uint32_t format_version,
+     libwtcdb_chunk_cache_source_t **source,
+     libcerror_error_t **error );
+
+int libwtcdb_chunk_cache_append_source(
+     libwtcdb_chunk_cache_t *chunk_cache,
+     libwtcdb_chunk_cache_source_t **source,
+     libwtcdb_internal_snapshot_t *snapshot,
+     int number_of_reused_entries,
+     libcerror_error_t **error );
+
+int libwtcdb_chunk_cache_release_source(
+     libwtcdb_chunk_cache_t *chunk_cache,
+     libwtcdb_chunk_cache_source_t **source,
+     libcerror_error_t **error );
+
+int libwtcdb_chunk_cache_remove_oldest_sources(
+     libwtcdb_internal_chunk_cache_t *internal_chunk_cache,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBWTCDB_CHUNK_CACHE_H ) */
+
@@ -0,0 +1,1093 @@
+/*
+ * Diff functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libwtcdb_cache_entry.h"
+#include "libwtcdb_definitions.h"
+#include "libwtcdb_diff.h"
+#include "libwtcdb_file.h"
+#include "libwtcdb_hash_column.h"
+#include "libwtcdb_item.h"
+#include "libwtcdb_libcdata.h"
+#include "libwtcdb_libcerror.h"
+#include "libwtcdb_libcthreads.h"
+#include "libwtcdb_snapshot.h"
+
+/* Creates a diff
+ * Make sure the value diff is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_diff_initialize(
+     libwtcdb_diff_t **diff,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_diff_t *internal_diff = NULL;
+	static char *function                   = "libwtcdb_diff_initialize";
+
+	if( diff == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff.",
+		 function );
+
+		return( -1 );
+	}
+	if( *diff != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid diff value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_diff = memory_allocate_structure(
+	                 libwtcdb_internal_diff_t );
+
+	if( internal_diff == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create diff.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_diff,
+	     0,
+	     sizeof( libwtcdb_internal_diff_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear diff.",
+		 function );
+
+		memory_free(
+		 internal_diff );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_diff->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	*diff = (libwtcdb_diff_t *) internal_diff;
+
+	return( 1 );
+
+on_error:
+	if( internal_diff != NULL )
+	{
+		memory_free(
+		 internal_diff );
+	}
+	return( -1 );
+}
+
+/* Frees a diff
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_diff_free(
+     libwtcdb_diff_t **diff,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_diff_t *internal_diff = NULL;
+	static char *function                   = "libwtcdb_diff_free";
+	int result                              = 1;
+
+	if( diff == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff.",
+		 function );
+
+		return( -1 );
+	}
+	if( *diff != NULL )
+	{
+		internal_diff = (libwtcdb_internal_diff_t *) *diff;
+		*diff         = NULL;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_diff->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( internal_diff->changes != NULL )
+		{
+			memory_free(
+			 internal_diff->changes );
+		}
+		memory_free(
+		 internal_diff );
+	}
+	return( result );
+}
+
+/* Appends a change to the diff
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_internal_diff_append_change(
+     libwtcdb_internal_diff_t *internal_diff,
+     uint8_t change_type,
+     uint64_t hash,
+     int old_item_index,
+     int new_item_index,
+     libcerror_error_t **error )
+{
+	libwtcdb_diff_change_t *changes = NULL;
+	static char *function           = "libwtcdb_internal_diff_append_change";
+	size_t changes_size             = 0;
+	int number_of_allocated_changes = 0;
+
+	if( internal_diff == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_diff->number_of_changes >= internal_diff->number_of_allocated_changes )
+	{
+		if( internal_diff->number_of_allocated_changes == 0 )
+		{
+			number_of_allocated_changes = 256;
+		}
+		else if( internal_diff->number_of_allocated_changes <= ( (int) INT_MAX / 2 ) )
+		{
+			number_of_allocated_changes = internal_diff->number_of_allocated_changes * 2;
+		}
+		else if( internal_diff->number_of_allocated_changes < (int) INT_MAX )
+		{
+			number_of_allocated_changes = (int) INT_MAX;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid diff - number of changes value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		changes_size = sizeof( libwtcdb_diff_change_t ) * (size_t) number_of_allocated_changes;
+
+		if( changes_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid changes size value exceeds maximum allocation size.",
+			 function );
+
+			return( -1 );
+		}
+		changes = (libwtcdb_diff_change_t *) memory_reallocate(
+		                                      internal_diff->changes,
+		                                      changes_size );
+
+		if( changes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize changes.",
+			 function );
+
+			return( -1 );
+		}
+		internal_diff->changes                     = changes;
+		internal_diff->number_of_allocated_changes = number_of_allocated_changes;
+	}
+	changes = &( internal_diff->changes[ internal_diff->number_of_changes ] );
+
+	changes->hash           = hash;
+	changes->old_item_index = old_item_index;
+	changes->new_item_index = new_item_index;
+	changes->change_type    = change_type;
+
+	internal_diff->number_of_changes += 1;
+
+	return( 1 );
+}
+
+/* Compares the cached data of an item in the old file with that of an item in the new file
+ * The items are read from the entries of the snapshots the hash columns were taken from
+ * Returns 1 if the cached data is the same, 0 if not or -1 on error
+ */
+int libwtcdb_diff_compare_data(
+     libwtcdb_file_t *old_file,
+     libwtcdb_internal_snapshot_t *old_snapshot,
+     int old_item_index,
+     libwtcdb_file_t *new_file,
+     libwtcdb_internal_snapshot_t *new_snapshot,
+     int new_item_index,
+     libcerror_error_t **error )
+{
+	libwtcdb_item_t *new_item = NULL;
+	libwtcdb_item_t *old_item = NULL;
+	uint8_t *new_data         = NULL;
+	uint8_t *old_data         = NULL;
+	static char *function     = "libwtcdb_diff_compare_data";
+	size_t new_data_size      = 0;
+	size_t old_data_size      = 0;
+	int result                = 0;
+
+	if( libwtcdb_file_get_snapshot_item(
+	     old_file,
+	     old_snapshot,
+	     old_item_index,
+	     &old_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve old item: %d.",
+		 function,
+		 old_item_index );
+
+		goto on_error;
+	}
+	if( libwtcdb_file_get_snapshot_item(
+	     new_file,
+	     new_snapshot,
+	     new_item_index,
+	     &new_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve new item: %d.",
+		 function,
+		 new_item_index );
+
+		goto on_error;
+	}
+	if( libwtcdb_item_get_data_size(
+	     old_item,
+	     &old_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve old data size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libwtcdb_item_get_data_size(
+	     new_item,
+	     &new_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve new data size.",
+		 function );
+
+		goto on_error;
+	}
+	if( old_data_size != new_data_size )
+	{
+		result = 0;
+	}
+	else if( old_data_size == 0 )
+	{
+		result = 1;
+	}
+	else
+	{
+		if( old_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid data size value exceeds maximum allocation size.",
+			 function );
+
+			goto on_error;
+		}
+		old_data = (uint8_t *) memory_allocate(
+		                        sizeof( uint8_t ) * old_data_size );
+
+		if( old_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create old data.",
+			 function );
+
+			goto on_error;
+		}
+		new_data = (uint8_t *) memory_allocate(
+		                        sizeof( uint8_t ) * new_data_size );
+
+		if( new_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create new data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libwtcdb_item_copy_data(
+		     old_item,
+		     old_data,
+		     old_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read old data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libwtcdb_item_copy_data(
+		     new_item,
+		     new_data,
+		     new_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read new data.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_compare(
+		     old_data,
+		     new_data,
+		     old_data_size ) == 0 )
+		{
+			result = 1;
+		}
+		memory_free(
+		 new_data );
+
+		new_data = NULL;
+
+		memory_free(
+		 old_data );
+
+		old_data = NULL;
+	}
+	if( libwtcdb_item_free(
+	     &new_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free new item.",
+		 function );
+
+		goto on_error;
+	}
+	if( libwtcdb_item_free(
+	     &old_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free old item.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( new_data != NULL )
+	{
+		memory_free(
+		 new_data );
+	}
+	if( old_data != NULL )
+	{
+		memory_free(
+		 old_data );
+	}
+	if( new_item != NULL )
+	{
+		libwtcdb_item_free(
+		 &new_item,
+		 NULL );
+	}
+	if( old_item != NULL )
+	{
+		libwtcdb_item_free(
+		 &old_item,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Compares two versions of a cache file
+ * The entries of both files are joined on hash using their sorted hash columns.
+ * Entries with the same hash are modified if their cached data size or data CRC
+ * differs. The cached data itself is only read and compared if the
+ * LIBWTCDB_DIFF_FLAG_COMPARE_DATA flag is set. Entries with a hash that occurs
+ * more than once in a file are paired in entry order
+ * Any previous changes of the diff are replaced
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_diff_compare_files(
+     libwtcdb_diff_t *diff,
+     libwtcdb_file_t *old_file,
+     libwtcdb_file_t *new_file,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	libwtcdb_cache_entry_t *new_cache_entry    = NULL;
+	libwtcdb_cache_entry_t *old_cache_entry    = NULL;
+	libwtcdb_hash_column_t *new_hash_column    = NULL;
+	libwtcdb_hash_column_t *old_hash_column    = NULL;
+	libwtcdb_internal_diff_t *internal_diff    = NULL;
+	libwtcdb_internal_snapshot_t *new_snapshot = NULL;
+	libwtcdb_internal_snapshot_t *old_snapshot = NULL;
+	static char *function                      = "libwtcdb_diff_compare_files";
+	uint64_t new_hash                          = 0;
+	uint64_t old_hash                          = 0;
+	uint8_t change_type                        = 0;
+	int new_entry_index                        = 0;
+	int new_position                           = 0;
+	int old_entry_index                        = 0;
+	int old_position                           = 0;
+	int result                                 = 1;
+
+	if( diff == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff.",
+		 function );
+
+		return( -1 );
+	}
+	internal_diff = (libwtcdb_internal_diff_t *) diff;
+
+	if( ( flags & ~( LIBWTCDB_DIFF_FLAG_COMPARE_DATA ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02" PRIx8 ".",
+		 function,
+		 flags );
+
+		return( -1 );
+	}
+	result = libwtcdb_file_get_snapshot(
+	          old_file,
+	          (libwtcdb_snapshot_t **) &old_snapshot,
+	          error );
+
+	if( result != 1 )
+	{
+		if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid old file - file is not open.",
+			 function );
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve snapshot from old file.",
+			 function );
+		}
+		goto on_error;
+	}
+	result = libwtcdb_file_get_snapshot(
+	          new_file,
+	          (libwtcdb_snapshot_t **) &new_snapshot,
+	          error );
+
+	if( result != 1 )
+	{
+		if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid new file - file is not open.",
+			 function );
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve snapshot from new file.",
+			 function );
+		}
+		goto on_error;
+	}
+	if( ( old_snapshot->file_type != LIBWTCDB_FILE_TYPE_CACHE )
+	 || ( new_snapshot->file_type != LIBWTCDB_FILE_TYPE_CACHE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported file type - only cache files can be compared.",
+		 function );
+
+		goto on_error;
+	}
+	if( libwtcdb_snapshot_get_hash_column(
+	     old_snapshot,
+	     &old_hash_column,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve hash column of old file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libwtcdb_snapshot_get_hash_column(
+	     new_snapshot,
+	     &new_hash_column,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve hash column of new file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_diff->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_diff->number_of_changes = 0;
+
+	result = 1;
+
+	while( ( old_position < old_hash_column->number_of_entries )
+	    || ( new_position < new_hash_column->number_of_entries ) )
+	{
+		change_type     = 0;
+		old_entry_index = -1;
+		new_entry_index = -1;
+
+		if( old_position < old_hash_column->number_of_entries )
+		{
+			old_hash        = old_hash_column->hashes[ old_position ];
+			old_entry_index = old_hash_column->entry_indexes[ old_position ];
+		}
+		if( new_position < new_hash_column->number_of_entries )
+		{
+			new_hash        = new_hash_column->hashes[ new_position ];
+			new_entry_index = new_hash_column->entry_indexes[ new_position ];
+		}
+		if( ( new_entry_index == -1 )
+		 || ( ( old_entry_index != -1 )
+		  && ( old_hash < new_hash ) ) )
+		{
+			change_type     = LIBWTCDB_CHANGE_TYPE_REMOVED;
+			new_entry_index = -1;
+
+			old_position++;
+		}
+		else if( ( old_entry_index == -1 )
+		      || ( old_hash > new_hash ) )
+		{
+			change_type     = LIBWTCDB_CHANGE_TYPE_ADDED;
+			old_entry_index = -1;
+			old_hash        = new_hash;
+
+			new_position++;
+		}
+		else
+		{
+			if( libcdata_array_get_entry_by_index(
+			     old_snapshot->entries,
+			     old_entry_index,
+			     (intptr_t **) &old_cache_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve old cache entry: %d.",
+				 function,
+				 old_entry_index );
+
+				result = -1;
+
+				break;
+			}
+			if( libcdata_array_get_entry_by_index(
+			     new_snapshot->entries,
+			     new_entry_index,
+			     (intptr_t **) &new_cache_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve new cache entry: %d.",
+				 function,
+				 new_entry_index );
+
+				result = -1;
+
+				break;
+			}
+			if( ( old_cache_entry == NULL )
+			 || ( new_cache_entry == NULL ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing cache entry.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+			if( ( old_cache_entry->cached_data_size != new_cache_entry->cached_data_size )
+			 || ( old_cache_entry->data_crc != new_cache_entry->data_crc ) )
+			{
+				change_type = LIBWTCDB_CHANGE_TYPE_MODIFIED;
+			}
+			else if( ( flags & LIBWTCDB_DIFF_FLAG_COMPARE_DATA ) != 0 )
+			{
+				result = libwtcdb_diff_compare_data(
+				          old_file,
+				          old_snapshot,
+				          old_entry_index,
+				          new_file,
+				          new_snapshot,
+				          new_entry_index,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to compare data of old item: %d and new item: %d.",
+					 function,
+					 old_entry_index,
+					 new_entry_index );
+
+					break;
+				}
+				else if( result == 0 )
+				{
+					change_type = LIBWTCDB_CHANGE_TYPE_MODIFIED;
+				}
+				result = 1;
+			}
+			old_position++;
+			new_position++;
+		}
+		if( change_type != 0 )
+		{
+			if( libwtcdb_internal_diff_append_change(
+			     internal_diff,
+			     change_type,
+			     old_hash,
+			     old_entry_index,
+			     new_entry_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append change.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+		}
+	}
+	if( result != 1 )
+	{
+		internal_diff->number_of_changes = 0;
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_diff->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	if( libwtcdb_snapshot_free(
+	     (libwtcdb_snapshot_t **) &new_snapshot,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free snapshot of new file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libwtcdb_snapshot_free(
+	     (libwtcdb_snapshot_t **) &old_snapshot,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free snapshot of old file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( new_snapshot != NULL )
+	{
+		libwtcdb_snapshot_free(
+		 (libwtcdb_snapshot_t **) &new_snapshot,
+		 NULL );
+	}
+	if( old_snapshot != NULL )
+	{
+		libwtcdb_snapshot_free(
+		 (libwtcdb_snapshot_t **) &old_snapshot,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of changes
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_diff_get_number_of_changes(
+     libwtcdb_diff_t *diff,
+     int *number_of_changes,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_diff_t *internal_diff = NULL;
+	static char *function                   = "libwtcdb_diff_get_number_of_changes";
+
+	if( diff == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff.",
+		 function );
+
+		return( -1 );
+	}
+	internal_diff = (libwtcdb_internal_diff_t *) diff;
+
+	if( number_of_changes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of changes.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_diff->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_changes = internal_diff->number_of_changes;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_diff->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves a specific change
+ * The item indexes are -1 if the item is not available in the corresponding file
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_diff_get_change(
+     libwtcdb_diff_t *diff,
+     int change_index,
+     uint8_t *change_type,
+     uint64_t *hash,
+     int *old_item_index,
+     int *new_item_index,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_diff_t *internal_diff = NULL;
+	static char *function                   = "libwtcdb_diff_get_change";
+	int result                              = 1;
+
+	if( diff == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff.",
+		 function );
+
+		return( -1 );
+	}
+	internal_diff = (libwtcdb_internal_diff_t *) diff;
+
+	if( change_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid change type.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( old_item_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid old item index.",
+		 function );
+
+		return( -1 );
+	}
+	if( new_item_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid new item index.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_diff->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( change_index < 0 )
+	 || ( change_index >= internal_diff->number_of_changes ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid change index value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		*change_type    = internal_diff->changes[ change_index ].change_type;
+		*hash           = internal_diff->changes[ change_index ].hash;
+		*old_item_index = internal_diff->changes[ change_index ].old_item_index;
+		*new_item_index = internal_diff->changes[ change_index ].new_item_index;
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_diff->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
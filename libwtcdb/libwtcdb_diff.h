@@ -0,0 +1,143 @@
+/*
+ * Diff functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBWTCDB_DIFF_H )
+#define _LIBWTCDB_DIFF_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libwtcdb_extern.h"
+#include "libwtcdb_libcerror.h"
+#include "libwtcdb_libcthreads.h"
+#include "libwtcdb_snapshot.h"
+#include "libwtcdb_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libwtcdb_diff_change libwtcdb_diff_change_t;
+
+/* The diff change contains an item that was added, removed or modified
+ */
+struct libwtcdb_diff_change
+{
+	/* The hash
+	 */
+	uint64_t hash;
+
+	/* The index of the item in the old file or -1 if not available
+	 */
+	int old_item_index;
+
+	/* The index of the item in the new file or -1 if not available
+	 */
+	int new_item_index;
+
+	/* The change type
+	 */
+	uint8_t change_type;
+};
+
+typedef struct libwtcdb_internal_diff libwtcdb_internal_diff_t;
+
+/* The diff contains the changes between two versions of a cache file
+ */
+struct libwtcdb_internal_diff
+{
+	/* The changes, ordered by hash
+	 */
+	libwtcdb_diff_change_t *changes;
+
+	/* The number of changes
+	 */
+	int number_of_changes;
+
+	/* The number of allocated changes
+	 */
+	int number_of_allocated_changes;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+LIBWTCDB_EXTERN \
+int libwtcdb_diff_initialize(
+     libwtcdb_diff_t **diff,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_diff_free(
+     libwtcdb_diff_t **diff,
+     libcerror_error_t **error );
+
+int libwtcdb_internal_diff_append_change(
+     libwtcdb_internal_diff_t *internal_diff,
+     uint8_t change_type,
+     uint64_t hash,
+     int old_item_index,
+     int new_item_index,
+     libcerror_error_t **error );
+
+int libwtcdb_diff_compare_data(
+     libwtcdb_file_t *old_file,
+     libwtcdb_internal_snapshot_t *old_snapshot,
+     int old_item_index,
+     libwtcdb_file_t *new_file,
+     libwtcdb_internal_snapshot_t *new_snapshot,
+     int new_item_index,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_diff_compare_files(
+     libwtcdb_diff_t *diff,
+     libwtcdb_file_t *old_file,
+     libwtcdb_file_t *new_file,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_diff_get_number_of_changes(
+     libwtcdb_diff_t *diff,
+     int *number_of_changes,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_diff_get_change(
+     libwtcdb_diff_t *diff,
+     int change_index,
+     uint8_t *change_type,
+     uint64_t *hash,
+     int *old_item_index,
+     int *new_item_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBWTCDB_DIFF_H ) */
+
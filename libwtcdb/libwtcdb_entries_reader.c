@@ -0,0 +1,3324 @@
+/*
+ * Entries reader functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "libwtcdb_cache_entry.h"
+#include "libwtcdb_crc.h"
+#include "libwtcdb_definitions.h"
+#include "libwtcdb_entries_reader.h"
+#include "libwtcdb_index_entry.h"
+#include "libwtcdb_index_records.h"
+#include "libwtcdb_io_backend.h"
+#include "libwtcdb_io_handle.h"
+#include "libwtcdb_libbfio.h"
+#include "libwtcdb_libcdata.h"
+#include "libwtcdb_libcerror.h"
+#include "libwtcdb_libcnotify.h"
+#include "libwtcdb_libcthreads.h"
+#include "libwtcdb_unused.h"
+
+#include "wtcdb_cache_entry.h"
+#include "wtcdb_index_entry.h"
+
+/* Creates an entries reader
+ * Make sure the value entries_reader is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_entries_reader_initialize(
+     libwtcdb_entries_reader_t **entries_reader,
+     libwtcdb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_entries_reader_initialize";
+
+	if( entries_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entries reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( *entries_reader != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid entries reader value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	*entries_reader = memory_allocate_structure(
+	                   libwtcdb_entries_reader_t );
+
+	if( *entries_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries reader.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *entries_reader,
+	     0,
+	     sizeof( libwtcdb_entries_reader_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entries reader.",
+		 function );
+
+		memory_free(
+		 *entries_reader );
+
+		*entries_reader = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *entries_reader )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *entries_reader )->io_handle      = io_handle;
+	( *entries_reader )->file_io_handle = file_io_handle;
+
+	return( 1 );
+
+on_error:
+	if( *entries_reader != NULL )
+	{
+		memory_free(
+		 *entries_reader );
+
+		*entries_reader = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an entries reader
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_entries_reader_free(
+     libwtcdb_entries_reader_t **entries_reader,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_entries_reader_free";
+	int entry_index       = 0;
+	int result            = 1;
+
+	if( entries_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entries reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( *entries_reader != NULL )
+	{
+		if( ( *entries_reader )->entries != NULL )
+		{
+			for( entry_index = 0;
+			     entry_index < ( *entries_reader )->number_of_entries;
+			     entry_index++ )
+			{
+				if( ( *entries_reader )->entries[ entry_index ] == NULL )
+				{
+					continue;
+				}
+				if( libwtcdb_entries_reader_free_entry(
+				     *entries_reader,
+				     &( ( *entries_reader )->entries[ entry_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free entry: %d.",
+					 function,
+					 entry_index );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 ( *entries_reader )->entries );
+		}
+		if( ( *entries_reader )->entry_offsets != NULL )
+		{
+			memory_free(
+			 ( *entries_reader )->entry_offsets );
+		}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+		if( ( *entries_reader )->task_error != NULL )
+		{
+			libcerror_error_free(
+			 &( ( *entries_reader )->task_error ) );
+		}
+		if( libcthreads_mutex_free(
+		     &( ( *entries_reader )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *entries_reader );
+
+		*entries_reader = NULL;
+	}
+	return( result );
+}
+
+/* Frees an entry read by the entries reader
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_entries_reader_free_entry(
+     libwtcdb_entries_reader_t *entries_reader,
+     intptr_t **entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_entries_reader_free_entry";
+	int result            = 0;
+
+	if( entries_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entries reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( entries_reader->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid entries reader - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( entries_reader->io_handle->file_type == LIBWTCDB_FILE_TYPE_CACHE )
+	{
+		result = libwtcdb_cache_entry_free(
+		          (libwtcdb_cache_entry_t **) entry,
+		          error );
+	}
+	else
+	{
+		result = libwtcdb_index_entry_free(
+		          (libwtcdb_index_entry_t **) entry,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free entry.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends an entry offset
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_entries_reader_append_entry_offset(
+     libwtcdb_entries_reader_t *entries_reader,
+     off64_t entry_offset,
+     libcerror_error_t **error )
+{
+	off64_t *entry_offsets                = NULL;
+	static char *function                 = "libwtcdb_entries_reader_append_entry_offset";
+	size_t entry_offsets_size             = 0;
+	int number_of_allocated_entry_offsets = 0;
+
+	if( entries_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entries reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( entries_reader->number_of_entry_offsets >= entries_reader->number_of_allocated_entry_offsets )
+	{
+		if( entries_reader->number_of_allocated_entry_offsets == 0 )
+		{
+			number_of_allocated_entry_offsets = 256;
+		}
+		else if( entries_reader->number_of_allocated_entry_offsets > ( INT_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid entries reader - number of allocated entry offsets value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		else
+		{
+			number_of_allocated_entry_offsets = entries_reader->number_of_allocated_entry_offsets * 2;
+		}
+		entry_offsets_size = sizeof( off64_t ) * (size_t) number_of_allocated_entry_offsets;
+
+		if( entry_offsets_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid entry offsets size value exceeds maximum allocation size.",
+			 function );
+
+			return( -1 );
+		}
+		entry_offsets = (off64_t *) memory_reallocate(
+		                             entries_reader->entry_offsets,
+		                             entry_offsets_size );
+
+		if( entry_offsets == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entry offsets.",
+			 function );
+
+			return( -1 );
+		}
+		entries_reader->entry_offsets                     = entry_offsets;
+		entries_reader->number_of_allocated_entry_offsets = number_of_allocated_entry_offsets;
+	}
+	entries_reader->entry_offsets[ entries_reader->number_of_entry_offsets ] = entry_offset;
+
+	entries_reader->number_of_entry_offsets += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the cache entry header size
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_entries_reader_get_cache_entry_header_size(
+     libwtcdb_entries_reader_t *entries_reader,
+     uint32_t *cache_entry_header_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_entries_reader_get_cache_entry_header_size";
+
+	if( entries_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entries reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( entries_reader->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid entries reader - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_entry_header_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache entry header size.",
+		 function );
+
+		return( -1 );
+	}
+	if( entries_reader->io_handle->file_type != LIBWTCDB_FILE_TYPE_CACHE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid entries reader - unsupported file type.",
+		 function );
+
+		return( -1 );
+	}
+	if( entries_reader->io_handle->format_version == 20 )
+	{
+		*cache_entry_header_size = sizeof( wtcdb_cache_entry_v20_t );
+	}
+	else if( entries_reader->io_handle->format_version == 21 )
+	{
+		*cache_entry_header_size = sizeof( wtcdb_cache_entry_v21_t );
+	}
+	else if( ( entries_reader->io_handle->format_version == 30 )
+	      || ( entries_reader->io_handle->format_version == 31 )
+	      || ( entries_reader->io_handle->format_version == 32 ) )
+	{
+		*cache_entry_header_size = sizeof( wtcdb_cache_entry_v30_t );
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid entries reader - unsupported format version: %" PRIu32 ".",
+		 function,
+		 entries_reader->io_handle->format_version );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reports the bytes up to a specific offset that have not been reported before as progress
+ * Returns 1 if successful or -1 on error or if abort was signalled or requested by the progress callback
+ */
+int libwtcdb_entries_reader_update_progress(
+     libwtcdb_entries_reader_t *entries_reader,
+     off64_t progress_offset,
+     libcerror_error_t **error )
+{
+	static char *function  = "libwtcdb_entries_reader_update_progress";
+	uint64_t bytes_scanned = 0;
+
+	if( entries_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entries reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( progress_offset > entries_reader->progress_offset )
+	{
+		bytes_scanned = (uint64_t) ( progress_offset - entries_reader->progress_offset );
+
+		entries_reader->progress_offset = progress_offset;
+	}
+	if( libwtcdb_io_handle_update_progress(
+	     entries_reader->io_handle,
+	     bytes_scanned,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update progress.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the cache entry offsets in a specific range
+ * Only the signature and size of every cache entry are read to determine the offset of the next entry
+ * The offset following the last cache entry is returned in next_entry_offset
+ * Only the bytes up to the end offset that have not been reported before are reported as progress
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_entries_reader_read_cache_entry_offsets_in_range(
+     libwtcdb_entries_reader_t *entries_reader,
+     off64_t start_offset,
+     off64_t end_offset,
+     off64_t *next_entry_offset,
+     libcerror_error_t **error )
+{
+	uint8_t cache_entry_data[ 8 ];
+
+	libwtcdb_cache_entry_t *cache_entry = NULL;
+	static char *function               = "libwtcdb_entries_reader_read_cache_entry_offsets_in_range";
+	off64_t file_offset                 = 0;
+	off64_t progress_offset             = 0;
+	ssize_t read_count                  = 0;
+	uint32_t cache_entry_header_size    = 0;
+	uint32_t cache_entry_size           = 0;
+	int number_of_entry_offsets         = 0;
+	int result                          = 0;
+
+	if( libwtcdb_entries_reader_get_cache_entry_header_size(
+	     entries_reader,
+	     &cache_entry_header_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache entry header size.",
+		 function );
+
+		return( -1 );
+	}
+	if( start_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid start offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( next_entry_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid next entry offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( entries_reader->progress_offset < start_offset )
+	{
+		entries_reader->progress_offset = start_offset;
+	}
+	file_offset = start_offset;
+
+	while( file_offset < end_offset )
+	{
+		if( number_of_entry_offsets >= LIBWTCDB_PROGRESS_NUMBER_OF_ENTRY_OFFSETS_PER_UPDATE )
+		{
+			if( libwtcdb_entries_reader_update_progress(
+			     entries_reader,
+			     file_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update progress.",
+				 function );
+
+				return( -1 );
+			}
+			number_of_entry_offsets = 0;
+		}
+		else if( libwtcdb_io_handle_check_abort(
+		          entries_reader->io_handle,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: unable to read cache entry offsets.",
+			 function );
+
+			return( -1 );
+		}
+		result = 0;
+
+		/* The size of a reused cache entry is known, hence its signature and size
+		 * do not need to be read
+		 */
+		if( entries_reader->chunk_cache_source != NULL )
+		{
+			result = libwtcdb_chunk_cache_source_get_entry(
+			          entries_reader->chunk_cache_source,
+			          file_offset,
+			          entries_reader->number_of_entry_offsets,
+			          &cache_entry,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve reusable cache entry: %d.",
+				 function,
+				 entries_reader->number_of_entry_offsets );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				cache_entry_size = cache_entry->data_size;
+
+				entries_reader->number_of_reused_entries += 1;
+			}
+		}
+		if( result == 0 )
+		{
+			read_count = libwtcdb_io_backend_read_buffer_at_offset(
+			              entries_reader->io_handle->io_backend,
+			              entries_reader->file_io_handle,
+			              cache_entry_data,
+			              8,
+			              file_offset,
+			              error );
+
+			if( read_count != (ssize_t) 8 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read cache entry: %d signature and size at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 entries_reader->number_of_entry_offsets,
+				 file_offset,
+				 file_offset );
+
+				return( -1 );
+			}
+			if( memory_compare(
+			     cache_entry_data,
+			     wtcdb_cache_file_signature,
+			     4 ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: invalid cache entry: %d signature at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 entries_reader->number_of_entry_offsets,
+				 file_offset,
+				 file_offset );
+
+				return( -1 );
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 &( cache_entry_data[ 4 ] ),
+			 cache_entry_size );
+
+			if( cache_entry_size < cache_entry_header_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid cache entry: %d size value out of bounds.",
+				 function,
+				 entries_reader->number_of_entry_offsets );
+
+				return( -1 );
+			}
+		}
+		if( libwtcdb_entries_reader_append_entry_offset(
+		     entries_reader,
+		     file_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append cache entry: %d offset.",
+			 function,
+			 entries_reader->number_of_entry_offsets );
+
+			return( -1 );
+		}
+		file_offset += (off64_t) cache_entry_size;
+
+		number_of_entry_offsets++;
+	}
+	/* The bytes of the last cache entry beyond the end offset are reported by the range that contains them
+	 */
+	progress_offset = file_offset;
+
+	if( progress_offset > end_offset )
+	{
+		progress_offset = end_offset;
+	}
+	if( libwtcdb_entries_reader_update_progress(
+	     entries_reader,
+	     progress_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update progress.",
+		 function );
+
+		return( -1 );
+	}
+	*next_entry_offset = file_offset;
+
+	return( 1 );
+}
+
+/* Checks if the data contains a valid cache entry header
+ * This is stricter than the checks used when reading the entry offsets, since
+ * the data is a candidate found by scanning for the signature
+ * Returns 1 if valid, 0 if not or -1 on error
+ */
+int libwtcdb_entries_reader_check_cache_entry_header(
+     libwtcdb_entries_reader_t *entries_reader,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t *cache_entry_size,
+     libcerror_error_t **error )
+{
+	static char *function            = "libwtcdb_entries_reader_check_cache_entry_header";
+	uint64_t calculated_crc          = 0;
+	uint64_t stored_header_crc       = 0;
+	uint32_t cache_entry_header_size = 0;
+	uint32_t cached_data_size        = 0;
+	uint32_t identifier_size         = 0;
+	uint32_t padding_size            = 0;
+	uint32_t safe_cache_entry_size   = 0;
+
+	if( libwtcdb_entries_reader_get_cache_entry_header_size(
+	     entries_reader,
+	     &cache_entry_header_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache entry header size.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < (size_t) cache_entry_header_size )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_entry_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache entry size.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     data,
+	     wtcdb_cache_file_signature,
+	     4 ) != 0 )
+	{
+		return( 0 );
+	}
+	if( entries_reader->io_handle->format_version == 20 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (wtcdb_cache_entry_v20_t *) data )->size,
+		 safe_cache_entry_size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (wtcdb_cache_entry_v20_t *) data )->identifier_string_size,
+		 identifier_size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (wtcdb_cache_entry_v20_t *) data )->padding_size,
+		 padding_size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (wtcdb_cache_entry_v20_t *) data )->data_size,
+		 cached_data_size );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (wtcdb_cache_entry_v20_t *) data )->header_checksum,
+		 stored_header_crc );
+	}
+	else if( entries_reader->io_handle->format_version == 21 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (wtcdb_cache_entry_v21_t *) data )->size,
+		 safe_cache_entry_size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (wtcdb_cache_entry_v21_t *) data )->identifier_string_size,
+		 identifier_size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (wtcdb_cache_entry_v21_t *) data )->padding_size,
+		 padding_size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (wtcdb_cache_entry_v21_t *) data )->data_size,
+		 cached_data_size );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (wtcdb_cache_entry_v21_t *) data )->header_checksum,
+		 stored_header_crc );
+	}
+	else
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (wtcdb_cache_entry_v30_t *) data )->size,
+		 safe_cache_entry_size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (wtcdb_cache_entry_v30_t *) data )->identifier_string_size,
+		 identifier_size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (wtcdb_cache_entry_v30_t *) data )->padding_size,
+		 padding_size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (wtcdb_cache_entry_v30_t *) data )->data_size,
+		 cached_data_size );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (wtcdb_cache_entry_v30_t *) data )->header_checksum,
+		 stored_header_crc );
+	}
+	if( safe_cache_entry_size < cache_entry_header_size )
+	{
+		return( 0 );
+	}
+	/* The identifier, padding and data must fill the remainder of the cache entry
+	 */
+	if( ( identifier_size > ( safe_cache_entry_size - cache_entry_header_size ) )
+	 || ( padding_size > ( safe_cache_entry_size - cache_entry_header_size - identifier_size ) )
+	 || ( cached_data_size != ( safe_cache_entry_size - cache_entry_header_size - identifier_size - padding_size ) ) )
+	{
+		return( 0 );
+	}
+	/* Some writers do not set the header checksum
+	 */
+	if( stored_header_crc != 0 )
+	{
+		if( libwtcdb_crc64_weak_calculate(
+		     &calculated_crc,
+		     data,
+		     cache_entry_header_size - 8,
+		     (uint64_t) -1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unable to calculate CRC-64.",
+			 function );
+
+			return( -1 );
+		}
+		if( stored_header_crc != calculated_crc )
+		{
+			return( 0 );
+		}
+	}
+	*cache_entry_size = safe_cache_entry_size;
+
+	return( 1 );
+}
+
+/* Scans a region for the first cache entry and reads the cache entry offsets that follow it
+ * The region is marked as consistent if the chain of cache entries could be followed
+ * up to or beyond the end of the region
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_entries_reader_scan_region(
+     libwtcdb_entries_reader_region_t *region,
+     libcerror_error_t **error )
+{
+	uint8_t *scan_data                        = NULL;
+	libcerror_error_t *chain_error            = NULL;
+	libwtcdb_entries_reader_t *entries_reader = NULL;
+	static char *function                     = "libwtcdb_entries_reader_scan_region";
+	size_t scan_data_offset                   = 0;
+	size_t scan_data_size                     = 0;
+	ssize_t read_count                        = 0;
+	off64_t file_offset                       = 0;
+	off64_t scanned_offset                    = 0;
+	uint32_t cache_entry_header_size          = 0;
+	uint32_t cache_entry_size                 = 0;
+	int result                                = 0;
+
+	if( region == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid region.",
+		 function );
+
+		return( -1 );
+	}
+	entries_reader = region->entries_reader;
+
+	if( libwtcdb_entries_reader_get_cache_entry_header_size(
+	     entries_reader,
+	     &cache_entry_header_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache entry header size.",
+		 function );
+
+		goto on_error;
+	}
+	scan_data = (uint8_t *) memory_allocate(
+	                         sizeof( uint8_t ) * LIBWTCDB_ENTRIES_READER_SCAN_BUFFER_SIZE );
+
+	if( scan_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create scan data.",
+		 function );
+
+		goto on_error;
+	}
+	region->first_entry_offset = -1;
+	region->is_consistent      = 0;
+
+	/* The region reader reports the progress of the region
+	 */
+	region->region_reader->progress_offset = region->start_offset;
+
+	file_offset = region->start_offset;
+
+	while( ( region->first_entry_offset == -1 )
+	    && ( file_offset < region->end_offset ) )
+	{
+		read_count = libwtcdb_io_backend_read_buffer_at_offset(
+		              entries_reader->io_handle->io_backend,
+		              entries_reader->file_io_handle,
+		              scan_data,
+		              LIBWTCDB_ENTRIES_READER_SCAN_BUFFER_SIZE,
+		              file_offset,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read scan data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			goto on_error;
+		}
+		scan_data_size = (size_t) read_count;
+
+		/* A cache entry header that does not fit in the remainder of the scan data
+		 * is checked in the next scan data, which overlaps the remainder
+		 */
+		for( scan_data_offset = 0;
+		     ( scan_data_offset + cache_entry_header_size ) <= scan_data_size;
+		     scan_data_offset++ )
+		{
+			if( ( file_offset + (off64_t) scan_data_offset ) >= region->end_offset )
+			{
+				break;
+			}
+			if( memory_compare(
+			     &( scan_data[ scan_data_offset ] ),
+			     wtcdb_cache_file_signature,
+			     4 ) != 0 )
+			{
+				continue;
+			}
+			result = libwtcdb_entries_reader_check_cache_entry_header(
+			          entries_reader,
+			          &( scan_data[ scan_data_offset ] ),
+			          (size_t) cache_entry_header_size,
+			          &cache_entry_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to check cache entry header at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 file_offset + (off64_t) scan_data_offset,
+				 file_offset + (off64_t) scan_data_offset );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				region->first_entry_offset = file_offset + (off64_t) scan_data_offset;
+
+				break;
+			}
+		}
+		if( region->first_entry_offset != -1 )
+		{
+			scanned_offset = region->first_entry_offset;
+		}
+		else
+		{
+			scanned_offset = file_offset + (off64_t) scan_data_size;
+
+			if( scanned_offset > region->end_offset )
+			{
+				scanned_offset = region->end_offset;
+			}
+		}
+		/* The chain of cache entries that follows the first cache entry is reported
+		 * when it is read
+		 */
+		if( libwtcdb_entries_reader_update_progress(
+		     region->region_reader,
+		     scanned_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update progress.",
+			 function );
+
+			goto on_error;
+		}
+		if( scan_data_size < LIBWTCDB_ENTRIES_READER_SCAN_BUFFER_SIZE )
+		{
+			break;
+		}
+		/* Overlap the scan data so that a cache entry header that straddles the scan data is found
+		 */
+		file_offset += LIBWTCDB_ENTRIES_READER_SCAN_BUFFER_SIZE - ( cache_entry_header_size - 1 );
+	}
+	memory_free(
+	 scan_data );
+
+	scan_data = NULL;
+
+	if( region->first_entry_offset == -1 )
+	{
+		return( 1 );
+	}
+	/* A chain that cannot be followed is not an error since the candidate is speculative,
+	 * the region is read again from the end of the chain of the previous region
+	 */
+	result = libwtcdb_entries_reader_read_cache_entry_offsets_in_range(
+	          region->region_reader,
+	          region->first_entry_offset,
+	          region->end_offset,
+	          &( region->next_entry_offset ),
+	          &chain_error );
+
+	if( result == 1 )
+	{
+		region->is_consistent = 1;
+	}
+	else if( chain_error != NULL )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to follow chain of cache entries from offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
+			 function,
+			 region->first_entry_offset,
+			 region->first_entry_offset );
+
+			libcnotify_print_error_backtrace(
+			 chain_error );
+		}
+#endif
+		libcerror_error_free(
+		 &chain_error );
+	}
+	/* The error of the chain is ignored, hence abort is checked separately
+	 */
+	if( libwtcdb_io_handle_check_abort(
+	     entries_reader->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+		 "%s: unable to scan region.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( scan_data != NULL )
+	{
+		memory_free(
+		 scan_data );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+
+/* Callback function to scan a region from a thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_entries_reader_scan_region_task_callback(
+     libwtcdb_entries_reader_region_t *region,
+     void *arguments LIBWTCDB_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error                  = NULL;
+	libwtcdb_entries_reader_t *entries_reader = NULL;
+	static char *function                     = "libwtcdb_entries_reader_scan_region_task_callback";
+	int result                                = 0;
+
+	LIBWTCDB_UNREFERENCED_PARAMETER( arguments )
+
+	if( region == NULL )
+	{
+		return( -1 );
+	}
+	entries_reader = region->entries_reader;
+
+	if( entries_reader == NULL )
+	{
+		return( -1 );
+	}
+	result = libwtcdb_entries_reader_scan_region(
+	          region,
+	          &error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan region: %" PRIi64 " - %" PRIi64 ".",
+		 function,
+		 region->start_offset,
+		 region->end_offset );
+
+		/* Keep the error of the first task that failed for the thread that started the tasks
+		 */
+		if( libcthreads_mutex_grab(
+		     entries_reader->mutex,
+		     NULL ) == 1 )
+		{
+			entries_reader->task_failed = 1;
+
+			if( entries_reader->task_error == NULL )
+			{
+				entries_reader->task_error = error;
+
+				error = NULL;
+			}
+			libcthreads_mutex_release(
+			 entries_reader->mutex,
+			 NULL );
+		}
+		if( error != NULL )
+		{
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT ) */
+
+/* Scans the cache entry offsets in multiple regions
+ * Every region is scanned for a candidate cache entry from which the chain of cache entries
+ * is followed up to the end of the region. The chains are stitched together where the chain
+ * of the previous region ends at the candidate of the next region, otherwise the region is
+ * read again starting at the end of the chain of the previous region. The resulting entry
+ * offsets are the same as those of reading the chain from the first entry onwards
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_entries_reader_scan_cache_entry_offsets(
+     libwtcdb_entries_reader_t *entries_reader,
+     uint32_t first_entry_offset,
+     int number_of_regions,
+     libcerror_error_t **error )
+{
+	libwtcdb_entries_reader_region_t *regions = NULL;
+	static char *function                     = "libwtcdb_entries_reader_scan_cache_entry_offsets";
+	size64_t file_size                        = 0;
+	size64_t region_size                      = 0;
+	off64_t file_offset                       = 0;
+	off64_t progress_offset                   = 0;
+	int entry_index                           = 0;
+	int region_index                          = 0;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *thread_pool    = NULL;
+#endif
+
+	if( entries_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entries reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_regions < 1 )
+	 || ( number_of_regions > LIBWTCDB_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of regions value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     entries_reader->file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) first_entry_offset >= file_size )
+	{
+		return( 1 );
+	}
+	entries_reader->progress_offset = (off64_t) first_entry_offset;
+
+	region_size = ( file_size - first_entry_offset ) / number_of_regions;
+
+	if( region_size == 0 )
+	{
+		number_of_regions = 1;
+	}
+	regions = (libwtcdb_entries_reader_region_t *) memory_allocate(
+	                                                sizeof( libwtcdb_entries_reader_region_t ) * (size_t) number_of_regions );
+
+	if( regions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create regions.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     regions,
+	     0,
+	     sizeof( libwtcdb_entries_reader_region_t ) * (size_t) number_of_regions ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear regions.",
+		 function );
+
+		goto on_error;
+	}
+	for( region_index = 0;
+	     region_index < number_of_regions;
+	     region_index++ )
+	{
+		regions[ region_index ].entries_reader     = entries_reader;
+		regions[ region_index ].start_offset       = (off64_t) first_entry_offset + (off64_t) ( region_size * region_index );
+		regions[ region_index ].end_offset         = (off64_t) first_entry_offset + (off64_t) ( region_size * ( region_index + 1 ) );
+		regions[ region_index ].first_entry_offset = -1;
+
+		if( region_index == ( number_of_regions - 1 ) )
+		{
+			regions[ region_index ].end_offset = (off64_t) file_size;
+		}
+		if( region_index == 0 )
+		{
+			continue;
+		}
+		if( libwtcdb_entries_reader_initialize(
+		     &( regions[ region_index ].region_reader ),
+		     entries_reader->io_handle,
+		     entries_reader->file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create region: %d entries reader.",
+			 function,
+			 region_index );
+
+			goto on_error;
+		}
+	}
+	/* The first region starts at the first entry, hence it does not need to be scanned
+	 */
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( number_of_regions > 1 )
+	{
+		entries_reader->task_failed = 0;
+
+		if( libcthreads_thread_pool_create(
+		     &thread_pool,
+		     NULL,
+		     number_of_regions - 1,
+		     number_of_regions - 1,
+		     (int (*)(intptr_t *, void *)) &libwtcdb_entries_reader_scan_region_task_callback,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		for( region_index = 1;
+		     region_index < number_of_regions;
+		     region_index++ )
+		{
+			if( libcthreads_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) &( regions[ region_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push region: %d onto thread pool.",
+				 function,
+				 region_index );
+
+				goto on_error;
+			}
+		}
+	}
+	else
+#endif /* defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT ) */
+	{
+		for( region_index = 1;
+		     region_index < number_of_regions;
+		     region_index++ )
+		{
+			if( libwtcdb_entries_reader_scan_region(
+			     &( regions[ region_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to scan region: %d.",
+				 function,
+				 region_index );
+
+				goto on_error;
+			}
+		}
+	}
+	/* The chain of the first region is read while the other regions are scanned
+	 */
+	if( libwtcdb_entries_reader_read_cache_entry_offsets_in_range(
+	     entries_reader,
+	     regions[ 0 ].start_offset,
+	     regions[ 0 ].end_offset,
+	     &file_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read cache entry offsets of region: 0.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		/* The tasks report their errors in the entries reader
+		 */
+		if( libcthreads_thread_pool_join(
+		     &thread_pool,
+		     NULL ) != 1 )
+		{
+			entries_reader->task_failed = 1;
+		}
+		if( entries_reader->task_failed != 0 )
+		{
+			if( ( error != NULL )
+			 && ( *error == NULL ) )
+			{
+				*error = entries_reader->task_error;
+
+				entries_reader->task_error = NULL;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan regions.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	for( region_index = 1;
+	     region_index < number_of_regions;
+	     region_index++ )
+	{
+		/* The bytes of the region up to the progress offset of the region reader were
+		 * reported when the region was scanned, the bytes of the region covered by the
+		 * previous chain that were not are reported here
+		 */
+		entries_reader->progress_offset = regions[ region_index ].region_reader->progress_offset;
+
+		progress_offset = file_offset;
+
+		if( progress_offset > regions[ region_index ].end_offset )
+		{
+			progress_offset = regions[ region_index ].end_offset;
+		}
+		if( libwtcdb_entries_reader_update_progress(
+		     entries_reader,
+		     progress_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update progress.",
+			 function );
+
+			goto on_error;
+		}
+		/* The previous chain extends beyond this region
+		 */
+		if( file_offset >= regions[ region_index ].end_offset )
+		{
+			continue;
+		}
+		if( ( regions[ region_index ].is_consistent != 0 )
+		 && ( regions[ region_index ].first_entry_offset == file_offset ) )
+		{
+			for( entry_index = 0;
+			     entry_index < regions[ region_index ].region_reader->number_of_entry_offsets;
+			     entry_index++ )
+			{
+				if( libwtcdb_entries_reader_append_entry_offset(
+				     entries_reader,
+				     regions[ region_index ].region_reader->entry_offsets[ entry_index ],
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append cache entry: %d offset.",
+					 function,
+					 entries_reader->number_of_entry_offsets );
+
+					goto on_error;
+				}
+			}
+			file_offset = regions[ region_index ].next_entry_offset;
+		}
+		else
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: chain of region: %d does not match, reading from offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
+				 function,
+				 region_index,
+				 file_offset,
+				 file_offset );
+			}
+#endif
+			if( libwtcdb_entries_reader_read_cache_entry_offsets_in_range(
+			     entries_reader,
+			     file_offset,
+			     regions[ region_index ].end_offset,
+			     &file_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read cache entry offsets of region: %d.",
+				 function,
+				 region_index );
+
+				goto on_error;
+			}
+		}
+	}
+	for( region_index = 0;
+	     region_index < number_of_regions;
+	     region_index++ )
+	{
+		if( libwtcdb_entries_reader_free(
+		     &( regions[ region_index ].region_reader ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free region: %d entries reader.",
+			 function,
+			 region_index );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 regions );
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+#endif
+	if( regions != NULL )
+	{
+		for( region_index = 0;
+		     region_index < number_of_regions;
+		     region_index++ )
+		{
+			if( regions[ region_index ].region_reader != NULL )
+			{
+				libwtcdb_entries_reader_free(
+				 &( regions[ region_index ].region_reader ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 regions );
+	}
+	return( -1 );
+}
+
+/* Reads the cache entry offsets
+ * Large files are scanned in multiple regions if maximum_number_of_threads is more than 1
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_entries_reader_read_cache_entry_offsets(
+     libwtcdb_entries_reader_t *entries_reader,
+     uint32_t first_entry_offset,
+     int maximum_number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function     = "libwtcdb_entries_reader_read_cache_entry_offsets";
+	size64_t file_size        = 0;
+	off64_t next_entry_offset = 0;
+	int number_of_regions     = 1;
+
+	if( entries_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entries reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_threads < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     entries_reader->file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( (size64_t) first_entry_offset < file_size )
+	{
+		number_of_regions = (int) ( ( file_size - first_entry_offset ) / LIBWTCDB_ENTRIES_READER_MINIMUM_REGION_SIZE );
+
+		if( number_of_regions > maximum_number_of_threads )
+		{
+			number_of_regions = maximum_number_of_threads;
+		}
+	}
+	/* The chain of cache entries is followed in a single region when cache entries
+	 * can be reused, since the size of a reused cache entry does not need to be read
+	 */
+	if( ( entries_reader->chunk_cache_source != NULL )
+	 && ( entries_reader->chunk_cache_source->number_of_matching_chunks > 0 ) )
+	{
+		number_of_regions = 1;
+	}
+#endif
+	entries_reader->progress_offset = (off64_t) first_entry_offset;
+
+	if( number_of_regions > 1 )
+	{
+		if( libwtcdb_entries_reader_scan_cache_entry_offsets(
+		     entries_reader,
+		     first_entry_offset,
+		     number_of_regions,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to scan cache entry offsets.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( libwtcdb_entries_reader_read_cache_entry_offsets_in_range(
+		     entries_reader,
+		     (off64_t) first_entry_offset,
+		     (off64_t) file_size,
+		     &next_entry_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read cache entry offsets.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	entries_reader->number_of_entries = entries_reader->number_of_entry_offsets;
+
+	return( 1 );
+}
+
+/* Compares two entry offsets
+ * Returns -1 if first is less than second, 0 if equal or 1 if greater
+ */
+int libwtcdb_entries_reader_compare_entry_offsets(
+     const off64_t *first_entry_offset,
+     const off64_t *second_entry_offset )
+{
+	if( *first_entry_offset < *second_entry_offset )
+	{
+		return( -1 );
+	}
+	else if( *first_entry_offset > *second_entry_offset )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Sets the cache entry offsets instead of reading them from the chain of cache entries
+ * Offsets before the first entry or beyond the end of the file, such as 0xffffffff,
+ * are ignored. The offsets are sorted and duplicates are removed, so that the cache
+ * entries are read in file order, and the cache entry headers are checked when read
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_entries_reader_set_cache_entry_offsets(
+     libwtcdb_entries_reader_t *entries_reader,
+     uint32_t first_entry_offset,
+     const uint32_t *cache_entry_offsets,
+     int number_of_cache_entry_offsets,
+     libcerror_error_t **error )
+{
+	static char *function              = "libwtcdb_entries_reader_set_cache_entry_offsets";
+	size64_t file_size                 = 0;
+	int cache_entry_offset_index       = 0;
+	int entry_offset_index             = 0;
+	int number_of_unique_entry_offsets = 0;
+
+	if( entries_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entries reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( entries_reader->number_of_entry_offsets != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid entries reader - entry offsets value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( cache_entry_offsets == NULL )
+	 && ( number_of_cache_entry_offsets != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache entry offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_cache_entry_offsets < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of cache entry offsets value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     entries_reader->file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		return( -1 );
+	}
+	for( cache_entry_offset_index = 0;
+	     cache_entry_offset_index < number_of_cache_entry_offsets;
+	     cache_entry_offset_index++ )
+	{
+		if( ( cache_entry_offsets[ cache_entry_offset_index ] < first_entry_offset )
+		 || ( (size64_t) cache_entry_offsets[ cache_entry_offset_index ] >= file_size ) )
+		{
+			continue;
+		}
+		if( libwtcdb_entries_reader_append_entry_offset(
+		     entries_reader,
+		     (off64_t) cache_entry_offsets[ cache_entry_offset_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append entry offset.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( entries_reader->number_of_entry_offsets > 1 )
+	{
+		qsort(
+		 entries_reader->entry_offsets,
+		 (size_t) entries_reader->number_of_entry_offsets,
+		 sizeof( off64_t ),
+		 (int (*)(const void *, const void *)) &libwtcdb_entries_reader_compare_entry_offsets );
+
+		number_of_unique_entry_offsets = 1;
+
+		for( entry_offset_index = 1;
+		     entry_offset_index < entries_reader->number_of_entry_offsets;
+		     entry_offset_index++ )
+		{
+			if( entries_reader->entry_offsets[ entry_offset_index ] != entries_reader->entry_offsets[ number_of_unique_entry_offsets - 1 ] )
+			{
+				entries_reader->entry_offsets[ number_of_unique_entry_offsets++ ] = entries_reader->entry_offsets[ entry_offset_index ];
+			}
+		}
+		entries_reader->number_of_entry_offsets = number_of_unique_entry_offsets;
+	}
+	entries_reader->number_of_entries         = entries_reader->number_of_entry_offsets;
+	entries_reader->check_cache_entry_headers = 1;
+
+	return( 1 );
+}
+
+/* Reads a range of cache entries
+ * The header and identifier string of the cache entries are read in batches
+ * using the IO backend, where cache entries that are close to each other are
+ * read with a single read
+ * Cache entries that can be reused from the chunk cache source are copied instead
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_entries_reader_read_cache_entries_range(
+     libwtcdb_entries_reader_t *entries_reader,
+     int first_entry_index,
+     int number_of_entries,
+     libcerror_error_t **error )
+{
+	libwtcdb_io_backend_read_t reads[ LIBWTCDB_ENTRIES_READER_NUMBER_OF_ENTRIES_PER_BATCH ];
+
+	libwtcdb_cache_entry_t *cache_entry        = NULL;
+	libwtcdb_cache_entry_t *reused_cache_entry = NULL;
+	uint8_t *batch_data                        = NULL;
+	static char *function                      = "libwtcdb_entries_reader_read_cache_entries_range";
+	off64_t entry_offset                       = 0;
+	off64_t read_end_offset                    = 0;
+	size_t batch_data_offset                   = 0;
+	size_t batch_data_size                     = 0;
+	size_t data_offset                         = 0;
+	size_t read_data_size                      = 0;
+	size_t read_extension_size                 = 0;
+	uint32_t cache_entry_header_size           = 0;
+	uint32_t cache_entry_size                  = 0;
+	int batch_entry_index                      = 0;
+	int entry_index                            = 0;
+	int last_entry_index                       = 0;
+	int number_of_batch_entries                = 0;
+	int number_of_reads                        = 0;
+	int read_index                             = 0;
+	int result                                 = 0;
+
+	if( entries_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entries reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( entries_reader->entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid entries reader - missing entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( first_entry_index < 0 )
+	 || ( first_entry_index > entries_reader->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_entries < 0 )
+	 || ( number_of_entries > ( entries_reader->number_of_entries - first_entry_index ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == 0 )
+	{
+		return( 1 );
+	}
+	if( libwtcdb_entries_reader_get_cache_entry_header_size(
+	     entries_reader,
+	     &cache_entry_header_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache entry header size.",
+		 function );
+
+		goto on_error;
+	}
+	last_entry_index = first_entry_index + number_of_entries;
+
+	/* The reusable cache entries are copied, the other cache entries are read in batches
+	 */
+	if( entries_reader->chunk_cache_source != NULL )
+	{
+		for( entry_index = first_entry_index;
+		     entry_index < last_entry_index;
+		     entry_index++ )
+		{
+			result = libwtcdb_chunk_cache_source_get_entry(
+			          entries_reader->chunk_cache_source,
+			          entries_reader->entry_offsets[ entry_index ],
+			          entry_index,
+			          &reused_cache_entry,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve reusable cache entry: %d.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				continue;
+			}
+			if( libwtcdb_cache_entry_clone(
+			     &cache_entry,
+			     reused_cache_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create cache entry: %d.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+			entries_reader->entries[ entry_index ] = (intptr_t *) cache_entry;
+
+			cache_entry = NULL;
+		}
+	}
+	batch_data_size = LIBWTCDB_ENTRIES_READER_NUMBER_OF_ENTRIES_PER_BATCH * LIBWTCDB_ENTRIES_READER_CACHE_ENTRY_READ_SIZE;
+
+	batch_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * batch_data_size );
+
+	if( batch_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create batch data.",
+		 function );
+
+		goto on_error;
+	}
+	batch_entry_index = first_entry_index;
+
+	while( batch_entry_index < last_entry_index )
+	{
+		/* Determine the reads of the batch, where a cache entry that starts
+		 * within or shortly after the previous read extends that read
+		 */
+		batch_data_offset = 0;
+		number_of_reads   = 0;
+
+		for( entry_index = batch_entry_index;
+		     entry_index < last_entry_index;
+		     entry_index++ )
+		{
+			if( entries_reader->entries[ entry_index ] != NULL )
+			{
+				continue;
+			}
+			entry_offset = entries_reader->entry_offsets[ entry_index ];
+
+			if( number_of_reads > 0 )
+			{
+				read_end_offset = reads[ number_of_reads - 1 ].file_offset
+				                + (off64_t) reads[ number_of_reads - 1 ].data_size;
+
+				if( ( entry_offset >= reads[ number_of_reads - 1 ].file_offset )
+				 && ( entry_offset <= ( read_end_offset + LIBWTCDB_ENTRIES_READER_MAXIMUM_READ_GAP ) ) )
+				{
+					read_extension_size = 0;
+
+					if( ( entry_offset + LIBWTCDB_ENTRIES_READER_CACHE_ENTRY_READ_SIZE ) > read_end_offset )
+					{
+						read_extension_size = (size_t) ( entry_offset + LIBWTCDB_ENTRIES_READER_CACHE_ENTRY_READ_SIZE - read_end_offset );
+					}
+					if( read_extension_size <= ( batch_data_size - batch_data_offset ) )
+					{
+						reads[ number_of_reads - 1 ].data_size += read_extension_size;
+
+						batch_data_offset += read_extension_size;
+
+						continue;
+					}
+				}
+			}
+			if( ( number_of_reads >= LIBWTCDB_ENTRIES_READER_NUMBER_OF_ENTRIES_PER_BATCH )
+			 || ( LIBWTCDB_ENTRIES_READER_CACHE_ENTRY_READ_SIZE > ( batch_data_size - batch_data_offset ) ) )
+			{
+				break;
+			}
+			reads[ number_of_reads ].file_offset = entry_offset;
+			reads[ number_of_reads ].data        = &( batch_data[ batch_data_offset ] );
+			reads[ number_of_reads ].data_size   = LIBWTCDB_ENTRIES_READER_CACHE_ENTRY_READ_SIZE;
+			reads[ number_of_reads ].read_count  = 0;
+
+			batch_data_offset += LIBWTCDB_ENTRIES_READER_CACHE_ENTRY_READ_SIZE;
+
+			number_of_reads++;
+		}
+		number_of_batch_entries = entry_index - batch_entry_index;
+
+		if( number_of_reads > 0 )
+		{
+			if( libwtcdb_io_backend_read_batch(
+			     entries_reader->io_handle->io_backend,
+			     entries_reader->file_io_handle,
+			     reads,
+			     number_of_reads,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read batch of cache entries.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		read_index = 0;
+
+		for( entry_index = batch_entry_index;
+		     entry_index < ( batch_entry_index + number_of_batch_entries );
+		     entry_index++ )
+		{
+			if( entries_reader->entries[ entry_index ] != NULL )
+			{
+				continue;
+			}
+			entry_offset = entries_reader->entry_offsets[ entry_index ];
+
+			/* The entry offsets are sorted, hence the read that contains
+			 * the cache entry is either the current or one of the next reads
+			 */
+			while( ( ( read_index + 1 ) < number_of_reads )
+			    && ( entry_offset >= reads[ read_index + 1 ].file_offset ) )
+			{
+				read_index++;
+			}
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: reading cache entry: %d at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+				 function,
+				 entry_index,
+				 entry_offset,
+				 entry_offset );
+			}
+#endif
+			data_offset    = (size_t) ( entry_offset - reads[ read_index ].file_offset );
+			read_data_size = 0;
+
+			if( reads[ read_index ].read_count > (ssize_t) data_offset )
+			{
+				read_data_size = (size_t) reads[ read_index ].read_count - data_offset;
+			}
+			if( entries_reader->check_cache_entry_headers != 0 )
+			{
+				result = libwtcdb_entries_reader_check_cache_entry_header(
+				          entries_reader,
+				          &( reads[ read_index ].data[ data_offset ] ),
+				          read_data_size,
+				          &cache_entry_size,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to check cache entry: %d header.",
+					 function,
+					 entry_index );
+
+					goto on_error;
+				}
+				else if( result == 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_INPUT,
+					 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+					 "%s: invalid cache entry: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+					 function,
+					 entry_index,
+					 entry_offset,
+					 entry_offset );
+
+					goto on_error;
+				}
+			}
+			if( libwtcdb_cache_entry_initialize(
+			     &cache_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create cache entry.",
+				 function );
+
+				goto on_error;
+			}
+			result = 0;
+
+			if( read_data_size >= (size_t) cache_entry_header_size )
+			{
+				result = libwtcdb_cache_entry_read_data(
+				          cache_entry,
+				          entries_reader->io_handle,
+				          &( reads[ read_index ].data[ data_offset ] ),
+				          read_data_size,
+				          entry_offset,
+				          error );
+			}
+			/* Fall back to separate reads if the batched read was too small
+			 * to contain the header and identifier string
+			 */
+			if( result == 0 )
+			{
+				result = libwtcdb_cache_entry_read_file_io_handle(
+				          cache_entry,
+				          entries_reader->io_handle,
+				          entries_reader->file_io_handle,
+				          entry_offset,
+				          error );
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read cache entry: %d.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+			entries_reader->entries[ entry_index ] = (intptr_t *) cache_entry;
+
+			cache_entry = NULL;
+		}
+		if( libwtcdb_io_handle_update_progress(
+		     entries_reader->io_handle,
+		     0,
+		     number_of_batch_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update progress.",
+			 function );
+
+			goto on_error;
+		}
+		batch_entry_index += number_of_batch_entries;
+	}
+	memory_free(
+	 batch_data );
+
+	return( 1 );
+
+on_error:
+	if( cache_entry != NULL )
+	{
+		libwtcdb_cache_entry_free(
+		 &cache_entry,
+		 NULL );
+	}
+	if( batch_data != NULL )
+	{
+		memory_free(
+		 batch_data );
+	}
+	return( -1 );
+}
+
+/* Determines the number of index entries
+ * Index entries are stored as fixed-size records from the first entry offset up to the end of the file
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_entries_reader_determine_number_of_index_entries(
+     libwtcdb_entries_reader_t *entries_reader,
+     uint32_t first_entry_offset,
+     libcerror_error_t **error )
+{
+	static char *function      = "libwtcdb_entries_reader_determine_number_of_index_entries";
+	size64_t file_size         = 0;
+	size64_t number_of_entries = 0;
+	size_t index_entry_size    = 0;
+
+	if( entries_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entries reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( entries_reader->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid entries reader - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entries_reader->io_handle->file_type != LIBWTCDB_FILE_TYPE_INDEX_V20 )
+	 && ( entries_reader->io_handle->file_type != LIBWTCDB_FILE_TYPE_INDEX_V30 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid entries reader - unsupported file type.",
+		 function );
+
+		return( -1 );
+	}
+	if( entries_reader->io_handle->format_version == 20 )
+	{
+		index_entry_size = sizeof( wtcdb_index_entry_v20_t );
+	}
+	else if( entries_reader->io_handle->format_version == 21 )
+	{
+		index_entry_size = sizeof( wtcdb_index_entry_v21_t );
+	}
+	else if( entries_reader->io_handle->format_version == 30 )
+	{
+		index_entry_size = sizeof( wtcdb_index_entry_v30_t );
+	}
+	else if( entries_reader->io_handle->format_version == 31 )
+	{
+		index_entry_size = sizeof( wtcdb_index_entry_v31_t );
+	}
+	else if( entries_reader->io_handle->format_version == 32 )
+	{
+		index_entry_size = sizeof( wtcdb_index_entry_v32_t );
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid entries reader - unsupported format version: %" PRIu32 ".",
+		 function,
+		 entries_reader->io_handle->format_version );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     entries_reader->file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) first_entry_offset < file_size )
+	{
+		if( ( ( file_size - first_entry_offset ) % index_entry_size ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid file size value out of bounds - last index entry is incomplete.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_entries = ( file_size - first_entry_offset ) / index_entry_size;
+
+		if( number_of_entries > (size64_t) INT_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of index entries value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	entries_reader->first_index_entry_offset = (off64_t) first_entry_offset;
+	entries_reader->index_entry_size         = index_entry_size;
+	entries_reader->number_of_entries        = (int) number_of_entries;
+
+	return( 1 );
+}
+
+/* Reads a range of index entries
+ * The index entries of the range are read at once and then decoded into index records
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_entries_reader_read_index_entries_range(
+     libwtcdb_entries_reader_t *entries_reader,
+     int first_entry_index,
+     int number_of_entries,
+     libcerror_error_t **error )
+{
+	libwtcdb_index_entry_t *index_entry     = NULL;
+	libwtcdb_index_records_t *index_records = NULL;
+	uint8_t *index_entries_data             = NULL;
+	static char *function                   = "libwtcdb_entries_reader_read_index_entries_range";
+	size_t data_offset                      = 0;
+	size_t index_entries_data_size          = 0;
+	ssize_t read_count                      = 0;
+	off64_t file_offset                     = 0;
+	int entry_index                         = 0;
+	int number_of_progress_entries          = 0;
+	int record_index                        = 0;
+
+	if( entries_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entries reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( entries_reader->entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid entries reader - missing entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( entries_reader->index_entry_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid entries reader - missing index entry size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( first_entry_index < 0 )
+	 || ( first_entry_index > entries_reader->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_entries < 0 )
+	 || ( number_of_entries > ( entries_reader->number_of_entries - first_entry_index ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == 0 )
+	{
+		return( 1 );
+	}
+	index_entries_data_size = entries_reader->index_entry_size * (size_t) number_of_entries;
+
+	if( index_entries_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid index entries data size value exceeds maximum allocation size.",
+		 function );
+
+		return( -1 );
+	}
+	index_entries_data = (uint8_t *) memory_allocate(
+	                                  sizeof( uint8_t ) * index_entries_data_size );
+
+	if( index_entries_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index entries data.",
+		 function );
+
+		goto on_error;
+	}
+	file_offset = entries_reader->first_index_entry_offset
+	            + (off64_t) ( entries_reader->index_entry_size * (size_t) first_entry_index );
+
+	read_count = libwtcdb_io_backend_read_buffer_at_offset(
+	              entries_reader->io_handle->io_backend,
+	              entries_reader->file_io_handle,
+	              index_entries_data,
+	              index_entries_data_size,
+	              file_offset,
+	              error );
+
+	if( read_count != (ssize_t) index_entries_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index entries: %d - %d data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 first_entry_index,
+		 first_entry_index + number_of_entries - 1,
+		 file_offset,
+		 file_offset );
+
+		goto on_error;
+	}
+	if( libwtcdb_index_records_initialize(
+	     &index_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index records.",
+		 function );
+
+		goto on_error;
+	}
+	if( libwtcdb_index_records_read_data(
+	     index_records,
+	     entries_reader->io_handle,
+	     index_entries_data,
+	     index_entries_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index records: %d - %d.",
+		 function,
+		 first_entry_index,
+		 first_entry_index + number_of_entries - 1 );
+
+		goto on_error;
+	}
+	for( record_index = 0;
+	     record_index < number_of_entries;
+	     record_index++ )
+	{
+		entry_index = first_entry_index + record_index;
+
+		if( number_of_progress_entries >= LIBWTCDB_ENTRIES_READER_NUMBER_OF_INDEX_ENTRIES_PER_TASK )
+		{
+			if( libwtcdb_io_handle_update_progress(
+			     entries_reader->io_handle,
+			     (uint64_t) number_of_progress_entries * entries_reader->index_entry_size,
+			     number_of_progress_entries,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update progress.",
+				 function );
+
+				goto on_error;
+			}
+			number_of_progress_entries = 0;
+		}
+		if( libwtcdb_index_entry_initialize(
+		     &index_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create index entry.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: reading index entry: %d at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+			 function,
+			 entry_index,
+			 file_offset + (off64_t) data_offset,
+			 file_offset + (off64_t) data_offset );
+
+			if( libwtcdb_index_entry_read_data(
+			     index_entry,
+			     entries_reader->io_handle,
+			     &( index_entries_data[ data_offset ] ),
+			     entries_reader->index_entry_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read index entry: %d.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+		}
+		else
+#endif
+		{
+			index_entry->data_size         = (uint32_t) entries_reader->index_entry_size;
+			index_entry->hash              = index_records->hashes[ record_index ];
+			index_entry->modification_time = index_records->modification_times[ record_index ];
+			index_entry->flags             = index_records->flags[ record_index ];
+
+			index_entry->number_of_cache_entry_offsets = index_records->number_of_cache_entry_offsets;
+
+			if( memory_copy(
+			     index_entry->cache_entry_offsets,
+			     &( index_records->cache_entry_offsets[ record_index * index_records->number_of_cache_entry_offsets ] ),
+			     sizeof( uint32_t ) * index_records->number_of_cache_entry_offsets ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy cache entry offsets of index entry: %d.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+		}
+		entries_reader->entries[ entry_index ] = (intptr_t *) index_entry;
+
+		index_entry = NULL;
+
+		data_offset += entries_reader->index_entry_size;
+
+		number_of_progress_entries++;
+	}
+	if( libwtcdb_io_handle_update_progress(
+	     entries_reader->io_handle,
+	     (uint64_t) number_of_progress_entries * entries_reader->index_entry_size,
+	     number_of_progress_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update progress.",
+		 function );
+
+		goto on_error;
+	}
+	if( libwtcdb_index_records_free(
+	     &index_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free index records.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 index_entries_data );
+
+	return( 1 );
+
+on_error:
+	if( index_records != NULL )
+	{
+		libwtcdb_index_records_free(
+		 &index_records,
+		 NULL );
+	}
+	if( index_entry != NULL )
+	{
+		libwtcdb_index_entry_free(
+		 &index_entry,
+		 NULL );
+	}
+	if( index_entries_data != NULL )
+	{
+		memory_free(
+		 index_entries_data );
+	}
+	return( -1 );
+}
+
+/* Reads a range of entries
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_entries_reader_read_entries_range(
+     libwtcdb_entries_reader_t *entries_reader,
+     int first_entry_index,
+     int number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_entries_reader_read_entries_range";
+	int result            = 0;
+
+	if( entries_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entries reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( entries_reader->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid entries reader - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( entries_reader->io_handle->file_type == LIBWTCDB_FILE_TYPE_CACHE )
+	{
+		result = libwtcdb_entries_reader_read_cache_entries_range(
+		          entries_reader,
+		          first_entry_index,
+		          number_of_entries,
+		          error );
+	}
+	else
+	{
+		result = libwtcdb_entries_reader_read_index_entries_range(
+		          entries_reader,
+		          first_entry_index,
+		          number_of_entries,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read entries: %d - %d.",
+		 function,
+		 first_entry_index,
+		 first_entry_index + number_of_entries - 1 );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+
+/* Callback function to read the entries of a task from a thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_entries_reader_read_entries_task_callback(
+     libwtcdb_entries_reader_task_t *task,
+     void *arguments LIBWTCDB_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error                  = NULL;
+	libwtcdb_entries_reader_t *entries_reader = NULL;
+	static char *function                     = "libwtcdb_entries_reader_read_entries_task_callback";
+	int result                                = 0;
+
+	LIBWTCDB_UNREFERENCED_PARAMETER( arguments )
+
+	if( task == NULL )
+	{
+		return( -1 );
+	}
+	entries_reader = task->entries_reader;
+
+	if( entries_reader == NULL )
+	{
+		return( -1 );
+	}
+	result = libwtcdb_entries_reader_read_entries_range(
+	          entries_reader,
+	          task->first_entry_index,
+	          task->number_of_entries,
+	          &error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read entries: %d - %d.",
+		 function,
+		 task->first_entry_index,
+		 task->first_entry_index + task->number_of_entries - 1 );
+
+		/* Keep the error of the first task that failed for the thread that started the tasks
+		 */
+		if( libcthreads_mutex_grab(
+		     entries_reader->mutex,
+		     NULL ) == 1 )
+		{
+			entries_reader->task_failed = 1;
+
+			if( entries_reader->task_error == NULL )
+			{
+				entries_reader->task_error = error;
+
+				error = NULL;
+			}
+			libcthreads_mutex_release(
+			 entries_reader->mutex,
+			 NULL );
+		}
+		if( error != NULL )
+		{
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT ) */
+
+/* Reads the entries
+ * The cache entry offsets or the number of index entries must have been determined beforehand
+ * The entries are read by multiple threads if maximum_number_of_threads is more than 1
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_entries_reader_read_entries(
+     libwtcdb_entries_reader_t *entries_reader,
+     int maximum_number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_entries_reader_read_entries";
+	size_t entries_size   = 0;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *thread_pool = NULL;
+	libwtcdb_entries_reader_task_t *tasks  = NULL;
+	int number_of_entries_per_task         = 0;
+	int number_of_tasks                    = 0;
+	int number_of_threads                  = 0;
+	int task_index                         = 0;
+#endif
+
+	if( entries_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entries reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( entries_reader->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid entries reader - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( entries_reader->entries != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid entries reader - entries value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_threads < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( entries_reader->number_of_entries == 0 )
+	{
+		return( 1 );
+	}
+	entries_size = sizeof( intptr_t * ) * (size_t) entries_reader->number_of_entries;
+
+	if( entries_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid entries size value exceeds maximum allocation size.",
+		 function );
+
+		return( -1 );
+	}
+	entries_reader->entries = (intptr_t **) memory_allocate(
+	                                         entries_size );
+
+	if( entries_reader->entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     entries_reader->entries,
+	     0,
+	     entries_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entries.",
+		 function );
+
+		memory_free(
+		 entries_reader->entries );
+
+		entries_reader->entries = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	/* The debug output of multiple threads would be interleaved
+	 */
+	if( libcnotify_verbose != 0 )
+	{
+		maximum_number_of_threads = 1;
+	}
+#endif
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( entries_reader->io_handle->file_type == LIBWTCDB_FILE_TYPE_CACHE )
+	{
+		number_of_entries_per_task = LIBWTCDB_ENTRIES_READER_NUMBER_OF_ENTRIES_PER_TASK;
+	}
+	else
+	{
+		number_of_entries_per_task = LIBWTCDB_ENTRIES_READER_NUMBER_OF_INDEX_ENTRIES_PER_TASK;
+	}
+	number_of_tasks = entries_reader->number_of_entries / number_of_entries_per_task;
+
+	if( ( entries_reader->number_of_entries % number_of_entries_per_task ) != 0 )
+	{
+		number_of_tasks += 1;
+	}
+	if( ( maximum_number_of_threads > 1 )
+	 && ( number_of_tasks > 1 ) )
+	{
+		number_of_threads = maximum_number_of_threads;
+
+		if( number_of_threads > number_of_tasks )
+		{
+			number_of_threads = number_of_tasks;
+		}
+		tasks = (libwtcdb_entries_reader_task_t *) memory_allocate(
+		                                            sizeof( libwtcdb_entries_reader_task_t ) * (size_t) number_of_tasks );
+
+		if( tasks == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create tasks.",
+			 function );
+
+			goto on_error;
+		}
+		for( task_index = 0;
+		     task_index < number_of_tasks;
+		     task_index++ )
+		{
+			tasks[ task_index ].entries_reader    = entries_reader;
+			tasks[ task_index ].first_entry_index = task_index * number_of_entries_per_task;
+			tasks[ task_index ].number_of_entries = number_of_entries_per_task;
+
+			if( tasks[ task_index ].number_of_entries > ( entries_reader->number_of_entries - tasks[ task_index ].first_entry_index ) )
+			{
+				tasks[ task_index ].number_of_entries = entries_reader->number_of_entries - tasks[ task_index ].first_entry_index;
+			}
+		}
+		entries_reader->task_failed = 0;
+
+		if( libcthreads_thread_pool_create(
+		     &thread_pool,
+		     NULL,
+		     number_of_threads,
+		     number_of_tasks,
+		     (int (*)(intptr_t *, void *)) &libwtcdb_entries_reader_read_entries_task_callback,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		for( task_index = 0;
+		     task_index < number_of_tasks;
+		     task_index++ )
+		{
+			if( libcthreads_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) &( tasks[ task_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push task: %d onto thread pool.",
+				 function,
+				 task_index );
+
+				goto on_error;
+			}
+		}
+		/* The tasks report their errors in the entries reader
+		 */
+		if( libcthreads_thread_pool_join(
+		     &thread_pool,
+		     NULL ) != 1 )
+		{
+			entries_reader->task_failed = 1;
+		}
+		memory_free(
+		 tasks );
+
+		tasks = NULL;
+
+		if( entries_reader->task_failed != 0 )
+		{
+			if( ( error != NULL )
+			 && ( *error == NULL ) )
+			{
+				*error = entries_reader->task_error;
+
+				entries_reader->task_error = NULL;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read entries.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+#endif /* defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT ) */
+
+	if( libwtcdb_entries_reader_read_entries_range(
+	     entries_reader,
+	     0,
+	     entries_reader->number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read entries.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+on_error:
+	if( thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	if( tasks != NULL )
+	{
+		memory_free(
+		 tasks );
+	}
+	return( -1 );
+#endif
+}
+
+/* Appends the entries to the entries array
+ * Entries without a hash are considered unused and are freed
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_entries_reader_append_entries(
+     libwtcdb_entries_reader_t *entries_reader,
+     libcdata_array_t *entries_array,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_entries_reader_append_entries";
+	uint64_t hash         = 0;
+	int array_entry_index = 0;
+	int entry_index       = 0;
+
+	if( entries_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entries reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( entries_reader->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid entries reader - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( entries_reader->entries == NULL )
+	{
+		return( 1 );
+	}
+	for( entry_index = 0;
+	     entry_index < entries_reader->number_of_entries;
+	     entry_index++ )
+	{
+		if( entries_reader->entries[ entry_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( entries_reader->io_handle->file_type == LIBWTCDB_FILE_TYPE_CACHE )
+		{
+			hash = ( (libwtcdb_cache_entry_t *) entries_reader->entries[ entry_index ] )->hash;
+		}
+		else
+		{
+			hash = ( (libwtcdb_index_entry_t *) entries_reader->entries[ entry_index ] )->hash;
+		}
+		if( hash == 0 )
+		{
+			if( libwtcdb_entries_reader_free_entry(
+			     entries_reader,
+			     &( entries_reader->entries[ entry_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free entry: %d.",
+				 function,
+				 entry_index );
+
+				return( -1 );
+			}
+			continue;
+		}
+		if( libcdata_array_append_entry(
+		     entries_array,
+		     &array_entry_index,
+		     entries_reader->entries[ entry_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append entry: %d to array.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		entries_reader->entries[ entry_index ] = NULL;
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,322 @@
+/*
+ * Entries reader functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBWTCDB_ENTRIES_READER_H )
+#define _LIBWTCDB_ENTRIES_READER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libwtcdb_chunk_cache.h"
+#include "libwtcdb_io_handle.h"
+#include "libwtcdb_libbfio.h"
+#include "libwtcdb_libcdata.h"
+#include "libwtcdb_libcerror.h"
+#include "libwtcdb_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of entries read by a thread at once
+ */
+#define LIBWTCDB_ENTRIES_READER_NUMBER_OF_ENTRIES_PER_TASK	64
+
+/* The number of cache entries read in a single batch
+ */
+#define LIBWTCDB_ENTRIES_READER_NUMBER_OF_ENTRIES_PER_BATCH	64
+
+/* The size of the data read per cache entry in a batch, which typically contains
+ * both the cache entry header and the identifier string
+ */
+#define LIBWTCDB_ENTRIES_READER_CACHE_ENTRY_READ_SIZE		256
+
+/* The maximum gap between the data of cache entries that are read with a single read
+ */
+#define LIBWTCDB_ENTRIES_READER_MAXIMUM_READ_GAP		1024
+
+/* The number of index entries read by a thread at once
+ */
+#define LIBWTCDB_ENTRIES_READER_NUMBER_OF_INDEX_ENTRIES_PER_TASK	4096
+
+/* The minimum size of a region that is scanned for cache entries by a thread
+ */
+#define LIBWTCDB_ENTRIES_READER_MINIMUM_REGION_SIZE		( 4 * 1024 * 1024 )
+
+/* The size of the buffer used to scan a region for a cache entry signature
+ */
+#define LIBWTCDB_ENTRIES_READER_SCAN_BUFFER_SIZE		65536
+
+typedef struct libwtcdb_entries_reader_region libwtcdb_entries_reader_region_t;
+typedef struct libwtcdb_entries_reader_task libwtcdb_entries_reader_task_t;
+typedef struct libwtcdb_entries_reader libwtcdb_entries_reader_t;
+
+/* The entries reader reads the entries of a file in two passes
+ * The first pass determines the cache entry offsets from the entry sizes or
+ * the number of index entries from the file size
+ * The second pass reads the entries, which can be done by multiple threads
+ */
+struct libwtcdb_entries_reader
+{
+	/* The IO handle
+	 */
+	libwtcdb_io_handle_t *io_handle;
+
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The entry offsets
+	 */
+	off64_t *entry_offsets;
+
+	/* The number of entry offsets
+	 */
+	int number_of_entry_offsets;
+
+	/* The number of allocated entry offsets
+	 */
+	int number_of_allocated_entry_offsets;
+
+	/* The offset up to which the scanned bytes have been reported as progress
+	 */
+	off64_t progress_offset;
+
+	/* Value to indicate the cache entry headers must be checked, since the
+	 * cache entry offsets were set instead of read from the chain of cache entries
+	 */
+	uint8_t check_cache_entry_headers;
+
+	/* The chunk cache source used to reuse previously read cache entries or NULL if not used
+	 */
+	libwtcdb_chunk_cache_source_t *chunk_cache_source;
+
+	/* The number of reused cache entries
+	 */
+	int number_of_reused_entries;
+
+	/* The offset of the first index entry
+	 */
+	off64_t first_index_entry_offset;
+
+	/* The index entry size
+	 */
+	size_t index_entry_size;
+
+	/* The entries, stored in the same order as in the file
+	 */
+	intptr_t **entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The error of the first task that failed
+	 */
+	libcerror_error_t *task_error;
+#endif
+
+	/* Value to indicate a task failed
+	 */
+	int task_failed;
+};
+
+/* A region of the file scanned by a single thread
+ */
+struct libwtcdb_entries_reader_region
+{
+	/* The entries reader
+	 */
+	libwtcdb_entries_reader_t *entries_reader;
+
+	/* The entries reader that contains the entry offsets of the region
+	 */
+	libwtcdb_entries_reader_t *region_reader;
+
+	/* The start offset
+	 */
+	off64_t start_offset;
+
+	/* The end offset
+	 */
+	off64_t end_offset;
+
+	/* The offset of the first cache entry found in the region or -1 if not found
+	 */
+	off64_t first_entry_offset;
+
+	/* The offset following the last cache entry of the region
+	 */
+	off64_t next_entry_offset;
+
+	/* Value to indicate the chain of cache entries could be followed up to the end of the region
+	 */
+	int is_consistent;
+};
+
+/* A range of entries read by a single thread
+ */
+struct libwtcdb_entries_reader_task
+{
+	/* The entries reader
+	 */
+	libwtcdb_entries_reader_t *entries_reader;
+
+	/* The index of the first entry
+	 */
+	int first_entry_index;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+};
+
+int libwtcdb_entries_reader_initialize(
+     libwtcdb_entries_reader_t **entries_reader,
+     libwtcdb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libwtcdb_entries_reader_free(
+     libwtcdb_entries_reader_t **entries_reader,
+     libcerror_error_t **error );
+
+int libwtcdb_entries_reader_free_entry(
+     libwtcdb_entries_reader_t *entries_reader,
+     intptr_t **entry,
+     libcerror_error_t **error );
+
+int libwtcdb_entries_reader_append_entry_offset(
+     libwtcdb_entries_reader_t *entries_reader,
+     off64_t entry_offset,
+     libcerror_error_t **error );
+
+int libwtcdb_entries_reader_get_cache_entry_header_size(
+     libwtcdb_entries_reader_t *entries_reader,
+     uint32_t *cache_entry_header_size,
+     libcerror_error_t **error );
+
+int libwtcdb_entries_reader_update_progress(
+     libwtcdb_entries_reader_t *entries_reader,
+     off64_t progress_offset,
+     libcerror_error_t **error );
+
+int libwtcdb_entries_reader_read_cache_entry_offsets_in_range(
+     libwtcdb_entries_reader_t *entries_reader,
+     off64_t start_offset,
+     off64_t end_offset,
+     off64_t *next_entry_offset,
+     libcerror_error_t **error );
+
+int libwtcdb_entries_reader_check_cache_entry_header(
+     libwtcdb_entries_reader_t *entries_reader,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t *cache_entry_size,
+     libcerror_error_t **error );
+
+int libwtcdb_entries_reader_scan_region(
+     libwtcdb_entries_reader_region_t *region,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+
+int libwtcdb_entries_reader_scan_region_task_callback(
+     libwtcdb_entries_reader_region_t *region,
+     void *arguments );
+
+#endif /* defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT ) */
+
+int libwtcdb_entries_reader_scan_cache_entry_offsets(
+     libwtcdb_entries_reader_t *entries_reader,
+     uint32_t first_entry_offset,
+     int number_of_regions,
+     libcerror_error_t **error );
+
+int libwtcdb_entries_reader_read_cache_entry_offsets(
+     libwtcdb_entries_reader_t *entries_reader,
+     uint32_t first_entry_offset,
+     int maximum_number_of_threads,
+     libcerror_error_t **error );
+
+int libwtcdb_entries_reader_compare_entry_offsets(
+     const off64_t *first_entry_offset,
+     const off64_t *second_entry_offset );
+
+int libwtcdb_entries_reader_set_cache_entry_offsets(
+     libwtcdb_entries_reader_t *entries_reader,
+     uint32_t first_entry_offset,
+     const uint32_t *cache_entry_offsets,
+     int number_of_cache_entry_offsets,
+     libcerror_error_t **error );
+
+int libwtcdb_entries_reader_read_cache_entries_range(
+     libwtcdb_entries_reader_t *entries_reader,
+     int first_entry_index,
+     int number_of_entries,
+     libcerror_error_t **error );
+
+int libwtcdb_entries_reader_determine_number_of_index_entries(
+     libwtcdb_entries_reader_t *entries_reader,
+     uint32_t first_entry_offset,
+     libcerror_error_t **error );
+
+int libwtcdb_entries_reader_read_index_entries_range(
+     libwtcdb_entries_reader_t *entries_reader,
+     int first_entry_index,
+     int number_of_entries,
+     libcerror_error_t **error );
+
+int libwtcdb_entries_reader_read_entries_range(
+     libwtcdb_entries_reader_t *entries_reader,
+     int first_entry_index,
+     int number_of_entries,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+
+int libwtcdb_entries_reader_read_entries_task_callback(
+     libwtcdb_entries_reader_task_t *task,
+     void *arguments );
+
+#endif /* defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT ) */
+
+int libwtcdb_entries_reader_read_entries(
+     libwtcdb_entries_reader_t *entries_reader,
+     int maximum_number_of_threads,
+     libcerror_error_t **error );
+
+int libwtcdb_entries_reader_append_entries(
+     libwtcdb_entries_reader_t *entries_reader,
+     libcdata_array_t *entries_array,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBWTCDB_ENTRIES_READER_H ) */
+
@@ -0,0 +1,999 @@
+/*
+ * EXIF functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libwtcdb_definitions.h"
+#include "libwtcdb_exif.h"
+#include "libwtcdb_jpeg.h"
+#include "libwtcdb_io_backend.h"
+#include "libwtcdb_libbfio.h"
+#include "libwtcdb_libcerror.h"
+#include "libwtcdb_libcnotify.h"
+
+const uint8_t libwtcdb_exif_identifier[ 6 ] = {
+	'E', 'x', 'i', 'f', 0, 0 };
+
+/* Retrieves the size of a single value of a specific value type
+ * Returns 1 if successful, 0 if the value type is not supported or -1 on error
+ */
+int libwtcdb_exif_get_value_type_size(
+     uint16_t value_type,
+     size_t *value_type_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_exif_get_value_type_size";
+
+	if( value_type_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value type size.",
+		 function );
+
+		return( -1 );
+	}
+	switch( value_type )
+	{
+		case LIBWTCDB_EXIF_VALUE_TYPE_BYTE:
+		case LIBWTCDB_EXIF_VALUE_TYPE_ASCII:
+		case LIBWTCDB_EXIF_VALUE_TYPE_SBYTE:
+		case LIBWTCDB_EXIF_VALUE_TYPE_UNDEFINED:
+			*value_type_size = 1;
+			break;
+
+		case LIBWTCDB_EXIF_VALUE_TYPE_SHORT:
+		case LIBWTCDB_EXIF_VALUE_TYPE_SSHORT:
+			*value_type_size = 2;
+			break;
+
+		case LIBWTCDB_EXIF_VALUE_TYPE_LONG:
+		case LIBWTCDB_EXIF_VALUE_TYPE_SLONG:
+		case LIBWTCDB_EXIF_VALUE_TYPE_FLOAT:
+			*value_type_size = 4;
+			break;
+
+		case LIBWTCDB_EXIF_VALUE_TYPE_RATIONAL:
+		case LIBWTCDB_EXIF_VALUE_TYPE_SRATIONAL:
+		case LIBWTCDB_EXIF_VALUE_TYPE_DOUBLE:
+			*value_type_size = 8;
+			break;
+
+		default:
+			return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of entries of an image file directory (IFD) in the TIFF data
+ * Returns 1 if successful, 0 if the IFD does not fit in the data or -1 on error
+ */
+int libwtcdb_exif_get_ifd_number_of_entries(
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t byte_order,
+     uint32_t ifd_offset,
+     uint16_t *number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_exif_get_ifd_number_of_entries";
+	uint16_t value_16bit  = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < 2 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( byte_order != LIBWTCDB_EXIF_BYTE_ORDER_BIG_ENDIAN )
+	 && ( byte_order != LIBWTCDB_EXIF_BYTE_ORDER_LITTLE_ENDIAN ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported byte order.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) ifd_offset > ( data_size - 2 ) )
+	{
+		return( 0 );
+	}
+	if( byte_order == LIBWTCDB_EXIF_BYTE_ORDER_BIG_ENDIAN )
+	{
+		byte_stream_copy_to_uint16_big_endian(
+		 &( data[ ifd_offset ] ),
+		 value_16bit );
+	}
+	else
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( data[ ifd_offset ] ),
+		 value_16bit );
+	}
+	if( (size_t) value_16bit > ( ( data_size - ifd_offset - 2 ) / 12 ) )
+	{
+		return( 0 );
+	}
+	*number_of_entries = value_16bit;
+
+	return( 1 );
+}
+
+/* Reads an image file directory (IFD) from the TIFF data
+ * The values are referenced in the data and passed to the callback function
+ * Only the primary IFD can contain the EXIF and GPS IFD offsets
+ * Returns 1 if successful, 0 if the callback function requested to stop or -1 on error
+ */
+int libwtcdb_exif_read_ifd_data(
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t byte_order,
+     uint32_t ifd_offset,
+     int ifd,
+     const uint16_t *tags,
+     int number_of_tags,
+     libwtcdb_exif_value_callback_t callback,
+     void *user_data,
+     uint32_t *exif_ifd_offset,
+     uint32_t *gps_ifd_offset,
+     libcerror_error_t **error )
+{
+	const uint8_t *entry_data  = NULL;
+	const uint8_t *value_data  = NULL;
+	static char *function      = "libwtcdb_exif_read_ifd_data";
+	size_t value_data_size     = 0;
+	size_t value_type_size     = 0;
+	uint32_t number_of_values  = 0;
+	uint32_t value_32bit       = 0;
+	uint16_t entry_index       = 0;
+	uint16_t number_of_entries = 0;
+	uint16_t tag               = 0;
+	uint16_t value_type        = 0;
+	int result                 = 0;
+	int tag_index              = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < 2 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( byte_order != LIBWTCDB_EXIF_BYTE_ORDER_BIG_ENDIAN )
+	 && ( byte_order != LIBWTCDB_EXIF_BYTE_ORDER_LITTLE_ENDIAN ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported byte order.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( tags == NULL )
+	 && ( number_of_tags != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tags.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_tags < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of tags value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback.",
+		 function );
+
+		return( -1 );
+	}
+	result = libwtcdb_exif_get_ifd_number_of_entries(
+	          data,
+	          data_size,
+	          byte_order,
+	          ifd_offset,
+	          &number_of_entries,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IFD offset or number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: IFD: %d number of entries\t\t: %" PRIu16 "\n",
+		 function,
+		 ifd,
+		 number_of_entries );
+	}
+#endif
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		entry_data = &( data[ ifd_offset + 2 + ( (size_t) entry_index * 12 ) ] );
+
+		if( byte_order == LIBWTCDB_EXIF_BYTE_ORDER_BIG_ENDIAN )
+		{
+			byte_stream_copy_to_uint16_big_endian(
+			 &( entry_data[ 0 ] ),
+			 tag );
+
+			byte_stream_copy_to_uint16_big_endian(
+			 &( entry_data[ 2 ] ),
+			 value_type );
+
+			byte_stream_copy_to_uint32_big_endian(
+			 &( entry_data[ 4 ] ),
+			 number_of_values );
+
+			byte_stream_copy_to_uint32_big_endian(
+			 &( entry_data[ 8 ] ),
+			 value_32bit );
+		}
+		else
+		{
+			byte_stream_copy_to_uint16_little_endian(
+			 &( entry_data[ 0 ] ),
+			 tag );
+
+			byte_stream_copy_to_uint16_little_endian(
+			 &( entry_data[ 2 ] ),
+			 value_type );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 &( entry_data[ 4 ] ),
+			 number_of_values );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 &( entry_data[ 8 ] ),
+			 value_32bit );
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: IFD: %d entry: %02" PRIu16 " tag\t\t: 0x%04" PRIx16 "\n",
+			 function,
+			 ifd,
+			 entry_index,
+			 tag );
+
+			libcnotify_printf(
+			 "%s: IFD: %d entry: %02" PRIu16 " value type\t\t: %" PRIu16 "\n",
+			 function,
+			 ifd,
+			 entry_index,
+			 value_type );
+
+			libcnotify_printf(
+			 "%s: IFD: %d entry: %02" PRIu16 " number of values\t: %" PRIu32 "\n",
+			 function,
+			 ifd,
+			 entry_index,
+			 number_of_values );
+		}
+#endif
+		if( ifd == LIBWTCDB_EXIF_IFD_PRIMARY )
+		{
+			if( ( value_type == LIBWTCDB_EXIF_VALUE_TYPE_LONG )
+			 && ( number_of_values == 1 ) )
+			{
+				if( ( tag == LIBWTCDB_EXIF_TAG_EXIF_IFD_POINTER )
+				 && ( exif_ifd_offset != NULL ) )
+				{
+					*exif_ifd_offset = value_32bit;
+				}
+				else if( ( tag == LIBWTCDB_EXIF_TAG_GPS_IFD_POINTER )
+				      && ( gps_ifd_offset != NULL ) )
+				{
+					*gps_ifd_offset = value_32bit;
+				}
+			}
+		}
+		if( tags != NULL )
+		{
+			for( tag_index = 0;
+			     tag_index < number_of_tags;
+			     tag_index++ )
+			{
+				if( tags[ tag_index ] == tag )
+				{
+					break;
+				}
+			}
+			if( tag_index >= number_of_tags )
+			{
+				continue;
+			}
+		}
+		result = libwtcdb_exif_get_value_type_size(
+		          value_type,
+		          &value_type_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type size.",
+			 function );
+
+			return( -1 );
+		}
+		/* Values of an unsupported type cannot be bounded and are ignored
+		 */
+		else if( result == 0 )
+		{
+			continue;
+		}
+		if( (size_t) number_of_values > ( data_size / value_type_size ) )
+		{
+			continue;
+		}
+		value_data_size = (size_t) number_of_values * value_type_size;
+
+		/* Values of 4 bytes or less are stored in the entry itself
+		 */
+		if( value_data_size <= 4 )
+		{
+			value_data = &( entry_data[ 8 ] );
+		}
+		else
+		{
+			if( ( (size_t) value_32bit > data_size )
+			 || ( value_data_size > ( data_size - value_32bit ) ) )
+			{
+				continue;
+			}
+			value_data = &( data[ value_32bit ] );
+		}
+		result = callback(
+		          ifd,
+		          tag,
+		          value_type,
+		          number_of_values,
+		          value_data,
+		          value_data_size,
+		          byte_order,
+		          user_data );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: callback failed for IFD: %d tag: 0x%04" PRIx16 ".",
+			 function,
+			 ifd,
+			 tag );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Reads the TIFF data of an EXIF APP1 segment
+ * The values are referenced in the data and passed to the callback function
+ * If tags is NULL all values are passed to the callback function
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_exif_read_tiff_data(
+     const uint8_t *data,
+     size_t data_size,
+     const uint16_t *tags,
+     int number_of_tags,
+     libwtcdb_exif_value_callback_t callback,
+     void *user_data,
+     libcerror_error_t **error )
+{
+	static char *function      = "libwtcdb_exif_read_tiff_data";
+	uint32_t exif_ifd_offset   = 0;
+	uint32_t gps_ifd_offset    = 0;
+	uint32_t ifd_offset        = 0;
+	uint16_t number_of_entries = 0;
+	uint16_t value_16bit       = 0;
+	uint8_t byte_order         = 0;
+	int result                 = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < 8 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data[ 0 ] == 'I' )
+	 && ( data[ 1 ] == 'I' ) )
+	{
+		byte_order = LIBWTCDB_EXIF_BYTE_ORDER_LITTLE_ENDIAN;
+
+		byte_stream_copy_to_uint16_little_endian(
+		 &( data[ 2 ] ),
+		 value_16bit );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ 4 ] ),
+		 ifd_offset );
+	}
+	else if( ( data[ 0 ] == 'M' )
+	      && ( data[ 1 ] == 'M' ) )
+	{
+		byte_order = LIBWTCDB_EXIF_BYTE_ORDER_BIG_ENDIAN;
+
+		byte_stream_copy_to_uint16_big_endian(
+		 &( data[ 2 ] ),
+		 value_16bit );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 &( data[ 4 ] ),
+		 ifd_offset );
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported TIFF byte order: 0x%02" PRIx8 " 0x%02" PRIx8 ".",
+		 function,
+		 data[ 0 ],
+		 data[ 1 ] );
+
+		return( -1 );
+	}
+	if( value_16bit != 42 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported TIFF signature: %" PRIu16 ".",
+		 function,
+		 value_16bit );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: byte order\t\t\t\t: %c\n",
+		 function,
+		 byte_order );
+
+		libcnotify_printf(
+		 "%s: primary IFD offset\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 ifd_offset );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	result = libwtcdb_exif_read_ifd_data(
+	          data,
+	          data_size,
+	          byte_order,
+	          ifd_offset,
+	          LIBWTCDB_EXIF_IFD_PRIMARY,
+	          tags,
+	          number_of_tags,
+	          callback,
+	          user_data,
+	          &exif_ifd_offset,
+	          &gps_ifd_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read primary IFD.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( result != 0 )
+	 && ( exif_ifd_offset != 0 ) )
+	{
+		/* A sub IFD that does not fit in the data is skipped so that
+		 * the values that were already passed to the callback are kept
+		 */
+		result = libwtcdb_exif_get_ifd_number_of_entries(
+		          data,
+		          data_size,
+		          byte_order,
+		          exif_ifd_offset,
+		          &number_of_entries,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve EXIF IFD number of entries.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: EXIF IFD offset: 0x%08" PRIx32 " out of bounds.\n",
+				 function,
+				 exif_ifd_offset );
+			}
+#endif
+			result = 1;
+		}
+		else
+		{
+			result = libwtcdb_exif_read_ifd_data(
+			          data,
+			          data_size,
+			          byte_order,
+			          exif_ifd_offset,
+			          LIBWTCDB_EXIF_IFD_EXIF,
+			          tags,
+			          number_of_tags,
+			          callback,
+			          user_data,
+			          NULL,
+			          NULL,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read EXIF IFD.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	if( ( result != 0 )
+	 && ( gps_ifd_offset != 0 ) )
+	{
+		result = libwtcdb_exif_get_ifd_number_of_entries(
+		          data,
+		          data_size,
+		          byte_order,
+		          gps_ifd_offset,
+		          &number_of_entries,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve GPS IFD number of entries.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: GPS IFD offset: 0x%08" PRIx32 " out of bounds.\n",
+				 function,
+				 gps_ifd_offset );
+			}
+#endif
+			result = 1;
+		}
+		else
+		{
+			result = libwtcdb_exif_read_ifd_data(
+			          data,
+			          data_size,
+			          byte_order,
+			          gps_ifd_offset,
+			          LIBWTCDB_EXIF_IFD_GPS,
+			          tags,
+			          number_of_tags,
+			          callback,
+			          user_data,
+			          NULL,
+			          NULL,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read GPS IFD.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Scans the JPEG marker chain for the EXIF APP1 segment
+ * The segment offset is relative to the start of the data and refers to the segment data that follows the segment size
+ * Returns 1 if successful, 0 if no EXIF APP1 segment was found or -1 on error
+ */
+int libwtcdb_exif_find_app1_segment_file_io_handle(
+     libwtcdb_io_backend_t *io_backend,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     uint32_t data_size,
+     uint32_t *segment_offset,
+     uint16_t *segment_size,
+     libcerror_error_t **error )
+{
+	libwtcdb_jpeg_segment_t jpeg_segment;
+
+	static char *function = "libwtcdb_exif_find_app1_segment_file_io_handle";
+	int result            = 0;
+
+	if( segment_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment size.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &jpeg_segment,
+	     0,
+	     sizeof( libwtcdb_jpeg_segment_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear JPEG segment.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		result = libwtcdb_jpeg_segment_read_next_file_io_handle(
+		          &jpeg_segment,
+		          io_backend,
+		          file_io_handle,
+		          file_offset,
+		          data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read JPEG segment.",
+			 function );
+
+			return( -1 );
+		}
+		/* The APP1 segment should precede the SOS segment and EOI marker
+		 * and be contained in the data
+		 */
+		else if( ( result != 0 )
+		      && ( jpeg_segment.marker == 0xe1 )
+		      && ( jpeg_segment.size >= 8 )
+		      && ( jpeg_segment.data_size == 10 )
+		      && ( (uint32_t) jpeg_segment.size <= ( data_size - jpeg_segment.offset - 2 ) ) )
+		{
+			if( memory_compare(
+			     &( jpeg_segment.data[ 4 ] ),
+			     libwtcdb_exif_identifier,
+			     6 ) == 0 )
+			{
+				*segment_offset = jpeg_segment.offset + 4;
+				*segment_size   = jpeg_segment.size - 2;
+
+				return( 1 );
+			}
+		}
+	}
+	while( result != 0 );
+
+	return( 0 );
+}
+
+/* Reads the EXIF values from JPEG data
+ * Only the EXIF APP1 segment is read, other JPEG segments are skipped
+ * If tags is NULL all values are passed to the callback function
+ * Returns 1 if successful, 0 if no EXIF data was found or -1 on error
+ */
+int libwtcdb_exif_read_file_io_handle(
+     libwtcdb_io_backend_t *io_backend,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     uint32_t data_size,
+     const uint16_t *tags,
+     int number_of_tags,
+     libwtcdb_exif_value_callback_t callback,
+     void *user_data,
+     libcerror_error_t **error )
+{
+	uint8_t *tiff_data      = NULL;
+	static char *function   = "libwtcdb_exif_read_file_io_handle";
+	size_t tiff_data_size   = 0;
+	ssize_t read_count      = 0;
+	uint32_t segment_offset = 0;
+	uint16_t segment_size   = 0;
+	int result              = 0;
+
+	if( callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback.",
+		 function );
+
+		return( -1 );
+	}
+	result = libwtcdb_exif_find_app1_segment_file_io_handle(
+	          io_backend,
+	          file_io_handle,
+	          file_offset,
+	          data_size,
+	          &segment_offset,
+	          &segment_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to find EXIF APP1 segment.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	/* The TIFF data follows the 6 byte EXIF identifier
+	 */
+	tiff_data_size = (size_t) segment_size - 6;
+
+	if( tiff_data_size < 8 )
+	{
+		return( 0 );
+	}
+	tiff_data = (uint8_t *) memory_allocate(
+	                         sizeof( uint8_t ) * tiff_data_size );
+
+	if( tiff_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create TIFF data.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libwtcdb_io_backend_read_buffer_at_offset(
+	              io_backend,
+	              file_io_handle,
+	              tiff_data,
+	              tiff_data_size,
+	              file_offset + segment_offset + 6,
+	              error );
+
+	if( read_count != (ssize_t) tiff_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read TIFF data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset + segment_offset + 6,
+		 file_offset + segment_offset + 6 );
+
+		goto on_error;
+	}
+	if( libwtcdb_exif_read_tiff_data(
+	     tiff_data,
+	     tiff_data_size,
+	     tags,
+	     number_of_tags,
+	     callback,
+	     user_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read TIFF data.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 tiff_data );
+
+	return( 1 );
+
+on_error:
+	if( tiff_data != NULL )
+	{
+		memory_free(
+		 tiff_data );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,98 @@
+/*
+ * EXIF functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBWTCDB_EXIF_H )
+#define _LIBWTCDB_EXIF_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libwtcdb_io_backend.h"
+#include "libwtcdb_libbfio.h"
+#include "libwtcdb_libcerror.h"
+#include "libwtcdb_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+int libwtcdb_exif_get_value_type_size(
+     uint16_t value_type,
+     size_t *value_type_size,
+     libcerror_error_t **error );
+
+int libwtcdb_exif_get_ifd_number_of_entries(
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t byte_order,
+     uint32_t ifd_offset,
+     uint16_t *number_of_entries,
+     libcerror_error_t **error );
+
+int libwtcdb_exif_read_ifd_data(
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t byte_order,
+     uint32_t ifd_offset,
+     int ifd,
+     const uint16_t *tags,
+     int number_of_tags,
+     libwtcdb_exif_value_callback_t callback,
+     void *user_data,
+     uint32_t *exif_ifd_offset,
+     uint32_t *gps_ifd_offset,
+     libcerror_error_t **error );
+
+int libwtcdb_exif_read_tiff_data(
+     const uint8_t *data,
+     size_t data_size,
+     const uint16_t *tags,
+     int number_of_tags,
+     libwtcdb_exif_value_callback_t callback,
+     void *user_data,
+     libcerror_error_t **error );
+
+int libwtcdb_exif_find_app1_segment_file_io_handle(
+     libwtcdb_io_backend_t *io_backend,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     uint32_t data_size,
+     uint32_t *segment_offset,
+     uint16_t *segment_size,
+     libcerror_error_t **error );
+
+int libwtcdb_exif_read_file_io_handle(
+     libwtcdb_io_backend_t *io_backend,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     uint32_t data_size,
+     const uint16_t *tags,
+     int number_of_tags,
+     libwtcdb_exif_value_callback_t callback,
+     void *user_data,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBWTCDB_EXIF_H ) */
+
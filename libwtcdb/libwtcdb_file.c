@@ -28,15 +28,23 @@
 #include "libwtcdb_cache_entry.h"
 #include "libwtcdb_debug.h"
 #include "libwtcdb_definitions.h"
+#include "libwtcdb_entries_reader.h"
 #include "libwtcdb_index_entry.h"
+#include "libwtcdb_handle_pool.h"
+#include "libwtcdb_io_backend.h"
 #include "libwtcdb_io_handle.h"
 #include "libwtcdb_item.h"
+#include "libwtcdb_item_worker.h"
 #include "libwtcdb_file.h"
 #include "libwtcdb_file_header.h"
 #include "libwtcdb_libbfio.h"
 #include "libwtcdb_libcdata.h"
 #include "libwtcdb_libcerror.h"
 #include "libwtcdb_libcnotify.h"
+#include "libwtcdb_libcthreads.h"
+#include "libwtcdb_progress.h"
+#include "libwtcdb_read_ahead.h"
+#include "libwtcdb_snapshot.h"
 
 /* Creates a file
  * Make sure the value file is referencing, is set to NULL
@@ -102,33 +110,36 @@ int libwtcdb_file_initialize(
 
 		return( -1 );
 	}
-	if( libcdata_array_initialize(
-	     &( internal_file->entries ),
-	     0,
+	if( libwtcdb_io_handle_initialize(
+	     &( internal_file->io_handle ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create entries array.",
+		 "%s: unable to create IO handle.",
 		 function );
 
 		goto on_error;
 	}
-	if( libwtcdb_io_handle_initialize(
-	     &( internal_file->io_handle ),
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_file->read_write_lock ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create IO handle.",
+		 "%s: unable to initialize read/write lock.",
 		 function );
 
 		goto on_error;
 	}
+#endif
+	internal_file->maximum_number_of_threads = 1;
+
 	*file = (libwtcdb_file_t *) internal_file;
 
 	return( 1 );
@@ -136,11 +147,10 @@ int libwtcdb_file_initialize(
 on_error:
 	if( internal_file != NULL )
 	{
-		if( internal_file->entries != NULL )
+		if( internal_file->io_handle != NULL )
 		{
-			libcdata_array_free(
-			 &( internal_file->entries ),
-			 NULL,
+			libwtcdb_io_handle_free(
+			 &( internal_file->io_handle ),
 			 NULL );
 		}
 		memory_free(
@@ -193,33 +203,39 @@ int libwtcdb_file_free(
 		}
 		*file = NULL;
 
-		if( libcdata_array_free(
-		     &( internal_file->entries ),
-		     (int (*)(intptr_t **, libcerror_error_t **)) internal_file->entry_free_function,
+		if( libwtcdb_io_handle_free(
+		     &( internal_file->io_handle ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free entries array.",
+			 "%s: unable to free IO handle.",
 			 function );
 
 			result = -1;
 		}
-		if( libwtcdb_io_handle_free(
-		     &( internal_file->io_handle ),
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_file->read_write_lock ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free IO handle.",
+			 "%s: unable to free read/write lock.",
 			 function );
 
 			result = -1;
 		}
+#endif
+		if( internal_file->cache_entry_offsets != NULL )
+		{
+			memory_free(
+			 internal_file->cache_entry_offsets );
+		}
 		memory_free(
 		 internal_file );
 	}
@@ -265,19 +281,16 @@ int libwtcdb_file_signal_abort(
 	return( 1 );
 }
 
-/* Opens a file
+/* Retrieves the maximum number of threads used to read the entries
  * Returns 1 if successful or -1 on error
  */
-int libwtcdb_file_open(
+int libwtcdb_file_get_maximum_number_of_threads(
      libwtcdb_file_t *file,
-     const char *filename,
-     int access_flags,
+     int *maximum_number_of_threads,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *file_io_handle        = NULL;
 	libwtcdb_internal_file_t *internal_file = NULL;
-	static char *function                   = "libwtcdb_file_open";
-	size_t filename_length                  = 0;
+	static char *function                   = "libwtcdb_file_get_maximum_number_of_threads";
 
 	if( file == NULL )
 	{
@@ -292,132 +305,135 @@ int libwtcdb_file_open(
 	}
 	internal_file = (libwtcdb_internal_file_t *) file;
 
-	if( filename == NULL )
+	if( maximum_number_of_threads == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename.",
+		 "%s: invalid maximum number of threads.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( ( access_flags & LIBWTCDB_ACCESS_FLAG_READ ) == 0 )
-	 && ( ( access_flags & LIBWTCDB_ACCESS_FLAG_WRITE ) == 0 ) )
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported access flags.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( access_flags & LIBWTCDB_ACCESS_FLAG_WRITE ) != 0 )
+#endif
+	*maximum_number_of_threads = internal_file->maximum_number_of_threads;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: write access currently not supported.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	if( libbfio_file_initialize(
-	     &file_io_handle,
-	     error ) != 1 )
+#endif
+	return( 1 );
+}
+
+/* Sets the maximum number of threads used to read the entries
+ * More than 1 thread is only used when compiled with multi-thread support
+ * The value is used the next time the file is opened
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_file_set_maximum_number_of_threads(
+     libwtcdb_file_t *file,
+     int maximum_number_of_threads,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libwtcdb_file_set_maximum_number_of_threads";
+
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libbfio_handle_set_track_offsets_read(
-	     file_io_handle,
-	     1,
-	     error ) != 1 )
+	internal_file = (libwtcdb_internal_file_t *) file;
+
+	if( ( maximum_number_of_threads < 1 )
+	 || ( maximum_number_of_threads > LIBWTCDB_MAXIMUM_NUMBER_OF_THREADS ) )
 	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set track offsets read in file IO handle.",
-                 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of threads value out of bounds.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#endif
-	filename_length = narrow_string_length(
-	                   filename );
-
-	if( libbfio_file_set_name(
-	     file_io_handle,
-	     filename,
-	     filename_length + 1,
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set filename in file IO handle.",
-                 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libwtcdb_file_open_file_io_handle(
-	     file,
-	     file_io_handle,
-	     access_flags,
+#endif
+	internal_file->maximum_number_of_threads = maximum_number_of_threads;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open file: %s.",
-		 function,
-		 filename );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	internal_file->file_io_handle_created_in_library = 1;
-
+#endif
 	return( 1 );
-
-on_error:
-	if( file_io_handle != NULL )
-	{
-		libbfio_handle_free(
-		 &file_io_handle,
-		 NULL );
-	}
-	return( -1 );
 }
 
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
-
-/* Opens a file
+/* Retrieves the number of items of which the cached data is read ahead
  * Returns 1 if successful or -1 on error
  */
-int libwtcdb_file_open_wide(
+int libwtcdb_file_get_number_of_read_ahead_items(
      libwtcdb_file_t *file,
-     const wchar_t *filename,
-     int access_flags,
+     int *number_of_read_ahead_items,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *file_io_handle        = NULL;
 	libwtcdb_internal_file_t *internal_file = NULL;
-	static char *function                   = "libwtcdb_file_open_wide";
-	size_t filename_length                  = 0;
+	static char *function                   = "libwtcdb_file_get_number_of_read_ahead_items";
 
 	if( file == NULL )
 	{
@@ -432,133 +448,66 @@ int libwtcdb_file_open_wide(
 	}
 	internal_file = (libwtcdb_internal_file_t *) file;
 
-	if( filename == NULL )
+	if( number_of_read_ahead_items == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename.",
+		 "%s: invalid number of read-ahead items.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( ( access_flags & LIBWTCDB_ACCESS_FLAG_READ ) == 0 )
-	 && ( ( access_flags & LIBWTCDB_ACCESS_FLAG_WRITE ) == 0 ) )
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported access flags.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( access_flags & LIBWTCDB_ACCESS_FLAG_WRITE ) != 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: write access currently not supported.",
-		 function );
+#endif
+	*number_of_read_ahead_items = internal_file->number_of_read_ahead_items;
 
-		return( -1 );
-	}
-	if( libbfio_file_initialize(
-	     &file_io_handle,
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
-		goto on_error;
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libbfio_handle_set_track_offsets_read(
-	     file_io_handle,
-	     1,
-	     error ) != 1 )
-	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set track offsets read in file IO handle.",
-                 function );
-
-		goto on_error;
+		return( -1 );
 	}
 #endif
-	filename_length = wide_string_length(
-	                   filename );
-
-	if( libbfio_file_set_name_wide(
-	     file_io_handle,
-	     filename,
-	     filename_length + 1,
-	     error ) != 1 )
-	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set filename in file IO handle.",
-                 function );
-
-		goto on_error;
-	}
-	if( libwtcdb_file_open_file_io_handle(
-	     file,
-	     file_io_handle,
-	     access_flags,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open file: %ls.",
-		 function,
-		 filename );
-
-		goto on_error;
-	}
-	internal_file->file_io_handle_created_in_library = 1;
-
 	return( 1 );
-
-on_error:
-	if( file_io_handle != NULL )
-	{
-		libbfio_handle_free(
-		 &file_io_handle,
-		 NULL );
-	}
-	return( -1 );
 }
 
-#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
-
-/* Opens a file using a Basic File IO (bfio) handle
+/* Sets the number of items of which the cached data is read ahead
+ * When retrieving the items in sequence the cached data of the items following
+ * the current item is read on a helper thread, 0 disables read-ahead
+ * Read-ahead is only used when compiled with multi-thread support
+ * The value is used the next time the file is opened
  * Returns 1 if successful or -1 on error
  */
-int libwtcdb_file_open_file_io_handle(
+int libwtcdb_file_set_number_of_read_ahead_items(
      libwtcdb_file_t *file,
-     libbfio_handle_t *file_io_handle,
-     int access_flags,
+     int number_of_read_ahead_items,
      libcerror_error_t **error )
 {
-	libwtcdb_internal_file_t *internal_file  = NULL;
-	static char *function                    = "libwtcdb_file_open_file_io_handle";
-	uint8_t file_io_handle_opened_in_library = 0;
-	int bfio_access_flags                    = 0;
-	int file_io_handle_is_open               = 0;
+	libwtcdb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libwtcdb_file_set_number_of_read_ahead_items";
 
 	if( file == NULL )
 	{
@@ -573,127 +522,149 @@ int libwtcdb_file_open_file_io_handle(
 	}
 	internal_file = (libwtcdb_internal_file_t *) file;
 
-	if( internal_file->file_io_handle != NULL )
+	if( ( number_of_read_ahead_items < 0 )
+	 || ( number_of_read_ahead_items > LIBWTCDB_MAXIMUM_NUMBER_OF_READ_AHEAD_ITEMS ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - file IO handle already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of read-ahead items value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( file_io_handle == NULL )
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( ( access_flags & LIBWTCDB_ACCESS_FLAG_READ ) == 0 )
-	 && ( ( access_flags & LIBWTCDB_ACCESS_FLAG_WRITE ) == 0 ) )
+#endif
+	internal_file->number_of_read_ahead_items = number_of_read_ahead_items;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported access flags.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( access_flags & LIBWTCDB_ACCESS_FLAG_WRITE ) != 0 )
+#endif
+	return( 1 );
+}
+
+/* Retrieves the IO backend
+ * If the file is open this is the IO backend in use, otherwise the requested IO backend
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_file_get_io_backend(
+     libwtcdb_file_t *file,
+     int *io_backend,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libwtcdb_file_get_io_backend";
+
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: write access currently not supported.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( access_flags & LIBWTCDB_ACCESS_FLAG_READ ) != 0 )
-	{
-		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
-	}
-	file_io_handle_is_open = libbfio_handle_is_open(
-	                          file_io_handle,
-	                          error );
+	internal_file = (libwtcdb_internal_file_t *) file;
 
-	if( file_io_handle_is_open == -1 )
+	if( io_backend == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to determine if file IO handle is open.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO backend.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	else if( file_io_handle_is_open == 0 )
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
 	{
-		if( libbfio_handle_open(
-		     file_io_handle,
-		     bfio_access_flags,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_OPEN_FAILED,
-			 "%s: unable to open file IO handle.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
 
-			goto on_error;
-		}
-		file_io_handle_opened_in_library = 1;
+		return( -1 );
 	}
-	if( libwtcdb_file_open_read(
-	     internal_file,
-	     file_io_handle,
+#endif
+	if( internal_file->file_io_handle == NULL )
+	{
+		*io_backend = internal_file->requested_io_backend;
+	}
+	else if( internal_file->io_backend == NULL )
+	{
+		*io_backend = LIBWTCDB_IO_BACKEND_BFIO;
+	}
+	else
+	{
+		*io_backend = internal_file->io_backend->type;
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read from file handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	internal_file->file_io_handle                   = file_io_handle;
-	internal_file->file_io_handle_opened_in_library = file_io_handle_opened_in_library;
-
+#endif
 	return( 1 );
-
-on_error:
-	if( file_io_handle_opened_in_library != 0 )
-	{
-		libbfio_handle_close(
-		 file_io_handle,
-		 error );
-	}
-	return( -1 );
 }
 
-/* Closes a file
- * Returns 0 if successful or -1 on error
+/* Sets the requested IO backend
+ * By default io_uring is used when libwtcdb was build with liburing and the kernel
+ * supports it, otherwise pread is used when available and otherwise the reads are
+ * passed to the file IO handle
+ * io_uring and pread are only used when the file is opened by filename without handle pool
+ * The value is used the next time the file is opened
+ * Returns 1 if successful or -1 on error
  */
-int libwtcdb_file_close(
+int libwtcdb_file_set_io_backend(
      libwtcdb_file_t *file,
+     int io_backend,
      libcerror_error_t **error )
 {
 	libwtcdb_internal_file_t *internal_file = NULL;
-	static char *function                   = "libwtcdb_file_close";
-	int result                              = 0;
+	static char *function                   = "libwtcdb_file_set_io_backend";
 
 	if( file == NULL )
 	{
@@ -708,123 +679,139 @@ int libwtcdb_file_close(
 	}
 	internal_file = (libwtcdb_internal_file_t *) file;
 
-	if( internal_file->file_io_handle == NULL )
+	if( ( io_backend != LIBWTCDB_IO_BACKEND_DEFAULT )
+	 && ( io_backend != LIBWTCDB_IO_BACKEND_BFIO )
+	 && ( io_backend != LIBWTCDB_IO_BACKEND_IO_URING )
+	 && ( io_backend != LIBWTCDB_IO_BACKEND_PREAD ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing file IO handle.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported IO backend: %d.",
+		 function,
+		 io_backend );
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
 	{
-		if( internal_file->file_io_handle_created_in_library != 0 )
-		{
-			if( libwtcdb_debug_print_read_offsets(
-			     internal_file->file_io_handle,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-				 "%s: unable to print the read offsets.",
-				 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
 
-				result = -1;
-			}
-		}
+		return( -1 );
 	}
 #endif
-	if( internal_file->file_io_handle_opened_in_library != 0 )
+	internal_file->requested_io_backend = io_backend;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
 	{
-		if( libbfio_handle_close(
-		     internal_file->file_io_handle,
-		     error ) != 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-			 "%s: unable to close file IO handle.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
 
-			result = -1;
-		}
-		internal_file->file_io_handle_opened_in_library = 0;
+		return( -1 );
 	}
-	if( internal_file->file_io_handle_created_in_library != 0 )
+#endif
+	return( 1 );
+}
+
+/* Sets the handle pool
+ * The handle pool bounds the number of file IO handles that are open at the same time,
+ * the file IO handle is closed when idle and reopened on the next read
+ * The handle pool is only used for files opened by filename, which are read
+ * without IO backend and read-ahead. The handle pool is removed if handle_pool is NULL
+ * The value is used the next time the file is opened
+ * and the handle pool must remain valid until the file is closed
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_file_set_handle_pool(
+     libwtcdb_file_t *file,
+     libwtcdb_handle_pool_t *handle_pool,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libwtcdb_file_set_handle_pool";
+
+	if( file == NULL )
 	{
-		if( libbfio_handle_free(
-		     &( internal_file->file_io_handle ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free file IO handle.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
 
-			result = -1;
-		}
-		internal_file->file_io_handle_created_in_library = 0;
+		return( -1 );
 	}
-	internal_file->file_io_handle = NULL;
+	internal_file = (libwtcdb_internal_file_t *) file;
 
-	if( libwtcdb_io_handle_clear(
-	     internal_file->io_handle,
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to clear IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
-		result = -1;
+		return( -1 );
 	}
-	if( libcdata_array_empty(
-	     internal_file->entries,
-	     (int (*)(intptr_t **, libcerror_error_t **)) internal_file->entry_free_function,
+#endif
+	internal_file->handle_pool = handle_pool;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to empty entries array.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		result = -1;
+		return( -1 );
 	}
-	return( result );
+#endif
+	return( 1 );
 }
 
-/* Opens a file for reading
+/* Sets the chunk cache
+ * The chunk cache allows the entries of a previously read version of the file
+ * to be reused for the parts of the file that are the same
+ * The chunk cache is only used for cache files of which all the entries are read
+ * The chunk cache is removed if chunk_cache is NULL
+ * The value is used the next time the file is opened
+ * and the chunk cache must remain valid until the file has been opened
  * Returns 1 if successful or -1 on error
  */
-int libwtcdb_file_open_read(
-     libwtcdb_internal_file_t *internal_file,
-     libbfio_handle_t *file_io_handle,
+int libwtcdb_file_set_chunk_cache(
+     libwtcdb_file_t *file,
+     libwtcdb_chunk_cache_t *chunk_cache,
      libcerror_error_t **error )
 {
-	libwtcdb_file_header_t *file_header = NULL;
-	static char *function               = "libwtcdb_file_open_read";
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	uint8_t *trailing_data              = NULL;
-	size_t first_entry_offset           = 0;
-	size_t trailing_data_size           = 0;
-	ssize_t read_count                  = 0;
-#endif
+	libwtcdb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libwtcdb_file_set_chunk_cache";
 
-	if( internal_file == NULL )
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -835,205 +822,2905 @@ int libwtcdb_file_open_read(
 
 		return( -1 );
 	}
-	if( internal_file->io_handle == NULL )
+	internal_file = (libwtcdb_internal_file_t *) file;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file->io_handle->abort = 0;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "Reading file header:\n" );
-	}
 #endif
-	if( libwtcdb_file_header_initialize(
-	     &file_header,
+	internal_file->chunk_cache = chunk_cache;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file header.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libwtcdb_file_header_read_file_io_handle(
-	     file_header,
-	     file_io_handle,
-	     error ) != 1 )
+#endif
+	return( 1 );
+}
+
+/* Sets the progress callback
+ * The callback reports the progress of reading the entries when the file is opened
+ * and is called at most once per interval in milliseconds, except when the phase changes
+ * The callback can abort opening the file by returning 0
+ * The callback is removed if callback is NULL
+ * The value is used the next time the file is opened
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_file_set_progress_callback(
+     libwtcdb_file_t *file,
+     libwtcdb_progress_callback_t callback,
+     void *user_data,
+     uint32_t interval,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libwtcdb_file_set_progress_callback";
+
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read file header.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	internal_file->io_handle->file_type      = file_header->file_type;
-	internal_file->io_handle->format_version = file_header->format_version;
+	internal_file = (libwtcdb_internal_file_t *) file;
 
-	if( internal_file->io_handle->file_type == LIBWTCDB_FILE_TYPE_CACHE )
-	{
-		internal_file->entry_free_function = (intptr_t *) &libwtcdb_cache_entry_free;
-	}
-	else if( ( internal_file->io_handle->file_type == LIBWTCDB_FILE_TYPE_INDEX_V20 )
-	      || ( internal_file->io_handle->file_type == LIBWTCDB_FILE_TYPE_INDEX_V30 ) )
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
 	{
-		internal_file->entry_free_function = (intptr_t *) &libwtcdb_index_entry_free;
-	}
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_file->progress_callback  = callback;
+	internal_file->progress_user_data = user_data;
+	internal_file->progress_interval  = interval;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the offsets of the cache entries to read
+ * When set, only the cache entries at these offsets are read when a cache file
+ * is opened instead of following the chain of all cache entries, which is
+ * intended for the cache entry offsets of the entries of an index file
+ * Offsets that are outside the file, such as 0xffffffff, are ignored
+ * All cache entries are read if cache_entry_offsets is NULL
+ * The value is used the next time the file is opened
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_file_set_cache_entry_offsets(
+     libwtcdb_file_t *file,
+     const uint32_t *cache_entry_offsets,
+     int number_of_cache_entry_offsets,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_file_t *internal_file = NULL;
+	uint32_t *safe_cache_entry_offsets      = NULL;
+	static char *function                   = "libwtcdb_file_set_cache_entry_offsets";
+	size_t cache_entry_offsets_size         = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libwtcdb_internal_file_t *) file;
+
+	if( cache_entry_offsets != NULL )
+	{
+		if( number_of_cache_entry_offsets < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of cache entry offsets value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		/* Allocate at least one offset so that an empty selection is distinguishable from no selection
+		 */
+		cache_entry_offsets_size = sizeof( uint32_t ) * (size_t) number_of_cache_entry_offsets;
+
+		if( cache_entry_offsets_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid cache entry offsets size value exceeds maximum allocation size.",
+			 function );
+
+			return( -1 );
+		}
+		safe_cache_entry_offsets = (uint32_t *) memory_allocate(
+		                                         cache_entry_offsets_size + sizeof( uint32_t ) );
+
+		if( safe_cache_entry_offsets == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create cache entry offsets.",
+			 function );
+
+			return( -1 );
+		}
+		if( cache_entry_offsets_size > 0 )
+		{
+			if( memory_copy(
+			     safe_cache_entry_offsets,
+			     cache_entry_offsets,
+			     cache_entry_offsets_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy cache entry offsets.",
+				 function );
+
+				memory_free(
+				 safe_cache_entry_offsets );
+
+				return( -1 );
+			}
+		}
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		if( safe_cache_entry_offsets != NULL )
+		{
+			memory_free(
+			 safe_cache_entry_offsets );
+		}
+		return( -1 );
+	}
+#endif
+	if( internal_file->cache_entry_offsets != NULL )
+	{
+		memory_free(
+		 internal_file->cache_entry_offsets );
+	}
+	internal_file->cache_entry_offsets           = safe_cache_entry_offsets;
+	internal_file->number_of_cache_entry_offsets = 0;
+
+	if( safe_cache_entry_offsets != NULL )
+	{
+		internal_file->number_of_cache_entry_offsets = number_of_cache_entry_offsets;
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Opens a file
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_file_open(
+     libwtcdb_file_t *file,
+     const char *filename,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle        = NULL;
+	libwtcdb_internal_file_t *internal_file = NULL;
+	libwtcdb_io_backend_t *io_backend       = NULL;
+	static char *function                   = "libwtcdb_file_open";
+	size_t filename_length                  = 0;
+	int result                              = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libwtcdb_internal_file_t *) file;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBWTCDB_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBWTCDB_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBWTCDB_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( libbfio_handle_set_track_offsets_read(
+	     file_io_handle,
+	     1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set track offsets read in file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+#endif
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set filename in file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+	/* The IO backend holds its own file descriptor hence it is not used with a handle pool
+	 */
+	if( ( internal_file->requested_io_backend != LIBWTCDB_IO_BACKEND_BFIO )
+	 && ( internal_file->handle_pool == NULL ) )
+	{
+		if( libwtcdb_io_backend_initialize(
+		     &io_backend,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create IO backend.",
+			 function );
+
+			goto on_error;
+		}
+		result = libwtcdb_io_backend_open(
+		          io_backend,
+		          filename,
+		          internal_file->requested_io_backend,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open IO backend.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( libwtcdb_io_backend_free(
+			     &io_backend,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free IO backend.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		/* The IO backend must be set before the entries are read
+		 */
+		internal_file->io_backend            = io_backend;
+		internal_file->io_handle->io_backend = io_backend;
+	}
+	if( libwtcdb_internal_file_open_file_io_handle_in_handle_pool(
+	     internal_file,
+	     file_io_handle,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	internal_file->file_io_handle_created_in_library = 1;
+
+	return( 1 );
+
+on_error:
+	internal_file->io_backend            = NULL;
+	internal_file->io_handle->io_backend = NULL;
+
+	if( io_backend != NULL )
+	{
+		libwtcdb_io_backend_free(
+		 &io_backend,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Opens a file
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_file_open_wide(
+     libwtcdb_file_t *file,
+     const wchar_t *filename,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle        = NULL;
+	libwtcdb_internal_file_t *internal_file = NULL;
+	libwtcdb_io_backend_t *io_backend       = NULL;
+	static char *function                   = "libwtcdb_file_open_wide";
+	size_t filename_length                  = 0;
+	int result                              = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libwtcdb_internal_file_t *) file;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBWTCDB_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBWTCDB_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBWTCDB_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libbfio_handle_set_track_offsets_read(
+	     file_io_handle,
+	     1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set track offsets read in file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+#endif
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set filename in file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+	/* The IO backend holds its own file descriptor hence it is not used with a handle pool
+	 */
+	if( ( internal_file->requested_io_backend != LIBWTCDB_IO_BACKEND_BFIO )
+	 && ( internal_file->handle_pool == NULL ) )
+	{
+		if( libwtcdb_io_backend_initialize(
+		     &io_backend,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create IO backend.",
+			 function );
+
+			goto on_error;
+		}
+		result = libwtcdb_io_backend_open_wide(
+		          io_backend,
+		          filename,
+		          internal_file->requested_io_backend,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open IO backend.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( libwtcdb_io_backend_free(
+			     &io_backend,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free IO backend.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		/* The IO backend must be set before the entries are read
+		 */
+		internal_file->io_backend            = io_backend;
+		internal_file->io_handle->io_backend = io_backend;
+	}
+	if( libwtcdb_internal_file_open_file_io_handle_in_handle_pool(
+	     internal_file,
+	     file_io_handle,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %ls.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	internal_file->file_io_handle_created_in_library = 1;
+
+	return( 1 );
+
+on_error:
+	internal_file->io_backend            = NULL;
+	internal_file->io_handle->io_backend = NULL;
+
+	if( io_backend != NULL )
+	{
+		libwtcdb_io_backend_free(
+		 &io_backend,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Opens a file using a Basic File IO (bfio) handle created in the library
+ * If a handle pool is set the file IO handle is registered with the handle pool,
+ * which opens it for reading the entries and closes it when idle
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_internal_file_open_file_io_handle_in_handle_pool(
+     libwtcdb_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	static char *function         = "libwtcdb_internal_file_open_file_io_handle_in_handle_pool";
+	int file_io_handle_is_grabbed = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->handle_pool != NULL )
+	{
+		if( libwtcdb_handle_pool_append_handle(
+		     internal_file->handle_pool,
+		     file_io_handle,
+		     LIBBFIO_ACCESS_FLAG_READ,
+		     &( internal_file->io_handle->handle_pool_entry ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append file IO handle to handle pool.",
+			 function );
+
+			goto on_error;
+		}
+		internal_file->io_handle->handle_pool = internal_file->handle_pool;
+
+		if( libwtcdb_io_handle_grab_file_io_handle(
+		     internal_file->io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to grab file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		file_io_handle_is_grabbed = 1;
+	}
+	if( libwtcdb_file_open_file_io_handle(
+	     (libwtcdb_file_t *) internal_file,
+	     file_io_handle,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_io_handle_is_grabbed != 0 )
+	{
+		file_io_handle_is_grabbed = 0;
+
+		if( libwtcdb_io_handle_release_file_io_handle(
+		     internal_file->io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( internal_file->io_handle->handle_pool_entry != NULL )
+	{
+		if( file_io_handle_is_grabbed != 0 )
+		{
+			libwtcdb_io_handle_release_file_io_handle(
+			 internal_file->io_handle,
+			 NULL );
+		}
+		libwtcdb_handle_pool_remove_handle(
+		 internal_file->io_handle->handle_pool,
+		 &( internal_file->io_handle->handle_pool_entry ),
+		 NULL );
+
+		internal_file->io_handle->handle_pool = NULL;
+	}
+	return( -1 );
+}
+
+/* Opens a file using a Basic File IO (bfio) handle
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_file_open_file_io_handle(
+     libwtcdb_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_file_open_file_io_handle";
+
+	if( libwtcdb_file_open_file_io_handle_with_snapshot(
+	     file,
+	     file_io_handle,
+	     access_flags,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens a file using a Basic File IO (bfio) handle and a previously read snapshot
+ * If snapshot is NULL the entries are read from the file, otherwise a reference
+ * to the snapshot is kept and the entries are shared with the other files using it
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_file_open_file_io_handle_with_snapshot(
+     libwtcdb_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libwtcdb_snapshot_t *snapshot,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_file_t *internal_file  = NULL;
+	static char *function                    = "libwtcdb_file_open_file_io_handle_with_snapshot";
+	uint8_t file_io_handle_opened_in_library = 0;
+	int bfio_access_flags                    = 0;
+	int file_io_handle_is_open               = 0;
+	int result                               = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libwtcdb_internal_file_t *) file;
+
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBWTCDB_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBWTCDB_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBWTCDB_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBWTCDB_ACCESS_FLAG_READ ) != 0 )
+	{
+		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     bfio_access_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		file_io_handle_opened_in_library = 1;
+	}
+	if( snapshot == NULL )
+	{
+		result = libwtcdb_file_open_read(
+		          internal_file,
+		          file_io_handle,
+		          error );
+	}
+	else
+	{
+		result = libwtcdb_file_open_read_with_snapshot(
+		          internal_file,
+		          file_io_handle,
+		          (libwtcdb_internal_snapshot_t *) snapshot,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from file handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	/* Only cache file entries contain cached data, the read-ahead is not used
+	 * with a handle pool since its helper thread keeps the file IO handle busy
+	 */
+	if( ( internal_file->number_of_read_ahead_items > 0 )
+	 && ( internal_file->io_handle->file_type == LIBWTCDB_FILE_TYPE_CACHE )
+	 && ( internal_file->io_handle->handle_pool_entry == NULL ) )
+	{
+		if( libwtcdb_read_ahead_initialize(
+		     &( internal_file->read_ahead ),
+		     internal_file->io_handle->io_backend,
+		     file_io_handle,
+		     internal_file->snapshot->entries,
+		     internal_file->number_of_read_ahead_items,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create read-ahead.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_file->file_io_handle                   = file_io_handle;
+	internal_file->file_io_handle_opened_in_library = file_io_handle_opened_in_library;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( internal_file->read_ahead != NULL )
+	{
+		libwtcdb_read_ahead_free(
+		 &( internal_file->read_ahead ),
+		 NULL );
+	}
+#endif
+	if( internal_file->snapshot != NULL )
+	{
+		libwtcdb_snapshot_free(
+		 (libwtcdb_snapshot_t **) &( internal_file->snapshot ),
+		 NULL );
+	}
+	if( file_io_handle_opened_in_library != 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 error );
+	}
+	return( -1 );
+}
+
+/* Closes a file
+ * Returns 0 if successful or -1 on error
+ */
+int libwtcdb_file_close(
+     libwtcdb_file_t *file,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libwtcdb_file_close";
+	int result                              = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libwtcdb_internal_file_t *) file;
+
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+	/* The read-ahead is freed first since its helper thread reads from the file IO handle
+	 */
+	if( internal_file->read_ahead != NULL )
+	{
+		if( libwtcdb_read_ahead_free(
+		     &( internal_file->read_ahead ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read-ahead.",
+			 function );
+
+			result = -1;
+		}
+	}
+#endif
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( internal_file->file_io_handle_created_in_library != 0 )
+		{
+			if( libwtcdb_debug_print_read_offsets(
+			     internal_file->file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print the read offsets.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+#endif
+	/* Removing the file IO handle from the handle pool closes it if open
+	 */
+	if( internal_file->io_handle->handle_pool_entry != NULL )
+	{
+		if( libwtcdb_handle_pool_remove_handle(
+		     internal_file->io_handle->handle_pool,
+		     &( internal_file->io_handle->handle_pool_entry ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove file IO handle from handle pool.",
+			 function );
+
+			result = -1;
+		}
+		internal_file->io_handle->handle_pool = NULL;
+	}
+	if( internal_file->file_io_handle_opened_in_library != 0 )
+	{
+		if( libbfio_handle_close(
+		     internal_file->file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		internal_file->file_io_handle_opened_in_library = 0;
+	}
+	if( internal_file->file_io_handle_created_in_library != 0 )
+	{
+		if( libbfio_handle_free(
+		     &( internal_file->file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		internal_file->file_io_handle_created_in_library = 0;
+	}
+	internal_file->file_io_handle = NULL;
+
+	if( internal_file->io_backend != NULL )
+	{
+		if( libwtcdb_io_backend_free(
+		     &( internal_file->io_backend ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free IO backend.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libwtcdb_io_handle_clear(
+	     internal_file->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear IO handle.",
+		 function );
+
+		result = -1;
+	}
+	if( libwtcdb_snapshot_free(
+	     (libwtcdb_snapshot_t **) &( internal_file->snapshot ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free snapshot.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Opens a file for reading
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_file_open_read(
+     libwtcdb_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libwtcdb_chunk_cache_source_t *chunk_cache_source = NULL;
+	libwtcdb_file_header_t *file_header               = NULL;
+	libwtcdb_internal_snapshot_t *snapshot            = NULL;
+	libwtcdb_progress_t *progress                     = NULL;
+	static char *function                             = "libwtcdb_file_open_read";
+	int number_of_reused_entries                      = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint8_t *trailing_data                            = NULL;
+	size_t first_entry_offset                         = 0;
+	size_t trailing_data_size                         = 0;
+	ssize_t read_count                                = 0;
+#endif
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->snapshot != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - snapshot value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file->io_handle->abort = 0;
+
+	if( libwtcdb_snapshot_initialize(
+	     &snapshot,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create snapshot.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &( snapshot->file_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_file->progress_callback != NULL )
+	{
+		if( libwtcdb_progress_initialize(
+		     &progress,
+		     internal_file->progress_callback,
+		     internal_file->progress_user_data,
+		     internal_file->progress_interval,
+		     (uint64_t) snapshot->file_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create progress.",
+			 function );
+
+			goto on_error;
+		}
+		internal_file->io_handle->progress = progress;
+	}
+	if( libwtcdb_io_handle_set_progress_phase(
+	     internal_file->io_handle,
+	     LIBWTCDB_PROGRESS_PHASE_READ_FILE_HEADER,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set progress phase.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading file header:\n" );
+	}
+#endif
+	if( libwtcdb_file_header_initialize(
+	     &file_header,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( libwtcdb_file_header_read_file_io_handle(
+	     file_header,
+	     internal_file->io_handle->io_backend,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		goto on_error;
+	}
+	internal_file->io_handle->file_type      = file_header->file_type;
+	internal_file->io_handle->format_version = file_header->format_version;
+
+	snapshot->file_type      = file_header->file_type;
+	snapshot->format_version = file_header->format_version;
+
+	if( snapshot->file_type == LIBWTCDB_FILE_TYPE_CACHE )
+	{
+		snapshot->entry_free_function = (intptr_t *) &libwtcdb_cache_entry_free;
+	}
+	else if( ( snapshot->file_type == LIBWTCDB_FILE_TYPE_INDEX_V20 )
+	      || ( snapshot->file_type == LIBWTCDB_FILE_TYPE_INDEX_V30 ) )
+	{
+		snapshot->entry_free_function = (intptr_t *) &libwtcdb_index_entry_free;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( ( internal_file->io_handle->file_type == LIBWTCDB_FILE_TYPE_CACHE )
+		 || ( internal_file->io_handle->file_type == LIBWTCDB_FILE_TYPE_INDEX_V20 ) )
+		{
+			first_entry_offset = 24;
+		}
+		else if( internal_file->io_handle->file_type == LIBWTCDB_FILE_TYPE_INDEX_V30 )
+		{
+			first_entry_offset = 32;
+		}
+		if( file_header->first_entry_offset > first_entry_offset )
+		{
+			trailing_data_size = (size_t) ( file_header->first_entry_offset - first_entry_offset );
+
+			trailing_data = (uint8_t *) memory_allocate(
+			                             sizeof( uint8_t ) * trailing_data_size );
+
+			if( trailing_data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create trailing data.",
+				 function );
+
+				goto on_error;
+			}
+			read_count = libwtcdb_io_backend_read_buffer_at_offset(
+			              internal_file->io_backend,
+			              file_io_handle,
+			              trailing_data,
+			              trailing_data_size,
+			              (off64_t) first_entry_offset,
+			              error );
+
+			if( read_count != (ssize_t) trailing_data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read trailing data at offset: %" PRIzd " (0x%08" PRIzx ").",
+				 function,
+				 first_entry_offset,
+				 first_entry_offset );
+
+				goto on_error;
+			}
+			libcnotify_printf(
+			 "%s: trailing data:\n",
+			 function );
+			libcnotify_print_data(
+			 trailing_data,
+			 trailing_data_size,
+			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+
+			memory_free(
+			 trailing_data );
+
+			trailing_data = NULL;
+		}
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading entries:\n" );
+	}
+#endif
+	/* The chunk cache is only used when all the cache entries are read
+	 */
+	if( ( internal_file->chunk_cache != NULL )
+	 && ( snapshot->file_type == LIBWTCDB_FILE_TYPE_CACHE )
+	 && ( internal_file->cache_entry_offsets == NULL ) )
+	{
+		if( libwtcdb_chunk_cache_create_source(
+		     internal_file->chunk_cache,
+		     internal_file->io_handle->io_backend,
+		     file_io_handle,
+		     snapshot->file_type,
+		     snapshot->format_version,
+		     &chunk_cache_source,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create chunk cache source.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libwtcdb_file_read_entries(
+	     internal_file,
+	     file_io_handle,
+	     file_header->first_entry_offset,
+	     chunk_cache_source,
+	     snapshot->entries,
+	     &number_of_reused_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( chunk_cache_source != NULL )
+	{
+		if( libwtcdb_chunk_cache_append_source(
+		     internal_file->chunk_cache,
+		     &chunk_cache_source,
+		     snapshot,
+		     number_of_reused_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append chunk cache source.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libwtcdb_file_header_free(
+	     &file_header,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( libwtcdb_io_handle_set_progress_phase(
+	     internal_file->io_handle,
+	     LIBWTCDB_PROGRESS_PHASE_COMPLETED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set progress phase.",
+		 function );
+
+		goto on_error;
+	}
+	internal_file->io_handle->progress = NULL;
+
+	if( progress != NULL )
+	{
+		if( libwtcdb_progress_free(
+		     &progress,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free progress.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_file->snapshot = snapshot;
+
+	internal_file->io_handle->abort = 0;
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( trailing_data != NULL )
+	{
+		memory_free(
+		 trailing_data );
+	}
+#endif
+	if( chunk_cache_source != NULL )
+	{
+		libwtcdb_chunk_cache_release_source(
+		 internal_file->chunk_cache,
+		 &chunk_cache_source,
+		 NULL );
+	}
+	if( file_header != NULL )
+	{
+		libwtcdb_file_header_free(
+		 &file_header,
+		 NULL );
+	}
+	if( snapshot != NULL )
+	{
+		libwtcdb_snapshot_free(
+		 (libwtcdb_snapshot_t **) &snapshot,
+		 NULL );
+	}
+	internal_file->io_handle->progress = NULL;
+
+	if( progress != NULL )
+	{
+		libwtcdb_progress_free(
+		 &progress,
+		 NULL );
+	}
+	internal_file->io_handle->abort = 0;
+
+	return( -1 );
+}
+
+/* Opens a file for reading using a previously read snapshot
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_file_open_read_with_snapshot(
+     libwtcdb_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libwtcdb_internal_snapshot_t *snapshot,
+     libcerror_error_t **error )
+{
+	libwtcdb_file_header_t *file_header = NULL;
+	static char *function               = "libwtcdb_file_open_read_with_snapshot";
+	size64_t file_size                  = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->snapshot != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - snapshot value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( snapshot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid snapshot.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libwtcdb_file_header_initialize(
+	     &file_header,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( libwtcdb_file_header_read_file_io_handle(
+	     file_header,
+	     internal_file->io_handle->io_backend,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( file_size != snapshot->file_size )
+	 || ( file_header->file_type != snapshot->file_type )
+	 || ( file_header->format_version != snapshot->format_version ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: snapshot does not match file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libwtcdb_file_header_free(
+	     &file_header,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( libwtcdb_snapshot_add_reference(
+	     snapshot,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to add reference to snapshot.",
+		 function );
+
+		goto on_error;
+	}
+	internal_file->io_handle->file_type      = snapshot->file_type;
+	internal_file->io_handle->format_version = snapshot->format_version;
+	internal_file->snapshot                  = snapshot;
+
+	return( 1 );
+
+on_error:
+	if( file_header != NULL )
+	{
+		libwtcdb_file_header_free(
+		 &file_header,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the entries into the entries array
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_file_read_entries(
+     libwtcdb_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     uint32_t first_entry_offset,
+     libwtcdb_chunk_cache_source_t *chunk_cache_source,
+     libcdata_array_t *entries_array,
+     int *number_of_reused_entries,
+     libcerror_error_t **error )
+{
+	libwtcdb_entries_reader_t *entries_reader = NULL;
+	static char *function                     = "libwtcdb_file_read_entries";
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file->io_handle->file_type != LIBWTCDB_FILE_TYPE_CACHE )
+	 && ( internal_file->io_handle->file_type != LIBWTCDB_FILE_TYPE_INDEX_V20 )
+	 && ( internal_file->io_handle->file_type != LIBWTCDB_FILE_TYPE_INDEX_V30 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported file type.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_reused_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of reused entries.",
+		 function );
+
+		return( -1 );
+	}
+	/* The entries are read in two passes, first the cache entry offsets or the number
+	 * of index entries are determined and then the entries are read, optionally by
+	 * multiple threads
+	 */
+	if( libwtcdb_entries_reader_initialize(
+	     &entries_reader,
+	     internal_file->io_handle,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create entries reader.",
+		 function );
+
+		goto on_error;
+	}
+	entries_reader->chunk_cache_source = chunk_cache_source;
+
+	if( libwtcdb_io_handle_set_progress_phase(
+	     internal_file->io_handle,
+	     LIBWTCDB_PROGRESS_PHASE_SCAN_ENTRIES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set progress phase.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( internal_file->io_handle->file_type == LIBWTCDB_FILE_TYPE_CACHE )
+	 && ( internal_file->cache_entry_offsets != NULL ) )
+	{
+		if( libwtcdb_entries_reader_set_cache_entry_offsets(
+		     entries_reader,
+		     first_entry_offset,
+		     internal_file->cache_entry_offsets,
+		     internal_file->number_of_cache_entry_offsets,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set cache entry offsets.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else if( internal_file->io_handle->file_type == LIBWTCDB_FILE_TYPE_CACHE )
+	{
+		if( libwtcdb_entries_reader_read_cache_entry_offsets(
+		     entries_reader,
+		     first_entry_offset,
+		     internal_file->maximum_number_of_threads,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read cache entry offsets.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( libwtcdb_entries_reader_determine_number_of_index_entries(
+		     entries_reader,
+		     first_entry_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine number of index entries.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libwtcdb_io_handle_set_progress_phase(
+	     internal_file->io_handle,
+	     LIBWTCDB_PROGRESS_PHASE_READ_ENTRIES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set progress phase.",
+		 function );
+
+		goto on_error;
+	}
+	if( libwtcdb_entries_reader_read_entries(
+	     entries_reader,
+	     internal_file->maximum_number_of_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( libwtcdb_entries_reader_append_entries(
+	     entries_reader,
+	     entries_array,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append entries to array.",
+		 function );
+
+		goto on_error;
+	}
+	*number_of_reused_entries = entries_reader->number_of_reused_entries;
+
+	if( libwtcdb_entries_reader_free(
+	     &entries_reader,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free entries reader.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( entries_reader != NULL )
+	{
+		libwtcdb_entries_reader_free(
+		 &entries_reader,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the snapshot
+ * The snapshot contains the entries read from the file and can be used to open
+ * the same file with other file IO handles without reading the entries again
+ * The returned snapshot must be freed with libwtcdb_snapshot_free
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libwtcdb_file_get_snapshot(
+     libwtcdb_file_t *file,
+     libwtcdb_snapshot_t **snapshot,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libwtcdb_file_get_snapshot";
+	int result                              = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libwtcdb_internal_file_t *) file;
+
+	if( snapshot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid snapshot.",
+		 function );
+
+		return( -1 );
+	}
+	if( *snapshot != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid snapshot value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file->snapshot != NULL )
+	{
+		result = libwtcdb_snapshot_add_reference(
+		          internal_file->snapshot,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add reference to snapshot.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			*snapshot = (libwtcdb_snapshot_t *) internal_file->snapshot;
+		}
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the file type
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_file_get_type(
+     libwtcdb_file_t *file,
+     uint8_t *type,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libwtcdb_file_get_type";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libwtcdb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid type.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*type = internal_file->io_handle->file_type;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the number of items
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_file_get_number_of_items(
+     libwtcdb_file_t *file,
+     int *number_of_items,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libwtcdb_file_get_number_of_items";
+	int result                              = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libwtcdb_internal_file_t *) file;
+
+	if( number_of_items == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of items.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file->snapshot == NULL )
+	{
+		*number_of_items = 0;
+	}
+	else if( libcdata_array_get_number_of_entries(
+	          internal_file->snapshot->entries,
+	          number_of_items,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from array.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a specific item
+ * This function expects the read/write lock of the file to be grabbed for reading
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_internal_file_get_item(
+     libwtcdb_internal_file_t *internal_file,
+     int item_index,
+     libwtcdb_item_t **item,
+     libcerror_error_t **error )
+{
+	intptr_t *entry       = NULL;
+	static char *function = "libwtcdb_internal_file_get_item";
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->snapshot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing snapshot.",
+		 function );
+
+		return( -1 );
+	}
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_file->snapshot->entries,
+	     item_index,
+	     &entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry: %d.",
+		 function,
+		 item_index );
+
+		return( -1 );
+	}
+	if( libwtcdb_item_initialize(
+	     item,
+	     internal_file->io_handle,
+	     internal_file->file_io_handle,
+	     entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create item.",
+		 function );
+
+		return( -1 );
+	}
+	( (libwtcdb_internal_item_t *) *item )->item_index = item_index;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( internal_file->read_ahead != NULL )
+	{
+		if( libwtcdb_read_ahead_set_position(
+		     internal_file->read_ahead,
+		     item_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set read-ahead position.",
+			 function );
+
+			libwtcdb_item_free(
+			 item,
+			 NULL );
+
+			return( -1 );
+		}
+		( (libwtcdb_internal_item_t *) *item )->read_ahead = internal_file->read_ahead;
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves a specific item
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_file_get_item(
+     libwtcdb_file_t *file,
+     int item_index,
+     libwtcdb_item_t **item,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libwtcdb_file_get_item";
+	int result                              = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libwtcdb_internal_file_t *) file;
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libwtcdb_internal_file_get_item(
+	     internal_file,
+	     item_index,
+	     item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve item: %d.",
+		 function,
+		 item_index );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a specific item from the entries of a snapshot of the file
+ * The snapshot must still be the snapshot of the file, since the data
+ * of the item is read from the file
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_file_get_snapshot_item(
+     libwtcdb_file_t *file,
+     libwtcdb_internal_snapshot_t *snapshot,
+     int item_index,
+     libwtcdb_item_t **item,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_file_t *internal_file = NULL;
+	intptr_t *entry                         = NULL;
+	static char *function                   = "libwtcdb_file_get_snapshot_item";
+	int result                              = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libwtcdb_internal_file_t *) file;
+
+	if( snapshot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid snapshot.",
+		 function );
+
+		return( -1 );
+	}
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file->snapshot != snapshot )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid snapshot - file was closed or reopened.",
+		 function );
+
+		result = -1;
+	}
+	else if( libcdata_array_get_entry_by_index(
+	          snapshot->entries,
+	          item_index,
+	          &entry,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry: %d.",
+		 function,
+		 item_index );
+
+		result = -1;
+	}
+	else if( libwtcdb_item_initialize(
+	          item,
+	          internal_file->io_handle,
+	          internal_file->file_io_handle,
+	          entry,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create item.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		( (libwtcdb_internal_item_t *) *item )->item_index = item_index;
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
 	{
-		if( ( internal_file->io_handle->file_type == LIBWTCDB_FILE_TYPE_CACHE )
-		 || ( internal_file->io_handle->file_type == LIBWTCDB_FILE_TYPE_INDEX_V20 ) )
-		{
-			first_entry_offset = 24;
-		}
-		else if( internal_file->io_handle->file_type == LIBWTCDB_FILE_TYPE_INDEX_V30 )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		if( *item != NULL )
 		{
-			first_entry_offset = 32;
+			libwtcdb_item_free(
+			 item,
+			 NULL );
 		}
-		if( file_header->first_entry_offset > first_entry_offset )
-		{
-			trailing_data_size = (size_t) ( file_header->first_entry_offset - first_entry_offset );
+		return( -1 );
+	}
+#endif
+	return( result );
+}
 
-			trailing_data = (uint8_t *) memory_allocate(
-			                             sizeof( uint8_t ) * trailing_data_size );
+/* Retrieves the index of the entry at a specific file offset
+ * The entries of a cache file are stored in order of their file offset
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libwtcdb_internal_file_get_entry_index_by_offset(
+     libwtcdb_internal_file_t *internal_file,
+     off64_t file_offset,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	libwtcdb_cache_entry_t *cache_entry = NULL;
+	static char *function               = "libwtcdb_internal_file_get_entry_index_by_offset";
+	int first_entry_index               = 0;
+	int last_entry_index                = 0;
+	int middle_entry_index              = 0;
+	int number_of_entries               = 0;
 
-			if( trailing_data == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create trailing data.",
-				 function );
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
 
-				goto on_error;
-			}
-			read_count = libbfio_handle_read_buffer(
-				      file_io_handle,
-				      trailing_data,
-				      trailing_data_size,
-				      error );
+		return( -1 );
+	}
+	if( internal_file->snapshot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing snapshot.",
+		 function );
 
-			if( read_count != (ssize_t) trailing_data_size )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read trailing data.",
-				 function );
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
 
-				goto on_error;
-			}
-			libcnotify_printf(
-			 "%s: trailing data:\n",
-			 function );
-			libcnotify_print_data(
-			 trailing_data,
-			 trailing_data_size,
-			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+		return( -1 );
+	}
+	if( internal_file->snapshot->file_type != LIBWTCDB_FILE_TYPE_CACHE )
+	{
+		return( 0 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->snapshot->entries,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
 
-			memory_free(
-			 trailing_data );
+		return( -1 );
+	}
+	last_entry_index = number_of_entries - 1;
 
-			trailing_data = NULL;
+	while( first_entry_index <= last_entry_index )
+	{
+		middle_entry_index = first_entry_index + ( ( last_entry_index - first_entry_index ) / 2 );
+
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->snapshot->entries,
+		     middle_entry_index,
+		     (intptr_t **) &cache_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry: %d.",
+			 function,
+			 middle_entry_index );
+
+			return( -1 );
+		}
+		if( cache_entry == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing entry: %d.",
+			 function,
+			 middle_entry_index );
+
+			return( -1 );
+		}
+		if( cache_entry->file_offset == file_offset )
+		{
+			*entry_index = middle_entry_index;
+
+			return( 1 );
+		}
+		if( cache_entry->file_offset < file_offset )
+		{
+			first_entry_index = middle_entry_index + 1;
+		}
+		else
+		{
+			last_entry_index = middle_entry_index - 1;
 		}
 	}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+	return( 0 );
+}
 
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+/* Retrieves the item of the cache entry at a specific file offset
+ * This is used to resolve the cache entry offsets of an index file entry
+ * Returns 1 if successful, 0 if no such item or -1 on error
+ */
+int libwtcdb_file_get_item_by_offset(
+     libwtcdb_file_t *file,
+     off64_t file_offset,
+     libwtcdb_item_t **item,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libwtcdb_file_get_item_by_offset";
+	int entry_index                         = 0;
+	int result                              = 0;
+
+	if( file == NULL )
 	{
-		libcnotify_printf(
-		 "Reading entries:\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
 	}
-#endif
-	if( libwtcdb_file_read_entries(
-	     internal_file,
-	     file_io_handle,
-	     file_header->first_entry_offset,
-	     error ) != 1 )
+	internal_file = (libwtcdb_internal_file_t *) file;
+
+	if( item == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read entries.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libwtcdb_file_header_free(
-	     &file_header,
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free file header.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	internal_file->io_handle->abort = 0;
-
-	return( 1 );
+#endif
+	result = libwtcdb_internal_file_get_entry_index_by_offset(
+	          internal_file,
+	          file_offset,
+	          &entry_index,
+	          error );
 
-on_error:
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( trailing_data != NULL )
+	if( result == -1 )
 	{
-		memory_free(
-		 trailing_data );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry index at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
 	}
-#endif
-	if( file_header != NULL )
+	/* The item is created while the read/write lock is held, hence the entry
+	 * at the index cannot be changed between the lookup and the creation
+	 */
+	else if( result != 0 )
 	{
-		libwtcdb_file_header_free(
-		 &file_header,
-		 NULL );
+		if( libwtcdb_internal_file_get_item(
+		     internal_file,
+		     entry_index,
+		     item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve item: %d.",
+			 function,
+			 entry_index );
+
+			result = -1;
+		}
 	}
-	internal_file->io_handle->abort = 0;
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
 
-	return( -1 );
+		return( -1 );
+	}
+#endif
+	return( result );
 }
 
-/* Reads the entries into the entries array
+/* Runs the item workers
  * Returns 1 if successful or -1 on error
  */
-int libwtcdb_file_read_entries(
+int libwtcdb_file_run_item_workers(
      libwtcdb_internal_file_t *internal_file,
-     libbfio_handle_t *file_io_handle,
-     uint32_t first_entry_offset,
+     libwtcdb_item_callback_t callback,
+     void *user_data,
+     int number_of_workers,
+     const libwtcdb_parallel_options_t *options,
      libcerror_error_t **error )
 {
-	libwtcdb_cache_entry_t *cache_entry = NULL;
-	libwtcdb_index_entry_t *index_entry = NULL;
-	static char *function               = "libwtcdb_file_read_entries";
-	off64_t file_offset                 = 0;
-	size64_t file_size                  = 0;
-	int entry_index                     = 0;
-	int entry_iterator                  = 0;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	const char *type_string             = NULL;
+	libwtcdb_item_worker_t *item_workers = NULL;
+	static char *function                = "libwtcdb_file_run_item_workers";
+	int first_item_index                 = 0;
+	int number_of_items                  = 0;
+	int number_of_submitted_workers      = 0;
+	int result                           = 1;
+	int stop                             = 0;
+	int worker_index                     = 0;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_t *stop_mutex        = NULL;
+	libcthreads_thread_pool_t *thread_pool = NULL;
 #endif
 
 	if( internal_file == NULL )
@@ -1047,296 +3734,329 @@ int libwtcdb_file_read_entries(
 
 		return( -1 );
 	}
-	if( internal_file->io_handle == NULL )
+	if( internal_file->snapshot == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 "%s: invalid file - missing snapshot.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( internal_file->io_handle->file_type != LIBWTCDB_FILE_TYPE_CACHE )
-	 && ( internal_file->io_handle->file_type != LIBWTCDB_FILE_TYPE_INDEX_V20 )
-	 && ( internal_file->io_handle->file_type != LIBWTCDB_FILE_TYPE_INDEX_V30 ) )
+	if( ( number_of_workers < 1 )
+	 || ( number_of_workers > LIBWTCDB_MAXIMUM_NUMBER_OF_THREADS ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported file type.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of workers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->snapshot->entries,
+	     &number_of_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from array.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_items == 0 )
+	{
+		return( 1 );
+	}
+	if( number_of_workers > number_of_items )
+	{
+		number_of_workers = number_of_items;
+	}
+	item_workers = (libwtcdb_item_worker_t *) memory_allocate(
+	                                           sizeof( libwtcdb_item_worker_t ) * (size_t) number_of_workers );
+
+	if( item_workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create item workers.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     item_workers,
+	     0,
+	     sizeof( libwtcdb_item_worker_t ) * (size_t) number_of_workers ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear item workers.",
 		 function );
 
+		memory_free(
+		 item_workers );
+
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( internal_file->io_handle->file_type == LIBWTCDB_FILE_TYPE_CACHE )
-	{
-		type_string = "cache";
-	}
-	else if( internal_file->io_handle->file_type == LIBWTCDB_FILE_TYPE_INDEX_V20 )
-	{
-		type_string = "index (v20)";
-	}
-	else if( internal_file->io_handle->file_type == LIBWTCDB_FILE_TYPE_INDEX_V30 )
-	{
-		type_string = "index (v30)";
-	}
-#endif
-	if( libbfio_handle_get_size(
-	     file_io_handle,
-	     &file_size,
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	/* The workers can run concurrently when run by an executor or a thread pool
+	 */
+	if( libcthreads_mutex_initialize(
+	     &stop_mutex,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file size.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize stop mutex.",
 		 function );
 
-		goto on_error;
-	}
-	file_offset = (off64_t) first_entry_offset;
+		memory_free(
+		 item_workers );
 
-	while( (size64_t) file_offset < file_size )
+		return( -1 );
+	}
+#endif
+	/* Divide the items in contiguous ranges where the first workers
+	 * process 1 item more if the items cannot be divided equally
+	 */
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		item_workers[ worker_index ].io_handle        = internal_file->io_handle;
+		item_workers[ worker_index ].file_io_handle   = internal_file->file_io_handle;
+		item_workers[ worker_index ].entries          = internal_file->snapshot->entries;
+		item_workers[ worker_index ].first_item_index = first_item_index;
+		item_workers[ worker_index ].number_of_items  = number_of_items / number_of_workers;
+		item_workers[ worker_index ].worker_index     = worker_index;
+		item_workers[ worker_index ].callback         = callback;
+		item_workers[ worker_index ].user_data        = user_data;
+		item_workers[ worker_index ].stop             = &stop;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+		item_workers[ worker_index ].stop_mutex = stop_mutex;
+#endif
+
+		if( worker_index < ( number_of_items % number_of_workers ) )
 		{
-			libcnotify_printf(
-			 "%s: reading %s entry: %d at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
-			 function,
-			 type_string,
-			 entry_iterator,
-			 file_offset,
-			 file_offset );
+			item_workers[ worker_index ].number_of_items += 1;
 		}
-#endif
-		if( internal_file->io_handle->file_type == LIBWTCDB_FILE_TYPE_CACHE )
+		first_item_index += item_workers[ worker_index ].number_of_items;
+	}
+	if( ( options != NULL )
+	 && ( options->executor_submit != NULL ) )
+	{
+		for( worker_index = 0;
+		     worker_index < number_of_workers;
+		     worker_index++ )
 		{
-			if( libwtcdb_cache_entry_initialize(
-			     &cache_entry,
-			     error ) != 1 )
+			if( options->executor_submit(
+			     &libwtcdb_item_worker_task_function,
+			     (void *) &( item_workers[ worker_index ] ),
+			     options->executor_data ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create cache entry.",
-				 function );
-
-				goto on_error;
-			}
-			if( libwtcdb_cache_entry_read_file_io_handle(
-			     cache_entry,
-			     internal_file->io_handle,
-			     file_io_handle,
-			     file_offset,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read cache entry: %d.",
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to submit item worker: %d to executor.",
 				 function,
-				 entry_iterator );
+				 worker_index );
 
-				goto on_error;
-			}
-			file_offset += (size_t) cache_entry->data_size;
+				/* Signal the workers that were already started to stop
+				 */
+				libwtcdb_item_worker_set_stop(
+				 &( item_workers[ 0 ] ),
+				 NULL );
 
-			if( cache_entry->hash == 0 )
-			{
-				if( libwtcdb_cache_entry_free(
-				     &cache_entry,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-					 "%s: unable to free cache entry.",
-					 function );
+				result = -1;
 
-					goto on_error;
-				}
+				break;
 			}
-			else
+			number_of_submitted_workers++;
+		}
+		/* The submitted workers must have completed before the item workers can be freed
+		 */
+		if( number_of_submitted_workers > 0 )
+		{
+			if( options->executor_wait(
+			     options->executor_data ) != 1 )
 			{
-				if( libcdata_array_append_entry(
-				     internal_file->entries,
-				     &entry_index,
-				     (intptr_t *) cache_entry,
-				     error ) != 1 )
+				if( result == 1 )
 				{
 					libcerror_error_set(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-					 "%s: unable to append cache entry to array.",
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to wait for executor.",
 					 function );
-
-					goto on_error;
 				}
-				cache_entry = NULL;
+				result = -1;
 			}
 		}
-		else if( ( internal_file->io_handle->file_type == LIBWTCDB_FILE_TYPE_INDEX_V20 )
-		      || ( internal_file->io_handle->file_type == LIBWTCDB_FILE_TYPE_INDEX_V30 ) )
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	else if( number_of_workers > 1 )
+	{
+		if( libcthreads_thread_pool_create(
+		     &thread_pool,
+		     NULL,
+		     number_of_workers,
+		     number_of_workers,
+		     (int (*)(intptr_t *, void *)) &libwtcdb_item_worker_thread_pool_callback,
+		     NULL,
+		     error ) != 1 )
 		{
-			if( libwtcdb_index_entry_initialize(
-			     &index_entry,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create index entry.",
-				 function );
-
-				goto on_error;
-			}
-			if( libwtcdb_index_entry_read_file_io_handle(
-			     index_entry,
-			     internal_file->io_handle,
-			     file_io_handle,
-			     file_offset,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read index entry: %d.",
-				 function,
-				 entry_iterator );
-
-				goto on_error;
-			}
-			file_offset += (size_t) index_entry->data_size;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
 
-			if( index_entry->hash == 0 )
+			result = -1;
+		}
+		else
+		{
+			for( worker_index = 0;
+			     worker_index < number_of_workers;
+			     worker_index++ )
 			{
-				if( libwtcdb_index_entry_free(
-				     &index_entry,
+				if( libcthreads_thread_pool_push(
+				     thread_pool,
+				     (intptr_t *) &( item_workers[ worker_index ] ),
 				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-					 "%s: unable to free index entry.",
-					 function );
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to push item worker: %d onto thread pool.",
+					 function,
+					 worker_index );
 
-					goto on_error;
+					/* Signal the workers that were already started to stop
+					 */
+					libwtcdb_item_worker_set_stop(
+					 &( item_workers[ 0 ] ),
+					 NULL );
+
+					result = -1;
+
+					break;
 				}
 			}
-			else
+			if( libcthreads_thread_pool_join(
+			     &thread_pool,
+			     NULL ) != 1 )
 			{
-				if( libcdata_array_append_entry(
-				     internal_file->entries,
-				     &entry_index,
-				     (intptr_t *) index_entry,
-				     error ) != 1 )
+				if( result == 1 )
 				{
 					libcerror_error_set(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-					 "%s: unable to append index entry to array.",
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to join thread pool.",
 					 function );
-
-					goto on_error;
 				}
-				index_entry = NULL;
+				result = -1;
 			}
 		}
-		entry_iterator++;
-	}
-	return( 1 );
-
-on_error:
-	if( index_entry != NULL )
-	{
-		libwtcdb_index_entry_free(
-		 &index_entry,
-		 NULL );
 	}
-	if( cache_entry != NULL )
+#endif /* defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT ) */
+	else
 	{
-		libwtcdb_cache_entry_free(
-		 &cache_entry,
-		 NULL );
+		for( worker_index = 0;
+		     worker_index < number_of_workers;
+		     worker_index++ )
+		{
+			libwtcdb_item_worker_task_function(
+			 (void *) &( item_workers[ worker_index ] ) );
+		}
 	}
-	return( -1 );
-}
-
-/* Retrieves the file type
- * Returns 1 if successful or -1 on error
- */
-int libwtcdb_file_get_type(
-     libwtcdb_file_t *file,
-     uint8_t *type,
-     libcerror_error_t **error )
-{
-	libwtcdb_internal_file_t *internal_file = NULL;
-	static char *function                   = "libwtcdb_file_get_type";
-
-	if( file == NULL )
+	/* Keep the error of the first worker that failed
+	 */
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
-		 function );
-
-		return( -1 );
-	}
-	internal_file = (libwtcdb_internal_file_t *) file;
+		if( item_workers[ worker_index ].result == -1 )
+		{
+			if( ( result == 1 )
+			 && ( error != NULL )
+			 && ( *error == NULL ) )
+			{
+				*error = item_workers[ worker_index ].error;
 
-	if( internal_file->io_handle == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
-		 function );
+				item_workers[ worker_index ].error = NULL;
 
-		return( -1 );
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: item worker: %d failed.",
+				 function,
+				 worker_index );
+			}
+			result = -1;
+		}
+		if( item_workers[ worker_index ].error != NULL )
+		{
+			libcerror_error_free(
+			 &( item_workers[ worker_index ].error ) );
+		}
 	}
-	if( type == NULL )
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_free(
+	     &stop_mutex,
+	     error ) != 1 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid type.",
-		 function );
-
-		return( -1 );
+		if( result == 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free stop mutex.",
+			 function );
+		}
+		result = -1;
 	}
-	*type = internal_file->io_handle->file_type;
+#endif
+	memory_free(
+	 item_workers );
 
-	return( 1 );
+	return( result );
 }
 
-/* Retrieves the number of items
+/* Calls the callback for every item using multiple workers
  * Returns 1 if successful or -1 on error
  */
-int libwtcdb_file_get_number_of_items(
+int libwtcdb_file_for_each_item_parallel(
      libwtcdb_file_t *file,
-     int *number_of_items,
+     libwtcdb_item_callback_t callback,
+     void *user_data,
+     const libwtcdb_parallel_options_t *options,
      libcerror_error_t **error )
 {
 	libwtcdb_internal_file_t *internal_file = NULL;
-	static char *function                   = "libwtcdb_file_get_number_of_items";
+	static char *function                   = "libwtcdb_file_for_each_item_parallel";
+	int number_of_workers                   = 0;
+	int result                              = 1;
 
 	if( file == NULL )
 	{
@@ -1351,103 +4071,96 @@ int libwtcdb_file_get_number_of_items(
 	}
 	internal_file = (libwtcdb_internal_file_t *) file;
 
-	if( libcdata_array_get_number_of_entries(
-	     internal_file->entries,
-	     number_of_items,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries from array.",
-		 function );
-
-		return( -1 );
-	}
-	return( 1 );
-}
-
-/* Retrieves a specific item
- * Returns 1 if successful or -1 on error
- */
-int libwtcdb_file_get_item(
-     libwtcdb_file_t *file,
-     int item_index,
-     libwtcdb_item_t **item,
-     libcerror_error_t **error )
-{
-	libwtcdb_internal_file_t *internal_file = NULL;
- 	intptr_t *entry                         = NULL;
-	static char *function                   = "libwtcdb_file_get_item";
-
-	if( file == NULL )
+	if( callback == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 "%s: invalid callback.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file = (libwtcdb_internal_file_t *) file;
+	if( options != NULL )
+	{
+		if( ( options->number_of_workers < 0 )
+		 || ( options->number_of_workers > LIBWTCDB_MAXIMUM_NUMBER_OF_THREADS ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid options - number of workers value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( ( options->executor_submit == NULL ) && ( options->executor_wait != NULL ) )
+		 || ( ( options->executor_submit != NULL ) && ( options->executor_wait == NULL ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid options - executor submit and wait callbacks must both be set.",
+			 function );
 
-	if( internal_file->entries == NULL )
+			return( -1 );
+		}
+		number_of_workers = options->number_of_workers;
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing entries array.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	if( item == NULL )
+#endif
+	if( number_of_workers == 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid item.",
-		 function );
-
-		return( -1 );
+		number_of_workers = internal_file->maximum_number_of_threads;
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_file->entries,
-	     item_index,
-	     &entry,
+	if( libwtcdb_file_run_item_workers(
+	     internal_file,
+	     callback,
+	     user_data,
+	     number_of_workers,
+	     options,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve entry: %d.",
-		 function,
-		 item_index );
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to run item workers.",
+		 function );
 
-		return( -1 );
+		result = -1;
 	}
-	if( libwtcdb_item_initialize(
-	     item,
-	     internal_file->io_handle,
-	     internal_file->file_io_handle,
-	     entry,
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create item.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+#endif
+	return( result );
 }
 
@@ -25,11 +25,17 @@
 #include <common.h>
 #include <types.h>
 
+#include "libwtcdb_chunk_cache.h"
 #include "libwtcdb_extern.h"
+#include "libwtcdb_handle_pool.h"
+#include "libwtcdb_io_backend.h"
 #include "libwtcdb_io_handle.h"
 #include "libwtcdb_libbfio.h"
 #include "libwtcdb_libcdata.h"
 #include "libwtcdb_libcerror.h"
+#include "libwtcdb_libcthreads.h"
+#include "libwtcdb_read_ahead.h"
+#include "libwtcdb_snapshot.h"
 #include "libwtcdb_types.h"
 
 #if defined( __cplusplus )
@@ -40,13 +46,9 @@ typedef struct libwtcdb_internal_file libwtcdb_internal_file_t;
 
 struct libwtcdb_internal_file
 {
-	/* The entries array
+	/* The snapshot
 	 */
-	libcdata_array_t *entries;
-
-	/* The entry free function
-	 */
-	intptr_t *entry_free_function;
+	libwtcdb_internal_snapshot_t *snapshot;
 
 	/* The IO handle
 	 */
@@ -63,6 +65,60 @@ struct libwtcdb_internal_file
 	/* Value to indicate if the file IO handle was opened inside the library
 	 */
 	uint8_t file_io_handle_opened_in_library;
+
+	/* The maximum number of threads used to read the entries
+	 */
+	int maximum_number_of_threads;
+
+	/* The number of items of which the cached data is read ahead
+	 */
+	int number_of_read_ahead_items;
+
+	/* The requested IO backend
+	 */
+	int requested_io_backend;
+
+	/* The IO backend
+	 */
+	libwtcdb_io_backend_t *io_backend;
+
+	/* The handle pool used by files opened by filename, NULL if not used
+	 */
+	libwtcdb_handle_pool_t *handle_pool;
+
+	/* The chunk cache used to reuse the entries of previously read files, NULL if not used
+	 */
+	libwtcdb_chunk_cache_t *chunk_cache;
+
+	/* The progress callback
+	 */
+	libwtcdb_progress_callback_t progress_callback;
+
+	/* The user data passed to the progress callback
+	 */
+	void *progress_user_data;
+
+	/* The interval between progress reports in milliseconds
+	 */
+	uint32_t progress_interval;
+
+	/* The offsets of the cache entries to read or NULL to read all cache entries
+	 */
+	uint32_t *cache_entry_offsets;
+
+	/* The number of cache entry offsets
+	 */
+	int number_of_cache_entry_offsets;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	/* The read-ahead
+	 */
+	libwtcdb_read_ahead_t *read_ahead;
+
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 LIBWTCDB_EXTERN \
@@ -80,6 +136,69 @@ int libwtcdb_file_signal_abort(
      libwtcdb_file_t *file,
      libcerror_error_t **error );
 
+LIBWTCDB_EXTERN \
+int libwtcdb_file_get_maximum_number_of_threads(
+     libwtcdb_file_t *file,
+     int *maximum_number_of_threads,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_file_set_maximum_number_of_threads(
+     libwtcdb_file_t *file,
+     int maximum_number_of_threads,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_file_get_number_of_read_ahead_items(
+     libwtcdb_file_t *file,
+     int *number_of_read_ahead_items,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_file_set_number_of_read_ahead_items(
+     libwtcdb_file_t *file,
+     int number_of_read_ahead_items,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_file_get_io_backend(
+     libwtcdb_file_t *file,
+     int *io_backend,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_file_set_io_backend(
+     libwtcdb_file_t *file,
+     int io_backend,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_file_set_handle_pool(
+     libwtcdb_file_t *file,
+     libwtcdb_handle_pool_t *handle_pool,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_file_set_chunk_cache(
+     libwtcdb_file_t *file,
+     libwtcdb_chunk_cache_t *chunk_cache,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_file_set_progress_callback(
+     libwtcdb_file_t *file,
+     libwtcdb_progress_callback_t callback,
+     void *user_data,
+     uint32_t interval,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_file_set_cache_entry_offsets(
+     libwtcdb_file_t *file,
+     const uint32_t *cache_entry_offsets,
+     int number_of_cache_entry_offsets,
+     libcerror_error_t **error );
+
 LIBWTCDB_EXTERN \
 int libwtcdb_file_open(
      libwtcdb_file_t *file,
@@ -98,6 +217,12 @@ int libwtcdb_file_open_wide(
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
+int libwtcdb_internal_file_open_file_io_handle_in_handle_pool(
+     libwtcdb_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libcerror_error_t **error );
+
 LIBWTCDB_EXTERN \
 int libwtcdb_file_open_file_io_handle(
      libwtcdb_file_t *file,
@@ -105,6 +230,14 @@ int libwtcdb_file_open_file_io_handle(
      int access_flags,
      libcerror_error_t **error );
 
+LIBWTCDB_EXTERN \
+int libwtcdb_file_open_file_io_handle_with_snapshot(
+     libwtcdb_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libwtcdb_snapshot_t *snapshot,
+     libcerror_error_t **error );
+
 LIBWTCDB_EXTERN \
 int libwtcdb_file_close(
      libwtcdb_file_t *file,
@@ -115,10 +248,25 @@ int libwtcdb_file_open_read(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+int libwtcdb_file_open_read_with_snapshot(
+     libwtcdb_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libwtcdb_internal_snapshot_t *snapshot,
+     libcerror_error_t **error );
+
 int libwtcdb_file_read_entries(
      libwtcdb_internal_file_t *internal_file,
      libbfio_handle_t *file_io_handle,
      uint32_t first_entry_offset,
+     libwtcdb_chunk_cache_source_t *chunk_cache_source,
+     libcdata_array_t *entries_array,
+     int *number_of_reused_entries,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_file_get_snapshot(
+     libwtcdb_file_t *file,
+     libwtcdb_snapshot_t **snapshot,
      libcerror_error_t **error );
 
 LIBWTCDB_EXTERN \
@@ -133,6 +281,12 @@ int libwtcdb_file_get_number_of_items(
      int *number_of_items,
      libcerror_error_t **error );
 
+int libwtcdb_internal_file_get_item(
+     libwtcdb_internal_file_t *internal_file,
+     int item_index,
+     libwtcdb_item_t **item,
+     libcerror_error_t **error );
+
 LIBWTCDB_EXTERN \
 int libwtcdb_file_get_item(
      libwtcdb_file_t *file,
@@ -140,6 +294,42 @@ int libwtcdb_file_get_item(
      libwtcdb_item_t **item,
      libcerror_error_t **error );
 
+int libwtcdb_file_get_snapshot_item(
+     libwtcdb_file_t *file,
+     libwtcdb_internal_snapshot_t *snapshot,
+     int item_index,
+     libwtcdb_item_t **item,
+     libcerror_error_t **error );
+
+int libwtcdb_internal_file_get_entry_index_by_offset(
+     libwtcdb_internal_file_t *internal_file,
+     off64_t file_offset,
+     int *entry_index,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_file_get_item_by_offset(
+     libwtcdb_file_t *file,
+     off64_t file_offset,
+     libwtcdb_item_t **item,
+     libcerror_error_t **error );
+
+int libwtcdb_file_run_item_workers(
+     libwtcdb_internal_file_t *internal_file,
+     libwtcdb_item_callback_t callback,
+     void *user_data,
+     int number_of_workers,
+     const libwtcdb_parallel_options_t *options,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_file_for_each_item_parallel(
+     libwtcdb_file_t *file,
+     libwtcdb_item_callback_t callback,
+     void *user_data,
+     const libwtcdb_parallel_options_t *options,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -27,6 +27,7 @@
 #include "libwtcdb_debug.h"
 #include "libwtcdb_definitions.h"
 #include "libwtcdb_file_header.h"
+#include "libwtcdb_io_backend.h"
 #include "libwtcdb_io_handle.h"
 #include "libwtcdb_libcerror.h"
 #include "libwtcdb_libcnotify.h"
@@ -501,6 +502,7 @@ int libwtcdb_file_header_read_data(
  */
 int libwtcdb_file_header_read_file_io_handle(
      libwtcdb_file_header_t *file_header,
+     libwtcdb_io_backend_t *io_backend,
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error )
 {
@@ -528,7 +530,8 @@ int libwtcdb_file_header_read_file_io_handle(
 		 function );
 	}
 #endif
-	read_count = libbfio_handle_read_buffer_at_offset(
+	read_count = libwtcdb_io_backend_read_buffer_at_offset(
+	              io_backend,
 	              file_io_handle,
 	              file_header_data,
 	              32,
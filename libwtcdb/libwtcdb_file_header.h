@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libwtcdb_io_backend.h"
 #include "libwtcdb_libbfio.h"
 #include "libwtcdb_libcerror.h"
 
@@ -77,6 +78,7 @@ int libwtcdb_file_header_read_data(
 
 int libwtcdb_file_header_read_file_io_handle(
      libwtcdb_file_header_t *file_header,
+     libwtcdb_io_backend_t *io_backend,
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
@@ -0,0 +1,1050 @@
+/*
+ * Handle pool functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libwtcdb_handle_pool.h"
+#include "libwtcdb_libbfio.h"
+#include "libwtcdb_libcerror.h"
+#include "libwtcdb_libcthreads.h"
+
+/* Creates a handle pool
+ * Make sure the value handle_pool is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_handle_pool_initialize(
+     libwtcdb_handle_pool_t **handle_pool,
+     int maximum_number_of_open_handles,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_handle_pool_t *internal_handle_pool = NULL;
+	static char *function                                 = "libwtcdb_handle_pool_initialize";
+
+	if( handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *handle_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_open_handles < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of open handles value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle_pool = memory_allocate_structure(
+	                        libwtcdb_internal_handle_pool_t );
+
+	if( internal_handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create handle pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_handle_pool,
+	     0,
+	     sizeof( libwtcdb_internal_handle_pool_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear handle pool.",
+		 function );
+
+		memory_free(
+		 internal_handle_pool );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( internal_handle_pool->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_handle_pool->maximum_number_of_open_handles = maximum_number_of_open_handles;
+
+	*handle_pool = (libwtcdb_handle_pool_t *) internal_handle_pool;
+
+	return( 1 );
+
+on_error:
+	if( internal_handle_pool != NULL )
+	{
+		memory_free(
+		 internal_handle_pool );
+	}
+	return( -1 );
+}
+
+/* Frees a handle pool
+ * The file IO handles registered with the handle pool must have been removed,
+ * which happens when the files that use the handle pool are closed
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_handle_pool_free(
+     libwtcdb_handle_pool_t **handle_pool,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_handle_pool_t *internal_handle_pool = NULL;
+	static char *function                                 = "libwtcdb_handle_pool_free";
+	int result                                            = 1;
+
+	if( handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *handle_pool != NULL )
+	{
+		internal_handle_pool = (libwtcdb_internal_handle_pool_t *) *handle_pool;
+
+		if( internal_handle_pool->number_of_handles != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid handle pool - handles still registered.",
+			 function );
+
+			return( -1 );
+		}
+		*handle_pool = NULL;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( internal_handle_pool->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 internal_handle_pool );
+	}
+	return( result );
+}
+
+/* Retrieves the maximum number of open handles
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_handle_pool_get_maximum_number_of_open_handles(
+     libwtcdb_handle_pool_t *handle_pool,
+     int *maximum_number_of_open_handles,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_handle_pool_t *internal_handle_pool = NULL;
+	static char *function                                 = "libwtcdb_handle_pool_get_maximum_number_of_open_handles";
+
+	if( handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle_pool = (libwtcdb_internal_handle_pool_t *) handle_pool;
+
+	if( maximum_number_of_open_handles == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum number of open handles.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_handle_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*maximum_number_of_open_handles = internal_handle_pool->maximum_number_of_open_handles;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_handle_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the maximum number of open handles
+ * The idle handles that exceed the maximum are closed
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_handle_pool_set_maximum_number_of_open_handles(
+     libwtcdb_handle_pool_t *handle_pool,
+     int maximum_number_of_open_handles,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_handle_pool_t *internal_handle_pool = NULL;
+	static char *function                                 = "libwtcdb_handle_pool_set_maximum_number_of_open_handles";
+	int result                                            = 1;
+
+	if( handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle_pool = (libwtcdb_internal_handle_pool_t *) handle_pool;
+
+	if( maximum_number_of_open_handles < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of open handles value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_handle_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_handle_pool->maximum_number_of_open_handles = maximum_number_of_open_handles;
+
+	if( libwtcdb_internal_handle_pool_close_idle_handles(
+	     internal_handle_pool,
+	     maximum_number_of_open_handles,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close idle handles.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_handle_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the number of open handles
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_handle_pool_get_number_of_open_handles(
+     libwtcdb_handle_pool_t *handle_pool,
+     int *number_of_open_handles,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_handle_pool_t *internal_handle_pool = NULL;
+	static char *function                                 = "libwtcdb_handle_pool_get_number_of_open_handles";
+
+	if( handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle_pool = (libwtcdb_internal_handle_pool_t *) handle_pool;
+
+	if( number_of_open_handles == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of open handles.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_handle_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_open_handles = internal_handle_pool->number_of_open_handles;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_handle_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Unlinks an entry from the list of open entries
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_internal_handle_pool_unlink_open_entry(
+     libwtcdb_internal_handle_pool_t *internal_handle_pool,
+     libwtcdb_handle_pool_entry_t *entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_internal_handle_pool_unlink_open_entry";
+
+	if( internal_handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry->previous_open_entry != NULL )
+	{
+		entry->previous_open_entry->next_open_entry = entry->next_open_entry;
+	}
+	else
+	{
+		internal_handle_pool->first_open_entry = entry->next_open_entry;
+	}
+	if( entry->next_open_entry != NULL )
+	{
+		entry->next_open_entry->previous_open_entry = entry->previous_open_entry;
+	}
+	else
+	{
+		internal_handle_pool->last_open_entry = entry->previous_open_entry;
+	}
+	entry->previous_open_entry = NULL;
+	entry->next_open_entry     = NULL;
+
+	return( 1 );
+}
+
+/* Closes the least recently used idle handles until no more than the maximum number of handles are open
+ * Handles that are in use are not closed, hence the maximum can be exceeded temporarily
+ * This function does not grab the mutex
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_internal_handle_pool_close_idle_handles(
+     libwtcdb_internal_handle_pool_t *internal_handle_pool,
+     int maximum_number_of_open_handles,
+     libcerror_error_t **error )
+{
+	libwtcdb_handle_pool_entry_t *entry          = NULL;
+	libwtcdb_handle_pool_entry_t *previous_entry = NULL;
+	static char *function                        = "libwtcdb_internal_handle_pool_close_idle_handles";
+
+	if( internal_handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	entry = internal_handle_pool->last_open_entry;
+
+	while( ( entry != NULL )
+	    && ( internal_handle_pool->number_of_open_handles > maximum_number_of_open_handles ) )
+	{
+		previous_entry = entry->previous_open_entry;
+
+		if( entry->number_of_users == 0 )
+		{
+			if( libwtcdb_internal_handle_pool_unlink_open_entry(
+			     internal_handle_pool,
+			     entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to unlink open entry.",
+				 function );
+
+				return( -1 );
+			}
+			entry->is_open = 0;
+
+			internal_handle_pool->number_of_open_handles -= 1;
+
+			if( libbfio_handle_close(
+			     entry->file_io_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close file IO handle.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		entry = previous_entry;
+	}
+	return( 1 );
+}
+
+/* Registers a closed file IO handle with the handle pool
+ * The file IO handle is opened when it is grabbed
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_handle_pool_append_handle(
+     libwtcdb_handle_pool_t *handle_pool,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libwtcdb_handle_pool_entry_t **entry,
+     libcerror_error_t **error )
+{
+	libwtcdb_handle_pool_entry_t *safe_entry              = NULL;
+	libwtcdb_internal_handle_pool_t *internal_handle_pool = NULL;
+	static char *function                                 = "libwtcdb_handle_pool_append_handle";
+
+	if( handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle_pool = (libwtcdb_internal_handle_pool_t *) handle_pool;
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+	safe_entry = memory_allocate_structure(
+	              libwtcdb_handle_pool_entry_t );
+
+	if( safe_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     safe_entry,
+	     0,
+	     sizeof( libwtcdb_handle_pool_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entry.",
+		 function );
+
+		memory_free(
+		 safe_entry );
+
+		return( -1 );
+	}
+	safe_entry->file_io_handle = file_io_handle;
+	safe_entry->access_flags   = access_flags;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_handle_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		memory_free(
+		 safe_entry );
+
+		return( -1 );
+	}
+#endif
+	internal_handle_pool->number_of_handles += 1;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_handle_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*entry = safe_entry;
+
+	return( 1 );
+}
+
+/* Removes a file IO handle from the handle pool
+ * The file IO handle is closed if the handle pool opened it, but not freed
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_handle_pool_remove_handle(
+     libwtcdb_handle_pool_t *handle_pool,
+     libwtcdb_handle_pool_entry_t **entry,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_handle_pool_t *internal_handle_pool = NULL;
+	static char *function                                 = "libwtcdb_handle_pool_remove_handle";
+	int result                                            = 1;
+
+	if( handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle_pool = (libwtcdb_internal_handle_pool_t *) handle_pool;
+
+	if( ( entry == NULL )
+	 || ( *entry == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_handle_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( *entry )->number_of_users != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid entry - handle still in use.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		if( ( *entry )->is_open != 0 )
+		{
+			if( libwtcdb_internal_handle_pool_unlink_open_entry(
+			     internal_handle_pool,
+			     *entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to unlink open entry.",
+				 function );
+
+				result = -1;
+			}
+			internal_handle_pool->number_of_open_handles -= 1;
+
+			if( libbfio_handle_close(
+			     ( *entry )->file_io_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		internal_handle_pool->number_of_handles -= 1;
+
+		memory_free(
+		 *entry );
+
+		*entry = NULL;
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_handle_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Grabs a file IO handle for reading
+ * The file IO handle is reopened if it was closed, after closing the least recently used idle handles
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_handle_pool_grab_handle(
+     libwtcdb_handle_pool_t *handle_pool,
+     libwtcdb_handle_pool_entry_t *entry,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_handle_pool_t *internal_handle_pool = NULL;
+	static char *function                                 = "libwtcdb_handle_pool_grab_handle";
+	int result                                            = 1;
+
+	if( handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle_pool = (libwtcdb_internal_handle_pool_t *) handle_pool;
+
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_handle_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( entry->is_open == 0 )
+	{
+		if( libwtcdb_internal_handle_pool_close_idle_handles(
+		     internal_handle_pool,
+		     internal_handle_pool->maximum_number_of_open_handles - 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close idle handles.",
+			 function );
+
+			result = -1;
+		}
+		else if( libbfio_handle_open(
+		          entry->file_io_handle,
+		          entry->access_flags,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			entry->is_open = 1;
+
+			internal_handle_pool->number_of_open_handles += 1;
+		}
+	}
+	else
+	{
+		result = libwtcdb_internal_handle_pool_unlink_open_entry(
+		          internal_handle_pool,
+		          entry,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to unlink open entry.",
+			 function );
+		}
+	}
+	if( result == 1 )
+	{
+		/* The grabbed entry becomes the most recently used open entry
+		 */
+		entry->next_open_entry = internal_handle_pool->first_open_entry;
+
+		if( internal_handle_pool->first_open_entry != NULL )
+		{
+			internal_handle_pool->first_open_entry->previous_open_entry = entry;
+		}
+		else
+		{
+			internal_handle_pool->last_open_entry = entry;
+		}
+		internal_handle_pool->first_open_entry = entry;
+
+		entry->number_of_users += 1;
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_handle_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Releases a file IO handle that was grabbed for reading
+ * Idle handles that exceed the maximum number of open handles are closed
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_handle_pool_release_handle(
+     libwtcdb_handle_pool_t *handle_pool,
+     libwtcdb_handle_pool_entry_t *entry,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_handle_pool_t *internal_handle_pool = NULL;
+	static char *function                                 = "libwtcdb_handle_pool_release_handle";
+	int result                                            = 1;
+
+	if( handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle_pool = (libwtcdb_internal_handle_pool_t *) handle_pool;
+
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_handle_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( entry->number_of_users <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry - handle not in use.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		entry->number_of_users -= 1;
+
+		if( libwtcdb_internal_handle_pool_close_idle_handles(
+		     internal_handle_pool,
+		     internal_handle_pool->maximum_number_of_open_handles,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close idle handles.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_handle_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
@@ -0,0 +1,170 @@
+/*
+ * Handle pool functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBWTCDB_HANDLE_POOL_H )
+#define _LIBWTCDB_HANDLE_POOL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libwtcdb_extern.h"
+#include "libwtcdb_libbfio.h"
+#include "libwtcdb_libcerror.h"
+#include "libwtcdb_libcthreads.h"
+#include "libwtcdb_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libwtcdb_handle_pool_entry libwtcdb_handle_pool_entry_t;
+
+/* The handle pool entry contains a file IO handle registered with a handle pool
+ */
+struct libwtcdb_handle_pool_entry
+{
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The access flags used to (re)open the file IO handle
+	 */
+	int access_flags;
+
+	/* The number of users that currently read from the file IO handle
+	 */
+	int number_of_users;
+
+	/* Value to indicate the file IO handle is open
+	 */
+	uint8_t is_open;
+
+	/* The previous open entry, which was used more recently
+	 */
+	libwtcdb_handle_pool_entry_t *previous_open_entry;
+
+	/* The next open entry, which was used less recently
+	 */
+	libwtcdb_handle_pool_entry_t *next_open_entry;
+};
+
+typedef struct libwtcdb_internal_handle_pool libwtcdb_internal_handle_pool_t;
+
+/* The handle pool bounds the number of file IO handles that are open at the same time
+ * The idle file IO handles are closed in least recently used order and reopened on demand
+ */
+struct libwtcdb_internal_handle_pool
+{
+	/* The maximum number of open handles
+	 */
+	int maximum_number_of_open_handles;
+
+	/* The number of open handles
+	 */
+	int number_of_open_handles;
+
+	/* The number of registered handles
+	 */
+	int number_of_handles;
+
+	/* The most recently used open entry
+	 */
+	libwtcdb_handle_pool_entry_t *first_open_entry;
+
+	/* The least recently used open entry
+	 */
+	libwtcdb_handle_pool_entry_t *last_open_entry;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+LIBWTCDB_EXTERN \
+int libwtcdb_handle_pool_initialize(
+     libwtcdb_handle_pool_t **handle_pool,
+     int maximum_number_of_open_handles,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_handle_pool_free(
+     libwtcdb_handle_pool_t **handle_pool,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_handle_pool_get_maximum_number_of_open_handles(
+     libwtcdb_handle_pool_t *handle_pool,
+     int *maximum_number_of_open_handles,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_handle_pool_set_maximum_number_of_open_handles(
+     libwtcdb_handle_pool_t *handle_pool,
+     int maximum_number_of_open_handles,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_handle_pool_get_number_of_open_handles(
+     libwtcdb_handle_pool_t *handle_pool,
+     int *number_of_open_handles,
+     libcerror_error_t **error );
+
+int libwtcdb_internal_handle_pool_unlink_open_entry(
+     libwtcdb_internal_handle_pool_t *internal_handle_pool,
+     libwtcdb_handle_pool_entry_t *entry,
+     libcerror_error_t **error );
+
+int libwtcdb_internal_handle_pool_close_idle_handles(
+     libwtcdb_internal_handle_pool_t *internal_handle_pool,
+     int maximum_number_of_open_handles,
+     libcerror_error_t **error );
+
+int libwtcdb_handle_pool_append_handle(
+     libwtcdb_handle_pool_t *handle_pool,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libwtcdb_handle_pool_entry_t **entry,
+     libcerror_error_t **error );
+
+int libwtcdb_handle_pool_remove_handle(
+     libwtcdb_handle_pool_t *handle_pool,
+     libwtcdb_handle_pool_entry_t **entry,
+     libcerror_error_t **error );
+
+int libwtcdb_handle_pool_grab_handle(
+     libwtcdb_handle_pool_t *handle_pool,
+     libwtcdb_handle_pool_entry_t *entry,
+     libcerror_error_t **error );
+
+int libwtcdb_handle_pool_release_handle(
+     libwtcdb_handle_pool_t *handle_pool,
+     libwtcdb_handle_pool_entry_t *entry,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBWTCDB_HANDLE_POOL_H ) */
+
@@ -0,0 +1,337 @@
+/*
+ * Hash column functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libwtcdb_cache_entry.h"
+#include "libwtcdb_definitions.h"
+#include "libwtcdb_hash_column.h"
+#include "libwtcdb_index_entry.h"
+#include "libwtcdb_libcdata.h"
+#include "libwtcdb_libcerror.h"
+#include "libwtcdb_radix_sort.h"
+
+/* Creates a hash column
+ * Make sure the value hash_column is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_hash_column_initialize(
+     libwtcdb_hash_column_t **hash_column,
+     int number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_hash_column_initialize";
+
+	if( hash_column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash column.",
+		 function );
+
+		return( -1 );
+	}
+	if( *hash_column != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid hash column value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_entries < 0 )
+	 || ( (size_t) number_of_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint64_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*hash_column = memory_allocate_structure(
+	                libwtcdb_hash_column_t );
+
+	if( *hash_column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash column.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *hash_column,
+	     0,
+	     sizeof( libwtcdb_hash_column_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash column.",
+		 function );
+
+		memory_free(
+		 *hash_column );
+
+		*hash_column = NULL;
+
+		return( -1 );
+	}
+	if( number_of_entries > 0 )
+	{
+		( *hash_column )->hashes = (uint64_t *) memory_allocate(
+		                                         sizeof( uint64_t ) * (size_t) number_of_entries );
+
+		if( ( *hash_column )->hashes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create hashes.",
+			 function );
+
+			goto on_error;
+		}
+		( *hash_column )->entry_indexes = (int *) memory_allocate(
+		                                           sizeof( int ) * (size_t) number_of_entries );
+
+		if( ( *hash_column )->entry_indexes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create entry indexes.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	( *hash_column )->number_of_entries = number_of_entries;
+
+	return( 1 );
+
+on_error:
+	if( *hash_column != NULL )
+	{
+		if( ( *hash_column )->hashes != NULL )
+		{
+			memory_free(
+			 ( *hash_column )->hashes );
+		}
+		memory_free(
+		 *hash_column );
+
+		*hash_column = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a hash column
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_hash_column_free(
+     libwtcdb_hash_column_t **hash_column,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_hash_column_free";
+
+	if( hash_column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash column.",
+		 function );
+
+		return( -1 );
+	}
+	if( *hash_column != NULL )
+	{
+		if( ( *hash_column )->entry_indexes != NULL )
+		{
+			memory_free(
+			 ( *hash_column )->entry_indexes );
+		}
+		if( ( *hash_column )->hashes != NULL )
+		{
+			memory_free(
+			 ( *hash_column )->hashes );
+		}
+		memory_free(
+		 *hash_column );
+
+		*hash_column = NULL;
+	}
+	return( 1 );
+}
+
+/* Reads the hashes of the entries into the hash column in entry order
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_hash_column_read_entries(
+     libwtcdb_hash_column_t *hash_column,
+     libcdata_array_t *entries_array,
+     uint8_t file_type,
+     libcerror_error_t **error )
+{
+	intptr_t *entry       = NULL;
+	static char *function = "libwtcdb_hash_column_read_entries";
+	int entry_index       = 0;
+	int number_of_entries = 0;
+
+	if( hash_column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash column.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     entries_array,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries != hash_column->number_of_entries )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     entries_array,
+		     entry_index,
+		     &entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( entry == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( file_type == LIBWTCDB_FILE_TYPE_CACHE )
+		{
+			hash_column->hashes[ entry_index ] = ( (libwtcdb_cache_entry_t *) entry )->hash;
+		}
+		else
+		{
+			hash_column->hashes[ entry_index ] = ( (libwtcdb_index_entry_t *) entry )->hash;
+		}
+		hash_column->entry_indexes[ entry_index ] = entry_index;
+	}
+	return( 1 );
+}
+
+/* Sorts the hash column by hash
+ * The sort is stable so that entries with the same hash remain in entry order
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_hash_column_sort(
+     libwtcdb_hash_column_t *hash_column,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_hash_column_sort";
+
+	if( hash_column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash column.",
+		 function );
+
+		return( -1 );
+	}
+	if( libwtcdb_radix_sort_keys(
+	     &( hash_column->hashes ),
+	     &( hash_column->entry_indexes ),
+	     hash_column->number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to sort hashs.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
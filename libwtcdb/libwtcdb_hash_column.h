@@ -0,0 +1,80 @@
+/*
+ * Hash column functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBWTCDB_HASH_COLUMN_H )
+#define _LIBWTCDB_HASH_COLUMN_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libwtcdb_libcdata.h"
+#include "libwtcdb_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libwtcdb_hash_column libwtcdb_hash_column_t;
+
+/* The hash column contains the hashes of the entries of a single file
+ * stored as a column, sorted by hash with the corresponding entry indexes
+ */
+struct libwtcdb_hash_column
+{
+	/* The hashes
+	 */
+	uint64_t *hashes;
+
+	/* The entry indexes
+	 */
+	int *entry_indexes;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+};
+
+int libwtcdb_hash_column_initialize(
+     libwtcdb_hash_column_t **hash_column,
+     int number_of_entries,
+     libcerror_error_t **error );
+
+int libwtcdb_hash_column_free(
+     libwtcdb_hash_column_t **hash_column,
+     libcerror_error_t **error );
+
+int libwtcdb_hash_column_read_entries(
+     libwtcdb_hash_column_t *hash_column,
+     libcdata_array_t *entries_array,
+     uint8_t file_type,
+     libcerror_error_t **error );
+
+int libwtcdb_hash_column_sort(
+     libwtcdb_hash_column_t *hash_column,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBWTCDB_HASH_COLUMN_H ) */
+
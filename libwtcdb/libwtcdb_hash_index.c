@@ -0,0 +1,377 @@
+/*
+ * Hash index functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "libwtcdb_hash_index.h"
+#include "libwtcdb_libcerror.h"
+
+/* Creates a hash index
+ * Make sure the value hash_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_hash_index_initialize(
+     libwtcdb_hash_index_t **hash_index,
+     int maximum_number_of_records,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_hash_index_initialize";
+	size_t records_size   = 0;
+
+	if( hash_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *hash_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid hash index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_records < 0 )
+	 || ( (size_t) maximum_number_of_records > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libwtcdb_hash_index_record_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of records value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*hash_index = memory_allocate_structure(
+	               libwtcdb_hash_index_t );
+
+	if( *hash_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *hash_index,
+	     0,
+	     sizeof( libwtcdb_hash_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash index.",
+		 function );
+
+		memory_free(
+		 *hash_index );
+
+		*hash_index = NULL;
+
+		return( -1 );
+	}
+	if( maximum_number_of_records > 0 )
+	{
+		records_size = sizeof( libwtcdb_hash_index_record_t ) * (size_t) maximum_number_of_records;
+
+		( *hash_index )->records = (libwtcdb_hash_index_record_t *) memory_allocate(
+		                                                             records_size );
+
+		if( ( *hash_index )->records == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create records.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	( *hash_index )->maximum_number_of_records = maximum_number_of_records;
+
+	return( 1 );
+
+on_error:
+	if( *hash_index != NULL )
+	{
+		memory_free(
+		 *hash_index );
+
+		*hash_index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a hash index
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_hash_index_free(
+     libwtcdb_hash_index_t **hash_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_hash_index_free";
+
+	if( hash_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *hash_index != NULL )
+	{
+		if( ( *hash_index )->records != NULL )
+		{
+			memory_free(
+			 ( *hash_index )->records );
+		}
+		memory_free(
+		 *hash_index );
+
+		*hash_index = NULL;
+	}
+	return( 1 );
+}
+
+/* Compares two hash index records by hash, file index and entry index
+ * Returns -1 if first is less than second, 0 if equal or 1 if greater
+ */
+int libwtcdb_hash_index_compare_records(
+     const libwtcdb_hash_index_record_t *first_record,
+     const libwtcdb_hash_index_record_t *second_record )
+{
+	if( first_record->hash < second_record->hash )
+	{
+		return( -1 );
+	}
+	else if( first_record->hash > second_record->hash )
+	{
+		return( 1 );
+	}
+	if( first_record->file_index < second_record->file_index )
+	{
+		return( -1 );
+	}
+	else if( first_record->file_index > second_record->file_index )
+	{
+		return( 1 );
+	}
+	if( first_record->entry_index < second_record->entry_index )
+	{
+		return( -1 );
+	}
+	else if( first_record->entry_index > second_record->entry_index )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Appends a record
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_hash_index_append_record(
+     libwtcdb_hash_index_t *hash_index,
+     uint64_t hash,
+     int file_index,
+     int entry_index,
+     libcerror_error_t **error )
+{
+	libwtcdb_hash_index_record_t *record = NULL;
+	static char *function                = "libwtcdb_hash_index_append_record";
+
+	if( hash_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash index.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_index->number_of_records >= hash_index->maximum_number_of_records )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid hash index - number of records value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	record = &( hash_index->records[ hash_index->number_of_records ] );
+
+	record->hash        = hash;
+	record->file_index  = file_index;
+	record->entry_index = entry_index;
+
+	hash_index->number_of_records += 1;
+
+	return( 1 );
+}
+
+/* Sorts the records by hash
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_hash_index_sort(
+     libwtcdb_hash_index_t *hash_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_hash_index_sort";
+
+	if( hash_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash index.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_index->number_of_records > 1 )
+	{
+		qsort(
+		 hash_index->records,
+		 (size_t) hash_index->number_of_records,
+		 sizeof( libwtcdb_hash_index_record_t ),
+		 (int (*)(const void *, const void *)) &libwtcdb_hash_index_compare_records );
+	}
+	return( 1 );
+}
+
+/* Retrieves the records of a specific hash
+ * The records must be sorted
+ * Returns 1 if successful, 0 if no such hash or -1 on error
+ */
+int libwtcdb_hash_index_get_records_by_hash(
+     libwtcdb_hash_index_t *hash_index,
+     uint64_t hash,
+     int *first_record_index,
+     int *number_of_records,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_hash_index_get_records_by_hash";
+	int last_record_index = 0;
+	int lower_index       = 0;
+	int middle_index      = 0;
+	int upper_index       = 0;
+
+	if( hash_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash index.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_record_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first record index.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of records.",
+		 function );
+
+		return( -1 );
+	}
+	/* Determine the first record with a hash that is not less than the hash
+	 */
+	lower_index = 0;
+	upper_index = hash_index->number_of_records;
+
+	while( lower_index < upper_index )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( hash_index->records[ middle_index ].hash < hash )
+		{
+			lower_index = middle_index + 1;
+		}
+		else
+		{
+			upper_index = middle_index;
+		}
+	}
+	if( ( lower_index >= hash_index->number_of_records )
+	 || ( hash_index->records[ lower_index ].hash != hash ) )
+	{
+		return( 0 );
+	}
+	last_record_index = lower_index + 1;
+
+	while( ( last_record_index < hash_index->number_of_records )
+	    && ( hash_index->records[ last_record_index ].hash == hash ) )
+	{
+		last_record_index++;
+	}
+	*first_record_index = lower_index;
+	*number_of_records  = last_record_index - lower_index;
+
+	return( 1 );
+}
+
@@ -0,0 +1,108 @@
+/*
+ * Hash index functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBWTCDB_HASH_INDEX_H )
+#define _LIBWTCDB_HASH_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libwtcdb_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libwtcdb_hash_index_record libwtcdb_hash_index_record_t;
+
+struct libwtcdb_hash_index_record
+{
+	/* The hash
+	 */
+	uint64_t hash;
+
+	/* The index of the file that contains the entry
+	 */
+	int file_index;
+
+	/* The index of the entry in the file
+	 */
+	int entry_index;
+};
+
+typedef struct libwtcdb_hash_index libwtcdb_hash_index_t;
+
+/* The hash index maps the hashes of the entries of multiple files
+ * to the entries, the records are sorted by hash once all have been appended
+ */
+struct libwtcdb_hash_index
+{
+	/* The records
+	 */
+	libwtcdb_hash_index_record_t *records;
+
+	/* The number of records
+	 */
+	int number_of_records;
+
+	/* The maximum number of records
+	 */
+	int maximum_number_of_records;
+};
+
+int libwtcdb_hash_index_initialize(
+     libwtcdb_hash_index_t **hash_index,
+     int maximum_number_of_records,
+     libcerror_error_t **error );
+
+int libwtcdb_hash_index_free(
+     libwtcdb_hash_index_t **hash_index,
+     libcerror_error_t **error );
+
+int libwtcdb_hash_index_compare_records(
+     const libwtcdb_hash_index_record_t *first_record,
+     const libwtcdb_hash_index_record_t *second_record );
+
+int libwtcdb_hash_index_append_record(
+     libwtcdb_hash_index_t *hash_index,
+     uint64_t hash,
+     int file_index,
+     int entry_index,
+     libcerror_error_t **error );
+
+int libwtcdb_hash_index_sort(
+     libwtcdb_hash_index_t *hash_index,
+     libcerror_error_t **error );
+
+int libwtcdb_hash_index_get_records_by_hash(
+     libwtcdb_hash_index_t *hash_index,
+     uint64_t hash,
+     int *first_record_index,
+     int *number_of_records,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBWTCDB_HASH_INDEX_H ) */
+
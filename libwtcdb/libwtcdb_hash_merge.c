@@ -0,0 +1,1003 @@
+/*
+ * Hash merge functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libwtcdb_cache_set.h"
+#include "libwtcdb_definitions.h"
+#include "libwtcdb_file.h"
+#include "libwtcdb_hash_column.h"
+#include "libwtcdb_hash_merge.h"
+#include "libwtcdb_item.h"
+#include "libwtcdb_libcdata.h"
+#include "libwtcdb_libcerror.h"
+#include "libwtcdb_libcthreads.h"
+#include "libwtcdb_merge_heap.h"
+#include "libwtcdb_snapshot.h"
+
+/* Creates a hash merge
+ * Make sure the value hash_merge is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_hash_merge_initialize(
+     libwtcdb_hash_merge_t **hash_merge,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_hash_merge_t *internal_hash_merge = NULL;
+	static char *function                               = "libwtcdb_hash_merge_initialize";
+
+	if( hash_merge == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash merge.",
+		 function );
+
+		return( -1 );
+	}
+	if( *hash_merge != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid hash merge value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_hash_merge = memory_allocate_structure(
+	                       libwtcdb_internal_hash_merge_t );
+
+	if( internal_hash_merge == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash merge.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_hash_merge,
+	     0,
+	     sizeof( libwtcdb_internal_hash_merge_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash merge.",
+		 function );
+
+		memory_free(
+		 internal_hash_merge );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( internal_hash_merge->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	*hash_merge = (libwtcdb_hash_merge_t *) internal_hash_merge;
+
+	return( 1 );
+
+on_error:
+	if( internal_hash_merge != NULL )
+	{
+		memory_free(
+		 internal_hash_merge );
+	}
+	return( -1 );
+}
+
+/* Frees a hash merge
+ * Releases the references to the snapshots of the files, the files are not freed
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_hash_merge_free(
+     libwtcdb_hash_merge_t **hash_merge,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_hash_merge_t *internal_hash_merge = NULL;
+	static char *function                               = "libwtcdb_hash_merge_free";
+	int input_index                                     = 0;
+	int result                                          = 1;
+
+	if( hash_merge == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash merge.",
+		 function );
+
+		return( -1 );
+	}
+	if( *hash_merge != NULL )
+	{
+		internal_hash_merge = (libwtcdb_internal_hash_merge_t *) *hash_merge;
+		*hash_merge         = NULL;
+
+		for( input_index = 0;
+		     input_index < internal_hash_merge->number_of_inputs;
+		     input_index++ )
+		{
+			if( libwtcdb_snapshot_free(
+			     (libwtcdb_snapshot_t **) &( internal_hash_merge->inputs[ input_index ].snapshot ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free snapshot of input: %d.",
+				 function,
+				 input_index );
+
+				result = -1;
+			}
+		}
+		if( internal_hash_merge->heap != NULL )
+		{
+			memory_free(
+			 internal_hash_merge->heap );
+		}
+		if( internal_hash_merge->inputs != NULL )
+		{
+			memory_free(
+			 internal_hash_merge->inputs );
+		}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( internal_hash_merge->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 internal_hash_merge );
+	}
+	return( result );
+}
+
+/* Appends an input to the hash merge
+ * Takes over the reference to the snapshot when successful
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_internal_hash_merge_append_input(
+     libwtcdb_internal_hash_merge_t *internal_hash_merge,
+     libwtcdb_file_t *file,
+     libwtcdb_internal_snapshot_t *snapshot,
+     libcerror_error_t **error )
+{
+	libwtcdb_hash_column_t *hash_column = NULL;
+	libwtcdb_hash_merge_input_t *inputs = NULL;
+	static char *function               = "libwtcdb_internal_hash_merge_append_input";
+	size_t inputs_size                  = 0;
+	int number_of_allocated_inputs      = 0;
+
+	if( internal_hash_merge == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash merge.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_hash_merge->is_started != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid hash merge - iteration already started.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_hash_merge->number_of_inputs == (int) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid hash merge - number of inputs value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* The hash column is sorted once per snapshot and shared by the files that use it
+	 */
+	if( libwtcdb_snapshot_get_hash_column(
+	     snapshot,
+	     &hash_column,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve hash column from snapshot.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_hash_merge->number_of_inputs >= internal_hash_merge->number_of_allocated_inputs )
+	{
+		if( internal_hash_merge->number_of_allocated_inputs == 0 )
+		{
+			number_of_allocated_inputs = 16;
+		}
+		else if( internal_hash_merge->number_of_allocated_inputs <= ( (int) INT_MAX / 2 ) )
+		{
+			number_of_allocated_inputs = internal_hash_merge->number_of_allocated_inputs * 2;
+		}
+		else
+		{
+			number_of_allocated_inputs = (int) INT_MAX;
+		}
+		inputs_size = sizeof( libwtcdb_hash_merge_input_t ) * (size_t) number_of_allocated_inputs;
+
+		if( inputs_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid inputs size value exceeds maximum allocation size.",
+			 function );
+
+			return( -1 );
+		}
+		inputs = (libwtcdb_hash_merge_input_t *) memory_reallocate(
+		                                          internal_hash_merge->inputs,
+		                                          inputs_size );
+
+		if( inputs == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize inputs.",
+			 function );
+
+			return( -1 );
+		}
+		internal_hash_merge->inputs                     = inputs;
+		internal_hash_merge->number_of_allocated_inputs = number_of_allocated_inputs;
+	}
+	inputs = &( internal_hash_merge->inputs[ internal_hash_merge->number_of_inputs ] );
+
+	inputs->file        = file;
+	inputs->snapshot    = snapshot;
+	inputs->hash_column = hash_column;
+	inputs->position    = 0;
+	inputs->input_index = internal_hash_merge->number_of_inputs;
+
+	internal_hash_merge->number_of_inputs += 1;
+
+	return( 1 );
+}
+
+/* Appends a file to the hash merge
+ * The file must be open and must remain open while the items are retrieved
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_hash_merge_append_file(
+     libwtcdb_hash_merge_t *hash_merge,
+     libwtcdb_file_t *file,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_hash_merge_t *internal_hash_merge = NULL;
+	libwtcdb_snapshot_t *snapshot                       = NULL;
+	static char *function                               = "libwtcdb_hash_merge_append_file";
+	int result                                          = 0;
+
+	if( hash_merge == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash merge.",
+		 function );
+
+		return( -1 );
+	}
+	internal_hash_merge = (libwtcdb_internal_hash_merge_t *) hash_merge;
+
+	result = libwtcdb_file_get_snapshot(
+	          file,
+	          &snapshot,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve snapshot from file.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - file is not open.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_hash_merge->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	result = libwtcdb_internal_hash_merge_append_input(
+	          internal_hash_merge,
+	          file,
+	          (libwtcdb_internal_snapshot_t *) snapshot,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append input.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		snapshot = NULL;
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_hash_merge->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( snapshot != NULL )
+	{
+		libwtcdb_snapshot_free(
+		 &snapshot,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Appends the cache files of a cache set to the hash merge
+ * The index files of the cache set are not merged
+ * The cache set must remain open while the items are retrieved
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_hash_merge_append_cache_set(
+     libwtcdb_hash_merge_t *hash_merge,
+     libwtcdb_cache_set_t *cache_set,
+     libcerror_error_t **error )
+{
+	libwtcdb_file_t *file         = NULL;
+	libwtcdb_snapshot_t *snapshot = NULL;
+	static char *function         = "libwtcdb_hash_merge_append_cache_set";
+	uint8_t file_type             = 0;
+	int file_index                = 0;
+	int number_of_files           = 0;
+
+	if( hash_merge == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash merge.",
+		 function );
+
+		return( -1 );
+	}
+	if( libwtcdb_cache_set_get_number_of_files(
+	     cache_set,
+	     &number_of_files,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of files.",
+		 function );
+
+		return( -1 );
+	}
+	for( file_index = 0;
+	     file_index < number_of_files;
+	     file_index++ )
+	{
+		if( libwtcdb_cache_set_get_file_by_index(
+		     cache_set,
+		     file_index,
+		     &file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file: %d.",
+			 function,
+			 file_index );
+
+			return( -1 );
+		}
+		if( libwtcdb_file_get_snapshot(
+		     file,
+		     &snapshot,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve snapshot of file: %d.",
+			 function,
+			 file_index );
+
+			return( -1 );
+		}
+		if( libwtcdb_snapshot_get_type(
+		     snapshot,
+		     &file_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve type of file: %d.",
+			 function,
+			 file_index );
+
+			goto on_error;
+		}
+		if( libwtcdb_snapshot_free(
+		     &snapshot,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free snapshot of file: %d.",
+			 function,
+			 file_index );
+
+			goto on_error;
+		}
+		if( file_type != LIBWTCDB_FILE_TYPE_CACHE )
+		{
+			continue;
+		}
+		if( libwtcdb_hash_merge_append_file(
+		     hash_merge,
+		     file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append file: %d.",
+			 function,
+			 file_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( snapshot != NULL )
+	{
+		libwtcdb_snapshot_free(
+		 &snapshot,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of inputs
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_hash_merge_get_number_of_inputs(
+     libwtcdb_hash_merge_t *hash_merge,
+     int *number_of_inputs,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_hash_merge_t *internal_hash_merge = NULL;
+	static char *function                               = "libwtcdb_hash_merge_get_number_of_inputs";
+
+	if( hash_merge == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash merge.",
+		 function );
+
+		return( -1 );
+	}
+	internal_hash_merge = (libwtcdb_internal_hash_merge_t *) hash_merge;
+
+	if( number_of_inputs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of inputs.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_hash_merge->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_inputs = internal_hash_merge->number_of_inputs;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_hash_merge->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Compares two inputs
+ * The inputs are ordered by their current hash and then by input index
+ * Returns LIBCDATA_COMPARE_LESS, LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ */
+int libwtcdb_hash_merge_input_compare(
+     libwtcdb_hash_merge_input_t *first_input,
+     libwtcdb_hash_merge_input_t *second_input,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_hash_merge_input_compare";
+	uint64_t first_hash   = 0;
+	uint64_t second_hash  = 0;
+
+	if( first_input == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first input.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_input == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second input.",
+		 function );
+
+		return( -1 );
+	}
+	first_hash  = first_input->hash_column->hashes[ first_input->position ];
+	second_hash = second_input->hash_column->hashes[ second_input->position ];
+
+	if( first_hash < second_hash )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( first_hash > second_hash )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	if( first_input->input_index < second_input->input_index )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( first_input->input_index > second_input->input_index )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	return( LIBCDATA_COMPARE_EQUAL );
+}
+
+/* Starts the iteration by building the heap of the inputs that have entries
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_internal_hash_merge_start(
+     libwtcdb_internal_hash_merge_t *internal_hash_merge,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_internal_hash_merge_start";
+	int input_index       = 0;
+
+	if( internal_hash_merge == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash merge.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_hash_merge->is_started != 0 )
+	{
+		return( 1 );
+	}
+	if( internal_hash_merge->number_of_inputs > 0 )
+	{
+		if( (size_t) internal_hash_merge->number_of_inputs > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( intptr_t * ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of inputs value exceeds maximum allocation size.",
+			 function );
+
+			return( -1 );
+		}
+		internal_hash_merge->heap = (intptr_t **) memory_allocate(
+		                                           sizeof( intptr_t * ) * (size_t) internal_hash_merge->number_of_inputs );
+
+		if( internal_hash_merge->heap == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create heap.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_hash_merge->heap_size = 0;
+
+	for( input_index = 0;
+	     input_index < internal_hash_merge->number_of_inputs;
+	     input_index++ )
+	{
+		if( internal_hash_merge->inputs[ input_index ].hash_column->number_of_entries > 0 )
+		{
+			internal_hash_merge->heap[ internal_hash_merge->heap_size ] = (intptr_t *) &( internal_hash_merge->inputs[ input_index ] );
+
+			internal_hash_merge->heap_size += 1;
+		}
+	}
+	if( libwtcdb_merge_heap_build(
+	     internal_hash_merge->heap,
+	     internal_hash_merge->heap_size,
+	     (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libwtcdb_hash_merge_input_compare,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build heap.",
+		 function );
+
+		memory_free(
+		 internal_hash_merge->heap );
+
+		internal_hash_merge->heap      = NULL;
+		internal_hash_merge->heap_size = 0;
+
+		return( -1 );
+	}
+	internal_hash_merge->is_started = 1;
+
+	return( 1 );
+}
+
+/* Retrieves the next item in hash order
+ * Items with the same hash are returned in the order their files were appended
+ * The first call starts the iteration, after which no more files can be appended
+ * Returns 1 if successful, 0 if no more items are available or -1 on error
+ */
+int libwtcdb_hash_merge_get_next_item(
+     libwtcdb_hash_merge_t *hash_merge,
+     uint64_t *hash,
+     int *input_index,
+     libwtcdb_item_t **item,
+     libcerror_error_t **error )
+{
+	libwtcdb_hash_merge_input_t *input                  = NULL;
+	libwtcdb_internal_hash_merge_t *internal_hash_merge = NULL;
+	static char *function                               = "libwtcdb_hash_merge_get_next_item";
+	int result                                          = 1;
+
+	if( hash_merge == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash merge.",
+		 function );
+
+		return( -1 );
+	}
+	internal_hash_merge = (libwtcdb_internal_hash_merge_t *) hash_merge;
+
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input index.",
+		 function );
+
+		return( -1 );
+	}
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( *item != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid item value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_hash_merge->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libwtcdb_internal_hash_merge_start(
+	     internal_hash_merge,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to start hash merge.",
+		 function );
+
+		result = -1;
+	}
+	else if( internal_hash_merge->heap_size == 0 )
+	{
+		result = 0;
+	}
+	else
+	{
+		input = (libwtcdb_hash_merge_input_t *) internal_hash_merge->heap[ 0 ];
+
+		if( libwtcdb_file_get_snapshot_item(
+		     input->file,
+		     input->snapshot,
+		     input->hash_column->entry_indexes[ input->position ],
+		     item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve item: %d from input: %d.",
+			 function,
+			 input->hash_column->entry_indexes[ input->position ],
+			 input->input_index );
+
+			result = -1;
+		}
+		else
+		{
+			*hash        = input->hash_column->hashes[ input->position ];
+			*input_index = input->input_index;
+
+			input->position += 1;
+
+			if( input->position >= input->hash_column->number_of_entries )
+			{
+				result = libwtcdb_merge_heap_remove_first(
+				          internal_hash_merge->heap,
+				          &( internal_hash_merge->heap_size ),
+				          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libwtcdb_hash_merge_input_compare,
+				          error );
+			}
+			else
+			{
+				result = libwtcdb_merge_heap_sift_down(
+				          internal_hash_merge->heap,
+				          internal_hash_merge->heap_size,
+				          0,
+				          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libwtcdb_hash_merge_input_compare,
+				          error );
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update heap.",
+				 function );
+
+				libwtcdb_item_free(
+				 item,
+				 NULL );
+
+				result = -1;
+			}
+		}
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_hash_merge->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		if( *item != NULL )
+		{
+			libwtcdb_item_free(
+			 item,
+			 NULL );
+		}
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
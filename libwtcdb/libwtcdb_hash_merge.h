@@ -0,0 +1,161 @@
+/*
+ * Hash merge functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBWTCDB_HASH_MERGE_H )
+#define _LIBWTCDB_HASH_MERGE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libwtcdb_extern.h"
+#include "libwtcdb_hash_column.h"
+#include "libwtcdb_libcerror.h"
+#include "libwtcdb_libcthreads.h"
+#include "libwtcdb_snapshot.h"
+#include "libwtcdb_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libwtcdb_hash_merge_input libwtcdb_hash_merge_input_t;
+
+/* The hash merge input contains the position of the merge in a single file
+ */
+struct libwtcdb_hash_merge_input
+{
+	/* The file
+	 */
+	libwtcdb_file_t *file;
+
+	/* The snapshot of the file
+	 */
+	libwtcdb_internal_snapshot_t *snapshot;
+
+	/* The hash column, which is owned by the snapshot
+	 */
+	libwtcdb_hash_column_t *hash_column;
+
+	/* The position in the hash column
+	 */
+	int position;
+
+	/* The input index
+	 */
+	int input_index;
+};
+
+typedef struct libwtcdb_internal_hash_merge libwtcdb_internal_hash_merge_t;
+
+/* The hash merge iterates the items of multiple files in hash order
+ * The files are merged through a heap that contains a single position per file
+ */
+struct libwtcdb_internal_hash_merge
+{
+	/* The inputs
+	 */
+	libwtcdb_hash_merge_input_t *inputs;
+
+	/* The number of inputs
+	 */
+	int number_of_inputs;
+
+	/* The number of allocated inputs
+	 */
+	int number_of_allocated_inputs;
+
+	/* The heap of the inputs that have remaining entries
+	 */
+	intptr_t **heap;
+
+	/* The number of inputs in the heap
+	 */
+	int heap_size;
+
+	/* Value to indicate the iteration has started
+	 */
+	uint8_t is_started;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+LIBWTCDB_EXTERN \
+int libwtcdb_hash_merge_initialize(
+     libwtcdb_hash_merge_t **hash_merge,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_hash_merge_free(
+     libwtcdb_hash_merge_t **hash_merge,
+     libcerror_error_t **error );
+
+int libwtcdb_internal_hash_merge_append_input(
+     libwtcdb_internal_hash_merge_t *internal_hash_merge,
+     libwtcdb_file_t *file,
+     libwtcdb_internal_snapshot_t *snapshot,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_hash_merge_append_file(
+     libwtcdb_hash_merge_t *hash_merge,
+     libwtcdb_file_t *file,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_hash_merge_append_cache_set(
+     libwtcdb_hash_merge_t *hash_merge,
+     libwtcdb_cache_set_t *cache_set,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_hash_merge_get_number_of_inputs(
+     libwtcdb_hash_merge_t *hash_merge,
+     int *number_of_inputs,
+     libcerror_error_t **error );
+
+int libwtcdb_hash_merge_input_compare(
+     libwtcdb_hash_merge_input_t *first_input,
+     libwtcdb_hash_merge_input_t *second_input,
+     libcerror_error_t **error );
+
+int libwtcdb_internal_hash_merge_start(
+     libwtcdb_internal_hash_merge_t *internal_hash_merge,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_hash_merge_get_next_item(
+     libwtcdb_hash_merge_t *hash_merge,
+     uint64_t *hash,
+     int *input_index,
+     libwtcdb_item_t **item,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBWTCDB_HASH_MERGE_H ) */
+
@@ -0,0 +1,697 @@
+/*
+ * Identifier functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libwtcdb_identifier.h"
+#include "libwtcdb_libcerror.h"
+#include "libwtcdb_libuna.h"
+
+#if defined( __AVX2__ )
+#define HAVE_LIBWTCDB_IDENTIFIER_AVX2	1
+#endif
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && ( _M_IX86_FP >= 2 ) )
+#define HAVE_LIBWTCDB_IDENTIFIER_SSE2	1
+#endif
+
+#if defined( HAVE_LIBWTCDB_IDENTIFIER_AVX2 )
+#include <immintrin.h>
+
+#elif defined( HAVE_LIBWTCDB_IDENTIFIER_SSE2 )
+#include <emmintrin.h>
+
+#endif
+
+/* Determines if the ASCII characters make up the entire UTF-16 little-endian stream
+ * either up to the end of the stream or up to an end-of-string character
+ */
+#define libwtcdb_identifier_is_ascii( utf16_stream, utf16_stream_size, ascii_length ) \
+	( ( ( ( ascii_length ) * 2 ) >= ( utf16_stream_size ) ) \
+	 || ( ( ( utf16_stream )[ ( ascii_length ) * 2 ] == 0 ) \
+	  &&  ( ( utf16_stream )[ ( ( ascii_length ) * 2 ) + 1 ] == 0 ) ) )
+
+/* Determines the number of leading ASCII characters in an UTF-16 little-endian stream
+ * The scan stops at the first character that is not in the range 0x01 - 0x7f
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_identifier_get_ascii_length(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     size_t *ascii_length,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LIBWTCDB_IDENTIFIER_AVX2 )
+	__m256i avx2_ascii_mask   = _mm256_set1_epi16( (short) 0xff80 );
+	__m256i avx2_units        = _mm256_setzero_si256();
+	__m256i avx2_zero         = _mm256_setzero_si256();
+#endif
+#if defined( HAVE_LIBWTCDB_IDENTIFIER_SSE2 )
+	__m128i sse2_ascii_mask   = _mm_set1_epi16( (short) 0xff80 );
+	__m128i sse2_units        = _mm_setzero_si128();
+	__m128i sse2_zero         = _mm_setzero_si128();
+#endif
+	static char *function     = "libwtcdb_identifier_get_ascii_length";
+	size_t utf16_stream_index = 0;
+
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ascii_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ASCII length.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_IDENTIFIER_AVX2 )
+	/* Check 16 characters at a time, a block is ASCII if no character
+	 * has bits outside 0x007f set and no character is 0
+	 */
+	while( ( utf16_stream_size - utf16_stream_index ) >= 32 )
+	{
+		avx2_units = _mm256_loadu_si256(
+		              (const __m256i *) &( utf16_stream[ utf16_stream_index ] ) );
+
+		avx2_units = _mm256_andnot_si256(
+		              _mm256_cmpeq_epi16(
+		               avx2_units,
+		               avx2_zero ),
+		              _mm256_cmpeq_epi16(
+		               _mm256_and_si256(
+		                avx2_units,
+		                avx2_ascii_mask ),
+		               avx2_zero ) );
+
+		if( _mm256_movemask_epi8(
+		     avx2_units ) != -1 )
+		{
+			break;
+		}
+		utf16_stream_index += 32;
+	}
+#endif
+#if defined( HAVE_LIBWTCDB_IDENTIFIER_SSE2 )
+	/* Check 8 characters at a time
+	 */
+	while( ( utf16_stream_size - utf16_stream_index ) >= 16 )
+	{
+		sse2_units = _mm_loadu_si128(
+		              (const __m128i *) &( utf16_stream[ utf16_stream_index ] ) );
+
+		sse2_units = _mm_andnot_si128(
+		              _mm_cmpeq_epi16(
+		               sse2_units,
+		               sse2_zero ),
+		              _mm_cmpeq_epi16(
+		               _mm_and_si128(
+		                sse2_units,
+		                sse2_ascii_mask ),
+		               sse2_zero ) );
+
+		if( _mm_movemask_epi8(
+		     sse2_units ) != 0xffff )
+		{
+			break;
+		}
+		utf16_stream_index += 16;
+	}
+#endif
+	/* Determine the remaining characters, including those of a block
+	 * that contains a non-ASCII character
+	 */
+	while( ( utf16_stream_index + 1 ) < utf16_stream_size )
+	{
+		if( ( utf16_stream[ utf16_stream_index + 1 ] != 0 )
+		 || ( utf16_stream[ utf16_stream_index ] == 0 )
+		 || ( utf16_stream[ utf16_stream_index ] >= 0x80 ) )
+		{
+			break;
+		}
+		utf16_stream_index += 2;
+	}
+	*ascii_length = utf16_stream_index / 2;
+
+	return( 1 );
+}
+
+/* Copies the leading ASCII characters of an UTF-16 little-endian stream to an ASCII string
+ * The copy stops at the first character that is not in the range 0x01 - 0x7f
+ * or when the ASCII string is full. The ASCII string is not terminated
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_identifier_copy_ascii(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     uint8_t *ascii_string,
+     size_t ascii_string_size,
+     size_t *ascii_length,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LIBWTCDB_IDENTIFIER_AVX2 )
+	__m256i avx2_ascii_mask   = _mm256_set1_epi16( (short) 0xff80 );
+	__m256i avx2_characters   = _mm256_setzero_si256();
+	__m256i avx2_units        = _mm256_setzero_si256();
+	__m256i avx2_zero         = _mm256_setzero_si256();
+#endif
+#if defined( HAVE_LIBWTCDB_IDENTIFIER_SSE2 )
+	__m128i sse2_ascii_mask   = _mm_set1_epi16( (short) 0xff80 );
+	__m128i sse2_characters   = _mm_setzero_si128();
+	__m128i sse2_units        = _mm_setzero_si128();
+	__m128i sse2_zero         = _mm_setzero_si128();
+#endif
+	static char *function     = "libwtcdb_identifier_copy_ascii";
+	size_t ascii_string_index = 0;
+	size_t utf16_stream_index = 0;
+
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ascii_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ASCII string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ascii_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid ASCII string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ascii_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ASCII length.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_IDENTIFIER_AVX2 )
+	/* Narrow 16 characters at a time, the pack operates per 128-bit lane
+	 * hence the permute to bring the 2 halves of the result together
+	 */
+	while( ( ( utf16_stream_size - utf16_stream_index ) >= 32 )
+	    && ( ( ascii_string_size - ascii_string_index ) >= 16 ) )
+	{
+		avx2_units = _mm256_loadu_si256(
+		              (const __m256i *) &( utf16_stream[ utf16_stream_index ] ) );
+
+		avx2_characters = _mm256_andnot_si256(
+		                   _mm256_cmpeq_epi16(
+		                    avx2_units,
+		                    avx2_zero ),
+		                   _mm256_cmpeq_epi16(
+		                    _mm256_and_si256(
+		                     avx2_units,
+		                     avx2_ascii_mask ),
+		                    avx2_zero ) );
+
+		if( _mm256_movemask_epi8(
+		     avx2_characters ) != -1 )
+		{
+			break;
+		}
+		avx2_characters = _mm256_permute4x64_epi64(
+		                   _mm256_packus_epi16(
+		                    avx2_units,
+		                    avx2_units ),
+		                   0xd8 );
+
+		_mm_storeu_si128(
+		 (__m128i *) &( ascii_string[ ascii_string_index ] ),
+		 _mm256_castsi256_si128(
+		  avx2_characters ) );
+
+		utf16_stream_index += 32;
+		ascii_string_index += 16;
+	}
+#endif
+#if defined( HAVE_LIBWTCDB_IDENTIFIER_SSE2 )
+	/* Narrow 8 characters at a time
+	 */
+	while( ( ( utf16_stream_size - utf16_stream_index ) >= 16 )
+	    && ( ( ascii_string_size - ascii_string_index ) >= 8 ) )
+	{
+		sse2_units = _mm_loadu_si128(
+		              (const __m128i *) &( utf16_stream[ utf16_stream_index ] ) );
+
+		sse2_characters = _mm_andnot_si128(
+		                   _mm_cmpeq_epi16(
+		                    sse2_units,
+		                    sse2_zero ),
+		                   _mm_cmpeq_epi16(
+		                    _mm_and_si128(
+		                     sse2_units,
+		                     sse2_ascii_mask ),
+		                    sse2_zero ) );
+
+		if( _mm_movemask_epi8(
+		     sse2_characters ) != 0xffff )
+		{
+			break;
+		}
+		_mm_storel_epi64(
+		 (__m128i *) &( ascii_string[ ascii_string_index ] ),
+		 _mm_packus_epi16(
+		  sse2_units,
+		  sse2_units ) );
+
+		utf16_stream_index += 16;
+		ascii_string_index += 8;
+	}
+#endif
+	while( ( ( utf16_stream_index + 1 ) < utf16_stream_size )
+	    && ( ascii_string_index < ascii_string_size ) )
+	{
+		if( ( utf16_stream[ utf16_stream_index + 1 ] != 0 )
+		 || ( utf16_stream[ utf16_stream_index ] == 0 )
+		 || ( utf16_stream[ utf16_stream_index ] >= 0x80 ) )
+		{
+			break;
+		}
+		ascii_string[ ascii_string_index++ ] = utf16_stream[ utf16_stream_index ];
+
+		utf16_stream_index += 2;
+	}
+	*ascii_length = ascii_string_index;
+
+	return( 1 );
+}
+
+/* Retrieves the size of an UTF-8 string of an UTF-16 little-endian stream
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_identifier_get_utf8_string_size(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_identifier_get_utf8_string_size";
+	size_t ascii_length   = 0;
+
+	if( ( utf16_stream_size % 2 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-16 stream size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libwtcdb_identifier_get_ascii_length(
+	     utf16_stream,
+	     utf16_stream_size,
+	     &ascii_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine ASCII length.",
+		 function );
+
+		return( -1 );
+	}
+	if( libwtcdb_identifier_is_ascii(
+	     utf16_stream,
+	     utf16_stream_size,
+	     ascii_length ) )
+	{
+		*utf8_string_size = ascii_length + 1;
+
+		return( 1 );
+	}
+	if( libuna_utf8_string_size_from_utf16_stream(
+	     utf16_stream,
+	     utf16_stream_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies an UTF-16 little-endian stream to an UTF-8 string
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_identifier_copy_to_utf8_string(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_identifier_copy_to_utf8_string";
+	size_t ascii_length   = 0;
+
+	if( ( utf16_stream_size % 2 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-16 stream size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string_size == 0 )
+	 || ( utf8_string_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libwtcdb_identifier_copy_ascii(
+	     utf16_stream,
+	     utf16_stream_size,
+	     utf8_string,
+	     utf8_string_size - 1,
+	     &ascii_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy ASCII characters.",
+		 function );
+
+		return( -1 );
+	}
+	if( libwtcdb_identifier_is_ascii(
+	     utf16_stream,
+	     utf16_stream_size,
+	     ascii_length ) )
+	{
+		utf8_string[ ascii_length ] = 0;
+
+		return( 1 );
+	}
+	/* Fall back to the character by character conversion if the stream
+	 * contains non-ASCII characters or the UTF-8 string is too small
+	 */
+	if( libuna_utf8_string_copy_from_utf16_stream(
+	     (libuna_utf8_character_t *) utf8_string,
+	     utf8_string_size,
+	     utf16_stream,
+	     utf16_stream_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of an UTF-16 string of an UTF-16 little-endian stream
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_identifier_get_utf16_string_size(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_identifier_get_utf16_string_size";
+	size_t ascii_length   = 0;
+
+	if( ( utf16_stream_size % 2 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-16 stream size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libwtcdb_identifier_get_ascii_length(
+	     utf16_stream,
+	     utf16_stream_size,
+	     &ascii_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine ASCII length.",
+		 function );
+
+		return( -1 );
+	}
+	if( libwtcdb_identifier_is_ascii(
+	     utf16_stream,
+	     utf16_stream_size,
+	     ascii_length ) )
+	{
+		*utf16_string_size = ascii_length + 1;
+
+		return( 1 );
+	}
+	if( libuna_utf16_string_size_from_utf16_stream(
+	     utf16_stream,
+	     utf16_stream_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 string size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies an UTF-16 little-endian stream to an UTF-16 string
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_identifier_copy_to_utf16_string(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libwtcdb_identifier_copy_to_utf16_string";
+	size_t ascii_length       = 0;
+	size_t utf16_string_index = 0;
+
+	if( ( utf16_stream_size % 2 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-16 stream size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf16_string_size == 0 )
+	 || ( utf16_string_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-16 string size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libwtcdb_identifier_get_ascii_length(
+	     utf16_stream,
+	     utf16_stream_size,
+	     &ascii_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine ASCII length.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ascii_length < utf16_string_size )
+	 && libwtcdb_identifier_is_ascii(
+	     utf16_stream,
+	     utf16_stream_size,
+	     ascii_length ) )
+	{
+		for( utf16_string_index = 0;
+		     utf16_string_index < ascii_length;
+		     utf16_string_index++ )
+		{
+			utf16_string[ utf16_string_index ] = (uint16_t) utf16_stream[ utf16_string_index * 2 ];
+		}
+		utf16_string[ ascii_length ] = 0;
+
+		return( 1 );
+	}
+	if( libuna_utf16_string_copy_from_utf16_stream(
+	     (libuna_utf16_character_t *) utf16_string,
+	     utf16_string_size,
+	     utf16_stream,
+	     utf16_stream_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
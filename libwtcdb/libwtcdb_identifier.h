@@ -0,0 +1,79 @@
+/*
+ * Identifier functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBWTCDB_IDENTIFIER_H )
+#define _LIBWTCDB_IDENTIFIER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libwtcdb_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+int libwtcdb_identifier_get_ascii_length(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     size_t *ascii_length,
+     libcerror_error_t **error );
+
+int libwtcdb_identifier_copy_ascii(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     uint8_t *ascii_string,
+     size_t ascii_string_size,
+     size_t *ascii_length,
+     libcerror_error_t **error );
+
+int libwtcdb_identifier_get_utf8_string_size(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+int libwtcdb_identifier_copy_to_utf8_string(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+int libwtcdb_identifier_get_utf16_string_size(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
+int libwtcdb_identifier_copy_to_utf16_string(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBWTCDB_IDENTIFIER_H ) */
+
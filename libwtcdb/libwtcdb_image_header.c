@@ -0,0 +1,607 @@
+/*
+ * Image header functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libwtcdb_definitions.h"
+#include "libwtcdb_image_header.h"
+#include "libwtcdb_jpeg.h"
+#include "libwtcdb_io_backend.h"
+#include "libwtcdb_libbfio.h"
+#include "libwtcdb_libcerror.h"
+#include "libwtcdb_libcnotify.h"
+
+const uint8_t libwtcdb_image_header_bmp_signature[ 2 ] = {
+	'B', 'M' };
+
+const uint8_t libwtcdb_image_header_jpeg_signature[ 3 ] = {
+	0xff, 0xd8, 0xff };
+
+const uint8_t libwtcdb_image_header_png_signature[ 8 ] = {
+	0x89, 'P', 'N', 'G', 0x0d, 0x0a, 0x1a, 0x0a };
+
+/* Creates an image header
+ * Make sure the value image_header is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_image_header_initialize(
+     libwtcdb_image_header_t **image_header,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_image_header_initialize";
+
+	if( image_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image header.",
+		 function );
+
+		return( -1 );
+	}
+	if( *image_header != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid image header value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*image_header = memory_allocate_structure(
+	                 libwtcdb_image_header_t );
+
+	if( *image_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create image header.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *image_header,
+	     0,
+	     sizeof( libwtcdb_image_header_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear image header.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *image_header != NULL )
+	{
+		memory_free(
+		 *image_header );
+
+		*image_header = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an image header
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_image_header_free(
+     libwtcdb_image_header_t **image_header,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_image_header_free";
+
+	if( image_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image header.",
+		 function );
+
+		return( -1 );
+	}
+	if( *image_header != NULL )
+	{
+		memory_free(
+		 *image_header );
+
+		*image_header = NULL;
+	}
+	return( 1 );
+}
+
+/* Reads the image header from the start of the image data
+ * The data should contain at least LIBWTCDB_IMAGE_HEADER_DATA_SIZE bytes
+ * to be able to determine the dimensions of a BMP or PNG image. For a JPEG
+ * image only the format is determined since the dimensions are stored in
+ * a segment further on in the data.
+ * Returns 1 if successful, 0 if the format is not supported or -1 on error
+ */
+int libwtcdb_image_header_read_data(
+     libwtcdb_image_header_t *image_header,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libwtcdb_image_header_read_data";
+	uint32_t header_size      = 0;
+	uint32_t value_32bit      = 0;
+	uint16_t value_16bit      = 0;
+	uint8_t bit_depth         = 0;
+	uint8_t color_type        = 0;
+	uint8_t number_of_samples = 0;
+
+	if( image_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image header.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	image_header->format         = LIBWTCDB_IMAGE_FORMAT_UNKNOWN;
+	image_header->width          = 0;
+	image_header->height         = 0;
+	image_header->bits_per_pixel = 0;
+
+	if( ( data_size >= 3 )
+	 && ( memory_compare(
+	       data,
+	       libwtcdb_image_header_jpeg_signature,
+	       3 ) == 0 ) )
+	{
+		image_header->format = LIBWTCDB_IMAGE_FORMAT_JPEG;
+
+		return( 1 );
+	}
+	if( ( data_size >= 26 )
+	 && ( memory_compare(
+	       data,
+	       libwtcdb_image_header_png_signature,
+	       8 ) == 0 ) )
+	{
+		/* The IHDR chunk is required to be the first chunk
+		 */
+		if( memory_compare(
+		     &( data[ 12 ] ),
+		     "IHDR",
+		     4 ) != 0 )
+		{
+			return( 0 );
+		}
+		byte_stream_copy_to_uint32_big_endian(
+		 &( data[ 16 ] ),
+		 image_header->width );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 &( data[ 20 ] ),
+		 image_header->height );
+
+		bit_depth  = data[ 24 ];
+		color_type = data[ 25 ];
+
+		switch( color_type )
+		{
+			case 0:
+			case 3:
+				number_of_samples = 1;
+				break;
+
+			case 2:
+				number_of_samples = 3;
+				break;
+
+			case 4:
+				number_of_samples = 2;
+				break;
+
+			case 6:
+				number_of_samples = 4;
+				break;
+
+			default:
+				return( 0 );
+		}
+		image_header->format         = LIBWTCDB_IMAGE_FORMAT_PNG;
+		image_header->bits_per_pixel = (uint16_t) bit_depth * number_of_samples;
+	}
+	else if( ( data_size >= 26 )
+	      && ( memory_compare(
+	            data,
+	            libwtcdb_image_header_bmp_signature,
+	            2 ) == 0 ) )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ 14 ] ),
+		 header_size );
+
+		if( header_size == 12 )
+		{
+			/* BITMAPCOREHEADER
+			 */
+			byte_stream_copy_to_uint16_little_endian(
+			 &( data[ 18 ] ),
+			 value_16bit );
+
+			image_header->width = value_16bit;
+
+			byte_stream_copy_to_uint16_little_endian(
+			 &( data[ 20 ] ),
+			 value_16bit );
+
+			image_header->height = value_16bit;
+
+			byte_stream_copy_to_uint16_little_endian(
+			 &( data[ 24 ] ),
+			 image_header->bits_per_pixel );
+		}
+		else if( ( header_size >= 40 )
+		      && ( data_size >= 30 ) )
+		{
+			/* BITMAPINFOHEADER and later versions
+			 */
+			byte_stream_copy_to_uint32_little_endian(
+			 &( data[ 18 ] ),
+			 value_32bit );
+
+			if( ( value_32bit & 0x80000000UL ) != 0 )
+			{
+				value_32bit = 0 - value_32bit;
+			}
+			image_header->width = value_32bit;
+
+			/* A negative height indicates a top-down bitmap
+			 */
+			byte_stream_copy_to_uint32_little_endian(
+			 &( data[ 22 ] ),
+			 value_32bit );
+
+			if( ( value_32bit & 0x80000000UL ) != 0 )
+			{
+				value_32bit = 0 - value_32bit;
+			}
+			image_header->height = value_32bit;
+
+			byte_stream_copy_to_uint16_little_endian(
+			 &( data[ 28 ] ),
+			 image_header->bits_per_pixel );
+		}
+		else
+		{
+			return( 0 );
+		}
+		image_header->format = LIBWTCDB_IMAGE_FORMAT_BMP;
+	}
+	else
+	{
+		return( 0 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: width\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 image_header->width );
+
+		libcnotify_printf(
+		 "%s: height\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 image_header->height );
+
+		libcnotify_printf(
+		 "%s: bits per pixel\t\t\t: %" PRIu16 "\n",
+		 function,
+		 image_header->bits_per_pixel );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	return( 1 );
+}
+
+/* Reads the dimensions of a JPEG image from its start of frame (SOF) segment
+ * Only the marker and length of every segment preceding the SOF segment are read
+ * Returns 1 if successful, 0 if no SOF segment was found or -1 on error
+ */
+int libwtcdb_image_header_read_jpeg_file_io_handle(
+     libwtcdb_image_header_t *image_header,
+     libwtcdb_io_backend_t *io_backend,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     uint32_t data_size,
+     libcerror_error_t **error )
+{
+	libwtcdb_jpeg_segment_t jpeg_segment;
+
+	static char *function = "libwtcdb_image_header_read_jpeg_file_io_handle";
+	uint16_t value_16bit  = 0;
+	int result            = 0;
+
+	if( image_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image header.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &jpeg_segment,
+	     0,
+	     sizeof( libwtcdb_jpeg_segment_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear JPEG segment.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		result = libwtcdb_jpeg_segment_read_next_file_io_handle(
+		          &jpeg_segment,
+		          io_backend,
+		          file_io_handle,
+		          file_offset,
+		          data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read JPEG segment.",
+			 function );
+
+			return( -1 );
+		}
+		/* SOF0 - SOF15 excluding DHT (0xc4), JPG (0xc8) and DAC (0xcc)
+		 */
+		else if( ( result != 0 )
+		      && ( jpeg_segment.marker >= 0xc0 )
+		      && ( jpeg_segment.marker <= 0xcf )
+		      && ( jpeg_segment.marker != 0xc4 )
+		      && ( jpeg_segment.marker != 0xc8 )
+		      && ( jpeg_segment.marker != 0xcc ) )
+		{
+			if( ( jpeg_segment.size < 8 )
+			 || ( jpeg_segment.data_size < 10 ) )
+			{
+				break;
+			}
+			byte_stream_copy_to_uint16_big_endian(
+			 &( jpeg_segment.data[ 5 ] ),
+			 value_16bit );
+
+			image_header->height = value_16bit;
+
+			byte_stream_copy_to_uint16_big_endian(
+			 &( jpeg_segment.data[ 7 ] ),
+			 value_16bit );
+
+			image_header->width          = value_16bit;
+			image_header->bits_per_pixel = (uint16_t) jpeg_segment.data[ 4 ] * jpeg_segment.data[ 9 ];
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: width\t\t\t\t: %" PRIu32 "\n",
+				 function,
+				 image_header->width );
+
+				libcnotify_printf(
+				 "%s: height\t\t\t\t: %" PRIu32 "\n",
+				 function,
+				 image_header->height );
+
+				libcnotify_printf(
+				 "%s: bits per pixel\t\t\t: %" PRIu16 "\n",
+				 function,
+				 image_header->bits_per_pixel );
+
+				libcnotify_printf(
+				 "\n" );
+			}
+#endif
+			return( 1 );
+		}
+	}
+	while( result != 0 );
+
+	return( 0 );
+}
+
+/* Reads the image header from the image data
+ * Returns 1 if successful, 0 if the format or dimensions could not be determined or -1 on error
+ */
+int libwtcdb_image_header_read_file_io_handle(
+     libwtcdb_image_header_t *image_header,
+     libwtcdb_io_backend_t *io_backend,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     uint32_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t header_data[ LIBWTCDB_IMAGE_HEADER_DATA_SIZE ];
+
+	static char *function = "libwtcdb_image_header_read_file_io_handle";
+	size_t read_size      = 0;
+	ssize_t read_count    = 0;
+	int result            = 0;
+
+	if( image_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image header.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	read_size = LIBWTCDB_IMAGE_HEADER_DATA_SIZE;
+
+	if( read_size > (size_t) data_size )
+	{
+		read_size = (size_t) data_size;
+	}
+	if( read_size == 0 )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading image header at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+		 function,
+		 file_offset,
+		 file_offset );
+	}
+#endif
+	read_count = libwtcdb_io_backend_read_buffer_at_offset(
+	              io_backend,
+	              file_io_handle,
+	              header_data,
+	              read_size,
+	              file_offset,
+	              error );
+
+	if( read_count != (ssize_t) read_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read image header data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		return( -1 );
+	}
+	result = libwtcdb_image_header_read_data(
+	          image_header,
+	          header_data,
+	          read_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read image header.",
+		 function );
+
+		return( -1 );
+	}
+	else if( ( result != 0 )
+	      && ( image_header->format == LIBWTCDB_IMAGE_FORMAT_JPEG ) )
+	{
+		result = libwtcdb_image_header_read_jpeg_file_io_handle(
+		          image_header,
+		          io_backend,
+		          file_io_handle,
+		          file_offset,
+		          data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read JPEG image header.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
@@ -0,0 +1,92 @@
+/*
+ * Image header functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBWTCDB_IMAGE_HEADER_H )
+#define _LIBWTCDB_IMAGE_HEADER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libwtcdb_io_backend.h"
+#include "libwtcdb_libbfio.h"
+#include "libwtcdb_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libwtcdb_image_header libwtcdb_image_header_t;
+
+struct libwtcdb_image_header
+{
+	/* The image format
+	 */
+	uint8_t format;
+
+	/* The width in pixels
+	 */
+	uint32_t width;
+
+	/* The height in pixels
+	 */
+	uint32_t height;
+
+	/* The number of bits per pixel
+	 */
+	uint16_t bits_per_pixel;
+};
+
+int libwtcdb_image_header_initialize(
+     libwtcdb_image_header_t **image_header,
+     libcerror_error_t **error );
+
+int libwtcdb_image_header_free(
+     libwtcdb_image_header_t **image_header,
+     libcerror_error_t **error );
+
+int libwtcdb_image_header_read_data(
+     libwtcdb_image_header_t *image_header,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libwtcdb_image_header_read_jpeg_file_io_handle(
+     libwtcdb_image_header_t *image_header,
+     libwtcdb_io_backend_t *io_backend,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     uint32_t data_size,
+     libcerror_error_t **error );
+
+int libwtcdb_image_header_read_file_io_handle(
+     libwtcdb_image_header_t *image_header,
+     libwtcdb_io_backend_t *io_backend,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     uint32_t data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBWTCDB_IMAGE_HEADER_H ) */
+
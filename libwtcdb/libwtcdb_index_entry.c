@@ -26,6 +26,7 @@
 #include "libwtcdb_debug.h"
 #include "libwtcdb_definitions.h"
 #include "libwtcdb_index_entry.h"
+#include "libwtcdb_io_backend.h"
 #include "libwtcdb_io_handle.h"
 #include "libwtcdb_libbfio.h"
 #include "libwtcdb_libcerror.h"
@@ -147,14 +148,14 @@ int libwtcdb_index_entry_read_data(
      size_t data_size,
      libcerror_error_t **error )
 {
+	const uint8_t *cache_entry_offset = NULL;
 	static char *function             = "libwtcdb_index_entry_read_data";
 	size_t index_entry_data_size      = 0;
+	int number_of_offsets             = 0;
+	int offset_index                  = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
-	const uint8_t *cache_entry_offset = NULL;
 	uint32_t value_32bit              = 0;
-	int number_of_offsets             = 0;
-	int offset_index                  = 0;
 #endif
 
 	if( index_entry == NULL )
@@ -210,22 +211,27 @@ int libwtcdb_index_entry_read_data(
 	if( io_handle->format_version == 20 )
 	{
 		index_entry_data_size = sizeof( wtcdb_index_entry_v20_t );
+		number_of_offsets     = 5;
 	}
 	else if( io_handle->format_version == 21 )
 	{
 		index_entry_data_size = sizeof( wtcdb_index_entry_v21_t );
+		number_of_offsets     = 5;
 	}
 	else if( io_handle->format_version == 30 )
 	{
 		index_entry_data_size = sizeof( wtcdb_index_entry_v30_t );
+		number_of_offsets     = 9;
 	}
 	else if( io_handle->format_version == 31 )
 	{
 		index_entry_data_size = sizeof( wtcdb_index_entry_v31_t );
+		number_of_offsets     = 11;
 	}
 	else if( io_handle->format_version == 32 )
 	{
 		index_entry_data_size = sizeof( wtcdb_index_entry_v32_t );
+		number_of_offsets     = 14;
 	}
 	if( data == NULL )
 	{
@@ -271,7 +277,43 @@ int libwtcdb_index_entry_read_data(
 		byte_stream_copy_to_uint64_little_endian(
 		 ( (wtcdb_index_entry_v20_t *) data )->modification_time,
 		 index_entry->modification_time );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (wtcdb_index_entry_v20_t *) data )->flags,
+		 index_entry->flags );
+
+		cache_entry_offset = ( (wtcdb_index_entry_v20_t *) data )->cache_entry_offsets;
 	}
+	else if( io_handle->format_version == 21 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (wtcdb_index_entry_v21_t *) data )->flags,
+		 index_entry->flags );
+
+		cache_entry_offset = ( (wtcdb_index_entry_v21_t *) data )->cache_entry_offsets;
+	}
+	else
+	{
+		/* The upper 32-bit of the 64-bit flags are not retained
+		 */
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (wtcdb_index_entry_v30_t *) data )->flags,
+		 index_entry->flags );
+
+		cache_entry_offset = ( (wtcdb_index_entry_v30_t *) data )->cache_entry_offsets;
+	}
+	for( offset_index = 0;
+	     offset_index < number_of_offsets;
+	     offset_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 cache_entry_offset,
+		 index_entry->cache_entry_offsets[ offset_index ] );
+
+		cache_entry_offset += 4;
+	}
+	index_entry->number_of_cache_entry_offsets = number_of_offsets;
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -300,64 +342,21 @@ int libwtcdb_index_entry_read_data(
 
 				return( -1 );
 			}
-			byte_stream_copy_to_uint32_little_endian(
-			 ( (wtcdb_index_entry_v20_t *) data )->flags,
-			 value_32bit );
-		}
-		else if( ( io_handle->format_version == 21 )
-		      || ( io_handle->format_version == 30 )
-		      || ( io_handle->format_version == 31 )
-		      || ( io_handle->format_version == 32 ) )
-		{
-			byte_stream_copy_to_uint32_little_endian(
-			 ( (wtcdb_index_entry_v21_t *) data )->flags,
-			 value_32bit );
 		}
 		libcnotify_printf(
 		 "%s: flags\t\t\t\t\t: 0x%08" PRIx32 "\n",
 		 function,
-		 value_32bit );
+		 index_entry->flags );
 
-		if( io_handle->format_version == 20 )
-		{
-			cache_entry_offset = ( (wtcdb_index_entry_v20_t *) data )->cache_entry_offsets;
-			number_of_offsets  = 5;
-		}
-		else if( io_handle->format_version == 21 )
-		{
-			cache_entry_offset = ( (wtcdb_index_entry_v21_t *) data )->cache_entry_offsets;
-			number_of_offsets  = 5;
-		}
-		else if( io_handle->format_version == 30 )
-		{
-			cache_entry_offset = ( (wtcdb_index_entry_v30_t *) data )->cache_entry_offsets;
-			number_of_offsets  = 9;
-		}
-		else if( io_handle->format_version == 31 )
-		{
-			cache_entry_offset = ( (wtcdb_index_entry_v31_t *) data )->cache_entry_offsets;
-			number_of_offsets  = 11;
-		}
-		else if( io_handle->format_version == 32 )
-		{
-			cache_entry_offset = ( (wtcdb_index_entry_v32_t *) data )->cache_entry_offsets;
-			number_of_offsets  = 14;
-		}
 		for( offset_index = 0;
 		     offset_index < number_of_offsets;
 		     offset_index++ )
 		{
-			byte_stream_copy_to_uint32_little_endian(
-			 cache_entry_offset,
-			 value_32bit );
-
 			libcnotify_printf(
 			 "%s: cache entry offset: %d\t\t\t: 0x%08" PRIx32 "\n",
 			 function,
 			 offset_index,
-			 value_32bit );
-
-			cache_entry_offset += 4;
+			 index_entry->cache_entry_offsets[ offset_index ] );
 		}
 		if( ( io_handle->format_version == 30 )
 		 || ( io_handle->format_version == 31 ) )
@@ -477,7 +476,8 @@ int libwtcdb_index_entry_read_file_io_handle(
 		 file_offset );
 	}
 #endif
-	read_count = libbfio_handle_read_buffer_at_offset(
+	read_count = libwtcdb_io_backend_read_buffer_at_offset(
+	              io_handle->io_backend,
 	              file_io_handle,
 	              index_entry_data,
 	              index_entry_data_size,
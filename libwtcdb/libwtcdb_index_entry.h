@@ -33,6 +33,10 @@
 extern "C" {
 #endif
 
+/* The maximum number of cache entry offsets of an index entry, which is 14 in format version 32
+ */
+#define LIBWTCDB_INDEX_ENTRY_MAXIMUM_NUMBER_OF_CACHE_ENTRY_OFFSETS	14
+
 typedef struct libwtcdb_index_entry libwtcdb_index_entry_t;
 
 struct libwtcdb_index_entry
@@ -48,6 +52,18 @@ struct libwtcdb_index_entry
 	/* The modification date and time
 	 */
 	uint64_t modification_time;
+
+	/* The flags
+	 */
+	uint32_t flags;
+
+	/* The number of cache entry offsets
+	 */
+	int number_of_cache_entry_offsets;
+
+	/* The cache entry offsets, one per cache file type
+	 */
+	uint32_t cache_entry_offsets[ LIBWTCDB_INDEX_ENTRY_MAXIMUM_NUMBER_OF_CACHE_ENTRY_OFFSETS ];
 };
 
 int libwtcdb_index_entry_initialize(
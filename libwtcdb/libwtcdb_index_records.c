@@ -0,0 +1,689 @@
+/*
+ * Index records functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libwtcdb_definitions.h"
+#include "libwtcdb_index_records.h"
+#include "libwtcdb_io_handle.h"
+#include "libwtcdb_libcerror.h"
+
+#include "wtcdb_index_entry.h"
+
+#if defined( __AVX2__ )
+#define HAVE_LIBWTCDB_INDEX_RECORDS_AVX2	1
+#endif
+
+#if defined( HAVE_LIBWTCDB_INDEX_RECORDS_AVX2 )
+#include <immintrin.h>
+
+#endif
+
+/* Creates index records
+ * Make sure the value index_records is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_index_records_initialize(
+     libwtcdb_index_records_t **index_records,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_index_records_initialize";
+
+	if( index_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index records.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index_records != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index records value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*index_records = memory_allocate_structure(
+	                  libwtcdb_index_records_t );
+
+	if( *index_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index records.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *index_records,
+	     0,
+	     sizeof( libwtcdb_index_records_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear index records.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *index_records != NULL )
+	{
+		memory_free(
+		 *index_records );
+
+		*index_records = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees index records
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_index_records_free(
+     libwtcdb_index_records_t **index_records,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_index_records_free";
+	int result            = 1;
+
+	if( index_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index records.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index_records != NULL )
+	{
+		if( libwtcdb_index_records_clear(
+		     *index_records,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear index records.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *index_records );
+
+		*index_records = NULL;
+	}
+	return( result );
+}
+
+/* Clears index records
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_index_records_clear(
+     libwtcdb_index_records_t *index_records,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_index_records_clear";
+
+	if( index_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index records.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_records->hashes != NULL )
+	{
+		memory_free(
+		 index_records->hashes );
+	}
+	if( index_records->modification_times != NULL )
+	{
+		memory_free(
+		 index_records->modification_times );
+	}
+	if( index_records->flags != NULL )
+	{
+		memory_free(
+		 index_records->flags );
+	}
+	if( index_records->cache_entry_offsets != NULL )
+	{
+		memory_free(
+		 index_records->cache_entry_offsets );
+	}
+	if( memory_set(
+	     index_records,
+	     0,
+	     sizeof( libwtcdb_index_records_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear index records.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the layout of an index entry record of a specific format version
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_index_records_get_record_layout(
+     uint32_t format_version,
+     size_t *record_size,
+     size_t *flags_offset,
+     size_t *cache_entry_offsets_offset,
+     int *number_of_cache_entry_offsets,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_index_records_get_record_layout";
+
+	if( record_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record size.",
+		 function );
+
+		return( -1 );
+	}
+	if( flags_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid flags offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_entry_offsets_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache entry offsets offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_cache_entry_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of cache entry offsets.",
+		 function );
+
+		return( -1 );
+	}
+	switch( format_version )
+	{
+		case 20:
+			*record_size                   = sizeof( wtcdb_index_entry_v20_t );
+			*flags_offset                  = 16;
+			*cache_entry_offsets_offset    = 20;
+			*number_of_cache_entry_offsets = 5;
+			break;
+
+		case 21:
+			*record_size                   = sizeof( wtcdb_index_entry_v21_t );
+			*flags_offset                  = 8;
+			*cache_entry_offsets_offset    = 12;
+			*number_of_cache_entry_offsets = 5;
+			break;
+
+		case 30:
+			*record_size                   = sizeof( wtcdb_index_entry_v30_t );
+			*flags_offset                  = 8;
+			*cache_entry_offsets_offset    = 16;
+			*number_of_cache_entry_offsets = 9;
+			break;
+
+		case 31:
+			*record_size                   = sizeof( wtcdb_index_entry_v31_t );
+			*flags_offset                  = 8;
+			*cache_entry_offsets_offset    = 16;
+			*number_of_cache_entry_offsets = 11;
+			break;
+
+		case 32:
+			*record_size                   = sizeof( wtcdb_index_entry_v32_t );
+			*flags_offset                  = 8;
+			*cache_entry_offsets_offset    = 16;
+			*number_of_cache_entry_offsets = 14;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported format version: %" PRIu32 ".",
+			 function,
+			 format_version );
+
+			return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads a contiguous block of index entry records
+ * The data size must be a multiple of the index entry record size
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_index_records_read_data(
+     libwtcdb_index_records_t *index_records,
+     libwtcdb_io_handle_t *io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	const uint8_t *record_data           = NULL;
+	static char *function                = "libwtcdb_index_records_read_data";
+	size_t cache_entry_offsets_offset    = 0;
+	size_t flags_offset                  = 0;
+	size_t number_of_records             = 0;
+	size_t record_index                  = 0;
+	size_t record_size                   = 0;
+	size_t values_index                  = 0;
+	int number_of_cache_entry_offsets    = 0;
+	int offset_index                     = 0;
+
+#if defined( HAVE_LIBWTCDB_INDEX_RECORDS_AVX2 )
+	__m256i avx2_record_offsets          = _mm256_setzero_si256();
+	__m256i avx2_values                  = _mm256_setzero_si256();
+	__m128i avx2_flags_record_offsets    = _mm_setzero_si128();
+	__m128i avx2_flags                   = _mm_setzero_si128();
+	size_t number_of_gathered_records    = 0;
+#endif
+
+	if( index_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index records.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle->file_type != LIBWTCDB_FILE_TYPE_INDEX_V20 )
+	 && ( io_handle->file_type != LIBWTCDB_FILE_TYPE_INDEX_V30 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid IO handle - unsupported file type.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libwtcdb_index_records_get_record_layout(
+	     io_handle->format_version,
+	     &record_size,
+	     &flags_offset,
+	     &cache_entry_offsets_offset,
+	     &number_of_cache_entry_offsets,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve index entry record layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size % record_size ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported data size: %" PRIzd " not a multiple of the index entry size: %" PRIzd ".",
+		 function,
+		 data_size,
+		 record_size );
+
+		return( -1 );
+	}
+	number_of_records = data_size / record_size;
+
+	if( number_of_records > (size_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of records value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libwtcdb_index_records_clear(
+	     index_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear index records.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records == 0 )
+	{
+		return( 1 );
+	}
+	index_records->hashes = (uint64_t *) memory_allocate(
+	                                      sizeof( uint64_t ) * number_of_records );
+
+	if( index_records->hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hashes.",
+		 function );
+
+		goto on_error;
+	}
+	index_records->modification_times = (uint64_t *) memory_allocate(
+	                                                  sizeof( uint64_t ) * number_of_records );
+
+	if( index_records->modification_times == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create modification times.",
+		 function );
+
+		goto on_error;
+	}
+	index_records->flags = (uint32_t *) memory_allocate(
+	                                     sizeof( uint32_t ) * number_of_records );
+
+	if( index_records->flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create flags.",
+		 function );
+
+		goto on_error;
+	}
+	/* The number of cache entry offsets per record is at most 14 hence
+	 * this cannot exceed the maximum allocation size when data_size does not
+	 */
+	index_records->cache_entry_offsets = (uint32_t *) memory_allocate(
+	                                                   sizeof( uint32_t ) * number_of_records * (size_t) number_of_cache_entry_offsets );
+
+	if( index_records->cache_entry_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cache entry offsets.",
+		 function );
+
+		goto on_error;
+	}
+	index_records->number_of_records             = (int) number_of_records;
+	index_records->number_of_cache_entry_offsets = number_of_cache_entry_offsets;
+
+#if defined( HAVE_LIBWTCDB_INDEX_RECORDS_AVX2 )
+	/* Gather the 64-bit and 32-bit values of 4 records at once
+	 * this relies on the host being little-endian, which is the case for all
+	 * platforms that support AVX2
+	 */
+	number_of_gathered_records = number_of_records & ~( (size_t) 3 );
+
+	avx2_record_offsets = _mm256_setr_epi64x(
+	                       0,
+	                       (long long) record_size,
+	                       (long long) ( record_size * 2 ),
+	                       (long long) ( record_size * 3 ) );
+
+	avx2_flags_record_offsets = _mm_setr_epi32(
+	                             0,
+	                             (int) record_size,
+	                             (int) ( record_size * 2 ),
+	                             (int) ( record_size * 3 ) );
+
+	for( record_index = 0;
+	     record_index < number_of_gathered_records;
+	     record_index += 4 )
+	{
+		record_data = &( data[ record_index * record_size ] );
+
+		avx2_values = _mm256_i64gather_epi64(
+		               (const long long *) record_data,
+		               avx2_record_offsets,
+		               1 );
+
+		_mm256_storeu_si256(
+		 (__m256i *) &( index_records->hashes[ record_index ] ),
+		 avx2_values );
+
+		if( io_handle->format_version == 20 )
+		{
+			avx2_values = _mm256_i64gather_epi64(
+			               (const long long *) &( record_data[ 8 ] ),
+			               avx2_record_offsets,
+			               1 );
+		}
+		else
+		{
+			avx2_values = _mm256_setzero_si256();
+		}
+		_mm256_storeu_si256(
+		 (__m256i *) &( index_records->modification_times[ record_index ] ),
+		 avx2_values );
+
+		avx2_flags = _mm_i32gather_epi32(
+		              (const int *) &( record_data[ flags_offset ] ),
+		              avx2_flags_record_offsets,
+		              1 );
+
+		_mm_storeu_si128(
+		 (__m128i *) &( index_records->flags[ record_index ] ),
+		 avx2_flags );
+	}
+	/* The cache entry offsets of a record are contiguous and copied 8 or 4 at a time
+	 */
+	values_index = 0;
+
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		record_data = &( data[ ( record_index * record_size ) + cache_entry_offsets_offset ] );
+
+		for( offset_index = 0;
+		     ( offset_index + 8 ) <= number_of_cache_entry_offsets;
+		     offset_index += 8 )
+		{
+			avx2_values = _mm256_loadu_si256(
+			               (const __m256i *) &( record_data[ offset_index * 4 ] ) );
+
+			_mm256_storeu_si256(
+			 (__m256i *) &( index_records->cache_entry_offsets[ values_index ] ),
+			 avx2_values );
+
+			values_index += 8;
+		}
+		if( ( offset_index + 4 ) <= number_of_cache_entry_offsets )
+		{
+			avx2_flags = _mm_loadu_si128(
+			              (const __m128i *) &( record_data[ offset_index * 4 ] ) );
+
+			_mm_storeu_si128(
+			 (__m128i *) &( index_records->cache_entry_offsets[ values_index ] ),
+			 avx2_flags );
+
+			offset_index += 4;
+			values_index += 4;
+		}
+		while( offset_index < number_of_cache_entry_offsets )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 &( record_data[ offset_index * 4 ] ),
+			 index_records->cache_entry_offsets[ values_index ] );
+
+			offset_index++;
+			values_index++;
+		}
+	}
+	record_index = number_of_gathered_records;
+
+#endif /* defined( HAVE_LIBWTCDB_INDEX_RECORDS_AVX2 ) */
+
+	/* Decode the remaining records
+	 */
+	while( record_index < number_of_records )
+	{
+		record_data = &( data[ record_index * record_size ] );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( record_data[ 0 ] ),
+		 index_records->hashes[ record_index ] );
+
+		if( io_handle->format_version == 20 )
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 &( record_data[ 8 ] ),
+			 index_records->modification_times[ record_index ] );
+		}
+		else
+		{
+			index_records->modification_times[ record_index ] = 0;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( record_data[ flags_offset ] ),
+		 index_records->flags[ record_index ] );
+
+#if !defined( HAVE_LIBWTCDB_INDEX_RECORDS_AVX2 )
+		values_index = record_index * (size_t) number_of_cache_entry_offsets;
+
+		for( offset_index = 0;
+		     offset_index < number_of_cache_entry_offsets;
+		     offset_index++ )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 &( record_data[ cache_entry_offsets_offset + ( offset_index * 4 ) ] ),
+			 index_records->cache_entry_offsets[ values_index ] );
+
+			values_index++;
+		}
+#endif
+		record_index++;
+	}
+	return( 1 );
+
+on_error:
+	libwtcdb_index_records_clear(
+	 index_records,
+	 NULL );
+
+	return( -1 );
+}
+
@@ -0,0 +1,99 @@
+/*
+ * Index records functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBWTCDB_INDEX_RECORDS_H )
+#define _LIBWTCDB_INDEX_RECORDS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libwtcdb_io_handle.h"
+#include "libwtcdb_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libwtcdb_index_records libwtcdb_index_records_t;
+
+/* The index records contain the values of a contiguous block of index entries
+ * stored per value (column) instead of per index entry
+ */
+struct libwtcdb_index_records
+{
+	/* The number of records
+	 */
+	int number_of_records;
+
+	/* The number of cache entry offsets per record
+	 */
+	int number_of_cache_entry_offsets;
+
+	/* The hashes
+	 */
+	uint64_t *hashes;
+
+	/* The modification times, which are only stored in format version 20
+	 */
+	uint64_t *modification_times;
+
+	/* The flags
+	 */
+	uint32_t *flags;
+
+	/* The cache entry offsets, number_of_cache_entry_offsets per record
+	 */
+	uint32_t *cache_entry_offsets;
+};
+
+int libwtcdb_index_records_initialize(
+     libwtcdb_index_records_t **index_records,
+     libcerror_error_t **error );
+
+int libwtcdb_index_records_free(
+     libwtcdb_index_records_t **index_records,
+     libcerror_error_t **error );
+
+int libwtcdb_index_records_clear(
+     libwtcdb_index_records_t *index_records,
+     libcerror_error_t **error );
+
+int libwtcdb_index_records_get_record_layout(
+     uint32_t format_version,
+     size_t *record_size,
+     size_t *flags_offset,
+     size_t *cache_entry_offsets_offset,
+     int *number_of_cache_entry_offsets,
+     libcerror_error_t **error );
+
+int libwtcdb_index_records_read_data(
+     libwtcdb_index_records_t *index_records,
+     libwtcdb_io_handle_t *io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBWTCDB_INDEX_RECORDS_H ) */
+
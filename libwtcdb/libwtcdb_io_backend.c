@@ -0,0 +1,1564 @@
+/*
+ * IO backend functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#if defined( HAVE_PREAD ) || defined( HAVE_LIBURING )
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#endif /* defined( HAVE_PREAD ) || defined( HAVE_LIBURING ) */
+
+#include "libwtcdb_definitions.h"
+#include "libwtcdb_io_backend.h"
+#include "libwtcdb_libbfio.h"
+#include "libwtcdb_libcerror.h"
+#include "libwtcdb_libclocale.h"
+#include "libwtcdb_libcnotify.h"
+#include "libwtcdb_libcthreads.h"
+#include "libwtcdb_libuna.h"
+#include "libwtcdb_unused.h"
+
+/* Creates an IO backend
+ * Make sure the value io_backend is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_io_backend_initialize(
+     libwtcdb_io_backend_t **io_backend,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_io_backend_initialize";
+
+	if( io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO backend.",
+		 function );
+
+		return( -1 );
+	}
+	if( *io_backend != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO backend value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*io_backend = memory_allocate_structure(
+	               libwtcdb_io_backend_t );
+
+	if( *io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create IO backend.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *io_backend,
+	     0,
+	     sizeof( libwtcdb_io_backend_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear IO backend.",
+		 function );
+
+		memory_free(
+		 *io_backend );
+
+		*io_backend = NULL;
+
+		return( -1 );
+	}
+	( *io_backend )->type = LIBWTCDB_IO_BACKEND_BFIO;
+
+#if defined( HAVE_LIBWTCDB_IO_BACKEND_FILE_DESCRIPTOR )
+	( *io_backend )->file_descriptor = -1;
+#endif
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *io_backend )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *io_backend != NULL )
+	{
+		memory_free(
+		 *io_backend );
+
+		*io_backend = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an IO backend
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_io_backend_free(
+     libwtcdb_io_backend_t **io_backend,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_io_backend_free";
+	int result            = 1;
+
+	if( io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO backend.",
+		 function );
+
+		return( -1 );
+	}
+	if( *io_backend != NULL )
+	{
+		if( libwtcdb_io_backend_close(
+		     *io_backend,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close IO backend.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *io_backend )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *io_backend );
+
+		*io_backend = NULL;
+	}
+	return( result );
+}
+
+/* Closes the io_uring and the file descriptor of the IO backend if open
+ * Afterwards the IO backend reads using the file IO handle
+ * This function should not be called while batches are being read
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_io_backend_close(
+     libwtcdb_io_backend_t *io_backend,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_io_backend_close";
+	int result            = 1;
+
+#if defined( HAVE_LIBURING )
+	int ring_index        = 0;
+#endif
+
+	if( io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO backend.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBURING )
+	for( ring_index = 0;
+	     ring_index < LIBWTCDB_IO_BACKEND_MAXIMUM_NUMBER_OF_RINGS;
+	     ring_index++ )
+	{
+		if( io_backend->ring_states[ ring_index ] != LIBWTCDB_IO_BACKEND_RING_STATE_UNINITIALIZED )
+		{
+			io_uring_queue_exit(
+			 &( io_backend->rings[ ring_index ] ) );
+
+			io_backend->ring_states[ ring_index ] = LIBWTCDB_IO_BACKEND_RING_STATE_UNINITIALIZED;
+		}
+	}
+#endif /* defined( HAVE_LIBURING ) */
+
+#if defined( HAVE_LIBWTCDB_IO_BACKEND_FILE_DESCRIPTOR )
+	if( io_backend->file_descriptor != -1 )
+	{
+		if( close(
+		     io_backend->file_descriptor ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 errno,
+			 "%s: unable to close file descriptor.",
+			 function );
+
+			result = -1;
+		}
+		io_backend->file_descriptor = -1;
+	}
+#endif /* defined( HAVE_LIBWTCDB_IO_BACKEND_FILE_DESCRIPTOR ) */
+
+	io_backend->type = LIBWTCDB_IO_BACKEND_BFIO;
+
+	return( result );
+}
+
+/* Opens the IO backend
+ * The IO backend opens its own file descriptor, which is read using io_uring when
+ * requested or by default if supported by both the build and the running kernel,
+ * otherwise using pread. If neither is supported the IO backend falls back
+ * to reading using the file IO handle
+ * Returns 1 if the file descriptor of the IO backend is used, 0 if not or -1 on error
+ */
+int libwtcdb_io_backend_open(
+     libwtcdb_io_backend_t *io_backend,
+     const char *filename,
+     int requested_type,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_io_backend_open";
+
+#if defined( HAVE_LIBWTCDB_IO_BACKEND_FILE_DESCRIPTOR )
+	int file_descriptor   = -1;
+#endif
+#if defined( HAVE_LIBURING )
+	int result            = 0;
+#endif
+
+	if( io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO backend.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_backend->type != LIBWTCDB_IO_BACKEND_BFIO )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO backend - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( requested_type != LIBWTCDB_IO_BACKEND_DEFAULT )
+	 && ( requested_type != LIBWTCDB_IO_BACKEND_BFIO )
+	 && ( requested_type != LIBWTCDB_IO_BACKEND_IO_URING )
+	 && ( requested_type != LIBWTCDB_IO_BACKEND_PREAD ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported requested type: %d.",
+		 function,
+		 requested_type );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_IO_BACKEND_FILE_DESCRIPTOR )
+	if( requested_type == LIBWTCDB_IO_BACKEND_BFIO )
+	{
+		return( 0 );
+	}
+	file_descriptor = open(
+	                   filename,
+	                   O_RDONLY | O_CLOEXEC );
+
+	if( file_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	io_backend->file_descriptor = file_descriptor;
+	io_backend->type            = LIBWTCDB_IO_BACKEND_PREAD;
+
+#if defined( HAVE_LIBURING )
+	if( requested_type != LIBWTCDB_IO_BACKEND_PREAD )
+	{
+		/* io_uring can be unavailable at runtime, for example if the kernel
+		 * does not support it or it has been disabled. The first io_uring is
+		 * created here, the others when multiple threads read concurrently
+		 */
+		result = io_uring_queue_init(
+		          LIBWTCDB_IO_BACKEND_IO_URING_QUEUE_DEPTH,
+		          &( io_backend->rings[ 0 ] ),
+		          0 );
+
+		if( result == 0 )
+		{
+			io_backend->ring_states[ 0 ] = LIBWTCDB_IO_BACKEND_RING_STATE_AVAILABLE;
+			io_backend->type             = LIBWTCDB_IO_BACKEND_IO_URING;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		else if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: io_uring not available (%d), falling back to pread.\n",
+			 function,
+			 -result );
+		}
+#endif
+	}
+#endif /* defined( HAVE_LIBURING ) */
+
+	return( 1 );
+#else
+	return( 0 );
+
+#endif /* defined( HAVE_LIBWTCDB_IO_BACKEND_FILE_DESCRIPTOR ) */
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Opens the IO backend
+ * The filename is converted into a narrow string using the codepage of the locale
+ * Returns 1 if the file descriptor of the IO backend is used, 0 if not or -1 on error
+ */
+int libwtcdb_io_backend_open_wide(
+     libwtcdb_io_backend_t *io_backend,
+     const wchar_t *filename,
+     int requested_type,
+     libcerror_error_t **error )
+{
+	static char *function       = "libwtcdb_io_backend_open_wide";
+
+#if defined( HAVE_LIBWTCDB_IO_BACKEND_FILE_DESCRIPTOR )
+	char *narrow_filename       = NULL;
+	size_t filename_size        = 0;
+	size_t narrow_filename_size = 0;
+	int result                  = 0;
+#endif
+
+	if( io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO backend.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( requested_type != LIBWTCDB_IO_BACKEND_DEFAULT )
+	 && ( requested_type != LIBWTCDB_IO_BACKEND_BFIO )
+	 && ( requested_type != LIBWTCDB_IO_BACKEND_IO_URING )
+	 && ( requested_type != LIBWTCDB_IO_BACKEND_PREAD ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported requested type: %d.",
+		 function,
+		 requested_type );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_IO_BACKEND_FILE_DESCRIPTOR )
+	if( requested_type == LIBWTCDB_IO_BACKEND_BFIO )
+	{
+		return( 0 );
+	}
+	filename_size = wide_string_length(
+	                 filename ) + 1;
+
+	if( libclocale_codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf8_string_size_from_utf32(
+		          (libuna_utf32_character_t *) filename,
+		          filename_size,
+		          &narrow_filename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf8_string_size_from_utf16(
+		          (libuna_utf16_character_t *) filename,
+		          filename_size,
+		          &narrow_filename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_byte_stream_size_from_utf32(
+		          (libuna_utf32_character_t *) filename,
+		          filename_size,
+		          libclocale_codepage,
+		          &narrow_filename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_byte_stream_size_from_utf16(
+		          (libuna_utf16_character_t *) filename,
+		          filename_size,
+		          libclocale_codepage,
+		          &narrow_filename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to determine narrow filename size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( narrow_filename_size == 0 )
+	 || ( narrow_filename_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid narrow filename size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	narrow_filename = narrow_string_allocate(
+	                   narrow_filename_size );
+
+	if( narrow_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create narrow filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( libclocale_codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf8_string_copy_from_utf32(
+		          (libuna_utf8_character_t *) narrow_filename,
+		          narrow_filename_size,
+		          (libuna_utf32_character_t *) filename,
+		          filename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf8_string_copy_from_utf16(
+		          (libuna_utf8_character_t *) narrow_filename,
+		          narrow_filename_size,
+		          (libuna_utf16_character_t *) filename,
+		          filename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_byte_stream_copy_from_utf32(
+		          (uint8_t *) narrow_filename,
+		          narrow_filename_size,
+		          libclocale_codepage,
+		          (libuna_utf32_character_t *) filename,
+		          filename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_byte_stream_copy_from_utf16(
+		          (uint8_t *) narrow_filename,
+		          narrow_filename_size,
+		          libclocale_codepage,
+		          (libuna_utf16_character_t *) filename,
+		          filename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to set narrow filename.",
+		 function );
+
+		goto on_error;
+	}
+	result = libwtcdb_io_backend_open(
+	          io_backend,
+	          narrow_filename,
+	          requested_type,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open IO backend.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 narrow_filename );
+
+	return( result );
+
+on_error:
+	if( narrow_filename != NULL )
+	{
+		memory_free(
+		 narrow_filename );
+	}
+	return( -1 );
+#else
+	return( 0 );
+
+#endif /* defined( HAVE_LIBWTCDB_IO_BACKEND_FILE_DESCRIPTOR ) */
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+#if defined( HAVE_LIBWTCDB_IO_BACKEND_FILE_DESCRIPTOR )
+
+/* Reads a buffer at a specific offset using pread on the file descriptor of the IO backend
+ * Reads of different threads do not share a current offset, hence do not need to be serialized
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libwtcdb_io_backend_read_buffer_pread(
+         libwtcdb_io_backend_t *io_backend,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_io_backend_read_buffer_pread";
+	ssize_t pread_count   = 0;
+	ssize_t read_count    = 0;
+
+	if( io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO backend.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_backend->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO backend - missing file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	/* pread can return less data than requested before the end of the file
+	 */
+	while( (size_t) read_count < buffer_size )
+	{
+		pread_count = pread(
+		               io_backend->file_descriptor,
+		               &( buffer[ read_count ] ),
+		               buffer_size - (size_t) read_count,
+		               (off_t) ( offset + read_count ) );
+
+		if( pread_count == -1 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 errno,
+			 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset + read_count,
+			 offset + read_count );
+
+			return( -1 );
+		}
+		else if( pread_count == 0 )
+		{
+			break;
+		}
+		read_count += pread_count;
+	}
+	return( read_count );
+}
+
+/* Reads a batch of positional reads using pread on the file descriptor of the IO backend
+ * A read error is reported by the read count of the read
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_io_backend_read_batch_pread(
+     libwtcdb_io_backend_t *io_backend,
+     libwtcdb_io_backend_read_t *reads,
+     int number_of_reads,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *read_error = NULL;
+	static char *function         = "libwtcdb_io_backend_read_batch_pread";
+	int read_index                = 0;
+
+	if( io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO backend.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_backend->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO backend - missing file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( reads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid reads.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_reads < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of reads value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	for( read_index = 0;
+	     read_index < number_of_reads;
+	     read_index++ )
+	{
+		reads[ read_index ].read_count = libwtcdb_io_backend_read_buffer_pread(
+		                                  io_backend,
+		                                  reads[ read_index ].data,
+		                                  reads[ read_index ].data_size,
+		                                  reads[ read_index ].file_offset,
+		                                  &read_error );
+
+		if( reads[ read_index ].read_count < 0 )
+		{
+			libcerror_error_free(
+			 &read_error );
+
+			reads[ read_index ].read_count = -1;
+		}
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_LIBWTCDB_IO_BACKEND_FILE_DESCRIPTOR ) */
+
+/* Reads a batch of positional reads using the file IO handle
+ * A read error is reported by the read count of the read
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_io_backend_read_batch_file_io_handle(
+     libbfio_handle_t *file_io_handle,
+     libwtcdb_io_backend_read_t *reads,
+     int number_of_reads,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *read_error = NULL;
+	static char *function         = "libwtcdb_io_backend_read_batch_file_io_handle";
+	int read_index                = 0;
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( reads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid reads.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_reads < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of reads value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	for( read_index = 0;
+	     read_index < number_of_reads;
+	     read_index++ )
+	{
+		reads[ read_index ].read_count = libbfio_handle_read_buffer_at_offset(
+		                                  file_io_handle,
+		                                  reads[ read_index ].data,
+		                                  reads[ read_index ].data_size,
+		                                  reads[ read_index ].file_offset,
+		                                  &read_error );
+
+		if( reads[ read_index ].read_count < 0 )
+		{
+			libcerror_error_free(
+			 &read_error );
+
+			reads[ read_index ].read_count = -1;
+		}
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_LIBURING )
+
+/* Grabs an io_uring for the exclusive use of the calling thread
+ * An additional io_uring is created if all created io_uring are in use
+ * Returns 1 if successful, 0 if no io_uring is available or -1 on error
+ */
+int libwtcdb_io_backend_grab_ring(
+     libwtcdb_io_backend_t *io_backend,
+     int *ring_index,
+     libcerror_error_t **error )
+{
+	static char *function        = "libwtcdb_io_backend_grab_ring";
+	int result                   = 0;
+	int state_index              = 0;
+	int uninitialized_ring_index = -1;
+
+	if( io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO backend.",
+		 function );
+
+		return( -1 );
+	}
+	if( ring_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ring index.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     io_backend->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	for( state_index = 0;
+	     state_index < LIBWTCDB_IO_BACKEND_MAXIMUM_NUMBER_OF_RINGS;
+	     state_index++ )
+	{
+		if( io_backend->ring_states[ state_index ] == LIBWTCDB_IO_BACKEND_RING_STATE_AVAILABLE )
+		{
+			io_backend->ring_states[ state_index ] = LIBWTCDB_IO_BACKEND_RING_STATE_IN_USE;
+
+			*ring_index = state_index;
+
+			result = 1;
+
+			break;
+		}
+		if( ( uninitialized_ring_index == -1 )
+		 && ( io_backend->ring_states[ state_index ] == LIBWTCDB_IO_BACKEND_RING_STATE_UNINITIALIZED ) )
+		{
+			uninitialized_ring_index = state_index;
+		}
+	}
+	if( ( result == 0 )
+	 && ( uninitialized_ring_index != -1 ) )
+	{
+		if( io_uring_queue_init(
+		     LIBWTCDB_IO_BACKEND_IO_URING_QUEUE_DEPTH,
+		     &( io_backend->rings[ uninitialized_ring_index ] ),
+		     0 ) == 0 )
+		{
+			io_backend->ring_states[ uninitialized_ring_index ] = LIBWTCDB_IO_BACKEND_RING_STATE_IN_USE;
+
+			*ring_index = uninitialized_ring_index;
+
+			result = 1;
+		}
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     io_backend->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Releases an io_uring that was grabbed by the calling thread
+ * The io_uring is exited if it can no longer be used, for example
+ * after an error, and is recreated when needed
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_io_backend_release_ring(
+     libwtcdb_io_backend_t *io_backend,
+     int ring_index,
+     uint8_t exit_ring,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_io_backend_release_ring";
+
+	if( io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO backend.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ring_index < 0 )
+	 || ( ring_index >= LIBWTCDB_IO_BACKEND_MAXIMUM_NUMBER_OF_RINGS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid ring index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     io_backend->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( io_backend->ring_states[ ring_index ] == LIBWTCDB_IO_BACKEND_RING_STATE_IN_USE )
+	{
+		if( exit_ring != 0 )
+		{
+			io_uring_queue_exit(
+			 &( io_backend->rings[ ring_index ] ) );
+
+			io_backend->ring_states[ ring_index ] = LIBWTCDB_IO_BACKEND_RING_STATE_UNINITIALIZED;
+		}
+		else
+		{
+			io_backend->ring_states[ ring_index ] = LIBWTCDB_IO_BACKEND_RING_STATE_AVAILABLE;
+		}
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     io_backend->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Reads a batch of positional reads using an io_uring grabbed by the calling thread
+ * The reads are submitted up to the queue depth at once and a single system call
+ * both submits new reads and waits for completed reads. The remainder of a short
+ * read is submitted again until the end of the file is reached
+ * A read error is reported by the read count of the read
+ * On error the reads that were submitted have completed, but the io_uring can
+ * contain reads that were not submitted and should be exited
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_io_backend_read_batch_io_uring(
+     libwtcdb_io_backend_t *io_backend,
+     int ring_index,
+     libwtcdb_io_backend_read_t *reads,
+     int number_of_reads,
+     libcerror_error_t **error )
+{
+	struct io_uring_cqe *completion_queue_entries[ LIBWTCDB_IO_BACKEND_IO_URING_QUEUE_DEPTH ];
+
+	libwtcdb_io_backend_read_t *read                = NULL;
+	struct io_uring *ring                           = NULL;
+	struct io_uring_cqe *completion_queue_entry     = NULL;
+	struct io_uring_sqe *submission_queue_entry     = NULL;
+	static char *function                           = "libwtcdb_io_backend_read_batch_io_uring";
+	unsigned int completion_queue_entry_index       = 0;
+	unsigned int number_of_completion_queue_entries = 0;
+	int number_of_completed_reads                   = 0;
+	int number_of_in_flight_reads                   = 0;
+	int number_of_prepared_reads                    = 0;
+	int read_index                                  = 0;
+	int result                                      = 0;
+
+	if( io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO backend.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_backend->type != LIBWTCDB_IO_BACKEND_IO_URING )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid IO backend - unsupported type.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ring_index < 0 )
+	 || ( ring_index >= LIBWTCDB_IO_BACKEND_MAXIMUM_NUMBER_OF_RINGS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid ring index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( reads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid reads.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_reads < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of reads value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	for( read_index = 0;
+	     read_index < number_of_reads;
+	     read_index++ )
+	{
+		if( reads[ read_index ].data_size > (size_t) UINT32_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid read: %d - data size value exceeds maximum.",
+			 function,
+			 read_index );
+
+			return( -1 );
+		}
+		reads[ read_index ].read_count = 0;
+	}
+	ring = &( io_backend->rings[ ring_index ] );
+
+	read_index = 0;
+
+	while( number_of_completed_reads < number_of_reads )
+	{
+		/* The number of reads in flight is limited to the queue depth
+		 * so that a short read can always be submitted again
+		 */
+		while( ( read_index < number_of_reads )
+		    && ( ( number_of_in_flight_reads + number_of_prepared_reads ) < LIBWTCDB_IO_BACKEND_IO_URING_QUEUE_DEPTH ) )
+		{
+			submission_queue_entry = io_uring_get_sqe(
+			                          ring );
+
+			if( submission_queue_entry == NULL )
+			{
+				break;
+			}
+			read = &( reads[ read_index ] );
+
+			io_uring_prep_read(
+			 submission_queue_entry,
+			 io_backend->file_descriptor,
+			 read->data,
+			 (unsigned int) read->data_size,
+			 (uint64_t) read->file_offset );
+
+			io_uring_sqe_set_data(
+			 submission_queue_entry,
+			 read );
+
+			number_of_prepared_reads++;
+
+			read_index++;
+		}
+		result = io_uring_submit_and_wait(
+		          ring,
+		          1 );
+
+		if( result == -EINTR )
+		{
+			continue;
+		}
+		if( result < 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 -result,
+			 "%s: unable to submit reads.",
+			 function );
+
+			goto on_error;
+		}
+		number_of_in_flight_reads += result;
+		number_of_prepared_reads  -= result;
+
+		number_of_completion_queue_entries = io_uring_peek_batch_cqe(
+		                                      ring,
+		                                      completion_queue_entries,
+		                                      LIBWTCDB_IO_BACKEND_IO_URING_QUEUE_DEPTH );
+
+		for( completion_queue_entry_index = 0;
+		     completion_queue_entry_index < number_of_completion_queue_entries;
+		     completion_queue_entry_index++ )
+		{
+			completion_queue_entry = completion_queue_entries[ completion_queue_entry_index ];
+
+			read = (libwtcdb_io_backend_read_t *) io_uring_cqe_get_data(
+			                                       completion_queue_entry );
+
+			number_of_in_flight_reads--;
+
+			if( completion_queue_entry->res < 0 )
+			{
+				read->read_count = -1;
+
+				number_of_completed_reads++;
+
+				continue;
+			}
+			read->read_count += (ssize_t) completion_queue_entry->res;
+
+			if( ( completion_queue_entry->res == 0 )
+			 || ( (size_t) read->read_count >= read->data_size ) )
+			{
+				number_of_completed_reads++;
+
+				continue;
+			}
+			/* Submit the remainder of a short read again
+			 */
+			submission_queue_entry = io_uring_get_sqe(
+			                          ring );
+
+			if( submission_queue_entry == NULL )
+			{
+				number_of_completed_reads++;
+
+				continue;
+			}
+			io_uring_prep_read(
+			 submission_queue_entry,
+			 io_backend->file_descriptor,
+			 &( read->data[ read->read_count ] ),
+			 (unsigned int) ( read->data_size - (size_t) read->read_count ),
+			 (uint64_t) read->file_offset + (uint64_t) read->read_count );
+
+			io_uring_sqe_set_data(
+			 submission_queue_entry,
+			 read );
+
+			number_of_prepared_reads++;
+		}
+		io_uring_cq_advance(
+		 ring,
+		 number_of_completion_queue_entries );
+	}
+	return( 1 );
+
+on_error:
+	/* Wait for the reads that were submitted, since they write into the data
+	 * of the reads after this function has returned otherwise
+	 */
+	while( number_of_in_flight_reads > 0 )
+	{
+		result = io_uring_wait_cqe(
+		          ring,
+		          &completion_queue_entry );
+
+		if( result == -EINTR )
+		{
+			continue;
+		}
+		if( result < 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 -result,
+			 "%s: unable to wait for %d reads in flight.",
+			 function,
+			 number_of_in_flight_reads );
+
+			break;
+		}
+		io_uring_cqe_seen(
+		 ring,
+		 completion_queue_entry );
+
+		number_of_in_flight_reads--;
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_LIBURING ) */
+
+/* Reads a batch of positional reads
+ * If io_uring is not used the reads are read one by one using pread on the file
+ * descriptor of the IO backend or, if no IO backend is provided or its file descriptor
+ * is not open, are passed one by one to the file IO handle
+ * The calling thread uses its own io_uring, hence batches of different
+ * threads are read concurrently
+ * A read error is reported by the read count of the read
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_io_backend_read_batch(
+     libwtcdb_io_backend_t *io_backend,
+     libbfio_handle_t *file_io_handle,
+     libwtcdb_io_backend_read_t *reads,
+     int number_of_reads,
+     libcerror_error_t **error )
+{
+	static char *function             = "libwtcdb_io_backend_read_batch";
+	int read_with_io_uring            = 0;
+	int result                        = 1;
+
+#if defined( HAVE_LIBURING )
+	libcerror_error_t *io_uring_error = NULL;
+	int ring_index                    = 0;
+#endif
+#if !defined( HAVE_LIBWTCDB_IO_BACKEND_FILE_DESCRIPTOR )
+	LIBWTCDB_UNREFERENCED_PARAMETER( io_backend )
+#endif
+
+#if defined( HAVE_LIBURING )
+	if( ( io_backend != NULL )
+	 && ( io_backend->type == LIBWTCDB_IO_BACKEND_IO_URING ) )
+	{
+		result = libwtcdb_io_backend_grab_ring(
+		          io_backend,
+		          &ring_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to grab io_uring.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			read_with_io_uring = libwtcdb_io_backend_read_batch_io_uring(
+			                      io_backend,
+			                      ring_index,
+			                      reads,
+			                      number_of_reads,
+			                      &io_uring_error );
+
+			if( read_with_io_uring != 1 )
+			{
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: unable to read batch using io_uring, falling back to pread.\n",
+					 function );
+				}
+#endif
+				libcerror_error_free(
+				 &io_uring_error );
+
+				read_with_io_uring = 0;
+			}
+			/* An io_uring that failed is exited since it can contain reads
+			 * that were not submitted
+			 */
+			if( libwtcdb_io_backend_release_ring(
+			     io_backend,
+			     ring_index,
+			     (uint8_t) ( read_with_io_uring == 0 ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release io_uring.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		result = 1;
+	}
+#endif /* defined( HAVE_LIBURING ) */
+
+#if defined( HAVE_LIBWTCDB_IO_BACKEND_FILE_DESCRIPTOR )
+	if( ( read_with_io_uring == 0 )
+	 && ( io_backend != NULL )
+	 && ( io_backend->file_descriptor != -1 ) )
+	{
+		if( libwtcdb_io_backend_read_batch_pread(
+		     io_backend,
+		     reads,
+		     number_of_reads,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read batch using pread.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+#endif /* defined( HAVE_LIBWTCDB_IO_BACKEND_FILE_DESCRIPTOR ) */
+
+	if( read_with_io_uring == 0 )
+	{
+		if( libwtcdb_io_backend_read_batch_file_io_handle(
+		     file_io_handle,
+		     reads,
+		     number_of_reads,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read batch using file IO handle.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Reads a buffer at a specific offset
+ * If the IO backend has an open file descriptor the buffer is read with pread,
+ * hence reads of different threads do not share the current offset of the file
+ * IO handle, otherwise the buffer is read using the file IO handle
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libwtcdb_io_backend_read_buffer_at_offset(
+         libwtcdb_io_backend_t *io_backend,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_io_backend_read_buffer_at_offset";
+	ssize_t read_count    = 0;
+
+#if defined( HAVE_LIBWTCDB_IO_BACKEND_FILE_DESCRIPTOR )
+	if( ( io_backend != NULL )
+	 && ( io_backend->file_descriptor != -1 ) )
+	{
+		read_count = libwtcdb_io_backend_read_buffer_pread(
+		              io_backend,
+		              buffer,
+		              buffer_size,
+		              offset,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ") using pread.",
+			 function,
+			 offset,
+			 offset );
+
+			return( -1 );
+		}
+		return( read_count );
+	}
+#else
+	LIBWTCDB_UNREFERENCED_PARAMETER( io_backend )
+#endif /* defined( HAVE_LIBWTCDB_IO_BACKEND_FILE_DESCRIPTOR ) */
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              buffer,
+	              buffer_size,
+	              offset,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ") using file IO handle.",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
@@ -0,0 +1,198 @@
+/*
+ * IO backend functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBWTCDB_IO_BACKEND_H )
+#define _LIBWTCDB_IO_BACKEND_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_LIBURING )
+#include <liburing.h>
+#endif
+
+#include "libwtcdb_definitions.h"
+#include "libwtcdb_libbfio.h"
+#include "libwtcdb_libcerror.h"
+#include "libwtcdb_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The IO backend reads using its own file descriptor if pread or io_uring is supported
+ */
+#if defined( HAVE_PREAD ) || defined( HAVE_LIBURING )
+#define HAVE_LIBWTCDB_IO_BACKEND_FILE_DESCRIPTOR
+#endif
+
+typedef struct libwtcdb_io_backend_read libwtcdb_io_backend_read_t;
+
+/* A single positional read of a batch
+ */
+struct libwtcdb_io_backend_read
+{
+	/* The offset of the data in the file
+	 */
+	off64_t file_offset;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The number of bytes read or -1 on error
+	 */
+	ssize_t read_count;
+};
+
+typedef struct libwtcdb_io_backend libwtcdb_io_backend_t;
+
+/* The IO backend reads batches of positional reads
+ * Without io_uring the reads are read one by one using pread on the file descriptor
+ * of the IO backend or, if not open, are passed one by one to the file IO handle
+ */
+struct libwtcdb_io_backend
+{
+	/* The type
+	 */
+	int type;
+
+#if defined( HAVE_LIBWTCDB_IO_BACKEND_FILE_DESCRIPTOR )
+	/* The file descriptor or -1 if not open
+	 */
+	int file_descriptor;
+#endif
+
+#if defined( HAVE_LIBURING )
+	/* The io_uring, one per thread that reads a batch
+	 */
+	struct io_uring rings[ LIBWTCDB_IO_BACKEND_MAXIMUM_NUMBER_OF_RINGS ];
+
+	/* The states of the io_uring
+	 */
+	uint8_t ring_states[ LIBWTCDB_IO_BACKEND_MAXIMUM_NUMBER_OF_RINGS ];
+#endif
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	/* The mutex that protects the states of the io_uring
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libwtcdb_io_backend_initialize(
+     libwtcdb_io_backend_t **io_backend,
+     libcerror_error_t **error );
+
+int libwtcdb_io_backend_free(
+     libwtcdb_io_backend_t **io_backend,
+     libcerror_error_t **error );
+
+int libwtcdb_io_backend_close(
+     libwtcdb_io_backend_t *io_backend,
+     libcerror_error_t **error );
+
+int libwtcdb_io_backend_open(
+     libwtcdb_io_backend_t *io_backend,
+     const char *filename,
+     int requested_type,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+int libwtcdb_io_backend_open_wide(
+     libwtcdb_io_backend_t *io_backend,
+     const wchar_t *filename,
+     int requested_type,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+#if defined( HAVE_LIBWTCDB_IO_BACKEND_FILE_DESCRIPTOR )
+
+ssize_t libwtcdb_io_backend_read_buffer_pread(
+         libwtcdb_io_backend_t *io_backend,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+int libwtcdb_io_backend_read_batch_pread(
+     libwtcdb_io_backend_t *io_backend,
+     libwtcdb_io_backend_read_t *reads,
+     int number_of_reads,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBWTCDB_IO_BACKEND_FILE_DESCRIPTOR ) */
+
+int libwtcdb_io_backend_read_batch_file_io_handle(
+     libbfio_handle_t *file_io_handle,
+     libwtcdb_io_backend_read_t *reads,
+     int number_of_reads,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBURING )
+
+int libwtcdb_io_backend_grab_ring(
+     libwtcdb_io_backend_t *io_backend,
+     int *ring_index,
+     libcerror_error_t **error );
+
+int libwtcdb_io_backend_release_ring(
+     libwtcdb_io_backend_t *io_backend,
+     int ring_index,
+     uint8_t exit_ring,
+     libcerror_error_t **error );
+
+int libwtcdb_io_backend_read_batch_io_uring(
+     libwtcdb_io_backend_t *io_backend,
+     int ring_index,
+     libwtcdb_io_backend_read_t *reads,
+     int number_of_reads,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBURING ) */
+
+int libwtcdb_io_backend_read_batch(
+     libwtcdb_io_backend_t *io_backend,
+     libbfio_handle_t *file_io_handle,
+     libwtcdb_io_backend_read_t *reads,
+     int number_of_reads,
+     libcerror_error_t **error );
+
+ssize_t libwtcdb_io_backend_read_buffer_at_offset(
+         libwtcdb_io_backend_t *io_backend,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBWTCDB_IO_BACKEND_H ) */
+
@@ -23,8 +23,10 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libwtcdb_handle_pool.h"
 #include "libwtcdb_io_handle.h"
 #include "libwtcdb_libcerror.h"
+#include "libwtcdb_progress.h"
 
 const uint8_t *wtcdb_cache_file_signature = (uint8_t *) "CMMM";
 const uint8_t *wtcdb_index_file_signature = (uint8_t *) "IMMM";
@@ -169,3 +171,236 @@ int libwtcdb_io_handle_clear(
 	return( 1 );
 }
 
+/* Checks if abort was signalled
+ * Returns 1 if successful or -1 on error or if abort was signalled
+ */
+int libwtcdb_io_handle_check_abort(
+     libwtcdb_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_io_handle_check_abort";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->abort != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+		 "%s: abort requested.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Grabs the file IO handle for reading
+ * The file IO handle is (re)opened by the handle pool if one is used
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_io_handle_grab_file_io_handle(
+     libwtcdb_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_io_handle_grab_file_io_handle";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->handle_pool_entry == NULL )
+	{
+		return( 1 );
+	}
+	if( libwtcdb_handle_pool_grab_handle(
+	     io_handle->handle_pool,
+	     io_handle->handle_pool_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to grab file IO handle from handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Releases the file IO handle after reading
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_io_handle_release_file_io_handle(
+     libwtcdb_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_io_handle_release_file_io_handle";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->handle_pool_entry == NULL )
+	{
+		return( 1 );
+	}
+	if( libwtcdb_handle_pool_release_handle(
+	     io_handle->handle_pool,
+	     io_handle->handle_pool_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release file IO handle to handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the progress phase
+ * Returns 1 if successful or -1 on error or if abort was signalled or requested by the progress callback
+ */
+int libwtcdb_io_handle_set_progress_phase(
+     libwtcdb_io_handle_t *io_handle,
+     int phase,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_io_handle_set_progress_phase";
+	int result            = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->progress != NULL )
+	{
+		result = libwtcdb_progress_set_phase(
+		          io_handle->progress,
+		          phase,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set progress phase.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: abort requested by progress callback.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( libwtcdb_io_handle_check_abort(
+	         io_handle,
+	         error ) );
+}
+
+/* Updates the progress with the number of bytes scanned and entries read
+ * Returns 1 if successful or -1 on error or if abort was signalled or requested by the progress callback
+ */
+int libwtcdb_io_handle_update_progress(
+     libwtcdb_io_handle_t *io_handle,
+     uint64_t bytes_scanned,
+     int number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_io_handle_update_progress";
+	int result            = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->progress != NULL )
+	{
+		result = libwtcdb_progress_update(
+		          io_handle->progress,
+		          bytes_scanned,
+		          number_of_entries,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update progress.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: abort requested by progress callback.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( libwtcdb_io_handle_check_abort(
+	         io_handle,
+	         error ) );
+}
+
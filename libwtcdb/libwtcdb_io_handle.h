@@ -25,7 +25,10 @@
 #include <common.h>
 #include <types.h>
 
+#include "libwtcdb_handle_pool.h"
+#include "libwtcdb_io_backend.h"
 #include "libwtcdb_libcerror.h"
+#include "libwtcdb_progress.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -46,6 +49,22 @@ struct libwtcdb_io_handle
 	 */
 	uint32_t format_version;
 
+	/* The IO backend used to read batches, NULL if reads are passed to the file IO handle
+	 */
+	libwtcdb_io_backend_t *io_backend;
+
+	/* The handle pool that bounds the number of open file IO handles, NULL if not used
+	 */
+	libwtcdb_handle_pool_t *handle_pool;
+
+	/* The entry of the file IO handle in the handle pool, NULL if not used
+	 */
+	libwtcdb_handle_pool_entry_t *handle_pool_entry;
+
+	/* The progress used to report reading the file, NULL if not reported
+	 */
+	libwtcdb_progress_t *progress;
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
@@ -63,6 +82,29 @@ int libwtcdb_io_handle_clear(
      libwtcdb_io_handle_t *io_handle,
      libcerror_error_t **error );
 
+int libwtcdb_io_handle_check_abort(
+     libwtcdb_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libwtcdb_io_handle_grab_file_io_handle(
+     libwtcdb_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libwtcdb_io_handle_release_file_io_handle(
+     libwtcdb_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libwtcdb_io_handle_set_progress_phase(
+     libwtcdb_io_handle_t *io_handle,
+     int phase,
+     libcerror_error_t **error );
+
+int libwtcdb_io_handle_update_progress(
+     libwtcdb_io_handle_t *io_handle,
+     uint64_t bytes_scanned,
+     int number_of_entries,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
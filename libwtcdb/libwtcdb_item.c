@@ -23,11 +23,18 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libwtcdb_cache_entry.h"
 #include "libwtcdb_definitions.h"
+#include "libwtcdb_exif.h"
+#include "libwtcdb_identifier.h"
+#include "libwtcdb_image_header.h"
+#include "libwtcdb_index_entry.h"
+#include "libwtcdb_io_backend.h"
 #include "libwtcdb_io_handle.h"
 #include "libwtcdb_item.h"
 #include "libwtcdb_libbfio.h"
 #include "libwtcdb_libcerror.h"
+#include "libwtcdb_read_ahead.h"
 
 /* Creates an item
  * Make sure the value item is referencing, is set to NULL
@@ -133,6 +140,7 @@ int libwtcdb_item_free(
 {
 	libwtcdb_internal_item_t *internal_item = NULL;
 	static char *function                   = "libwtcdb_item_free";
+	int result                              = 1;
 
 	if( item == NULL )
 	{
@@ -152,9 +160,1223 @@ int libwtcdb_item_free(
 
 		/* The io_handle, file_io_handle and entry references are freed elsewhere
 		 */
+		if( internal_item->image_header != NULL )
+		{
+			if( libwtcdb_image_header_free(
+			     &( internal_item->image_header ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free image header.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 internal_item );
 	}
+	return( result );
+}
+
+/* Reads the image header of the cached data
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libwtcdb_internal_item_read_image_header(
+     libwtcdb_internal_item_t *internal_item,
+     libcerror_error_t **error )
+{
+	libwtcdb_cache_entry_t *cache_entry = NULL;
+	static char *function               = "libwtcdb_internal_item_read_image_header";
+	int result                          = 0;
+
+	if( internal_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->image_header != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid item - image header value already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* Only cache file entries contain cached data
+	 */
+	if( internal_item->io_handle->file_type != LIBWTCDB_FILE_TYPE_CACHE )
+	{
+		return( 0 );
+	}
+	cache_entry = (libwtcdb_cache_entry_t *) internal_item->entry;
+
+	if( libwtcdb_image_header_initialize(
+	     &( internal_item->image_header ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create image header.",
+		 function );
+
+		goto on_error;
+	}
+	if( libwtcdb_io_handle_grab_file_io_handle(
+	     internal_item->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to grab file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	result = libwtcdb_image_header_read_file_io_handle(
+	          internal_item->image_header,
+	          internal_item->io_handle->io_backend,
+	          internal_item->file_io_handle,
+	          cache_entry->cached_data_offset,
+	          cache_entry->cached_data_size,
+	          error );
+
+	if( libwtcdb_io_handle_release_file_io_handle(
+	     internal_item->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release file IO handle.",
+		 function );
+
+		result = -1;
+	}
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read image header.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( internal_item->image_header != NULL )
+	{
+		libwtcdb_image_header_free(
+		 &( internal_item->image_header ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the hash
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_item_get_hash(
+     libwtcdb_item_t *item,
+     uint64_t *hash,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_item_t *internal_item = NULL;
+	static char *function                   = "libwtcdb_item_get_hash";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libwtcdb_internal_item_t *) item;
+
+	if( internal_item->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->io_handle->file_type == LIBWTCDB_FILE_TYPE_CACHE )
+	{
+		*hash = ( (libwtcdb_cache_entry_t *) internal_item->entry )->hash;
+	}
+	else
+	{
+		*hash = ( (libwtcdb_index_entry_t *) internal_item->entry )->hash;
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 encoded identifier
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libwtcdb_item_get_utf8_identifier_size(
+     libwtcdb_item_t *item,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libwtcdb_cache_entry_t *cache_entry     = NULL;
+	libwtcdb_internal_item_t *internal_item = NULL;
+	static char *function                   = "libwtcdb_item_get_utf8_identifier_size";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libwtcdb_internal_item_t *) item;
+
+	if( internal_item->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* Only cache file entries contain an identifier
+	 */
+	if( internal_item->io_handle->file_type != LIBWTCDB_FILE_TYPE_CACHE )
+	{
+		return( 0 );
+	}
+	cache_entry = (libwtcdb_cache_entry_t *) internal_item->entry;
+
+	if( cache_entry->identifier == NULL )
+	{
+		return( 0 );
+	}
+	if( libwtcdb_identifier_get_utf8_string_size(
+	     cache_entry->identifier,
+	     (size_t) cache_entry->identifier_size,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded identifier
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libwtcdb_item_get_utf8_identifier(
+     libwtcdb_item_t *item,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libwtcdb_cache_entry_t *cache_entry     = NULL;
+	libwtcdb_internal_item_t *internal_item = NULL;
+	static char *function                   = "libwtcdb_item_get_utf8_identifier";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libwtcdb_internal_item_t *) item;
+
+	if( internal_item->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* Only cache file entries contain an identifier
+	 */
+	if( internal_item->io_handle->file_type != LIBWTCDB_FILE_TYPE_CACHE )
+	{
+		return( 0 );
+	}
+	cache_entry = (libwtcdb_cache_entry_t *) internal_item->entry;
+
+	if( cache_entry->identifier == NULL )
+	{
+		return( 0 );
+	}
+	if( libwtcdb_identifier_copy_to_utf8_string(
+	     cache_entry->identifier,
+	     (size_t) cache_entry->identifier_size,
+	     utf8_string,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy identifier to UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-16 encoded identifier
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libwtcdb_item_get_utf16_identifier_size(
+     libwtcdb_item_t *item,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libwtcdb_cache_entry_t *cache_entry     = NULL;
+	libwtcdb_internal_item_t *internal_item = NULL;
+	static char *function                   = "libwtcdb_item_get_utf16_identifier_size";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libwtcdb_internal_item_t *) item;
+
+	if( internal_item->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* Only cache file entries contain an identifier
+	 */
+	if( internal_item->io_handle->file_type != LIBWTCDB_FILE_TYPE_CACHE )
+	{
+		return( 0 );
+	}
+	cache_entry = (libwtcdb_cache_entry_t *) internal_item->entry;
+
+	if( cache_entry->identifier == NULL )
+	{
+		return( 0 );
+	}
+	if( libwtcdb_identifier_get_utf16_string_size(
+	     cache_entry->identifier,
+	     (size_t) cache_entry->identifier_size,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 string size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-16 encoded identifier
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libwtcdb_item_get_utf16_identifier(
+     libwtcdb_item_t *item,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libwtcdb_cache_entry_t *cache_entry     = NULL;
+	libwtcdb_internal_item_t *internal_item = NULL;
+	static char *function                   = "libwtcdb_item_get_utf16_identifier";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libwtcdb_internal_item_t *) item;
+
+	if( internal_item->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* Only cache file entries contain an identifier
+	 */
+	if( internal_item->io_handle->file_type != LIBWTCDB_FILE_TYPE_CACHE )
+	{
+		return( 0 );
+	}
+	cache_entry = (libwtcdb_cache_entry_t *) internal_item->entry;
+
+	if( cache_entry->identifier == NULL )
+	{
+		return( 0 );
+	}
+	if( libwtcdb_identifier_copy_to_utf16_string(
+	     cache_entry->identifier,
+	     (size_t) cache_entry->identifier_size,
+	     utf16_string,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy identifier to UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the image format of the cached data
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libwtcdb_item_get_image_format(
+     libwtcdb_item_t *item,
+     uint8_t *image_format,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_item_t *internal_item = NULL;
+	static char *function                   = "libwtcdb_item_get_image_format";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libwtcdb_internal_item_t *) item;
+
+	if( image_format == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image format.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->image_header == NULL )
+	{
+		if( libwtcdb_internal_item_read_image_header(
+		     internal_item,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read image header.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ( internal_item->image_header == NULL )
+	 || ( internal_item->image_header->format == LIBWTCDB_IMAGE_FORMAT_UNKNOWN ) )
+	{
+		return( 0 );
+	}
+	*image_format = internal_item->image_header->format;
+
+	return( 1 );
+}
+
+/* Retrieves the image dimensions of the cached data
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libwtcdb_item_get_image_dimensions(
+     libwtcdb_item_t *item,
+     uint32_t *width,
+     uint32_t *height,
+     uint16_t *bits_per_pixel,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_item_t *internal_item = NULL;
+	static char *function                   = "libwtcdb_item_get_image_dimensions";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libwtcdb_internal_item_t *) item;
+
+	if( width == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid width.",
+		 function );
+
+		return( -1 );
+	}
+	if( height == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid height.",
+		 function );
+
+		return( -1 );
+	}
+	if( bits_per_pixel == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bits per pixel.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->image_header == NULL )
+	{
+		if( libwtcdb_internal_item_read_image_header(
+		     internal_item,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read image header.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ( internal_item->image_header == NULL )
+	 || ( internal_item->image_header->width == 0 )
+	 || ( internal_item->image_header->height == 0 ) )
+	{
+		return( 0 );
+	}
+	*width          = internal_item->image_header->width;
+	*height         = internal_item->image_header->height;
+	*bits_per_pixel = internal_item->image_header->bits_per_pixel;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the cached data
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libwtcdb_item_get_data_size(
+     libwtcdb_item_t *item,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libwtcdb_cache_entry_t *cache_entry     = NULL;
+	libwtcdb_internal_item_t *internal_item = NULL;
+	static char *function                   = "libwtcdb_item_get_data_size";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libwtcdb_internal_item_t *) item;
+
+	if( internal_item->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	/* Only cache file entries contain cached data
+	 */
+	if( internal_item->io_handle->file_type != LIBWTCDB_FILE_TYPE_CACHE )
+	{
+		return( 0 );
+	}
+	cache_entry = (libwtcdb_cache_entry_t *) internal_item->entry;
+
+	*data_size = (size_t) cache_entry->cached_data_size;
+
+	return( 1 );
+}
+
+/* Copies the cached data
+ * The data size must be at least the size of the cached data
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libwtcdb_item_copy_data(
+     libwtcdb_item_t *item,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libwtcdb_cache_entry_t *cache_entry     = NULL;
+	libwtcdb_internal_item_t *internal_item = NULL;
+	static char *function                   = "libwtcdb_item_copy_data";
+	ssize_t read_count                      = 0;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	int result                              = 0;
+#endif
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libwtcdb_internal_item_t *) item;
+
+	if( internal_item->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Only cache file entries contain cached data
+	 */
+	if( internal_item->io_handle->file_type != LIBWTCDB_FILE_TYPE_CACHE )
+	{
+		return( 0 );
+	}
+	cache_entry = (libwtcdb_cache_entry_t *) internal_item->entry;
+
+	if( data_size < (size_t) cache_entry->cached_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_entry->cached_data_size == 0 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( internal_item->read_ahead != NULL )
+	{
+		result = libwtcdb_read_ahead_copy_data(
+		          internal_item->read_ahead,
+		          internal_item->item_index,
+		          data,
+		          data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy cached data from read-ahead.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			return( 1 );
+		}
+	}
+#endif /* defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT ) */
+
+	if( libwtcdb_io_handle_grab_file_io_handle(
+	     internal_item->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to grab file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libwtcdb_io_backend_read_buffer_at_offset(
+	              internal_item->io_handle->io_backend,
+	              internal_item->file_io_handle,
+	              data,
+	              (size_t) cache_entry->cached_data_size,
+	              cache_entry->cached_data_offset,
+	              error );
+
+	if( libwtcdb_io_handle_release_file_io_handle(
+	     internal_item->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+
+	if( read_count != (ssize_t) cache_entry->cached_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read cached data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 cache_entry->cached_data_offset,
+		 cache_entry->cached_data_offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the EXIF values of the cached data
+ * Only the JPEG marker chain up to the EXIF APP1 segment and the APP1 segment itself are read
+ * If tags is NULL all values are passed to the callback function
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libwtcdb_item_read_exif_values(
+     libwtcdb_item_t *item,
+     const uint16_t *tags,
+     int number_of_tags,
+     libwtcdb_exif_value_callback_t callback,
+     void *user_data,
+     libcerror_error_t **error )
+{
+	libwtcdb_cache_entry_t *cache_entry     = NULL;
+	libwtcdb_internal_item_t *internal_item = NULL;
+	static char *function                   = "libwtcdb_item_read_exif_values";
+	int result                              = 0;
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libwtcdb_internal_item_t *) item;
+
+	if( internal_item->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback.",
+		 function );
+
+		return( -1 );
+	}
+	/* Only cache file entries contain cached data
+	 */
+	if( internal_item->io_handle->file_type != LIBWTCDB_FILE_TYPE_CACHE )
+	{
+		return( 0 );
+	}
+	cache_entry = (libwtcdb_cache_entry_t *) internal_item->entry;
+
+	if( libwtcdb_io_handle_grab_file_io_handle(
+	     internal_item->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to grab file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = libwtcdb_exif_read_file_io_handle(
+	          internal_item->io_handle->io_backend,
+	          internal_item->file_io_handle,
+	          cache_entry->cached_data_offset,
+	          cache_entry->cached_data_size,
+	          tags,
+	          number_of_tags,
+	          callback,
+	          user_data,
+	          error );
+
+	if( libwtcdb_io_handle_release_file_io_handle(
+	     internal_item->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release file IO handle.",
+		 function );
+
+		result = -1;
+	}
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read EXIF values.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the flags of an index file entry
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libwtcdb_item_get_flags(
+     libwtcdb_item_t *item,
+     uint32_t *flags,
+     libcerror_error_t **error )
+{
+	libwtcdb_index_entry_t *index_entry     = NULL;
+	libwtcdb_internal_item_t *internal_item = NULL;
+	static char *function                   = "libwtcdb_item_get_flags";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libwtcdb_internal_item_t *) item;
+
+	if( internal_item->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid flags.",
+		 function );
+
+		return( -1 );
+	}
+	/* Only index file entries contain flags
+	 */
+	if( ( internal_item->io_handle->file_type != LIBWTCDB_FILE_TYPE_INDEX_V20 )
+	 && ( internal_item->io_handle->file_type != LIBWTCDB_FILE_TYPE_INDEX_V30 ) )
+	{
+		return( 0 );
+	}
+	index_entry = (libwtcdb_index_entry_t *) internal_item->entry;
+
+	*flags = index_entry->flags;
+
+	return( 1 );
+}
+
+/* Retrieves the modification time of an index file entry
+ * The modification time is a FILETIME value that is only stored in format version 20 index files
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libwtcdb_item_get_modification_time(
+     libwtcdb_item_t *item,
+     uint64_t *modification_time,
+     libcerror_error_t **error )
+{
+	libwtcdb_index_entry_t *index_entry     = NULL;
+	libwtcdb_internal_item_t *internal_item = NULL;
+	static char *function                   = "libwtcdb_item_get_modification_time";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libwtcdb_internal_item_t *) item;
+
+	if( internal_item->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( modification_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid modification time.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_item->io_handle->file_type != LIBWTCDB_FILE_TYPE_INDEX_V20 )
+	 || ( internal_item->io_handle->format_version != 20 ) )
+	{
+		return( 0 );
+	}
+	index_entry = (libwtcdb_index_entry_t *) internal_item->entry;
+
+	*modification_time = index_entry->modification_time;
+
+	return( 1 );
+}
+
+/* Retrieves the number of cache entry offsets of an index file entry
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libwtcdb_item_get_number_of_cache_entry_offsets(
+     libwtcdb_item_t *item,
+     int *number_of_cache_entry_offsets,
+     libcerror_error_t **error )
+{
+	libwtcdb_index_entry_t *index_entry     = NULL;
+	libwtcdb_internal_item_t *internal_item = NULL;
+	static char *function                   = "libwtcdb_item_get_number_of_cache_entry_offsets";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libwtcdb_internal_item_t *) item;
+
+	if( internal_item->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_cache_entry_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of cache entry offsets.",
+		 function );
+
+		return( -1 );
+	}
+	/* Only index file entries contain cache entry offsets
+	 */
+	if( ( internal_item->io_handle->file_type != LIBWTCDB_FILE_TYPE_INDEX_V20 )
+	 && ( internal_item->io_handle->file_type != LIBWTCDB_FILE_TYPE_INDEX_V30 ) )
+	{
+		return( 0 );
+	}
+	index_entry = (libwtcdb_index_entry_t *) internal_item->entry;
+
+	*number_of_cache_entry_offsets = index_entry->number_of_cache_entry_offsets;
+
+	return( 1 );
+}
+
+/* Retrieves a specific cache entry offset of an index file entry
+ * The cache entry offset is the offset of the cache entry in the corresponding cache file
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libwtcdb_item_get_cache_entry_offset(
+     libwtcdb_item_t *item,
+     int cache_entry_offset_index,
+     uint32_t *cache_entry_offset,
+     libcerror_error_t **error )
+{
+	libwtcdb_index_entry_t *index_entry     = NULL;
+	libwtcdb_internal_item_t *internal_item = NULL;
+	static char *function                   = "libwtcdb_item_get_cache_entry_offset";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libwtcdb_internal_item_t *) item;
+
+	if( internal_item->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_entry_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache entry offset.",
+		 function );
+
+		return( -1 );
+	}
+	/* Only index file entries contain cache entry offsets
+	 */
+	if( ( internal_item->io_handle->file_type != LIBWTCDB_FILE_TYPE_INDEX_V20 )
+	 && ( internal_item->io_handle->file_type != LIBWTCDB_FILE_TYPE_INDEX_V30 ) )
+	{
+		return( 0 );
+	}
+	index_entry = (libwtcdb_index_entry_t *) internal_item->entry;
+
+	if( ( cache_entry_offset_index < 0 )
+	 || ( cache_entry_offset_index >= index_entry->number_of_cache_entry_offsets ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid cache entry offset index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*cache_entry_offset = index_entry->cache_entry_offsets[ cache_entry_offset_index ];
+
 	return( 1 );
 }
 
@@ -26,9 +26,11 @@
 #include <types.h>
 
 #include "libwtcdb_extern.h"
+#include "libwtcdb_image_header.h"
 #include "libwtcdb_io_handle.h"
 #include "libwtcdb_libbfio.h"
 #include "libwtcdb_libcerror.h"
+#include "libwtcdb_read_ahead.h"
 #include "libwtcdb_types.h"
 
 #if defined( __cplusplus )
@@ -50,6 +52,20 @@ struct libwtcdb_internal_item
 	/* The entry
 	 */
 	intptr_t *entry;
+
+	/* The image header
+	 */
+	libwtcdb_image_header_t *image_header;
+
+	/* The item index
+	 */
+	int item_index;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	/* The read-ahead or NULL if not used
+	 */
+	libwtcdb_read_ahead_t *read_ahead;
+#endif
 };
 
 int libwtcdb_item_initialize(
@@ -64,6 +80,103 @@ int libwtcdb_item_free(
      libwtcdb_item_t **item,
      libcerror_error_t **error );
 
+int libwtcdb_internal_item_read_image_header(
+     libwtcdb_internal_item_t *internal_item,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_item_get_hash(
+     libwtcdb_item_t *item,
+     uint64_t *hash,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_item_get_utf8_identifier_size(
+     libwtcdb_item_t *item,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_item_get_utf8_identifier(
+     libwtcdb_item_t *item,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_item_get_utf16_identifier_size(
+     libwtcdb_item_t *item,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_item_get_utf16_identifier(
+     libwtcdb_item_t *item,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_item_get_image_format(
+     libwtcdb_item_t *item,
+     uint8_t *image_format,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_item_get_image_dimensions(
+     libwtcdb_item_t *item,
+     uint32_t *width,
+     uint32_t *height,
+     uint16_t *bits_per_pixel,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_item_get_data_size(
+     libwtcdb_item_t *item,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_item_copy_data(
+     libwtcdb_item_t *item,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_item_read_exif_values(
+     libwtcdb_item_t *item,
+     const uint16_t *tags,
+     int number_of_tags,
+     libwtcdb_exif_value_callback_t callback,
+     void *user_data,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_item_get_flags(
+     libwtcdb_item_t *item,
+     uint32_t *flags,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_item_get_modification_time(
+     libwtcdb_item_t *item,
+     uint64_t *modification_time,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_item_get_number_of_cache_entry_offsets(
+     libwtcdb_item_t *item,
+     int *number_of_cache_entry_offsets,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_item_get_cache_entry_offset(
+     libwtcdb_item_t *item,
+     int cache_entry_offset_index,
+     uint32_t *cache_entry_offset,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,444 @@
+/*
+ * Item worker functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libwtcdb_io_handle.h"
+#include "libwtcdb_item.h"
+#include "libwtcdb_item_worker.h"
+#include "libwtcdb_libcdata.h"
+#include "libwtcdb_libcerror.h"
+#include "libwtcdb_libcthreads.h"
+#include "libwtcdb_types.h"
+#include "libwtcdb_unused.h"
+
+/* Retrieves the stop value shared by the workers
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_item_worker_get_stop(
+     libwtcdb_item_worker_t *item_worker,
+     int *stop,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_item_worker_get_stop";
+
+	if( item_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_worker->stop == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item worker - missing stop value.",
+		 function );
+
+		return( -1 );
+	}
+	if( stop == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stop.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( item_worker->stop_mutex != NULL )
+	{
+		if( libcthreads_mutex_grab(
+		     item_worker->stop_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab stop mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	*stop = *( item_worker->stop );
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( item_worker->stop_mutex != NULL )
+	{
+		if( libcthreads_mutex_release(
+		     item_worker->stop_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release stop mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the stop value shared by the workers, which makes all workers stop
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_item_worker_set_stop(
+     libwtcdb_item_worker_t *item_worker,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_item_worker_set_stop";
+
+	if( item_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_worker->stop == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item worker - missing stop value.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( item_worker->stop_mutex != NULL )
+	{
+		if( libcthreads_mutex_grab(
+		     item_worker->stop_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab stop mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	*( item_worker->stop ) = 1;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( item_worker->stop_mutex != NULL )
+	{
+		if( libcthreads_mutex_release(
+		     item_worker->stop_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release stop mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( 1 );
+}
+
+/* Calls the item callback for the items of the worker
+ * The worker stops early if the callback returns 0, if another worker has
+ * stopped or if abort was signalled
+ * Returns 1 if all items were processed, 0 if stopped or -1 on error
+ */
+int libwtcdb_item_worker_run(
+     libwtcdb_item_worker_t *item_worker,
+     libcerror_error_t **error )
+{
+	libwtcdb_item_t *item = NULL;
+	intptr_t *entry       = NULL;
+	static char *function = "libwtcdb_item_worker_run";
+	int item_index        = 0;
+	int last_item_index   = 0;
+	int result            = 0;
+	int stop              = 0;
+
+	if( item_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_worker->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item worker - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_worker->callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item worker - missing callback.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_worker->stop == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item worker - missing stop value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( item_worker->first_item_index < 0 )
+	 || ( item_worker->number_of_items < 0 )
+	 || ( item_worker->number_of_items > ( INT_MAX - item_worker->first_item_index ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid item worker - item range value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	last_item_index = item_worker->first_item_index + item_worker->number_of_items;
+
+	for( item_index = item_worker->first_item_index;
+	     item_index < last_item_index;
+	     item_index++ )
+	{
+		if( libwtcdb_item_worker_get_stop(
+		     item_worker,
+		     &stop,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve stop value.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( stop != 0 )
+		 || ( item_worker->io_handle->abort != 0 ) )
+		{
+			return( 0 );
+		}
+		if( libcdata_array_get_entry_by_index(
+		     item_worker->entries,
+		     item_index,
+		     &entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry: %d.",
+			 function,
+			 item_index );
+
+			goto on_error;
+		}
+		if( libwtcdb_item_initialize(
+		     &item,
+		     item_worker->io_handle,
+		     item_worker->file_io_handle,
+		     entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create item: %d.",
+			 function,
+			 item_index );
+
+			goto on_error;
+		}
+		result = item_worker->callback(
+		          item,
+		          item_index,
+		          item_worker->worker_index,
+		          item_worker->user_data );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: callback failed for item: %d.",
+			 function,
+			 item_index );
+
+			goto on_error;
+		}
+		if( libwtcdb_item_free(
+		     &item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free item: %d.",
+			 function,
+			 item_index );
+
+			goto on_error;
+		}
+		if( result == 0 )
+		{
+			if( libwtcdb_item_worker_set_stop(
+			     item_worker,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set stop value.",
+				 function );
+
+				return( -1 );
+			}
+			return( 0 );
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( item != NULL )
+	{
+		libwtcdb_item_free(
+		 &item,
+		 NULL );
+	}
+	libwtcdb_item_worker_set_stop(
+	 item_worker,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Runs the item worker as a task of an executor
+ * The result and error are stored in the item worker
+ */
+void libwtcdb_item_worker_task_function(
+      void *task_data )
+{
+	libwtcdb_item_worker_t *item_worker = NULL;
+	static char *function               = "libwtcdb_item_worker_task_function";
+
+	if( task_data == NULL )
+	{
+		return;
+	}
+	item_worker = (libwtcdb_item_worker_t *) task_data;
+
+	item_worker->result = libwtcdb_item_worker_run(
+	                       item_worker,
+	                       &( item_worker->error ) );
+
+	if( item_worker->result == -1 )
+	{
+		libcerror_error_set(
+		 &( item_worker->error ),
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to process items: %d - %d of worker: %d.",
+		 function,
+		 item_worker->first_item_index,
+		 item_worker->first_item_index + item_worker->number_of_items - 1,
+		 item_worker->worker_index );
+	}
+}
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+
+/* Runs the item worker as a thread pool callback
+ * The result and error are stored in the item worker
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_item_worker_thread_pool_callback(
+     libwtcdb_item_worker_t *item_worker,
+     void *arguments LIBWTCDB_ATTRIBUTE_UNUSED )
+{
+	LIBWTCDB_UNREFERENCED_PARAMETER( arguments )
+
+	if( item_worker == NULL )
+	{
+		return( -1 );
+	}
+	libwtcdb_item_worker_task_function(
+	 (void *) item_worker );
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT ) */
+
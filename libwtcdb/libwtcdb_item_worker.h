@@ -0,0 +1,126 @@
+/*
+ * Item worker functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBWTCDB_ITEM_WORKER_H )
+#define _LIBWTCDB_ITEM_WORKER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libwtcdb_io_handle.h"
+#include "libwtcdb_libbfio.h"
+#include "libwtcdb_libcdata.h"
+#include "libwtcdb_libcerror.h"
+#include "libwtcdb_libcthreads.h"
+#include "libwtcdb_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libwtcdb_item_worker libwtcdb_item_worker_t;
+
+/* The item worker calls the item callback for a contiguous range of items
+ */
+struct libwtcdb_item_worker
+{
+	/* The IO handle
+	 */
+	libwtcdb_io_handle_t *io_handle;
+
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The entries array
+	 */
+	libcdata_array_t *entries;
+
+	/* The index of the first item
+	 */
+	int first_item_index;
+
+	/* The number of items
+	 */
+	int number_of_items;
+
+	/* The worker index
+	 */
+	int worker_index;
+
+	/* The item callback
+	 */
+	libwtcdb_item_callback_t callback;
+
+	/* The user data passed to the item callback
+	 */
+	void *user_data;
+
+	/* Value, shared by all workers, to indicate the workers should stop
+	 */
+	int *stop;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	/* The mutex, shared by all workers, that protects the stop value
+	 * NULL if the workers are not run concurrently
+	 */
+	libcthreads_mutex_t *stop_mutex;
+#endif
+
+	/* The result, 1 if all items were processed, 0 if stopped or -1 on error
+	 */
+	int result;
+
+	/* The error
+	 */
+	libcerror_error_t *error;
+};
+
+int libwtcdb_item_worker_get_stop(
+     libwtcdb_item_worker_t *item_worker,
+     int *stop,
+     libcerror_error_t **error );
+
+int libwtcdb_item_worker_set_stop(
+     libwtcdb_item_worker_t *item_worker,
+     libcerror_error_t **error );
+
+int libwtcdb_item_worker_run(
+     libwtcdb_item_worker_t *item_worker,
+     libcerror_error_t **error );
+
+void libwtcdb_item_worker_task_function(
+      void *task_data );
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+
+int libwtcdb_item_worker_thread_pool_callback(
+     libwtcdb_item_worker_t *item_worker,
+     void *arguments );
+
+#endif /* defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBWTCDB_ITEM_WORKER_H ) */
+
@@ -0,0 +1,192 @@
+/*
+ * JPEG functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <types.h>
+
+#include "libwtcdb_definitions.h"
+#include "libwtcdb_jpeg.h"
+#include "libwtcdb_io_backend.h"
+#include "libwtcdb_libbfio.h"
+#include "libwtcdb_libcerror.h"
+#include "libwtcdb_libcnotify.h"
+
+/* Reads the next segment with a segment size from the JPEG marker chain
+ * The JPEG segment must be cleared before the first segment is read
+ * Fill bytes and markers without a segment size are skipped
+ * Only the marker and size of a segment and up to 6 bytes of its data are read
+ * A segment that exceeds the data ends the marker chain
+ * Returns 1 if successful, 0 if no more segments are available or -1 on error
+ */
+int libwtcdb_jpeg_segment_read_next_file_io_handle(
+     libwtcdb_jpeg_segment_t *jpeg_segment,
+     libwtcdb_io_backend_t *io_backend,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     uint32_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function  = "libwtcdb_jpeg_segment_read_next_file_io_handle";
+	size_t read_size       = 0;
+	ssize_t read_count     = 0;
+	uint32_t data_offset   = 0;
+	uint16_t segment_size  = 0;
+	uint8_t segment_marker = 0;
+
+	if( jpeg_segment == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid JPEG segment.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	while( jpeg_segment->next_index < LIBWTCDB_MAXIMUM_NUMBER_OF_JPEG_SEGMENTS )
+	{
+		data_offset = jpeg_segment->next_offset;
+
+		if( ( data_size < 4 )
+		 || ( data_offset > ( data_size - 4 ) ) )
+		{
+			break;
+		}
+		read_size = data_size - data_offset;
+
+		if( read_size > 10 )
+		{
+			read_size = 10;
+		}
+		read_count = libwtcdb_io_backend_read_buffer_at_offset(
+		              io_backend,
+		              file_io_handle,
+		              jpeg_segment->data,
+		              read_size,
+		              file_offset + data_offset,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read JPEG segment: %d data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 jpeg_segment->next_index,
+			 file_offset + data_offset,
+			 file_offset + data_offset );
+
+			return( -1 );
+		}
+		if( jpeg_segment->data[ 0 ] != 0xff )
+		{
+			break;
+		}
+		segment_marker = jpeg_segment->data[ 1 ];
+
+		/* The data should start with the SOI marker
+		 */
+		if( ( data_offset == 0 )
+		 && ( segment_marker != 0xd8 ) )
+		{
+			break;
+		}
+		/* Skip fill bytes
+		 */
+		if( segment_marker == 0xff )
+		{
+			jpeg_segment->next_offset += 1;
+			jpeg_segment->next_index  += 1;
+
+			continue;
+		}
+		/* Markers without a segment size: TEM, RST0 - RST7 and SOI
+		 */
+		if( ( segment_marker == 0x01 )
+		 || ( ( segment_marker >= 0xd0 )
+		  &&  ( segment_marker <= 0xd8 ) ) )
+		{
+			jpeg_segment->next_offset += 2;
+			jpeg_segment->next_index  += 1;
+
+			continue;
+		}
+		/* The marker chain ends at the SOS segment or EOI marker
+		 */
+		if( ( segment_marker == 0xd9 )
+		 || ( segment_marker == 0xda ) )
+		{
+			break;
+		}
+		byte_stream_copy_to_uint16_big_endian(
+		 &( jpeg_segment->data[ 2 ] ),
+		 segment_size );
+
+		if( segment_size < 2 )
+		{
+			break;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: segment: %d marker: 0x%02" PRIx8 " size\t: %" PRIu16 "\n",
+			 function,
+			 jpeg_segment->next_index,
+			 segment_marker,
+			 segment_size );
+		}
+#endif
+		jpeg_segment->offset    = data_offset;
+		jpeg_segment->marker    = segment_marker;
+		jpeg_segment->size      = segment_size;
+		jpeg_segment->data_size = read_size;
+
+		if( (uint32_t) segment_size > ( data_size - data_offset - 2 ) )
+		{
+			jpeg_segment->next_offset = data_size;
+		}
+		else
+		{
+			jpeg_segment->next_offset += 2 + (uint32_t) segment_size;
+		}
+		jpeg_segment->next_index += 1;
+
+		return( 1 );
+	}
+	return( 0 );
+}
+
@@ -0,0 +1,85 @@
+/*
+ * JPEG functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBWTCDB_JPEG_H )
+#define _LIBWTCDB_JPEG_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libwtcdb_io_backend.h"
+#include "libwtcdb_libbfio.h"
+#include "libwtcdb_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libwtcdb_jpeg_segment libwtcdb_jpeg_segment_t;
+
+/* The JPEG segment contains the start of a segment of the JPEG marker chain
+ * and the position of the next segment in the marker chain
+ */
+struct libwtcdb_jpeg_segment
+{
+	/* The offset of the segment marker relative to the start of the data
+	 */
+	uint32_t offset;
+
+	/* The segment marker
+	 */
+	uint8_t marker;
+
+	/* The segment size, which includes the segment size value but not the segment marker
+	 */
+	uint16_t size;
+
+	/* The start of the segment data, including the segment marker
+	 */
+	uint8_t data[ 10 ];
+
+	/* The number of bytes of the start of the segment data that were read
+	 */
+	size_t data_size;
+
+	/* The offset of the next segment marker relative to the start of the data
+	 */
+	uint32_t next_offset;
+
+	/* The index of the next segment marker
+	 */
+	int next_index;
+};
+
+int libwtcdb_jpeg_segment_read_next_file_io_handle(
+     libwtcdb_jpeg_segment_t *jpeg_segment,
+     libwtcdb_io_backend_t *io_backend,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     uint32_t data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBWTCDB_JPEG_H ) */
+
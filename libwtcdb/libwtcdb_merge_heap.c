@@ -0,0 +1,296 @@
+/*
+ * Merge heap functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <types.h>
+
+#include "libwtcdb_libcdata.h"
+#include "libwtcdb_libcerror.h"
+#include "libwtcdb_merge_heap.h"
+
+/* Moves the value at a specific index down to restore the heap order
+ * The heap is a binary min heap stored in the values array, the value that
+ * compares as less than all other values is stored first
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_merge_heap_sift_down(
+     intptr_t **values,
+     int number_of_values,
+     int value_index,
+     int (*value_compare_function)(
+            intptr_t *first_value,
+            intptr_t *second_value,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	intptr_t *value       = NULL;
+	static char *function = "libwtcdb_merge_heap_sift_down";
+	int child_index       = 0;
+	int compare_result    = 0;
+
+	if( values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_index < 0 )
+	 || ( value_index >= number_of_values ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_compare_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value compare function.",
+		 function );
+
+		return( -1 );
+	}
+	value = values[ value_index ];
+
+	while( value_index < ( number_of_values / 2 ) )
+	{
+		child_index = ( value_index * 2 ) + 1;
+
+		if( ( child_index + 1 ) < number_of_values )
+		{
+			compare_result = value_compare_function(
+			                  values[ child_index + 1 ],
+			                  values[ child_index ],
+			                  error );
+
+			if( compare_result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare values: %d and %d.",
+				 function,
+				 child_index + 1,
+				 child_index );
+
+				goto on_error;
+			}
+			else if( compare_result == LIBCDATA_COMPARE_LESS )
+			{
+				child_index += 1;
+			}
+		}
+		compare_result = value_compare_function(
+		                  values[ child_index ],
+		                  value,
+		                  error );
+
+		if( compare_result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare value: %d.",
+			 function,
+			 child_index );
+
+			goto on_error;
+		}
+		else if( compare_result != LIBCDATA_COMPARE_LESS )
+		{
+			break;
+		}
+		values[ value_index ] = values[ child_index ];
+
+		value_index = child_index;
+	}
+	values[ value_index ] = value;
+
+	return( 1 );
+
+on_error:
+	/* Keep every value in the heap when the comparison fails
+	 */
+	values[ value_index ] = value;
+
+	return( -1 );
+}
+
+/* Builds a heap from values in arbitrary order
+ * Values is not used when there are less than 2 values
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_merge_heap_build(
+     intptr_t **values,
+     int number_of_values,
+     int (*value_compare_function)(
+            intptr_t *first_value,
+            intptr_t *second_value,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_merge_heap_build";
+	int value_index       = 0;
+
+	if( number_of_values < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of values value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values < 2 )
+	{
+		return( 1 );
+	}
+	if( values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = ( number_of_values / 2 ) - 1;
+	     value_index >= 0;
+	     value_index-- )
+	{
+		if( libwtcdb_merge_heap_sift_down(
+		     values,
+		     number_of_values,
+		     value_index,
+		     value_compare_function,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to sift down value: %d.",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Removes the first value from the heap
+ * The last value is moved into the place of the first value after which the heap
+ * order is restored, the removed value remains stored after the heap values
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_merge_heap_remove_first(
+     intptr_t **values,
+     int *number_of_values,
+     int (*value_compare_function)(
+            intptr_t *first_value,
+            intptr_t *second_value,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	intptr_t *value       = NULL;
+	static char *function = "libwtcdb_merge_heap_remove_first";
+
+	if( values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of values.",
+		 function );
+
+		return( -1 );
+	}
+	if( *number_of_values <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of values value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_values -= 1;
+
+	value                       = values[ 0 ];
+	values[ 0 ]                 = values[ *number_of_values ];
+	values[ *number_of_values ] = value;
+
+	if( *number_of_values > 1 )
+	{
+		if( libwtcdb_merge_heap_sift_down(
+		     values,
+		     *number_of_values,
+		     0,
+		     value_compare_function,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to sift down first value.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
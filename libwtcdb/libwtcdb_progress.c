@@ -0,0 +1,480 @@
+/*
+ * Progress functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_TIME_H ) || defined( HAVE_CLOCK_GETTIME )
+#include <time.h>
+#endif
+
+#include "libwtcdb_definitions.h"
+#include "libwtcdb_libcerror.h"
+#include "libwtcdb_libcthreads.h"
+#include "libwtcdb_progress.h"
+#include "libwtcdb_types.h"
+
+/* Creates a progress
+ * Make sure the value progress is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_progress_initialize(
+     libwtcdb_progress_t **progress,
+     libwtcdb_progress_callback_t callback,
+     void *user_data,
+     uint32_t interval,
+     uint64_t file_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_progress_initialize";
+
+	if( progress == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid progress.",
+		 function );
+
+		return( -1 );
+	}
+	if( *progress != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid progress value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback.",
+		 function );
+
+		return( -1 );
+	}
+	*progress = memory_allocate_structure(
+	             libwtcdb_progress_t );
+
+	if( *progress == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create progress.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *progress,
+	     0,
+	     sizeof( libwtcdb_progress_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear progress.",
+		 function );
+
+		memory_free(
+		 *progress );
+
+		*progress = NULL;
+
+		return( -1 );
+	}
+	if( libwtcdb_progress_get_current_time(
+	     &( ( *progress )->last_report_time ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current time.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *progress )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *progress )->callback  = callback;
+	( *progress )->user_data = user_data;
+	( *progress )->interval  = interval;
+	( *progress )->file_size = file_size;
+
+	return( 1 );
+
+on_error:
+	if( *progress != NULL )
+	{
+		memory_free(
+		 *progress );
+
+		*progress = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a progress
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_progress_free(
+     libwtcdb_progress_t **progress,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_progress_free";
+	int result            = 1;
+
+	if( progress == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid progress.",
+		 function );
+
+		return( -1 );
+	}
+	if( *progress != NULL )
+	{
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *progress )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *progress );
+
+		*progress = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves the current time in milliseconds
+ * The time is only used to determine intervals and has no fixed epoch
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_progress_get_current_time(
+     uint64_t *current_time,
+     libcerror_error_t **error )
+{
+#if !defined( WINAPI ) && defined( HAVE_CLOCK_GETTIME )
+	struct timespec time_value;
+#endif
+
+	static char *function = "libwtcdb_progress_get_current_time";
+
+	if( current_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current time.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	*current_time = (uint64_t) GetTickCount();
+
+#elif defined( HAVE_CLOCK_GETTIME )
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve monotonic clock time.",
+		 function );
+
+		return( -1 );
+	}
+	*current_time = ( (uint64_t) time_value.tv_sec * 1000 )
+	              + ( (uint64_t) time_value.tv_nsec / 1000000 );
+
+#elif defined( HAVE_TIME_H )
+	*current_time = (uint64_t) time( NULL ) * 1000;
+
+#else
+	*current_time = 0;
+#endif
+	return( 1 );
+}
+
+/* Sets the phase and reports it regardless of the interval
+ * Once the callback requested an abort it is no longer called
+ * Returns 1 to continue, 0 if the callback requested an abort or -1 on error
+ */
+int libwtcdb_progress_set_phase(
+     libwtcdb_progress_t *progress,
+     int phase,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_progress_set_phase";
+	int result            = 0;
+
+	if( progress == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid progress.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     progress->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	progress->phase = phase;
+
+	if( phase == LIBWTCDB_PROGRESS_PHASE_COMPLETED )
+	{
+		progress->bytes_scanned = progress->file_size;
+	}
+	if( progress->abort != 0 )
+	{
+		result = 0;
+	}
+	else if( libwtcdb_progress_get_current_time(
+	          &( progress->last_report_time ),
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current time.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		result = progress->callback(
+		          progress->phase,
+		          progress->bytes_scanned,
+		          progress->file_size,
+		          progress->number_of_entries,
+		          progress->user_data );
+
+		if( result != 1 )
+		{
+			progress->abort = 1;
+
+			result = 0;
+		}
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     progress->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Adds bytes scanned and entries to the progress and reports them
+ * if the interval has elapsed since the last report
+ * Returns 1 to continue, 0 if the callback requested an abort or -1 on error
+ */
+int libwtcdb_progress_update(
+     libwtcdb_progress_t *progress,
+     uint64_t bytes_scanned,
+     int number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_progress_update";
+	uint64_t current_time = 0;
+	int result            = 1;
+
+	if( progress == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid progress.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of entries value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     progress->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( bytes_scanned > ( progress->file_size - progress->bytes_scanned ) )
+	{
+		progress->bytes_scanned = progress->file_size;
+	}
+	else
+	{
+		progress->bytes_scanned += bytes_scanned;
+	}
+	if( number_of_entries > ( INT_MAX - progress->number_of_entries ) )
+	{
+		progress->number_of_entries = INT_MAX;
+	}
+	else
+	{
+		progress->number_of_entries += number_of_entries;
+	}
+	if( progress->abort != 0 )
+	{
+		result = 0;
+	}
+	else if( libwtcdb_progress_get_current_time(
+	          &current_time,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current time.",
+		 function );
+
+		result = -1;
+	}
+	/* The current time can be less than the time of the last report
+	 * when the clock wraps around
+	 */
+	else if( ( current_time < progress->last_report_time )
+	      || ( ( current_time - progress->last_report_time ) >= (uint64_t) progress->interval ) )
+	{
+		progress->last_report_time = current_time;
+
+		result = progress->callback(
+		          progress->phase,
+		          progress->bytes_scanned,
+		          progress->file_size,
+		          progress->number_of_entries,
+		          progress->user_data );
+
+		if( result != 1 )
+		{
+			progress->abort = 1;
+
+			result = 0;
+		}
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     progress->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
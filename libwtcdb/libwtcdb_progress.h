@@ -0,0 +1,118 @@
+/*
+ * Progress functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBWTCDB_PROGRESS_H )
+#define _LIBWTCDB_PROGRESS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libwtcdb_libcerror.h"
+#include "libwtcdb_libcthreads.h"
+#include "libwtcdb_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libwtcdb_progress libwtcdb_progress_t;
+
+/* The progress keeps track of the bytes scanned and entries read of a file
+ * and reports them to a callback at most once per interval
+ */
+struct libwtcdb_progress
+{
+	/* The callback
+	 */
+	libwtcdb_progress_callback_t callback;
+
+	/* The user data passed to the callback
+	 */
+	void *user_data;
+
+	/* The interval between reports in milliseconds
+	 */
+	uint32_t interval;
+
+	/* The time of the last report in milliseconds
+	 */
+	uint64_t last_report_time;
+
+	/* The phase
+	 */
+	int phase;
+
+	/* The file size
+	 */
+	uint64_t file_size;
+
+	/* The number of bytes scanned
+	 */
+	uint64_t bytes_scanned;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* Value to indicate the callback requested an abort
+	 */
+	int abort;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libwtcdb_progress_initialize(
+     libwtcdb_progress_t **progress,
+     libwtcdb_progress_callback_t callback,
+     void *user_data,
+     uint32_t interval,
+     uint64_t file_size,
+     libcerror_error_t **error );
+
+int libwtcdb_progress_free(
+     libwtcdb_progress_t **progress,
+     libcerror_error_t **error );
+
+int libwtcdb_progress_get_current_time(
+     uint64_t *current_time,
+     libcerror_error_t **error );
+
+int libwtcdb_progress_set_phase(
+     libwtcdb_progress_t *progress,
+     int phase,
+     libcerror_error_t **error );
+
+int libwtcdb_progress_update(
+     libwtcdb_progress_t *progress,
+     uint64_t bytes_scanned,
+     int number_of_entries,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBWTCDB_PROGRESS_H ) */
+
@@ -0,0 +1,237 @@
+/*
+ * Radix sort functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libwtcdb_libcerror.h"
+#include "libwtcdb_radix_sort.h"
+
+/* Sorts 64-bit keys with their corresponding entry indexes
+ * Uses a least significant digit radix sort with 8-bit digits, which is stable
+ * so that entries with the same key remain in their original order. The digit
+ * counts of all passes are determined in a single scan and passes in which all
+ * keys have the same digit are skipped
+ * The keys and entry indexes are sorted using a second buffer of the same size,
+ * hence on return keys and entry_indexes can refer to the other buffer and the
+ * buffers they referred to before are freed
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_radix_sort_keys(
+     uint64_t **keys,
+     int **entry_indexes,
+     int number_of_entries,
+     libcerror_error_t **error )
+{
+	int digit_counts[ 8 ][ 256 ];
+
+	uint64_t *source_keys     = NULL;
+	uint64_t *sorted_keys     = NULL;
+	uint64_t *swap_keys       = NULL;
+	static char *function     = "libwtcdb_radix_sort_keys";
+	uint64_t key              = 0;
+	uint8_t digit             = 0;
+	int *source_entry_indexes = NULL;
+	int *sorted_entry_indexes = NULL;
+	int *swap_entry_indexes   = NULL;
+	int digit_index           = 0;
+	int digit_offset          = 0;
+	int digit_value           = 0;
+	int entry_index           = 0;
+
+	if( keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid keys.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry indexes.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_entries < 0 )
+	 || ( (size_t) number_of_entries > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint64_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries < 2 )
+	{
+		return( 1 );
+	}
+	if( ( *keys == NULL )
+	 || ( *entry_indexes == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid keys or entry indexes.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     digit_counts,
+	     0,
+	     sizeof( int ) * 8 * 256 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear digit counts.",
+		 function );
+
+		return( -1 );
+	}
+	source_keys          = *keys;
+	source_entry_indexes = *entry_indexes;
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		key = source_keys[ entry_index ];
+
+		for( digit_index = 0;
+		     digit_index < 8;
+		     digit_index++ )
+		{
+			digit_counts[ digit_index ][ key & 0xff ] += 1;
+
+			key >>= 8;
+		}
+	}
+	sorted_keys = (uint64_t *) memory_allocate(
+	                            sizeof( uint64_t ) * (size_t) number_of_entries );
+
+	if( sorted_keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sorted keys.",
+		 function );
+
+		goto on_error;
+	}
+	sorted_entry_indexes = (int *) memory_allocate(
+	                                sizeof( int ) * (size_t) number_of_entries );
+
+	if( sorted_entry_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sorted entry indexes.",
+		 function );
+
+		goto on_error;
+	}
+	for( digit_index = 0;
+	     digit_index < 8;
+	     digit_index++ )
+	{
+		digit = (uint8_t) ( source_keys[ 0 ] >> ( digit_index * 8 ) );
+
+		if( digit_counts[ digit_index ][ digit ] == number_of_entries )
+		{
+			continue;
+		}
+		/* Convert the digit counts into the offsets of the digit values
+		 */
+		digit_offset = 0;
+
+		for( digit_value = 0;
+		     digit_value < 256;
+		     digit_value++ )
+		{
+			entry_index = digit_counts[ digit_index ][ digit_value ];
+
+			digit_counts[ digit_index ][ digit_value ] = digit_offset;
+
+			digit_offset += entry_index;
+		}
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
+		{
+			key          = source_keys[ entry_index ];
+			digit        = (uint8_t) ( key >> ( digit_index * 8 ) );
+			digit_offset = digit_counts[ digit_index ][ digit ];
+
+			sorted_keys[ digit_offset ]          = key;
+			sorted_entry_indexes[ digit_offset ] = source_entry_indexes[ entry_index ];
+
+			digit_counts[ digit_index ][ digit ] += 1;
+		}
+		swap_keys            = source_keys;
+		source_keys          = sorted_keys;
+		sorted_keys          = swap_keys;
+		swap_entry_indexes   = source_entry_indexes;
+		source_entry_indexes = sorted_entry_indexes;
+		sorted_entry_indexes = swap_entry_indexes;
+	}
+	/* The source buffers contain the result of the last pass
+	 */
+	*keys          = source_keys;
+	*entry_indexes = source_entry_indexes;
+
+	memory_free(
+	 sorted_entry_indexes );
+
+	memory_free(
+	 sorted_keys );
+
+	return( 1 );
+
+on_error:
+	if( sorted_keys != NULL )
+	{
+		memory_free(
+		 sorted_keys );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,867 @@
+/*
+ * Read-ahead functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libwtcdb_cache_entry.h"
+#include "libwtcdb_definitions.h"
+#include "libwtcdb_io_backend.h"
+#include "libwtcdb_libbfio.h"
+#include "libwtcdb_libcdata.h"
+#include "libwtcdb_libcerror.h"
+#include "libwtcdb_libcthreads.h"
+#include "libwtcdb_read_ahead.h"
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+
+/* Creates a read-ahead and starts its helper thread
+ * Make sure the value read_ahead is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_read_ahead_initialize(
+     libwtcdb_read_ahead_t **read_ahead,
+     libwtcdb_io_backend_t *io_backend,
+     libbfio_handle_t *file_io_handle,
+     libcdata_array_t *entries,
+     int number_of_read_ahead_items,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_read_ahead_initialize";
+	int buffer_index      = 0;
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_ahead != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid read-ahead value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_read_ahead_items < 1 )
+	 || ( number_of_read_ahead_items > LIBWTCDB_MAXIMUM_NUMBER_OF_READ_AHEAD_ITEMS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of read-ahead items value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*read_ahead = memory_allocate_structure(
+	               libwtcdb_read_ahead_t );
+
+	if( *read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read-ahead.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *read_ahead,
+	     0,
+	     sizeof( libwtcdb_read_ahead_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read-ahead.",
+		 function );
+
+		memory_free(
+		 *read_ahead );
+
+		*read_ahead = NULL;
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     entries,
+	     &( ( *read_ahead )->number_of_items ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from array.",
+		 function );
+
+		goto on_error;
+	}
+	( *read_ahead )->number_of_buffers = number_of_read_ahead_items + 1;
+
+	( *read_ahead )->buffers = (libwtcdb_read_ahead_buffer_t *) memory_allocate(
+	                                                             sizeof( libwtcdb_read_ahead_buffer_t ) * (size_t) ( *read_ahead )->number_of_buffers );
+
+	if( ( *read_ahead )->buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffers.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *read_ahead )->buffers,
+	     0,
+	     sizeof( libwtcdb_read_ahead_buffer_t ) * (size_t) ( *read_ahead )->number_of_buffers ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buffers.",
+		 function );
+
+		goto on_error;
+	}
+	for( buffer_index = 0;
+	     buffer_index < ( *read_ahead )->number_of_buffers;
+	     buffer_index++ )
+	{
+		( *read_ahead )->buffers[ buffer_index ].item_index = -1;
+	}
+	if( libcthreads_mutex_initialize(
+	     &( ( *read_ahead )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *read_ahead )->condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create condition.",
+		 function );
+
+		goto on_error;
+	}
+	( *read_ahead )->io_backend     = io_backend;
+	( *read_ahead )->file_io_handle = file_io_handle;
+	( *read_ahead )->entries        = entries;
+
+	if( libcthreads_thread_create(
+	     &( ( *read_ahead )->thread ),
+	     NULL,
+	     (int (*)(void *)) &libwtcdb_read_ahead_thread_callback,
+	     (void *) *read_ahead,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create thread.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *read_ahead != NULL )
+	{
+		if( ( *read_ahead )->condition != NULL )
+		{
+			libcthreads_condition_free(
+			 &( ( *read_ahead )->condition ),
+			 NULL );
+		}
+		if( ( *read_ahead )->mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *read_ahead )->mutex ),
+			 NULL );
+		}
+		if( ( *read_ahead )->buffers != NULL )
+		{
+			memory_free(
+			 ( *read_ahead )->buffers );
+		}
+		memory_free(
+		 *read_ahead );
+
+		*read_ahead = NULL;
+	}
+	return( -1 );
+}
+
+/* Stops the helper thread and frees a read-ahead
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_read_ahead_free(
+     libwtcdb_read_ahead_t **read_ahead,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_read_ahead_free";
+	int buffer_index      = 0;
+	int result            = 1;
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_ahead != NULL )
+	{
+		if( ( *read_ahead )->thread != NULL )
+		{
+			if( libcthreads_mutex_grab(
+			     ( *read_ahead )->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab mutex.",
+				 function );
+
+				return( -1 );
+			}
+			( *read_ahead )->stop = 1;
+
+			if( libcthreads_condition_broadcast(
+			     ( *read_ahead )->condition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to broadcast condition.",
+				 function );
+
+				result = -1;
+			}
+			if( libcthreads_mutex_release(
+			     ( *read_ahead )->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release mutex.",
+				 function );
+
+				return( -1 );
+			}
+			/* The helper thread must have stopped before the buffers can be freed
+			 */
+			if( result != 1 )
+			{
+				return( -1 );
+			}
+			if( libcthreads_thread_join(
+			     &( ( *read_ahead )->thread ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		for( buffer_index = 0;
+		     buffer_index < ( *read_ahead )->number_of_buffers;
+		     buffer_index++ )
+		{
+			if( ( *read_ahead )->buffers[ buffer_index ].data != NULL )
+			{
+				memory_free(
+				 ( *read_ahead )->buffers[ buffer_index ].data );
+			}
+		}
+		memory_free(
+		 ( *read_ahead )->buffers );
+
+		if( libcthreads_condition_free(
+		     &( ( *read_ahead )->condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( ( *read_ahead )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *read_ahead );
+
+		*read_ahead = NULL;
+	}
+	return( result );
+}
+
+/* Reads the cached data of a specific item into a buffer
+ * This function is called by the helper thread without holding the mutex
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_read_ahead_read_buffer(
+     libwtcdb_read_ahead_t *read_ahead,
+     libwtcdb_read_ahead_buffer_t *buffer,
+     int item_index,
+     libcerror_error_t **error )
+{
+	libwtcdb_cache_entry_t *cache_entry = NULL;
+	uint8_t *data                       = NULL;
+	static char *function               = "libwtcdb_read_ahead_read_buffer";
+	ssize_t read_count                  = 0;
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     read_ahead->entries,
+	     item_index,
+	     (intptr_t **) &cache_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry: %d.",
+		 function,
+		 item_index );
+
+		return( -1 );
+	}
+	if( cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing entry: %d.",
+		 function,
+		 item_index );
+
+		return( -1 );
+	}
+	if( (size_t) cache_entry->cached_data_size > buffer->allocated_data_size )
+	{
+		if( (size_t) cache_entry->cached_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid cached data size value exceeds maximum allocation size.",
+			 function );
+
+			return( -1 );
+		}
+		data = (uint8_t *) memory_reallocate(
+		                    buffer->data,
+		                    sizeof( uint8_t ) * (size_t) cache_entry->cached_data_size );
+
+		if( data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize buffer data.",
+			 function );
+
+			return( -1 );
+		}
+		buffer->data                = data;
+		buffer->allocated_data_size = (size_t) cache_entry->cached_data_size;
+	}
+	buffer->data_size = (size_t) cache_entry->cached_data_size;
+
+	if( buffer->data_size > 0 )
+	{
+		read_count = libwtcdb_io_backend_read_buffer_at_offset(
+		              read_ahead->io_backend,
+		              read_ahead->file_io_handle,
+		              buffer->data,
+		              buffer->data_size,
+		              cache_entry->cached_data_offset,
+		              error );
+
+		if( read_count != (ssize_t) buffer->data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read cached data of item: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 item_index,
+			 cache_entry->cached_data_offset,
+			 cache_entry->cached_data_offset );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* The helper thread callback
+ * Reads the cached data of the items from the next item up to the end item
+ * and waits for the position to change once all of them have been read
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_read_ahead_thread_callback(
+     libwtcdb_read_ahead_t *read_ahead )
+{
+	libcerror_error_t *error             = NULL;
+	libwtcdb_read_ahead_buffer_t *buffer = NULL;
+	int item_index                       = 0;
+	int read_result                      = 0;
+	int result                           = 1;
+
+	if( read_ahead == NULL )
+	{
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     read_ahead->mutex,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	while( read_ahead->stop == 0 )
+	{
+		if( read_ahead->next_item_index >= read_ahead->end_item_index )
+		{
+			if( libcthreads_condition_wait(
+			     read_ahead->condition,
+			     read_ahead->mutex,
+			     NULL ) != 1 )
+			{
+				result = -1;
+
+				break;
+			}
+			continue;
+		}
+		item_index = read_ahead->next_item_index;
+
+		read_ahead->next_item_index += 1;
+
+		buffer = &( read_ahead->buffers[ item_index % read_ahead->number_of_buffers ] );
+
+		if( ( buffer->item_index == item_index )
+		 && ( buffer->state == LIBWTCDB_READ_AHEAD_BUFFER_STATE_READ ) )
+		{
+			continue;
+		}
+		buffer->item_index = item_index;
+		buffer->state      = LIBWTCDB_READ_AHEAD_BUFFER_STATE_READING;
+
+		/* The buffer is not accessed by other threads while it is being read
+		 */
+		if( libcthreads_mutex_release(
+		     read_ahead->mutex,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+		read_result = libwtcdb_read_ahead_read_buffer(
+		               read_ahead,
+		               buffer,
+		               item_index,
+		               &error );
+
+		if( read_result != 1 )
+		{
+			/* The item will be read without read-ahead
+			 */
+			libcerror_error_free(
+			 &error );
+		}
+		if( libcthreads_mutex_grab(
+		     read_ahead->mutex,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+		if( read_result != 1 )
+		{
+			buffer->state = LIBWTCDB_READ_AHEAD_BUFFER_STATE_FAILED;
+		}
+		else
+		{
+			buffer->state = LIBWTCDB_READ_AHEAD_BUFFER_STATE_READ;
+		}
+		if( libcthreads_condition_broadcast(
+		     read_ahead->condition,
+		     NULL ) != 1 )
+		{
+			result = -1;
+
+			break;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     read_ahead->mutex,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Sets the position of the read-ahead to a specific item
+ * The cached data of the item and the items following it are read ahead
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_read_ahead_set_position(
+     libwtcdb_read_ahead_t *read_ahead,
+     int item_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_read_ahead_set_position";
+	int end_item_index    = 0;
+	int result            = 1;
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( item_index < 0 )
+	 || ( item_index >= read_ahead->number_of_items ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid item index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	end_item_index = read_ahead->number_of_items;
+
+	if( item_index < ( read_ahead->number_of_items - read_ahead->number_of_buffers ) )
+	{
+		end_item_index = item_index + read_ahead->number_of_buffers;
+	}
+	if( libcthreads_mutex_grab(
+	     read_ahead->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	/* Restart reading at the item if the next item is outside the new range
+	 */
+	if( ( read_ahead->next_item_index < item_index )
+	 || ( read_ahead->next_item_index > end_item_index ) )
+	{
+		read_ahead->next_item_index = item_index;
+	}
+	read_ahead->end_item_index = end_item_index;
+
+	if( libcthreads_condition_broadcast(
+	     read_ahead->condition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast condition.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     read_ahead->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Copies the cached data of a specific item that was read ahead
+ * Waits if the cached data of the item is being read
+ * Returns 1 if successful, 0 if the cached data was not read ahead or -1 on error
+ */
+int libwtcdb_read_ahead_copy_data(
+     libwtcdb_read_ahead_t *read_ahead,
+     int item_index,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libwtcdb_read_ahead_buffer_t *buffer = NULL;
+	static char *function                = "libwtcdb_read_ahead_copy_data";
+	int result                           = 0;
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid item index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	buffer = &( read_ahead->buffers[ item_index % read_ahead->number_of_buffers ] );
+
+	if( libcthreads_mutex_grab(
+	     read_ahead->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( buffer->item_index == item_index )
+	    && ( buffer->state == LIBWTCDB_READ_AHEAD_BUFFER_STATE_READING ) )
+	{
+		if( libcthreads_condition_wait(
+		     read_ahead->condition,
+		     read_ahead->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for condition.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+	}
+	if( ( result == 0 )
+	 && ( buffer->item_index == item_index )
+	 && ( buffer->state == LIBWTCDB_READ_AHEAD_BUFFER_STATE_READ ) )
+	{
+		if( data_size < buffer->data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid data size value too small.",
+			 function );
+
+			result = -1;
+		}
+		else if( buffer->data_size > 0 )
+		{
+			if( memory_copy(
+			     data,
+			     buffer->data,
+			     buffer->data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy data.",
+				 function );
+
+				result = -1;
+			}
+			else
+			{
+				result = 1;
+			}
+		}
+		else
+		{
+			result = 1;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     read_ahead->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT ) */
+
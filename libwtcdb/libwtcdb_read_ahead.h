@@ -0,0 +1,171 @@
+/*
+ * Read-ahead functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBWTCDB_READ_AHEAD_H )
+#define _LIBWTCDB_READ_AHEAD_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libwtcdb_io_backend.h"
+#include "libwtcdb_libbfio.h"
+#include "libwtcdb_libcdata.h"
+#include "libwtcdb_libcerror.h"
+#include "libwtcdb_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+
+enum LIBWTCDB_READ_AHEAD_BUFFER_STATES
+{
+	LIBWTCDB_READ_AHEAD_BUFFER_STATE_EMPTY		= 0,
+	LIBWTCDB_READ_AHEAD_BUFFER_STATE_READING	= 1,
+	LIBWTCDB_READ_AHEAD_BUFFER_STATE_READ		= 2,
+	LIBWTCDB_READ_AHEAD_BUFFER_STATE_FAILED		= 3
+};
+
+typedef struct libwtcdb_read_ahead_buffer libwtcdb_read_ahead_buffer_t;
+
+/* The read-ahead buffer contains the cached data of a single item
+ */
+struct libwtcdb_read_ahead_buffer
+{
+	/* The index of the item or -1 if not set
+	 */
+	int item_index;
+
+	/* The state
+	 */
+	int state;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The allocated data size
+	 */
+	size_t allocated_data_size;
+};
+
+typedef struct libwtcdb_read_ahead libwtcdb_read_ahead_t;
+
+/* The read-ahead reads the cached data of the items following the current
+ * item on a helper thread into a ring of buffers
+ */
+struct libwtcdb_read_ahead
+{
+	/* The IO backend
+	 */
+	libwtcdb_io_backend_t *io_backend;
+
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The cache entries array
+	 */
+	libcdata_array_t *entries;
+
+	/* The number of items
+	 */
+	int number_of_items;
+
+	/* The buffers, one for the current item and one for every item read ahead
+	 */
+	libwtcdb_read_ahead_buffer_t *buffers;
+
+	/* The number of buffers
+	 */
+	int number_of_buffers;
+
+	/* The index of the next item to read
+	 */
+	int next_item_index;
+
+	/* The index of the item following the last item to read
+	 */
+	int end_item_index;
+
+	/* Value to indicate the helper thread should stop
+	 */
+	int stop;
+
+	/* The helper thread
+	 */
+	libcthreads_thread_t *thread;
+
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition that is broadcasted when the position or a buffer state changes
+	 */
+	libcthreads_condition_t *condition;
+};
+
+int libwtcdb_read_ahead_initialize(
+     libwtcdb_read_ahead_t **read_ahead,
+     libwtcdb_io_backend_t *io_backend,
+     libbfio_handle_t *file_io_handle,
+     libcdata_array_t *entries,
+     int number_of_read_ahead_items,
+     libcerror_error_t **error );
+
+int libwtcdb_read_ahead_free(
+     libwtcdb_read_ahead_t **read_ahead,
+     libcerror_error_t **error );
+
+int libwtcdb_read_ahead_read_buffer(
+     libwtcdb_read_ahead_t *read_ahead,
+     libwtcdb_read_ahead_buffer_t *buffer,
+     int item_index,
+     libcerror_error_t **error );
+
+int libwtcdb_read_ahead_thread_callback(
+     libwtcdb_read_ahead_t *read_ahead );
+
+int libwtcdb_read_ahead_set_position(
+     libwtcdb_read_ahead_t *read_ahead,
+     int item_index,
+     libcerror_error_t **error );
+
+int libwtcdb_read_ahead_copy_data(
+     libwtcdb_read_ahead_t *read_ahead,
+     int item_index,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBWTCDB_READ_AHEAD_H ) */
+
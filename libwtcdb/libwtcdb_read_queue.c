@@ -0,0 +1,1416 @@
+/*
+ * Read queue functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libwtcdb_cache_entry.h"
+#include "libwtcdb_definitions.h"
+#include "libwtcdb_io_backend.h"
+#include "libwtcdb_io_handle.h"
+#include "libwtcdb_item.h"
+#include "libwtcdb_libbfio.h"
+#include "libwtcdb_libcerror.h"
+#include "libwtcdb_libcthreads.h"
+#include "libwtcdb_read_queue.h"
+
+/* Creates a read queue
+ * Make sure the value read_queue is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_read_queue_initialize(
+     libwtcdb_read_queue_t **read_queue,
+     int queue_depth,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_read_queue_t *internal_read_queue = NULL;
+	static char *function                               = "libwtcdb_read_queue_initialize";
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	int number_of_threads                               = 0;
+#endif
+
+	if( read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_queue != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid read queue value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( queue_depth < 1 )
+	 || ( queue_depth > LIBWTCDB_MAXIMUM_READ_QUEUE_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid queue depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_read_queue = memory_allocate_structure(
+	                       libwtcdb_internal_read_queue_t );
+
+	if( internal_read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read queue.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_read_queue,
+	     0,
+	     sizeof( libwtcdb_internal_read_queue_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read queue.",
+		 function );
+
+		memory_free(
+		 internal_read_queue );
+
+		return( -1 );
+	}
+	internal_read_queue->requests = (libwtcdb_read_request_t *) memory_allocate(
+	                                                             sizeof( libwtcdb_read_request_t ) * (size_t) queue_depth );
+
+	if( internal_read_queue->requests == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create requests.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_read_queue->requests,
+	     0,
+	     sizeof( libwtcdb_read_request_t ) * (size_t) queue_depth ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear requests.",
+		 function );
+
+		goto on_error;
+	}
+	internal_read_queue->completed_request_indexes = (int *) memory_allocate(
+	                                                          sizeof( int ) * (size_t) queue_depth );
+
+	if( internal_read_queue->completed_request_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create completed request indexes.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( internal_read_queue->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( internal_read_queue->condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create condition.",
+		 function );
+
+		goto on_error;
+	}
+	internal_read_queue->batch_reads = (libwtcdb_io_backend_read_t *) memory_allocate(
+	                                    sizeof( libwtcdb_io_backend_read_t ) * (size_t) queue_depth );
+
+	if( internal_read_queue->batch_reads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create batch reads.",
+		 function );
+
+		goto on_error;
+	}
+	internal_read_queue->batch_request_indexes = (int *) memory_allocate(
+	                                              sizeof( int ) * (size_t) queue_depth );
+
+	if( internal_read_queue->batch_request_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create batch request indexes.",
+		 function );
+
+		goto on_error;
+	}
+	number_of_threads = queue_depth;
+
+	if( number_of_threads > LIBWTCDB_MAXIMUM_NUMBER_OF_READ_QUEUE_THREADS )
+	{
+		number_of_threads = LIBWTCDB_MAXIMUM_NUMBER_OF_READ_QUEUE_THREADS;
+	}
+	/* The thread pool can hold a value for every read request and the batch request
+	 */
+	if( libcthreads_thread_pool_create(
+	     &( internal_read_queue->thread_pool ),
+	     NULL,
+	     number_of_threads,
+	     queue_depth + 1,
+	     (int (*)(intptr_t *, void *)) &libwtcdb_read_queue_thread_pool_callback,
+	     (void *) internal_read_queue,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create thread pool.",
+		 function );
+
+		goto on_error;
+	}
+#endif /* defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT ) */
+
+	internal_read_queue->queue_depth = queue_depth;
+
+	*read_queue = (libwtcdb_read_queue_t *) internal_read_queue;
+
+	return( 1 );
+
+on_error:
+	if( internal_read_queue != NULL )
+	{
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+		if( internal_read_queue->batch_request_indexes != NULL )
+		{
+			memory_free(
+			 internal_read_queue->batch_request_indexes );
+		}
+		if( internal_read_queue->batch_reads != NULL )
+		{
+			memory_free(
+			 internal_read_queue->batch_reads );
+		}
+		if( internal_read_queue->condition != NULL )
+		{
+			libcthreads_condition_free(
+			 &( internal_read_queue->condition ),
+			 NULL );
+		}
+		if( internal_read_queue->mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( internal_read_queue->mutex ),
+			 NULL );
+		}
+#endif
+		if( internal_read_queue->completed_request_indexes != NULL )
+		{
+			memory_free(
+			 internal_read_queue->completed_request_indexes );
+		}
+		if( internal_read_queue->requests != NULL )
+		{
+			memory_free(
+			 internal_read_queue->requests );
+		}
+		memory_free(
+		 internal_read_queue );
+	}
+	return( -1 );
+}
+
+/* Frees a read queue
+ * Waits for the submitted read requests to complete
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_read_queue_free(
+     libwtcdb_read_queue_t **read_queue,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_read_queue_t *internal_read_queue = NULL;
+	static char *function                               = "libwtcdb_read_queue_free";
+	int result                                          = 1;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	libwtcdb_read_request_t *request                    = NULL;
+	int request_index                                   = 0;
+#endif
+
+	if( read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_queue != NULL )
+	{
+		internal_read_queue = (libwtcdb_internal_read_queue_t *) *read_queue;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+		/* The data of the submitted read requests is owned by the caller
+		 * so the read requests must have completed before returning
+		 */
+		if( libcthreads_mutex_grab(
+		     internal_read_queue->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			return( -1 );
+		}
+		/* The deferred read requests have not been read yet and are discarded
+		 */
+		for( request_index = 0;
+		     request_index < internal_read_queue->queue_depth;
+		     request_index++ )
+		{
+			request = &( internal_read_queue->requests[ request_index ] );
+
+			if( request->state == LIBWTCDB_READ_REQUEST_STATE_DEFERRED )
+			{
+				request->state = LIBWTCDB_READ_REQUEST_STATE_FREE;
+
+				internal_read_queue->number_of_requests          -= 1;
+				internal_read_queue->number_of_pending_requests  -= 1;
+				internal_read_queue->number_of_deferred_requests -= 1;
+			}
+		}
+		while( internal_read_queue->number_of_pending_requests > 0 )
+		{
+			if( libcthreads_condition_wait(
+			     internal_read_queue->condition,
+			     internal_read_queue->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to wait for condition.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+		}
+		if( libcthreads_mutex_release(
+		     internal_read_queue->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			return( -1 );
+		}
+		if( result != 1 )
+		{
+			return( -1 );
+		}
+		*read_queue = NULL;
+
+		if( libcthreads_thread_pool_join(
+		     &( internal_read_queue->thread_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_condition_free(
+		     &( internal_read_queue->condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( internal_read_queue->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_read_queue->batch_request_indexes );
+
+		memory_free(
+		 internal_read_queue->batch_reads );
+#else
+		*read_queue = NULL;
+
+#endif /* defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT ) */
+
+		memory_free(
+		 internal_read_queue->completed_request_indexes );
+
+		memory_free(
+		 internal_read_queue->requests );
+
+		memory_free(
+		 internal_read_queue );
+	}
+	return( result );
+}
+
+/* Reads the data of a read request
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_read_queue_read_request(
+     libwtcdb_read_request_t *request,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_read_queue_read_request";
+
+	if( request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid request.",
+		 function );
+
+		return( -1 );
+	}
+	/* The file IO handle is only grabbed for the duration of the read
+	 * so that a handle pool can close it while the request is pending
+	 */
+	if( libwtcdb_io_handle_grab_file_io_handle(
+	     request->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to grab file IO handle.",
+		 function );
+
+		request->read_count = -1;
+
+		return( -1 );
+	}
+	request->read_count = libwtcdb_io_backend_read_buffer_at_offset(
+	                       request->io_backend,
+	                       request->file_io_handle,
+	                       request->data,
+	                       request->data_size,
+	                       request->file_offset,
+	                       error );
+
+	if( libwtcdb_io_handle_release_file_io_handle(
+	     request->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release file IO handle.",
+		 function );
+
+		request->read_count = -1;
+
+		return( -1 );
+	}
+	if( request->read_count != (ssize_t) request->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 request->file_offset,
+		 request->file_offset );
+
+		request->read_count = -1;
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Marks a read request as completed
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_read_queue_complete_request(
+     libwtcdb_internal_read_queue_t *internal_read_queue,
+     libwtcdb_read_request_t *request,
+     libcerror_error_t **error )
+{
+	static char *function     = "libwtcdb_read_queue_complete_request";
+	int completed_entry_index = 0;
+	int result                = 1;
+
+	if( internal_read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( request < internal_read_queue->requests )
+	 || ( request >= &( internal_read_queue->requests[ internal_read_queue->queue_depth ] ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid request value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_read_queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( request->state != LIBWTCDB_READ_REQUEST_STATE_SUBMITTED )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported request state.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		completed_entry_index = ( internal_read_queue->first_completed_request_index + internal_read_queue->number_of_completed_requests )
+		                      % internal_read_queue->queue_depth;
+
+		internal_read_queue->completed_request_indexes[ completed_entry_index ] = (int) ( request - internal_read_queue->requests );
+
+		internal_read_queue->number_of_completed_requests += 1;
+		internal_read_queue->number_of_pending_requests   -= 1;
+
+		request->state = LIBWTCDB_READ_REQUEST_STATE_COMPLETED;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_condition_broadcast(
+		     internal_read_queue->condition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast condition.",
+			 function );
+
+			result = -1;
+		}
+#endif
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_read_queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+
+/* Reads the deferred read requests in batches of read requests of the same file
+ * Only the thread pool worker of the scheduled batch request reads the deferred read requests
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_read_queue_read_deferred_requests(
+     libwtcdb_internal_read_queue_t *internal_read_queue,
+     libcerror_error_t **error )
+{
+	libwtcdb_io_backend_read_t *reads = NULL;
+	libwtcdb_io_backend_t *io_backend = NULL;
+	libwtcdb_read_request_t *request  = NULL;
+	libbfio_handle_t *file_io_handle  = NULL;
+	libcerror_error_t *read_error     = NULL;
+	int *request_indexes              = NULL;
+	static char *function             = "libwtcdb_read_queue_read_deferred_requests";
+	int number_of_reads               = 0;
+	int read_index                    = 0;
+	int request_index                 = 0;
+
+	if( internal_read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	reads           = internal_read_queue->batch_reads;
+	request_indexes = internal_read_queue->batch_request_indexes;
+
+	do
+	{
+		if( libcthreads_mutex_grab(
+		     internal_read_queue->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			return( -1 );
+		}
+		io_backend      = NULL;
+		file_io_handle  = NULL;
+		number_of_reads = 0;
+
+		for( request_index = 0;
+		     request_index < internal_read_queue->queue_depth;
+		     request_index++ )
+		{
+			request = &( internal_read_queue->requests[ request_index ] );
+
+			if( request->state != LIBWTCDB_READ_REQUEST_STATE_DEFERRED )
+			{
+				continue;
+			}
+			if( number_of_reads == 0 )
+			{
+				io_backend     = request->io_backend;
+				file_io_handle = request->file_io_handle;
+			}
+			else if( ( request->io_backend != io_backend )
+			      || ( request->file_io_handle != file_io_handle ) )
+			{
+				continue;
+			}
+			request->state = LIBWTCDB_READ_REQUEST_STATE_SUBMITTED;
+
+			internal_read_queue->number_of_deferred_requests -= 1;
+
+			reads[ number_of_reads ].file_offset = request->file_offset;
+			reads[ number_of_reads ].data        = request->data;
+			reads[ number_of_reads ].data_size   = request->data_size;
+			reads[ number_of_reads ].read_count  = 0;
+
+			request_indexes[ number_of_reads ] = request_index;
+
+			number_of_reads++;
+		}
+		/* The batch request is unscheduled while the mutex is held so that
+		 * a read request deferred afterwards schedules a new batch request
+		 */
+		if( number_of_reads == 0 )
+		{
+			internal_read_queue->batch_is_scheduled = 0;
+		}
+		if( libcthreads_mutex_release(
+		     internal_read_queue->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			return( -1 );
+		}
+		if( number_of_reads == 0 )
+		{
+			break;
+		}
+		/* A read error is reported to the caller by the read count of the completed read request
+		 */
+		if( libwtcdb_io_backend_read_batch(
+		     io_backend,
+		     file_io_handle,
+		     reads,
+		     number_of_reads,
+		     &read_error ) != 1 )
+		{
+			libcerror_error_free(
+			 &read_error );
+
+			for( read_index = 0;
+			     read_index < number_of_reads;
+			     read_index++ )
+			{
+				reads[ read_index ].read_count = -1;
+			}
+		}
+		for( read_index = 0;
+		     read_index < number_of_reads;
+		     read_index++ )
+		{
+			request = &( internal_read_queue->requests[ request_indexes[ read_index ] ] );
+
+			if( reads[ read_index ].read_count != (ssize_t) reads[ read_index ].data_size )
+			{
+				request->read_count = -1;
+			}
+			else
+			{
+				request->read_count = reads[ read_index ].read_count;
+			}
+			if( libwtcdb_read_queue_complete_request(
+			     internal_read_queue,
+			     request,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to complete request: %d.",
+				 function,
+				 request_indexes[ read_index ] );
+
+				return( -1 );
+			}
+		}
+	}
+	while( number_of_reads > 0 );
+
+	return( 1 );
+}
+
+/* The thread pool callback function that reads a read request
+ * A read error is reported to the caller by the read count of the completed read request
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_read_queue_thread_pool_callback(
+     libwtcdb_read_request_t *request,
+     libwtcdb_internal_read_queue_t *internal_read_queue )
+{
+	libcerror_error_t *error = NULL;
+
+	if( ( request == NULL )
+	 || ( internal_read_queue == NULL ) )
+	{
+		return( -1 );
+	}
+	if( request == &( internal_read_queue->batch_request ) )
+	{
+		if( libwtcdb_read_queue_read_deferred_requests(
+		     internal_read_queue,
+		     &error ) != 1 )
+		{
+			libcerror_error_free(
+			 &error );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( libwtcdb_read_queue_read_request(
+	     request,
+	     &error ) != 1 )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( libwtcdb_read_queue_complete_request(
+	     internal_read_queue,
+	     request,
+	     &error ) != 1 )
+	{
+		libcerror_error_free(
+		 &error );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT ) */
+
+/* Submits a read request of the cached data of an item
+ * The data is read from the data offset relative to the start of the cached data
+ * The file of the item must remain open and the data must remain valid until
+ * the read request has been retrieved as completed
+ * Returns 1 if successful, 0 if the queue is full or -1 on error
+ */
+int libwtcdb_read_queue_submit(
+     libwtcdb_read_queue_t *read_queue,
+     libwtcdb_item_t *item,
+     off64_t data_offset,
+     uint8_t *data,
+     size_t data_size,
+     intptr_t *tag,
+     libcerror_error_t **error )
+{
+	libwtcdb_cache_entry_t *cache_entry                 = NULL;
+	libwtcdb_internal_item_t *internal_item             = NULL;
+	libwtcdb_internal_read_queue_t *internal_read_queue = NULL;
+	libwtcdb_read_request_t *request                    = NULL;
+	static char *function                               = "libwtcdb_read_queue_submit";
+	int request_index                                   = 0;
+	int result                                          = 0;
+
+#if !defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	libcerror_error_t *read_error                       = NULL;
+#endif
+
+	if( read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	internal_read_queue = (libwtcdb_internal_read_queue_t *) read_queue;
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libwtcdb_internal_item_t *) item;
+
+	if( internal_item->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* Only cache file entries contain cached data
+	 */
+	if( internal_item->io_handle->file_type != LIBWTCDB_FILE_TYPE_CACHE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported item - missing cached data.",
+		 function );
+
+		return( -1 );
+	}
+	cache_entry = (libwtcdb_cache_entry_t *) internal_item->entry;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_offset < 0 )
+	 || ( data_offset > (off64_t) cache_entry->cached_data_size )
+	 || ( data_size > (size_t) ( cache_entry->cached_data_size - (uint32_t) data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset and size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_read_queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_read_queue->number_of_requests < internal_read_queue->queue_depth )
+	{
+		for( request_index = 0;
+		     request_index < internal_read_queue->queue_depth;
+		     request_index++ )
+		{
+			request = &( internal_read_queue->requests[ request_index ] );
+
+			if( request->state == LIBWTCDB_READ_REQUEST_STATE_FREE )
+			{
+				break;
+			}
+		}
+		request->io_handle      = internal_item->io_handle;
+		request->file_io_handle = internal_item->file_io_handle;
+		request->io_backend     = internal_item->io_handle->io_backend;
+		request->file_offset    = cache_entry->cached_data_offset + data_offset;
+		request->data           = data;
+		request->data_size      = data_size;
+		request->tag            = tag;
+		request->read_count     = 0;
+		request->state          = LIBWTCDB_READ_REQUEST_STATE_SUBMITTED;
+
+		internal_read_queue->number_of_requests         += 1;
+		internal_read_queue->number_of_pending_requests += 1;
+
+		result = 1;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+		/* Read requests of a file with an IO backend are read in a single batch
+		 * by the thread pool worker of the batch request
+		 */
+		if( request->io_backend != NULL )
+		{
+			request->state = LIBWTCDB_READ_REQUEST_STATE_DEFERRED;
+
+			internal_read_queue->number_of_deferred_requests += 1;
+
+			/* The batch request is pushed while the mutex is held so that
+			 * a failed push does not leave other deferred read requests unread
+			 */
+			if( internal_read_queue->batch_is_scheduled == 0 )
+			{
+				if( libcthreads_thread_pool_push(
+				     internal_read_queue->thread_pool,
+				     (intptr_t *) &( internal_read_queue->batch_request ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to push batch request onto thread pool.",
+					 function );
+
+					request->state = LIBWTCDB_READ_REQUEST_STATE_FREE;
+
+					internal_read_queue->number_of_requests          -= 1;
+					internal_read_queue->number_of_pending_requests  -= 1;
+					internal_read_queue->number_of_deferred_requests -= 1;
+
+					result = -1;
+				}
+				else
+				{
+					internal_read_queue->batch_is_scheduled = 1;
+				}
+			}
+		}
+#endif /* defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT ) */
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_read_queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result != 1 )
+	{
+		return( result );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( request->io_backend != NULL )
+	{
+		return( 1 );
+	}
+	/* The thread pool can hold a value for every read request and the batch request,
+	 * hence pushing a read request does not block
+	 */
+	if( libcthreads_thread_pool_push(
+	     internal_read_queue->thread_pool,
+	     (intptr_t *) request,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to push request onto thread pool.",
+		 function );
+
+		goto on_error;
+	}
+#else
+	/* Without multi-thread support the read request is completed immediately
+	 */
+	if( libwtcdb_read_queue_read_request(
+	     request,
+	     &read_error ) != 1 )
+	{
+		libcerror_error_free(
+		 &read_error );
+	}
+	if( libwtcdb_read_queue_complete_request(
+	     internal_read_queue,
+	     request,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to complete request.",
+		 function );
+
+		goto on_error;
+	}
+#endif /* defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT ) */
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_read_queue->mutex,
+	     NULL ) == 1 )
+	{
+		request->state = LIBWTCDB_READ_REQUEST_STATE_FREE;
+
+		internal_read_queue->number_of_requests         -= 1;
+		internal_read_queue->number_of_pending_requests -= 1;
+
+		libcthreads_mutex_release(
+		 internal_read_queue->mutex,
+		 NULL );
+	}
+#else
+	request->state = LIBWTCDB_READ_REQUEST_STATE_FREE;
+
+	internal_read_queue->number_of_requests         -= 1;
+	internal_read_queue->number_of_pending_requests -= 1;
+
+#endif /* defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT ) */
+
+	return( -1 );
+}
+
+/* Retrieves the number of read requests that are submitted and not yet retrieved as completed
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_read_queue_get_number_of_requests(
+     libwtcdb_read_queue_t *read_queue,
+     int *number_of_requests,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_read_queue_t *internal_read_queue = NULL;
+	static char *function                               = "libwtcdb_read_queue_get_number_of_requests";
+
+	if( read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	internal_read_queue = (libwtcdb_internal_read_queue_t *) read_queue;
+
+	if( number_of_requests == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of requests.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_read_queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_requests = internal_read_queue->number_of_requests;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_read_queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the first completed read request
+ * If wait is set waits until a submitted read request completes
+ * The read count is -1 if the data could not be read
+ * Returns 1 if successful, 0 if no completed read request is available or -1 on error
+ */
+int libwtcdb_internal_read_queue_get_completion(
+     libwtcdb_internal_read_queue_t *internal_read_queue,
+     intptr_t **tag,
+     ssize_t *read_count,
+     int wait,
+     libcerror_error_t **error )
+{
+	libwtcdb_read_request_t *request = NULL;
+	static char *function            = "libwtcdb_internal_read_queue_get_completion";
+	int request_index                = 0;
+	int result                       = 0;
+
+	if( internal_read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_count == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read count.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_read_queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( wait != 0 )
+	    && ( internal_read_queue->number_of_completed_requests == 0 )
+	    && ( internal_read_queue->number_of_pending_requests > 0 ) )
+	{
+		if( libcthreads_condition_wait(
+		     internal_read_queue->condition,
+		     internal_read_queue->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for condition.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+	}
+#endif /* defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT ) */
+
+	if( ( result == 0 )
+	 && ( internal_read_queue->number_of_completed_requests > 0 ) )
+	{
+		request_index = internal_read_queue->completed_request_indexes[ internal_read_queue->first_completed_request_index ];
+
+		internal_read_queue->first_completed_request_index = ( internal_read_queue->first_completed_request_index + 1 )
+		                                                   % internal_read_queue->queue_depth;
+
+		internal_read_queue->number_of_completed_requests -= 1;
+		internal_read_queue->number_of_requests           -= 1;
+
+		request = &( internal_read_queue->requests[ request_index ] );
+
+		*tag        = request->tag;
+		*read_count = request->read_count;
+
+		request->state = LIBWTCDB_READ_REQUEST_STATE_FREE;
+
+		result = 1;
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_read_queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the first completed read request without waiting
+ * The read count is -1 if the data could not be read
+ * Returns 1 if successful, 0 if no completed read request is available or -1 on error
+ */
+int libwtcdb_read_queue_get_completion(
+     libwtcdb_read_queue_t *read_queue,
+     intptr_t **tag,
+     ssize_t *read_count,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_read_queue_get_completion";
+	int result            = 0;
+
+	result = libwtcdb_internal_read_queue_get_completion(
+	          (libwtcdb_internal_read_queue_t *) read_queue,
+	          tag,
+	          read_count,
+	          0,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve completion.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the first completed read request
+ * Waits until a submitted read request completes
+ * The read count is -1 if the data could not be read
+ * Returns 1 if successful, 0 if no read requests were submitted or -1 on error
+ */
+int libwtcdb_read_queue_wait_for_completion(
+     libwtcdb_read_queue_t *read_queue,
+     intptr_t **tag,
+     ssize_t *read_count,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_read_queue_wait_for_completion";
+	int result            = 0;
+
+	result = libwtcdb_internal_read_queue_get_completion(
+	          (libwtcdb_internal_read_queue_t *) read_queue,
+	          tag,
+	          read_count,
+	          1,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve completion.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
@@ -0,0 +1,236 @@
+/*
+ * Read queue functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBWTCDB_READ_QUEUE_H )
+#define _LIBWTCDB_READ_QUEUE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libwtcdb_extern.h"
+#include "libwtcdb_io_backend.h"
+#include "libwtcdb_io_handle.h"
+#include "libwtcdb_libbfio.h"
+#include "libwtcdb_libcerror.h"
+#include "libwtcdb_libcthreads.h"
+#include "libwtcdb_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+enum LIBWTCDB_READ_REQUEST_STATES
+{
+	LIBWTCDB_READ_REQUEST_STATE_FREE	= 0,
+	LIBWTCDB_READ_REQUEST_STATE_SUBMITTED	= 1,
+	LIBWTCDB_READ_REQUEST_STATE_COMPLETED	= 2,
+	LIBWTCDB_READ_REQUEST_STATE_DEFERRED	= 3
+};
+
+typedef struct libwtcdb_read_request libwtcdb_read_request_t;
+
+/* The read request contains a read of cached data submitted to a read queue
+ */
+struct libwtcdb_read_request
+{
+	/* The IO handle
+	 */
+	libwtcdb_io_handle_t *io_handle;
+
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The IO backend used to read the data in a batch or NULL if not available
+	 */
+	libwtcdb_io_backend_t *io_backend;
+
+	/* The offset of the data in the file
+	 */
+	off64_t file_offset;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The tag
+	 */
+	intptr_t *tag;
+
+	/* The number of bytes read or -1 on error
+	 */
+	ssize_t read_count;
+
+	/* The state
+	 */
+	int state;
+};
+
+typedef struct libwtcdb_internal_read_queue libwtcdb_internal_read_queue_t;
+
+/* The read queue reads the submitted read requests in the background
+ * and keeps the completed read requests until they are retrieved
+ */
+struct libwtcdb_internal_read_queue
+{
+	/* The queue depth
+	 */
+	int queue_depth;
+
+	/* The read requests
+	 */
+	libwtcdb_read_request_t *requests;
+
+	/* The number of read requests that are submitted and not yet retrieved
+	 */
+	int number_of_requests;
+
+	/* The number of read requests that are submitted and not yet completed
+	 */
+	int number_of_pending_requests;
+
+	/* The number of read requests that are waiting to be read in a batch
+	 */
+	int number_of_deferred_requests;
+
+	/* The indexes of the completed read requests in order of completion
+	 */
+	int *completed_request_indexes;
+
+	/* The index of the first completed read request index
+	 */
+	int first_completed_request_index;
+
+	/* The number of completed read requests
+	 */
+	int number_of_completed_requests;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	/* The thread pool
+	 */
+	libcthreads_thread_pool_t *thread_pool;
+
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition that is broadcasted when a read request completes
+	 */
+	libcthreads_condition_t *condition;
+
+	/* The batch request that is pushed onto the thread pool to read the deferred read requests
+	 */
+	libwtcdb_read_request_t batch_request;
+
+	/* Value to indicate the batch request was pushed onto the thread pool
+	 * and the deferred read requests are being read
+	 */
+	uint8_t batch_is_scheduled;
+
+	/* The reads of the batch
+	 */
+	libwtcdb_io_backend_read_t *batch_reads;
+
+	/* The indexes of the read requests of the batch
+	 */
+	int *batch_request_indexes;
+#endif
+};
+
+LIBWTCDB_EXTERN \
+int libwtcdb_read_queue_initialize(
+     libwtcdb_read_queue_t **read_queue,
+     int queue_depth,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_read_queue_free(
+     libwtcdb_read_queue_t **read_queue,
+     libcerror_error_t **error );
+
+int libwtcdb_read_queue_read_request(
+     libwtcdb_read_request_t *request,
+     libcerror_error_t **error );
+
+int libwtcdb_read_queue_complete_request(
+     libwtcdb_internal_read_queue_t *internal_read_queue,
+     libwtcdb_read_request_t *request,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+
+int libwtcdb_read_queue_read_deferred_requests(
+     libwtcdb_internal_read_queue_t *internal_read_queue,
+     libcerror_error_t **error );
+
+int libwtcdb_read_queue_thread_pool_callback(
+     libwtcdb_read_request_t *request,
+     libwtcdb_internal_read_queue_t *internal_read_queue );
+
+#endif /* defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT ) */
+
+LIBWTCDB_EXTERN \
+int libwtcdb_read_queue_submit(
+     libwtcdb_read_queue_t *read_queue,
+     libwtcdb_item_t *item,
+     off64_t data_offset,
+     uint8_t *data,
+     size_t data_size,
+     intptr_t *tag,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_read_queue_get_number_of_requests(
+     libwtcdb_read_queue_t *read_queue,
+     int *number_of_requests,
+     libcerror_error_t **error );
+
+int libwtcdb_internal_read_queue_get_completion(
+     libwtcdb_internal_read_queue_t *internal_read_queue,
+     intptr_t **tag,
+     ssize_t *read_count,
+     int wait,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_read_queue_get_completion(
+     libwtcdb_read_queue_t *read_queue,
+     intptr_t **tag,
+     ssize_t *read_count,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_read_queue_wait_for_completion(
+     libwtcdb_read_queue_t *read_queue,
+     intptr_t **tag,
+     ssize_t *read_count,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBWTCDB_READ_QUEUE_H ) */
+
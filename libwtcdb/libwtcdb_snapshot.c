@@ -0,0 +1,739 @@
+/*
+ * Snapshot functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libwtcdb_definitions.h"
+#include "libwtcdb_hash_column.h"
+#include "libwtcdb_libcdata.h"
+#include "libwtcdb_libcerror.h"
+#include "libwtcdb_libcthreads.h"
+#include "libwtcdb_snapshot.h"
+#include "libwtcdb_time_column.h"
+
+/* Creates a snapshot
+ * Make sure the value snapshot is referencing, is set to NULL
+ * The snapshot is created with a single reference
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_snapshot_initialize(
+     libwtcdb_internal_snapshot_t **snapshot,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_snapshot_t *internal_snapshot = NULL;
+	static char *function                           = "libwtcdb_snapshot_initialize";
+
+	if( snapshot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid snapshot.",
+		 function );
+
+		return( -1 );
+	}
+	if( *snapshot != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid snapshot value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_snapshot = memory_allocate_structure(
+	                     libwtcdb_internal_snapshot_t );
+
+	if( internal_snapshot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create snapshot.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_snapshot,
+	     0,
+	     sizeof( libwtcdb_internal_snapshot_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear snapshot.",
+		 function );
+
+		memory_free(
+		 internal_snapshot );
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &( internal_snapshot->entries ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create entries array.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_snapshot->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_snapshot->number_of_references = 1;
+
+	*snapshot = internal_snapshot;
+
+	return( 1 );
+
+on_error:
+	if( internal_snapshot != NULL )
+	{
+		if( internal_snapshot->entries != NULL )
+		{
+			libcdata_array_free(
+			 &( internal_snapshot->entries ),
+			 NULL,
+			 NULL );
+		}
+		memory_free(
+		 internal_snapshot );
+	}
+	return( -1 );
+}
+
+/* Frees a snapshot
+ * Releases the reference to the snapshot, the snapshot is freed when the last reference is released
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_snapshot_free(
+     libwtcdb_snapshot_t **snapshot,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_snapshot_t *internal_snapshot = NULL;
+	static char *function                           = "libwtcdb_snapshot_free";
+	int number_of_references                        = 0;
+	int result                                      = 1;
+
+	if( snapshot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid snapshot.",
+		 function );
+
+		return( -1 );
+	}
+	if( *snapshot != NULL )
+	{
+		internal_snapshot = (libwtcdb_internal_snapshot_t *) *snapshot;
+		*snapshot         = NULL;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_grab_for_write(
+		     internal_snapshot->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		internal_snapshot->number_of_references -= 1;
+
+		number_of_references = internal_snapshot->number_of_references;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_write(
+		     internal_snapshot->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		if( number_of_references > 0 )
+		{
+			return( 1 );
+		}
+		if( internal_snapshot->hash_column != NULL )
+		{
+			if( libwtcdb_hash_column_free(
+			     &( internal_snapshot->hash_column ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free hash column.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_snapshot->time_column != NULL )
+		{
+			if( libwtcdb_time_column_free(
+			     &( internal_snapshot->time_column ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free time column.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libcdata_array_free(
+		     &( internal_snapshot->entries ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) internal_snapshot->entry_free_function,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free entries array.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_snapshot->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 internal_snapshot );
+	}
+	return( result );
+}
+
+/* Adds a reference to the snapshot
+ * Every reference must be released with libwtcdb_snapshot_free
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_snapshot_add_reference(
+     libwtcdb_internal_snapshot_t *snapshot,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_snapshot_add_reference";
+	int result            = 1;
+
+	if( snapshot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid snapshot.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     snapshot->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( snapshot->number_of_references <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid snapshot - number of references value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else if( snapshot->number_of_references == (int) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid snapshot - number of references value exceeds maximum.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		snapshot->number_of_references += 1;
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     snapshot->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the file type
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_snapshot_get_type(
+     libwtcdb_snapshot_t *snapshot,
+     uint8_t *type,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_snapshot_t *internal_snapshot = NULL;
+	static char *function                           = "libwtcdb_snapshot_get_type";
+
+	if( snapshot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid snapshot.",
+		 function );
+
+		return( -1 );
+	}
+	internal_snapshot = (libwtcdb_internal_snapshot_t *) snapshot;
+
+	if( type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid type.",
+		 function );
+
+		return( -1 );
+	}
+	*type = internal_snapshot->file_type;
+
+	return( 1 );
+}
+
+/* Retrieves the number of items
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_snapshot_get_number_of_items(
+     libwtcdb_snapshot_t *snapshot,
+     int *number_of_items,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_snapshot_t *internal_snapshot = NULL;
+	static char *function                           = "libwtcdb_snapshot_get_number_of_items";
+
+	if( snapshot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid snapshot.",
+		 function );
+
+		return( -1 );
+	}
+	internal_snapshot = (libwtcdb_internal_snapshot_t *) snapshot;
+
+	if( libcdata_array_get_number_of_entries(
+	     internal_snapshot->entries,
+	     number_of_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from array.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the hash column
+ * The hash column is created and sorted on first use and shared by all references
+ * of the snapshot. It remains owned by the snapshot
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_snapshot_get_hash_column(
+     libwtcdb_internal_snapshot_t *snapshot,
+     libwtcdb_hash_column_t **hash_column,
+     libcerror_error_t **error )
+{
+	libwtcdb_hash_column_t *safe_hash_column = NULL;
+	static char *function                    = "libwtcdb_snapshot_get_hash_column";
+	int number_of_entries                    = 0;
+	int result                               = 1;
+
+	if( snapshot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid snapshot.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash column.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     snapshot->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( snapshot->hash_column == NULL )
+	{
+		if( libcdata_array_get_number_of_entries(
+		     snapshot->entries,
+		     &number_of_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of entries from array.",
+			 function );
+
+			result = -1;
+		}
+		else if( libwtcdb_hash_column_initialize(
+		          &safe_hash_column,
+		          number_of_entries,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create hash column.",
+			 function );
+
+			result = -1;
+		}
+		else if( libwtcdb_hash_column_read_entries(
+		          safe_hash_column,
+		          snapshot->entries,
+		          snapshot->file_type,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read hash column.",
+			 function );
+
+			result = -1;
+		}
+		else if( libwtcdb_hash_column_sort(
+		          safe_hash_column,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to sort hash column.",
+			 function );
+
+			result = -1;
+		}
+		if( result == 1 )
+		{
+			snapshot->hash_column = safe_hash_column;
+		}
+		else if( safe_hash_column != NULL )
+		{
+			libwtcdb_hash_column_free(
+			 &safe_hash_column,
+			 NULL );
+		}
+	}
+	*hash_column = snapshot->hash_column;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     snapshot->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the time column
+ * The time column is created and sorted on first use and shared by all references
+ * of the snapshot. It remains owned by the snapshot
+ * The time column is only available for index files
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_snapshot_get_time_column(
+     libwtcdb_internal_snapshot_t *snapshot,
+     libwtcdb_time_column_t **time_column,
+     libcerror_error_t **error )
+{
+	libwtcdb_time_column_t *safe_time_column = NULL;
+	static char *function                    = "libwtcdb_snapshot_get_time_column";
+	int number_of_entries                    = 0;
+	int result                               = 1;
+
+	if( snapshot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid snapshot.",
+		 function );
+
+		return( -1 );
+	}
+	if( time_column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid time column.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( snapshot->file_type != LIBWTCDB_FILE_TYPE_INDEX_V20 )
+	 && ( snapshot->file_type != LIBWTCDB_FILE_TYPE_INDEX_V30 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid snapshot - unsupported file type.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     snapshot->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( snapshot->time_column == NULL )
+	{
+		if( libcdata_array_get_number_of_entries(
+		     snapshot->entries,
+		     &number_of_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of entries from array.",
+			 function );
+
+			result = -1;
+		}
+		else if( libwtcdb_time_column_initialize(
+		          &safe_time_column,
+		          number_of_entries,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create time column.",
+			 function );
+
+			result = -1;
+		}
+		else if( libwtcdb_time_column_read_entries(
+		          safe_time_column,
+		          snapshot->entries,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read time column.",
+			 function );
+
+			result = -1;
+		}
+		else if( libwtcdb_time_column_sort(
+		          safe_time_column,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to sort time column.",
+			 function );
+
+			result = -1;
+		}
+		if( result == 1 )
+		{
+			snapshot->time_column = safe_time_column;
+		}
+		else if( safe_time_column != NULL )
+		{
+			libwtcdb_time_column_free(
+			 &safe_time_column,
+			 NULL );
+		}
+	}
+	*time_column = snapshot->time_column;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     snapshot->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
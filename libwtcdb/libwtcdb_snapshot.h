@@ -0,0 +1,129 @@
+/*
+ * Snapshot functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBWTCDB_SNAPSHOT_H )
+#define _LIBWTCDB_SNAPSHOT_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libwtcdb_extern.h"
+#include "libwtcdb_hash_column.h"
+#include "libwtcdb_libcdata.h"
+#include "libwtcdb_libcerror.h"
+#include "libwtcdb_libcthreads.h"
+#include "libwtcdb_time_column.h"
+#include "libwtcdb_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libwtcdb_internal_snapshot libwtcdb_internal_snapshot_t;
+
+/* The snapshot contains the entries parsed from a file
+ * The snapshot is not modified after it has been read and can be shared
+ * between multiple files, the last reference frees it
+ */
+struct libwtcdb_internal_snapshot
+{
+	/* The file type
+	 */
+	uint8_t file_type;
+
+	/* The format version
+	 */
+	uint32_t format_version;
+
+	/* The file size
+	 */
+	size64_t file_size;
+
+	/* The entries array
+	 */
+	libcdata_array_t *entries;
+
+	/* The entry free function
+	 */
+	intptr_t *entry_free_function;
+
+	/* The hash column
+	 * Created on demand and sorted by hash
+	 */
+	libwtcdb_hash_column_t *hash_column;
+
+	/* The time column
+	 * Created on demand for index files and sorted by modification time
+	 */
+	libwtcdb_time_column_t *time_column;
+
+	/* The number of references
+	 */
+	int number_of_references;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+int libwtcdb_snapshot_initialize(
+     libwtcdb_internal_snapshot_t **snapshot,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_snapshot_free(
+     libwtcdb_snapshot_t **snapshot,
+     libcerror_error_t **error );
+
+int libwtcdb_snapshot_add_reference(
+     libwtcdb_internal_snapshot_t *snapshot,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_snapshot_get_type(
+     libwtcdb_snapshot_t *snapshot,
+     uint8_t *type,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_snapshot_get_number_of_items(
+     libwtcdb_snapshot_t *snapshot,
+     int *number_of_items,
+     libcerror_error_t **error );
+
+int libwtcdb_snapshot_get_hash_column(
+     libwtcdb_internal_snapshot_t *snapshot,
+     libwtcdb_hash_column_t **hash_column,
+     libcerror_error_t **error );
+
+int libwtcdb_snapshot_get_time_column(
+     libwtcdb_internal_snapshot_t *snapshot,
+     libwtcdb_time_column_t **time_column,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBWTCDB_SNAPSHOT_H ) */
+
@@ -0,0 +1,341 @@
+/*
+ * Time column functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libwtcdb_index_entry.h"
+#include "libwtcdb_libcdata.h"
+#include "libwtcdb_libcerror.h"
+#include "libwtcdb_radix_sort.h"
+#include "libwtcdb_time_column.h"
+
+/* Creates a time column
+ * Make sure the value time_column is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_time_column_initialize(
+     libwtcdb_time_column_t **time_column,
+     int number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_time_column_initialize";
+
+	if( time_column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid time column.",
+		 function );
+
+		return( -1 );
+	}
+	if( *time_column != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid time column value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_entries < 0 )
+	 || ( (size_t) number_of_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint64_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*time_column = memory_allocate_structure(
+	                libwtcdb_time_column_t );
+
+	if( *time_column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create time column.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *time_column,
+	     0,
+	     sizeof( libwtcdb_time_column_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear time column.",
+		 function );
+
+		memory_free(
+		 *time_column );
+
+		*time_column = NULL;
+
+		return( -1 );
+	}
+	if( number_of_entries > 0 )
+	{
+		( *time_column )->times = (uint64_t *) memory_allocate(
+		                                        sizeof( uint64_t ) * (size_t) number_of_entries );
+
+		if( ( *time_column )->times == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create times.",
+			 function );
+
+			goto on_error;
+		}
+		( *time_column )->entry_indexes = (int *) memory_allocate(
+		                                           sizeof( int ) * (size_t) number_of_entries );
+
+		if( ( *time_column )->entry_indexes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create entry indexes.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	( *time_column )->number_of_entries           = number_of_entries;
+	( *time_column )->number_of_allocated_entries = number_of_entries;
+
+	return( 1 );
+
+on_error:
+	if( *time_column != NULL )
+	{
+		if( ( *time_column )->times != NULL )
+		{
+			memory_free(
+			 ( *time_column )->times );
+		}
+		memory_free(
+		 *time_column );
+
+		*time_column = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a time column
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_time_column_free(
+     libwtcdb_time_column_t **time_column,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_time_column_free";
+
+	if( time_column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid time column.",
+		 function );
+
+		return( -1 );
+	}
+	if( *time_column != NULL )
+	{
+		if( ( *time_column )->entry_indexes != NULL )
+		{
+			memory_free(
+			 ( *time_column )->entry_indexes );
+		}
+		if( ( *time_column )->times != NULL )
+		{
+			memory_free(
+			 ( *time_column )->times );
+		}
+		memory_free(
+		 *time_column );
+
+		*time_column = NULL;
+	}
+	return( 1 );
+}
+
+/* Reads the modification times of the index entries into the time column in entry order
+ * Index entries without a modification time are skipped, the number of entries
+ * of the time column is set to the number of entries read
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_time_column_read_entries(
+     libwtcdb_time_column_t *time_column,
+     libcdata_array_t *entries_array,
+     libcerror_error_t **error )
+{
+	libwtcdb_index_entry_t *index_entry = NULL;
+	static char *function               = "libwtcdb_time_column_read_entries";
+	int column_index                    = 0;
+	int entry_index                     = 0;
+	int number_of_entries               = 0;
+
+	if( time_column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid time column.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     entries_array,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries != time_column->number_of_allocated_entries )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     entries_array,
+		     entry_index,
+		     (intptr_t **) &index_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( index_entry == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		/* Only format version 20 index entries contain a modification time
+		 */
+		if( index_entry->modification_time == 0 )
+		{
+			continue;
+		}
+		time_column->times[ column_index ]         = index_entry->modification_time;
+		time_column->entry_indexes[ column_index ] = entry_index;
+
+		column_index++;
+	}
+	time_column->number_of_entries = column_index;
+
+	return( 1 );
+}
+
+/* Sorts the time column by modification time
+ * The sort is stable so that entries with the same modification time remain in entry order
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_time_column_sort(
+     libwtcdb_time_column_t *time_column,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_time_column_sort";
+
+	if( time_column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid time column.",
+		 function );
+
+		return( -1 );
+	}
+	if( libwtcdb_radix_sort_keys(
+	     &( time_column->times ),
+	     &( time_column->entry_indexes ),
+	     time_column->number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to sort modification times.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,84 @@
+/*
+ * Time column functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBWTCDB_TIME_COLUMN_H )
+#define _LIBWTCDB_TIME_COLUMN_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libwtcdb_libcdata.h"
+#include "libwtcdb_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libwtcdb_time_column libwtcdb_time_column_t;
+
+/* The time column contains the modification times of the entries of a single
+ * index file stored as a column, sorted by time with the corresponding entry indexes
+ * Entries without a modification time are not part of the time column
+ */
+struct libwtcdb_time_column
+{
+	/* The modification times
+	 */
+	uint64_t *times;
+
+	/* The entry indexes
+	 */
+	int *entry_indexes;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of allocated entries
+	 */
+	int number_of_allocated_entries;
+};
+
+int libwtcdb_time_column_initialize(
+     libwtcdb_time_column_t **time_column,
+     int number_of_entries,
+     libcerror_error_t **error );
+
+int libwtcdb_time_column_free(
+     libwtcdb_time_column_t **time_column,
+     libcerror_error_t **error );
+
+int libwtcdb_time_column_read_entries(
+     libwtcdb_time_column_t *time_column,
+     libcdata_array_t *entries_array,
+     libcerror_error_t **error );
+
+int libwtcdb_time_column_sort(
+     libwtcdb_time_column_t *time_column,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBWTCDB_TIME_COLUMN_H ) */
+
@@ -0,0 +1,1195 @@
+/*
+ * Timeline functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libwtcdb_cache_set.h"
+#include "libwtcdb_definitions.h"
+#include "libwtcdb_file.h"
+#include "libwtcdb_index_entry.h"
+#include "libwtcdb_item.h"
+#include "libwtcdb_libcdata.h"
+#include "libwtcdb_libcerror.h"
+#include "libwtcdb_libcthreads.h"
+#include "libwtcdb_merge_heap.h"
+#include "libwtcdb_snapshot.h"
+#include "libwtcdb_time_column.h"
+#include "libwtcdb_timeline.h"
+
+/* Creates a timeline
+ * Make sure the value timeline is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_timeline_initialize(
+     libwtcdb_timeline_t **timeline,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_timeline_t *internal_timeline = NULL;
+	static char *function                           = "libwtcdb_timeline_initialize";
+
+	if( timeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( *timeline != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid timeline value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_timeline = memory_allocate_structure(
+	                     libwtcdb_internal_timeline_t );
+
+	if( internal_timeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create timeline.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_timeline,
+	     0,
+	     sizeof( libwtcdb_internal_timeline_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear timeline.",
+		 function );
+
+		memory_free(
+		 internal_timeline );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( internal_timeline->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	*timeline = (libwtcdb_timeline_t *) internal_timeline;
+
+	return( 1 );
+
+on_error:
+	if( internal_timeline != NULL )
+	{
+		memory_free(
+		 internal_timeline );
+	}
+	return( -1 );
+}
+
+/* Frees a timeline
+ * Releases the references to the snapshots of the files, the files are not freed
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_timeline_free(
+     libwtcdb_timeline_t **timeline,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_timeline_t *internal_timeline = NULL;
+	static char *function                           = "libwtcdb_timeline_free";
+	int input_index                                 = 0;
+	int result                                      = 1;
+
+	if( timeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( *timeline != NULL )
+	{
+		internal_timeline = (libwtcdb_internal_timeline_t *) *timeline;
+		*timeline         = NULL;
+
+		for( input_index = 0;
+		     input_index < internal_timeline->number_of_inputs;
+		     input_index++ )
+		{
+			if( libwtcdb_snapshot_free(
+			     (libwtcdb_snapshot_t **) &( internal_timeline->inputs[ input_index ].snapshot ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free snapshot of input: %d.",
+				 function,
+				 input_index );
+
+				result = -1;
+			}
+		}
+		if( internal_timeline->heap != NULL )
+		{
+			memory_free(
+			 internal_timeline->heap );
+		}
+		if( internal_timeline->inputs != NULL )
+		{
+			memory_free(
+			 internal_timeline->inputs );
+		}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( internal_timeline->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 internal_timeline );
+	}
+	return( result );
+}
+
+/* Appends an input to the timeline
+ * Takes over the reference to the snapshot when successful
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_internal_timeline_append_input(
+     libwtcdb_internal_timeline_t *internal_timeline,
+     libwtcdb_file_t *file,
+     libwtcdb_cache_set_t *cache_set,
+     libwtcdb_internal_snapshot_t *snapshot,
+     libcerror_error_t **error )
+{
+	libwtcdb_time_column_t *time_column = NULL;
+	libwtcdb_timeline_input_t *inputs   = NULL;
+	static char *function               = "libwtcdb_internal_timeline_append_input";
+	size_t inputs_size                  = 0;
+	int number_of_allocated_inputs      = 0;
+
+	if( internal_timeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_timeline->is_started != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid timeline - iteration already started.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_timeline->number_of_inputs == (int) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid timeline - number of inputs value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* The time column is the sorted run of the index file, it is sorted once per snapshot
+	 * and shared by the files that use it
+	 */
+	if( libwtcdb_snapshot_get_time_column(
+	     snapshot,
+	     &time_column,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve time column from snapshot.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_timeline->number_of_inputs >= internal_timeline->number_of_allocated_inputs )
+	{
+		if( internal_timeline->number_of_allocated_inputs == 0 )
+		{
+			number_of_allocated_inputs = 16;
+		}
+		else if( internal_timeline->number_of_allocated_inputs <= ( (int) INT_MAX / 2 ) )
+		{
+			number_of_allocated_inputs = internal_timeline->number_of_allocated_inputs * 2;
+		}
+		else
+		{
+			number_of_allocated_inputs = (int) INT_MAX;
+		}
+		inputs_size = sizeof( libwtcdb_timeline_input_t ) * (size_t) number_of_allocated_inputs;
+
+		if( inputs_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid inputs size value exceeds maximum allocation size.",
+			 function );
+
+			return( -1 );
+		}
+		inputs = (libwtcdb_timeline_input_t *) memory_reallocate(
+		                                        internal_timeline->inputs,
+		                                        inputs_size );
+
+		if( inputs == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize inputs.",
+			 function );
+
+			return( -1 );
+		}
+		internal_timeline->inputs                     = inputs;
+		internal_timeline->number_of_allocated_inputs = number_of_allocated_inputs;
+	}
+	inputs = &( internal_timeline->inputs[ internal_timeline->number_of_inputs ] );
+
+	inputs->file        = file;
+	inputs->cache_set   = cache_set;
+	inputs->snapshot    = snapshot;
+	inputs->time_column = time_column;
+	inputs->position    = 0;
+	inputs->input_index = internal_timeline->number_of_inputs;
+
+	internal_timeline->number_of_inputs += 1;
+
+	return( 1 );
+}
+
+/* Appends an index file to the timeline
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_internal_timeline_append_file(
+     libwtcdb_internal_timeline_t *internal_timeline,
+     libwtcdb_file_t *file,
+     libwtcdb_cache_set_t *cache_set,
+     libcerror_error_t **error )
+{
+	libwtcdb_snapshot_t *snapshot = NULL;
+	static char *function         = "libwtcdb_internal_timeline_append_file";
+	uint8_t file_type             = 0;
+	int result                    = 0;
+
+	if( internal_timeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline.",
+		 function );
+
+		return( -1 );
+	}
+	result = libwtcdb_file_get_snapshot(
+	          file,
+	          &snapshot,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve snapshot from file.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - file is not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( libwtcdb_snapshot_get_type(
+	     snapshot,
+	     &file_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve type of file.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( file_type != LIBWTCDB_FILE_TYPE_INDEX_V20 )
+	 && ( file_type != LIBWTCDB_FILE_TYPE_INDEX_V30 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid file - unsupported file type.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_timeline->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	result = libwtcdb_internal_timeline_append_input(
+	          internal_timeline,
+	          file,
+	          cache_set,
+	          (libwtcdb_internal_snapshot_t *) snapshot,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append input.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		snapshot = NULL;
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_timeline->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( snapshot != NULL )
+	{
+		libwtcdb_snapshot_free(
+		 &snapshot,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Appends an index file to the timeline
+ * The file must be open and must remain open while the entries are retrieved
+ * The cache items of the entries of the file are not resolved
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_timeline_append_file(
+     libwtcdb_timeline_t *timeline,
+     libwtcdb_file_t *file,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_timeline_append_file";
+
+	if( timeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( libwtcdb_internal_timeline_append_file(
+	     (libwtcdb_internal_timeline_t *) timeline,
+	     file,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends the index files of a cache set to the timeline
+ * The cache items of the entries are resolved using the cache files of the cache set
+ * The cache set must remain open while the entries are retrieved
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_timeline_append_cache_set(
+     libwtcdb_timeline_t *timeline,
+     libwtcdb_cache_set_t *cache_set,
+     libcerror_error_t **error )
+{
+	libwtcdb_file_t *file = NULL;
+	static char *function = "libwtcdb_timeline_append_cache_set";
+	uint8_t file_type     = 0;
+	int file_index        = 0;
+	int number_of_files   = 0;
+
+	if( timeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( libwtcdb_cache_set_get_number_of_files(
+	     cache_set,
+	     &number_of_files,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of files.",
+		 function );
+
+		return( -1 );
+	}
+	for( file_index = 0;
+	     file_index < number_of_files;
+	     file_index++ )
+	{
+		if( libwtcdb_cache_set_get_file_by_index(
+		     cache_set,
+		     file_index,
+		     &file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file: %d.",
+			 function,
+			 file_index );
+
+			return( -1 );
+		}
+		if( libwtcdb_file_get_type(
+		     file,
+		     &file_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve type of file: %d.",
+			 function,
+			 file_index );
+
+			return( -1 );
+		}
+		if( ( file_type != LIBWTCDB_FILE_TYPE_INDEX_V20 )
+		 && ( file_type != LIBWTCDB_FILE_TYPE_INDEX_V30 ) )
+		{
+			continue;
+		}
+		if( libwtcdb_internal_timeline_append_file(
+		     (libwtcdb_internal_timeline_t *) timeline,
+		     file,
+		     cache_set,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append file: %d.",
+			 function,
+			 file_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of inputs
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_timeline_get_number_of_inputs(
+     libwtcdb_timeline_t *timeline,
+     int *number_of_inputs,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_timeline_t *internal_timeline = NULL;
+	static char *function                           = "libwtcdb_timeline_get_number_of_inputs";
+
+	if( timeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline.",
+		 function );
+
+		return( -1 );
+	}
+	internal_timeline = (libwtcdb_internal_timeline_t *) timeline;
+
+	if( number_of_inputs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of inputs.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_timeline->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_inputs = internal_timeline->number_of_inputs;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_timeline->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Compares two inputs
+ * The inputs are ordered by their current modification time and then by input index
+ * Returns LIBCDATA_COMPARE_LESS, LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ */
+int libwtcdb_timeline_input_compare(
+     libwtcdb_timeline_input_t *first_input,
+     libwtcdb_timeline_input_t *second_input,
+     libcerror_error_t **error )
+{
+	static char *function             = "libwtcdb_timeline_input_compare";
+	uint64_t first_modification_time  = 0;
+	uint64_t second_modification_time = 0;
+
+	if( first_input == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first input.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_input == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second input.",
+		 function );
+
+		return( -1 );
+	}
+	first_modification_time  = first_input->time_column->times[ first_input->position ];
+	second_modification_time = second_input->time_column->times[ second_input->position ];
+
+	if( first_modification_time < second_modification_time )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( first_modification_time > second_modification_time )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	if( first_input->input_index < second_input->input_index )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( first_input->input_index > second_input->input_index )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	return( LIBCDATA_COMPARE_EQUAL );
+}
+
+/* Starts the iteration by building the heap of the inputs that have entries
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_internal_timeline_start(
+     libwtcdb_internal_timeline_t *internal_timeline,
+     libcerror_error_t **error )
+{
+	static char *function = "libwtcdb_internal_timeline_start";
+	int input_index       = 0;
+
+	if( internal_timeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_timeline->is_started != 0 )
+	{
+		return( 1 );
+	}
+	if( internal_timeline->number_of_inputs > 0 )
+	{
+		if( (size_t) internal_timeline->number_of_inputs > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( intptr_t * ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of inputs value exceeds maximum allocation size.",
+			 function );
+
+			return( -1 );
+		}
+		internal_timeline->heap = (intptr_t **) memory_allocate(
+		                                         sizeof( intptr_t * ) * (size_t) internal_timeline->number_of_inputs );
+
+		if( internal_timeline->heap == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create heap.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_timeline->heap_size = 0;
+
+	for( input_index = 0;
+	     input_index < internal_timeline->number_of_inputs;
+	     input_index++ )
+	{
+		if( internal_timeline->inputs[ input_index ].time_column->number_of_entries > 0 )
+		{
+			internal_timeline->heap[ internal_timeline->heap_size ] = (intptr_t *) &( internal_timeline->inputs[ input_index ] );
+
+			internal_timeline->heap_size += 1;
+		}
+	}
+	if( libwtcdb_merge_heap_build(
+	     internal_timeline->heap,
+	     internal_timeline->heap_size,
+	     (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libwtcdb_timeline_input_compare,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build heap.",
+		 function );
+
+		memory_free(
+		 internal_timeline->heap );
+
+		internal_timeline->heap      = NULL;
+		internal_timeline->heap_size = 0;
+
+		return( -1 );
+	}
+	internal_timeline->is_started = 1;
+
+	return( 1 );
+}
+
+/* Retrieves the next entry in modification time order
+ * Entries with the same modification time are returned in the order their files were appended
+ * The input index is the index of the index file in the order it was appended
+ * The number of items is the number of cache items the entry resolves to, these
+ * can be retrieved with libwtcdb_timeline_get_items
+ * The first call starts the iteration, after which no more files can be appended
+ * Returns 1 if successful, 0 if no more entries are available or -1 on error
+ */
+int libwtcdb_timeline_get_next_entry(
+     libwtcdb_timeline_t *timeline,
+     uint64_t *modification_time,
+     uint64_t *hash,
+     int *input_index,
+     int *number_of_items,
+     libcerror_error_t **error )
+{
+	libwtcdb_index_entry_t *index_entry             = NULL;
+	libwtcdb_internal_timeline_t *internal_timeline = NULL;
+	libwtcdb_timeline_input_t *input                = NULL;
+	static char *function                           = "libwtcdb_timeline_get_next_entry";
+	int entry_index                                 = 0;
+	int result                                      = 1;
+
+	if( timeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline.",
+		 function );
+
+		return( -1 );
+	}
+	internal_timeline = (libwtcdb_internal_timeline_t *) timeline;
+
+	if( modification_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid modification time.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input index.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_items == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of items.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_timeline->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_timeline->current_input = NULL;
+
+	if( libwtcdb_internal_timeline_start(
+	     internal_timeline,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to start timeline.",
+		 function );
+
+		result = -1;
+	}
+	else if( internal_timeline->heap_size == 0 )
+	{
+		result = 0;
+	}
+	else
+	{
+		input       = (libwtcdb_timeline_input_t *) internal_timeline->heap[ 0 ];
+		entry_index = input->time_column->entry_indexes[ input->position ];
+
+		if( libcdata_array_get_entry_by_index(
+		     input->snapshot->entries,
+		     entry_index,
+		     (intptr_t **) &index_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry: %d from input: %d.",
+			 function,
+			 entry_index,
+			 input->input_index );
+
+			result = -1;
+		}
+		else if( index_entry == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing entry: %d from input: %d.",
+			 function,
+			 entry_index,
+			 input->input_index );
+
+			result = -1;
+		}
+		else if( input->cache_set == NULL )
+		{
+			*number_of_items = 0;
+		}
+		else if( libwtcdb_cache_set_get_number_of_items_by_hash(
+		          input->cache_set,
+		          index_entry->hash,
+		          number_of_items,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of items of entry: %d from input: %d.",
+			 function,
+			 entry_index,
+			 input->input_index );
+
+			result = -1;
+		}
+		if( result == 1 )
+		{
+			*modification_time = input->time_column->times[ input->position ];
+			*hash              = index_entry->hash;
+			*input_index       = input->input_index;
+
+			internal_timeline->current_input = input;
+			internal_timeline->current_hash  = index_entry->hash;
+
+			input->position += 1;
+
+			if( input->position >= input->time_column->number_of_entries )
+			{
+				result = libwtcdb_merge_heap_remove_first(
+				          internal_timeline->heap,
+				          &( internal_timeline->heap_size ),
+				          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libwtcdb_timeline_input_compare,
+				          error );
+			}
+			else
+			{
+				result = libwtcdb_merge_heap_sift_down(
+				          internal_timeline->heap,
+				          internal_timeline->heap_size,
+				          0,
+				          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libwtcdb_timeline_input_compare,
+				          error );
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update heap.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_timeline->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the cache items of the entry last retrieved by libwtcdb_timeline_get_next_entry
+ * The items are resolved by hash using the cache files of the cache set of the entry
+ * The items are stored in order of the files and must be freed by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int libwtcdb_timeline_get_items(
+     libwtcdb_timeline_t *timeline,
+     libwtcdb_item_t **items,
+     int items_size,
+     int *number_of_items,
+     libcerror_error_t **error )
+{
+	libwtcdb_internal_timeline_t *internal_timeline = NULL;
+	static char *function                           = "libwtcdb_timeline_get_items";
+	int result                                      = 1;
+
+	if( timeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline.",
+		 function );
+
+		return( -1 );
+	}
+	internal_timeline = (libwtcdb_internal_timeline_t *) timeline;
+
+	if( number_of_items == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of items.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_timeline->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_timeline->current_input == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid timeline - missing current entry.",
+		 function );
+
+		result = -1;
+	}
+	else if( internal_timeline->current_input->cache_set == NULL )
+	{
+		*number_of_items = 0;
+	}
+	else
+	{
+		result = libwtcdb_cache_set_get_items_by_hash(
+		          internal_timeline->current_input->cache_set,
+		          internal_timeline->current_hash,
+		          items,
+		          items_size,
+		          number_of_items,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve items of current entry.",
+			 function );
+		}
+		else
+		{
+			result = 1;
+		}
+	}
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_timeline->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		if( result == 1 )
+		{
+			while( *number_of_items > 0 )
+			{
+				*number_of_items -= 1;
+
+				libwtcdb_item_free(
+				 &( items[ *number_of_items ] ),
+				 NULL );
+			}
+		}
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
@@ -0,0 +1,190 @@
+/*
+ * Timeline functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBWTCDB_TIMELINE_H )
+#define _LIBWTCDB_TIMELINE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libwtcdb_extern.h"
+#include "libwtcdb_libcerror.h"
+#include "libwtcdb_libcthreads.h"
+#include "libwtcdb_snapshot.h"
+#include "libwtcdb_time_column.h"
+#include "libwtcdb_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libwtcdb_timeline_input libwtcdb_timeline_input_t;
+
+/* The timeline input contains the position of the timeline in a single index file
+ */
+struct libwtcdb_timeline_input
+{
+	/* The index file
+	 */
+	libwtcdb_file_t *file;
+
+	/* The cache set used to resolve the cache items, NULL if not set
+	 */
+	libwtcdb_cache_set_t *cache_set;
+
+	/* The snapshot of the index file
+	 */
+	libwtcdb_internal_snapshot_t *snapshot;
+
+	/* The time column, which is owned by the snapshot
+	 */
+	libwtcdb_time_column_t *time_column;
+
+	/* The position in the time column
+	 */
+	int position;
+
+	/* The input index
+	 */
+	int input_index;
+};
+
+typedef struct libwtcdb_internal_timeline libwtcdb_internal_timeline_t;
+
+/* The timeline iterates the entries of multiple index files in modification time order
+ * Every index file is a run that is sorted once, the runs are merged through a heap
+ * that contains a single position per index file
+ */
+struct libwtcdb_internal_timeline
+{
+	/* The inputs
+	 */
+	libwtcdb_timeline_input_t *inputs;
+
+	/* The number of inputs
+	 */
+	int number_of_inputs;
+
+	/* The number of allocated inputs
+	 */
+	int number_of_allocated_inputs;
+
+	/* The heap of the inputs that have remaining entries
+	 */
+	intptr_t **heap;
+
+	/* The number of inputs in the heap
+	 */
+	int heap_size;
+
+	/* Value to indicate the iteration has started
+	 */
+	uint8_t is_started;
+
+	/* The input of the current entry, NULL if not set
+	 */
+	libwtcdb_timeline_input_t *current_input;
+
+	/* The hash of the current entry
+	 */
+	uint64_t current_hash;
+
+#if defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+LIBWTCDB_EXTERN \
+int libwtcdb_timeline_initialize(
+     libwtcdb_timeline_t **timeline,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_timeline_free(
+     libwtcdb_timeline_t **timeline,
+     libcerror_error_t **error );
+
+int libwtcdb_internal_timeline_append_input(
+     libwtcdb_internal_timeline_t *internal_timeline,
+     libwtcdb_file_t *file,
+     libwtcdb_cache_set_t *cache_set,
+     libwtcdb_internal_snapshot_t *snapshot,
+     libcerror_error_t **error );
+
+int libwtcdb_internal_timeline_append_file(
+     libwtcdb_internal_timeline_t *internal_timeline,
+     libwtcdb_file_t *file,
+     libwtcdb_cache_set_t *cache_set,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_timeline_append_file(
+     libwtcdb_timeline_t *timeline,
+     libwtcdb_file_t *file,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_timeline_append_cache_set(
+     libwtcdb_timeline_t *timeline,
+     libwtcdb_cache_set_t *cache_set,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_timeline_get_number_of_inputs(
+     libwtcdb_timeline_t *timeline,
+     int *number_of_inputs,
+     libcerror_error_t **error );
+
+int libwtcdb_timeline_input_compare(
+     libwtcdb_timeline_input_t *first_input,
+     libwtcdb_timeline_input_t *second_input,
+     libcerror_error_t **error );
+
+int libwtcdb_internal_timeline_start(
+     libwtcdb_internal_timeline_t *internal_timeline,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_timeline_get_next_entry(
+     libwtcdb_timeline_t *timeline,
+     uint64_t *modification_time,
+     uint64_t *hash,
+     int *input_index,
+     int *number_of_items,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_timeline_get_items(
+     libwtcdb_timeline_t *timeline,
+     libwtcdb_item_t **items,
+     int items_size,
+     int *number_of_items,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBWTCDB_TIMELINE_H ) */
+
@@ -34,15 +34,114 @@
 /* The following type definitions hide internal data structures
  */
 #if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
+typedef struct libwtcdb_cache_set {}	libwtcdb_cache_set_t;
+typedef struct libwtcdb_chunk_cache {}	libwtcdb_chunk_cache_t;
+typedef struct libwtcdb_diff {}	libwtcdb_diff_t;
 typedef struct libwtcdb_file {}	libwtcdb_file_t;
+typedef struct libwtcdb_handle_pool {}	libwtcdb_handle_pool_t;
+typedef struct libwtcdb_hash_merge {}	libwtcdb_hash_merge_t;
 typedef struct libwtcdb_item {}	libwtcdb_item_t;
+typedef struct libwtcdb_read_queue {}	libwtcdb_read_queue_t;
+typedef struct libwtcdb_snapshot {}	libwtcdb_snapshot_t;
+typedef struct libwtcdb_timeline {}	libwtcdb_timeline_t;
 
 #else
+typedef intptr_t libwtcdb_cache_set_t;
+typedef intptr_t libwtcdb_chunk_cache_t;
+typedef intptr_t libwtcdb_diff_t;
 typedef intptr_t libwtcdb_file_t;
+typedef intptr_t libwtcdb_handle_pool_t;
+typedef intptr_t libwtcdb_hash_merge_t;
 typedef intptr_t libwtcdb_item_t;
+typedef intptr_t libwtcdb_read_queue_t;
+typedef intptr_t libwtcdb_snapshot_t;
+typedef intptr_t libwtcdb_timeline_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
 
+typedef int (*libwtcdb_exif_value_callback_t)(
+              int ifd,
+              uint16_t tag,
+              uint16_t value_type,
+              uint32_t number_of_values,
+              const uint8_t *value_data,
+              size_t value_data_size,
+              uint8_t byte_order,
+              void *user_data );
+
+/* The callback function type used to process an item in parallel
+ * The item is only valid during the callback
+ * The worker index is in the range 0 to the number of workers - 1 and can be
+ * used to look up a per worker context, a worker calls the callback from one
+ * thread at a time
+ * The callback should return 1 to continue, 0 to stop or -1 on error
+ */
+typedef int (*libwtcdb_item_callback_t)(
+              libwtcdb_item_t *item,
+              int item_index,
+              int worker_index,
+              void *user_data );
+
+/* The function type of a task that is run by an executor
+ */
+typedef void (*libwtcdb_executor_task_function_t)(
+              void *task_data );
+
+/* The callback function type used to submit a task to an executor
+ * The executor must call the task function exactly once with the task data
+ * The callback should return 1 if successful or -1 on error
+ */
+typedef int (*libwtcdb_executor_submit_callback_t)(
+              libwtcdb_executor_task_function_t task_function,
+              void *task_data,
+              void *executor_data );
+
+/* The callback function type used to wait for the submitted tasks of an executor
+ * The callback should only return after all submitted tasks have completed
+ * The callback should return 1 if successful or -1 on error
+ */
+typedef int (*libwtcdb_executor_wait_callback_t)(
+              void *executor_data );
+
+/* The callback function type used to report the progress of reading a file
+ * The bytes scanned is the number of bytes scanned for the cache entries
+ * and the number of entries is the number of entries read so far
+ * The callback is called from one thread at a time and should not call
+ * functions of the file that reports the progress
+ * The callback should return 1 to continue or 0 to abort
+ */
+typedef int (*libwtcdb_progress_callback_t)(
+              int phase,
+              uint64_t bytes_scanned,
+              uint64_t file_size,
+              int number_of_entries,
+              void *user_data );
+
+/* The options used to process items in parallel
+ */
+typedef struct libwtcdb_parallel_options libwtcdb_parallel_options_t;
+
+struct libwtcdb_parallel_options
+{
+	/* The number of workers
+	 * 0 represents the maximum number of threads of the file
+	 */
+	int number_of_workers;
+
+	/* The executor submit callback
+	 * NULL represents that the library runs the workers itself
+	 */
+	libwtcdb_executor_submit_callback_t executor_submit;
+
+	/* The executor wait callback
+	 */
+	libwtcdb_executor_wait_callback_t executor_wait;
+
+	/* The executor data
+	 */
+	void *executor_data;
+};
+
 #endif /* defined( HAVE_LOCAL_LIBWTCDB ) */
 
 #endif /* !defined( _LIBWTCDB_INTERNAL_TYPES_H ) */
@@ -0,0 +1,134 @@
+dnl Checks for liburing required headers and functions
+dnl
+dnl Version: 20260701
+
+dnl Function to detect if liburing is available
+dnl ac_liburing_dummy is used to prevent AC_CHECK_LIB adding unnecessary -l<library> arguments
+AC_DEFUN([AX_LIBURING_CHECK_LIB],
+  [AS_IF(
+    [test "x$ac_cv_enable_shared_libs" = xno || test "x$ac_cv_with_liburing" = xno],
+    [ac_cv_liburing=no],
+    [ac_cv_liburing=check
+    dnl Check if the directory provided as parameter exists
+    dnl For both --with-liburing which returns "yes" and --with-liburing= which returns ""
+    dnl treat them as auto-detection.
+    AS_IF(
+      [test "x$ac_cv_with_liburing" != x && test "x$ac_cv_with_liburing" != xauto-detect && test "x$ac_cv_with_liburing" != xyes],
+      [AX_CHECK_LIB_DIRECTORY_EXISTS([liburing])],
+      [dnl Check for a pkg-config file
+      AS_IF(
+        [test "x$cross_compiling" != "xyes" && test "x$PKGCONFIG" != "x"],
+        [PKG_CHECK_MODULES(
+          [liburing],
+          [liburing >= 2.0],
+          [ac_cv_liburing=yes],
+          [ac_cv_liburing=check])
+        ])
+      AS_IF(
+        [test "x$ac_cv_liburing" = xyes],
+        [ac_cv_liburing_CPPFLAGS="$pkg_cv_liburing_CFLAGS"
+        ac_cv_liburing_LIBADD="$pkg_cv_liburing_LIBS"])
+      ])
+
+    AS_IF(
+      [test "x$ac_cv_liburing" = xcheck],
+      [dnl Check for headers
+      AC_CHECK_HEADERS([liburing.h])
+
+      AS_IF(
+        [test "x$ac_cv_header_liburing_h" = xno],
+        [ac_cv_liburing=no],
+        [ac_cv_liburing=yes
+
+        AX_CHECK_LIB_FUNCTIONS(
+          [liburing],
+          [uring],
+          [[io_uring_queue_init],
+           [io_uring_queue_exit],
+           [io_uring_get_sqe],
+           [io_uring_submit_and_wait],
+           [io_uring_peek_batch_cqe]])
+
+        ac_cv_liburing_LIBADD="-luring"
+        ])
+      ])
+
+    AX_CHECK_LIB_DIRECTORY_MSG_ON_FAILURE([liburing])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_liburing" = xyes],
+    [AC_DEFINE(
+      [HAVE_LIBURING],
+      [1],
+      [Define to 1 if you have the 'uring' library (-luring).])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_liburing" = xyes],
+    [AC_SUBST(
+      [HAVE_LIBURING],
+      [1]) ],
+    [AC_SUBST(
+      [HAVE_LIBURING],
+      [0])
+    ])
+  ])
+
+dnl Function to detect if liburing dependencies are available
+AC_DEFUN([AX_LIBURING_CHECK_LOCAL],
+  [dnl Headers included in libwtcdb/libwtcdb_io_backend.c
+  AC_CHECK_HEADERS([errno.h fcntl.h unistd.h])
+  ])
+
+dnl Function to detect how to enable liburing
+AC_DEFUN([AX_LIBURING_CHECK_ENABLE],
+  [AX_COMMON_ARG_WITH(
+    [liburing],
+    [liburing],
+    [search for liburing in includedir and libdir or in the specified DIR, or no if not to use liburing for the io_uring IO backend],
+    [auto-detect],
+    [DIR])
+
+  dnl The io_uring IO backend is only supported on Linux
+  AS_CASE(
+    [$host],
+    [*linux*],
+    [AX_LIBURING_CHECK_LIB],
+    [ac_cv_liburing=no])
+
+  AS_IF(
+    [test "x$ac_cv_liburing" = xyes],
+    [AX_LIBURING_CHECK_LOCAL])
+
+  AS_IF(
+    [test "x$ac_cv_liburing_CPPFLAGS" != "x"],
+    [AC_SUBST(
+      [LIBURING_CPPFLAGS],
+      [$ac_cv_liburing_CPPFLAGS])
+    ])
+  AS_IF(
+    [test "x$ac_cv_liburing_LIBADD" != "x"],
+    [AC_SUBST(
+      [LIBURING_LIBADD],
+      [$ac_cv_liburing_LIBADD])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_liburing" = xyes],
+    [AC_SUBST(
+      [ax_liburing_pc_libs_private],
+      [-luring])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_liburing" = xyes],
+    [AC_SUBST(
+      [ax_liburing_spec_requires],
+      [liburing])
+    AC_SUBST(
+      [ax_liburing_spec_build_requires],
+      [liburing-devel])
+    ])
+  ])
+
@@ -1,7 +1,7 @@
 # Tests library functions and types.
 
-$LibraryTests = "cache_entry crc error file_header index_entry io_handle item notify"
-$LibraryTestsWithInput = "file support"
+$LibraryTests = "cache_entry crc entries_reader error exif file_header handle_pool hash_column hash_index identifier image_header index_entry index_records io_backend io_handle item item_worker jpeg merge_heap notify progress radix_sort read_ahead read_queue snapshot time_column"
+$LibraryTestsWithInput = "cache_set chunk_cache diff file hash_merge support timeline"
 $OptionSets = "" -split " "
 
 . .\test_functions.ps1
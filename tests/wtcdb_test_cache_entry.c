@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -660,16 +661,254 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libwtcdb_cache_entry_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_cache_entry_read_data(
+     void )
+{
+	uint8_t data[ 88 ];
+
+	libcerror_error_t *error            = NULL;
+	libwtcdb_cache_entry_t *cache_entry = NULL;
+	libwtcdb_io_handle_t *io_handle     = NULL;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libwtcdb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_cache_entry_initialize(
+	          &cache_entry,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_entry",
+	 cache_entry );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	io_handle->file_type      = LIBWTCDB_FILE_TYPE_CACHE;
+	io_handle->format_version = 20;
+
+	result = libwtcdb_cache_entry_read_data(
+	          cache_entry,
+	          io_handle,
+	          wtcdb_test_cache_entry_data1,
+	          88,
+	          1024,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_entry->identifier",
+	 cache_entry->identifier );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT64(
+	 "cache_entry->cached_data_offset",
+	 (int64_t) cache_entry->cached_data_offset,
+	 (int64_t) 1024 + 88 );
+
+	/* Test read with a cached data size that exceeds the cache entry
+	 */
+	memory_copy(
+	 data,
+	 wtcdb_test_cache_entry_data1,
+	 88 );
+
+	data[ 32 ] = 0x10;
+
+	result = libwtcdb_cache_entry_read_data(
+	          cache_entry,
+	          io_handle,
+	          data,
+	          88,
+	          1024,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT32(
+	 "cache_entry->cached_data_size",
+	 cache_entry->cached_data_size,
+	 0 );
+
+	/* Test read with data too small to contain the identifier string
+	 */
+	result = libwtcdb_cache_entry_read_data(
+	          cache_entry,
+	          io_handle,
+	          wtcdb_test_cache_entry_data1,
+	          60,
+	          1024,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "cache_entry->identifier",
+	 cache_entry->identifier );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_cache_entry_read_data(
+	          NULL,
+	          io_handle,
+	          wtcdb_test_cache_entry_data1,
+	          88,
+	          1024,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_cache_entry_read_data(
+	          cache_entry,
+	          io_handle,
+	          wtcdb_test_cache_entry_error_data1,
+	          88,
+	          1024,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwtcdb_cache_entry_free(
+	          &cache_entry,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "cache_entry",
+	 cache_entry );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache_entry != NULL )
+	{
+		libwtcdb_cache_entry_free(
+		 &cache_entry,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libwtcdb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libwtcdb_cache_entry_read_file_io_handle function
  * Returns 1 if successful or 0 if not
  */
 int wtcdb_test_cache_entry_read_file_io_handle(
      void )
 {
+	uint8_t data[ 104 ];
+
 	libbfio_handle_t *file_io_handle    = NULL;
 	libcerror_error_t *error            = NULL;
 	libwtcdb_cache_entry_t *cache_entry = NULL;
 	libwtcdb_io_handle_t *io_handle     = NULL;
+	off64_t offset                      = 0;
 	int result                          = 0;
 
 	/* Initialize test
@@ -750,6 +989,144 @@ int wtcdb_test_cache_entry_read_file_io_handle(
 	 "error",
 	 error );
 
+	/* Test read with the file IO handle current offset at the end of the data
+	 */
+	offset = libbfio_handle_seek_offset(
+	          file_io_handle,
+	          88,
+	          SEEK_SET,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 88 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_cache_entry_read_file_io_handle(
+	          cache_entry,
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_entry->identifier",
+	 cache_entry->identifier );
+
+	/* Clean up file IO handle
+	 */
+	result = wtcdb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read of a cache entry at a non-zero offset
+	 */
+	memory_set(
+	 data,
+	 0,
+	 16 );
+
+	memory_copy(
+	 &( data[ 16 ] ),
+	 wtcdb_test_cache_entry_data1,
+	 88 );
+
+	result = wtcdb_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          104,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_cache_entry_read_file_io_handle(
+	          cache_entry,
+	          io_handle,
+	          file_io_handle,
+	          16,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT64(
+	 "cache_entry->file_offset",
+	 (int64_t) cache_entry->file_offset,
+	 (int64_t) 16 );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT32(
+	 "cache_entry->data_size",
+	 cache_entry->data_size,
+	 88 );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT64(
+	 "cache_entry->hash",
+	 cache_entry->hash,
+	 (uint64_t) 0xd52627b293f9d716UL );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT32(
+	 "cache_entry->identifier_size",
+	 cache_entry->identifier_size,
+	 32 );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT32(
+	 "cache_entry->cached_data_size",
+	 cache_entry->cached_data_size,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_entry->identifier",
+	 cache_entry->identifier );
+
+	result = memory_compare(
+	          cache_entry->identifier,
+	          &( wtcdb_test_cache_entry_data1[ 56 ] ),
+	          32 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
 	/* Clean up file IO handle
 	 */
 	result = wtcdb_test_close_file_io_handle(
@@ -1285,6 +1662,10 @@ int main(
 	 "libwtcdb_cache_entry_header_read_data",
 	 wtcdb_test_cache_entry_header_read_data );
 
+	WTCDB_TEST_RUN(
+	 "libwtcdb_cache_entry_read_data",
+	 wtcdb_test_cache_entry_read_data );
+
 	WTCDB_TEST_RUN(
 	 "libwtcdb_cache_entry_read_file_io_handle",
 	 wtcdb_test_cache_entry_read_file_io_handle );
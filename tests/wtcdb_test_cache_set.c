@@ -0,0 +1,2931 @@
+/*
+ * Library cache_set type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "wtcdb_test_functions.h"
+#include "wtcdb_test_getopt.h"
+#include "wtcdb_test_libbfio.h"
+#include "wtcdb_test_libcerror.h"
+#include "wtcdb_test_libwtcdb.h"
+#include "wtcdb_test_macros.h"
+#include "wtcdb_test_memory.h"
+
+#include "../libwtcdb/libwtcdb_cache_set.h"
+#include "../libwtcdb/libwtcdb_file.h"
+#include "../libwtcdb/libwtcdb_libcdata.h"
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER ) && SIZEOF_WCHAR_T != 2 && SIZEOF_WCHAR_T != 4
+#error Unsupported size of wchar_t
+#endif
+
+/* Define to make wtcdb_test_cache_set generate verbose output
+#define WTCDB_TEST_CACHE_SET_VERBOSE
+ */
+
+#if !defined( LIBWTCDB_HAVE_BFIO )
+
+LIBWTCDB_EXTERN \
+int libwtcdb_check_file_signature_file_io_handle(
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+#endif /* !defined( LIBWTCDB_HAVE_BFIO ) */
+
+/* Tests the libwtcdb_cache_set_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_cache_set_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libwtcdb_cache_set_t *cache_set = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_WTCDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_cache_set_initialize(
+	          &cache_set,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_set",
+	 cache_set );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_cache_set_free(
+	          &cache_set,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "cache_set",
+	 cache_set );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_cache_set_initialize(
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	cache_set = (libwtcdb_cache_set_t *) 0x12345678UL;
+
+	result = libwtcdb_cache_set_initialize(
+	          &cache_set,
+	          &error );
+
+	cache_set = NULL;
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_WTCDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libwtcdb_cache_set_initialize with malloc failing
+		 */
+		wtcdb_test_malloc_attempts_before_fail = test_number;
+
+		result = libwtcdb_cache_set_initialize(
+		          &cache_set,
+		          &error );
+
+		if( wtcdb_test_malloc_attempts_before_fail != -1 )
+		{
+			wtcdb_test_malloc_attempts_before_fail = -1;
+
+			if( cache_set != NULL )
+			{
+				libwtcdb_cache_set_free(
+				 &cache_set,
+				 NULL );
+			}
+		}
+		else
+		{
+			WTCDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			WTCDB_TEST_ASSERT_IS_NULL(
+			 "cache_set",
+			 cache_set );
+
+			WTCDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libwtcdb_cache_set_initialize with memset failing
+		 */
+		wtcdb_test_memset_attempts_before_fail = test_number;
+
+		result = libwtcdb_cache_set_initialize(
+		          &cache_set,
+		          &error );
+
+		if( wtcdb_test_memset_attempts_before_fail != -1 )
+		{
+			wtcdb_test_memset_attempts_before_fail = -1;
+
+			if( cache_set != NULL )
+			{
+				libwtcdb_cache_set_free(
+				 &cache_set,
+				 NULL );
+			}
+		}
+		else
+		{
+			WTCDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			WTCDB_TEST_ASSERT_IS_NULL(
+			 "cache_set",
+			 cache_set );
+
+			WTCDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_WTCDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache_set != NULL )
+	{
+		libwtcdb_cache_set_free(
+		 &cache_set,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_cache_set_free function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_cache_set_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libwtcdb_cache_set_free(
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_cache_set_set_maximum_number_of_threads and libwtcdb_cache_set_set_io_backend functions
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_cache_set_settings(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libwtcdb_cache_set_t *cache_set = NULL;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libwtcdb_cache_set_initialize(
+	          &cache_set,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_set",
+	 cache_set );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_cache_set_set_maximum_number_of_threads(
+	          cache_set,
+	          4,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_cache_set_set_maximum_number_of_open_threads(
+	          cache_set,
+	          4,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_cache_set_set_io_backend(
+	          cache_set,
+	          LIBWTCDB_IO_BACKEND_BFIO,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_cache_set_set_read_mode(
+	          cache_set,
+	          LIBWTCDB_CACHE_SET_READ_MODE_INDEXED,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_cache_set_set_maximum_number_of_threads(
+	          NULL,
+	          4,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_cache_set_set_maximum_number_of_threads(
+	          cache_set,
+	          0,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_cache_set_set_maximum_number_of_open_threads(
+	          NULL,
+	          4,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_cache_set_set_maximum_number_of_open_threads(
+	          cache_set,
+	          0,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_cache_set_set_io_backend(
+	          NULL,
+	          LIBWTCDB_IO_BACKEND_BFIO,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_cache_set_set_io_backend(
+	          cache_set,
+	          -1,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_cache_set_set_read_mode(
+	          NULL,
+	          LIBWTCDB_CACHE_SET_READ_MODE_INDEXED,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_cache_set_set_read_mode(
+	          cache_set,
+	          -1,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwtcdb_cache_set_free(
+	          &cache_set,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "cache_set",
+	 cache_set );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache_set != NULL )
+	{
+		libwtcdb_cache_set_free(
+		 &cache_set,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_cache_set_open function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_cache_set_open(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libwtcdb_cache_set_t *cache_set = NULL;
+	int number_of_files             = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libwtcdb_cache_set_initialize(
+	          &cache_set,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_set",
+	 cache_set );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_cache_set_open(
+	          NULL,
+	          ".",
+	          LIBWTCDB_OPEN_READ,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_cache_set_open(
+	          cache_set,
+	          NULL,
+	          LIBWTCDB_OPEN_READ,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_cache_set_open(
+	          cache_set,
+	          "",
+	          LIBWTCDB_OPEN_READ,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_cache_set_open(
+	          cache_set,
+	          ".",
+	          LIBWTCDB_OPEN_WRITE,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test open of a directory without thumbcache files
+	 */
+	result = libwtcdb_cache_set_open(
+	          cache_set,
+	          "wtcdb_test_cache_set_missing",
+	          LIBWTCDB_OPEN_READ,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_cache_set_get_number_of_files(
+	          cache_set,
+	          &number_of_files,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwtcdb_cache_set_free(
+	          &cache_set,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "cache_set",
+	 cache_set );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache_set != NULL )
+	{
+		libwtcdb_cache_set_free(
+		 &cache_set,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_cache_set_open_files function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_cache_set_open_files(
+     const system_character_t *source )
+{
+	char error_string[ 512 ];
+	char narrow_source[ 256 ];
+
+	char *filenames[ 3 ]                = { NULL, NULL, NULL };
+	libcerror_error_t *error            = NULL;
+	libwtcdb_cache_set_t *cache_set     = NULL;
+	libwtcdb_file_t *file               = NULL;
+	libwtcdb_handle_pool_t *handle_pool = NULL;
+	libwtcdb_item_t *item               = NULL;
+	uint8_t *data                       = NULL;
+	size_t data_size                    = 0;
+	int file_index                      = 0;
+	int filename_index                  = 0;
+	int number_of_failed_files          = 0;
+	int number_of_files                 = 0;
+	int number_of_items                 = 0;
+	int number_of_open_handles          = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = wtcdb_test_get_narrow_source(
+	          source,
+	          narrow_source,
+	          256,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	filenames[ 0 ] = narrow_source;
+	filenames[ 1 ] = narrow_source;
+
+	result = libwtcdb_cache_set_initialize(
+	          &cache_set,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_set",
+	 cache_set );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open
+	 */
+	result = libwtcdb_cache_set_open_files(
+	          cache_set,
+	          filenames,
+	          2,
+	          LIBWTCDB_OPEN_READ,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_cache_set_get_number_of_files(
+	          cache_set,
+	          &number_of_files,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_files",
+	 number_of_files,
+	 2 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_cache_set_open_files(
+	          NULL,
+	          filenames,
+	          2,
+	          LIBWTCDB_OPEN_READ,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_cache_set_open_files(
+	          cache_set,
+	          NULL,
+	          2,
+	          LIBWTCDB_OPEN_READ,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_cache_set_open_files(
+	          cache_set,
+	          filenames,
+	          0,
+	          LIBWTCDB_OPEN_READ,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_cache_set_open_files(
+	          cache_set,
+	          filenames,
+	          2,
+	          -1,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test open when already opened
+	 */
+	result = libwtcdb_cache_set_open_files(
+	          cache_set,
+	          filenames,
+	          1,
+	          LIBWTCDB_OPEN_READ,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_cache_set_close(
+	          cache_set,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open with a file that cannot be opened
+	 */
+	filenames[ 1 ] = "wtcdb_test_nonexistent.db";
+	filenames[ 2 ] = narrow_source;
+
+	result = libwtcdb_cache_set_set_maximum_number_of_open_threads(
+	          cache_set,
+	          2,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_cache_set_open_files(
+	          cache_set,
+	          filenames,
+	          3,
+	          LIBWTCDB_OPEN_READ,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_cache_set_get_number_of_files(
+	          cache_set,
+	          &number_of_files,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_files",
+	 number_of_files,
+	 2 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_cache_set_get_number_of_failed_files(
+	          cache_set,
+	          &number_of_failed_files,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_failed_files",
+	 number_of_failed_files,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_cache_set_get_failed_file(
+	          cache_set,
+	          0,
+	          &filename_index,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "filename_index",
+	 filename_index,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_cache_set_failed_file_error_backtrace_sprint(
+	          cache_set,
+	          0,
+	          error_string,
+	          512,
+	          &error );
+
+	WTCDB_TEST_ASSERT_GREATER_THAN_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_cache_set_get_failed_file(
+	          NULL,
+	          0,
+	          &filename_index,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_cache_set_get_failed_file(
+	          cache_set,
+	          1,
+	          &filename_index,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_cache_set_get_failed_file(
+	          cache_set,
+	          0,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_cache_set_failed_file_error_backtrace_sprint(
+	          cache_set,
+	          0,
+	          NULL,
+	          512,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_cache_set_close(
+	          cache_set,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open with a handle pool that keeps a single file IO handle open
+	 */
+	filenames[ 1 ] = narrow_source;
+
+	result = libwtcdb_handle_pool_initialize(
+	          &handle_pool,
+	          1,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_cache_set_set_handle_pool(
+	          cache_set,
+	          handle_pool,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_cache_set_open_files(
+	          cache_set,
+	          filenames,
+	          2,
+	          LIBWTCDB_OPEN_READ,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Read the cached data of the first item of each file,
+	 * which reopens the file IO handle closed by the handle pool
+	 */
+	for( file_index = 0;
+	     file_index < 2;
+	     file_index++ )
+	{
+		result = libwtcdb_cache_set_get_file_by_index(
+		          cache_set,
+		          file_index,
+		          &file,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libwtcdb_file_get_number_of_items(
+		          file,
+		          &number_of_items,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( number_of_items == 0 )
+		{
+			continue;
+		}
+		result = libwtcdb_file_get_item(
+		          file,
+		          0,
+		          &item,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libwtcdb_item_get_data_size(
+		          item,
+		          &data_size,
+		          &error );
+
+		WTCDB_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( ( result == 1 )
+		 && ( data_size > 0 ) )
+		{
+			data = (uint8_t *) memory_allocate(
+			                    data_size );
+
+			WTCDB_TEST_ASSERT_IS_NOT_NULL(
+			 "data",
+			 data );
+
+			result = libwtcdb_item_copy_data(
+			          item,
+			          data,
+			          data_size,
+			          &error );
+
+			WTCDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			WTCDB_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			memory_free(
+			 data );
+
+			data = NULL;
+		}
+		result = libwtcdb_item_free(
+		          &item,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libwtcdb_handle_pool_get_number_of_open_handles(
+	          handle_pool,
+	          &number_of_open_handles,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_open_handles",
+	 number_of_open_handles,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_cache_set_close(
+	          cache_set,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_cache_set_set_handle_pool(
+	          cache_set,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_handle_pool_free(
+	          &handle_pool,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	filenames[ 1 ] = "wtcdb_test_nonexistent.db";
+
+	/* Test open when none of the files can be opened
+	 */
+	result = libwtcdb_cache_set_open_files(
+	          cache_set,
+	          &( filenames[ 1 ] ),
+	          1,
+	          LIBWTCDB_OPEN_READ,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwtcdb_cache_set_free(
+	          &cache_set,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "cache_set",
+	 cache_set );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	if( item != NULL )
+	{
+		libwtcdb_item_free(
+		 &item,
+		 NULL );
+	}
+	if( cache_set != NULL )
+	{
+		libwtcdb_cache_set_free(
+		 &cache_set,
+		 NULL );
+	}
+	if( handle_pool != NULL )
+	{
+		libwtcdb_handle_pool_free(
+		 &handle_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Tests the libwtcdb_cache_set_open_files_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_cache_set_open_files_wide(
+     const system_character_t *source )
+{
+	wchar_t wide_source[ 256 ];
+
+	wchar_t *filenames[ 1 ]         = { NULL };
+	libcerror_error_t *error        = NULL;
+	libwtcdb_cache_set_t *cache_set = NULL;
+	int number_of_files             = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = wtcdb_test_get_wide_source(
+	          source,
+	          wide_source,
+	          256,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	filenames[ 0 ] = wide_source;
+
+	result = libwtcdb_cache_set_initialize(
+	          &cache_set,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_set",
+	 cache_set );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open
+	 */
+	result = libwtcdb_cache_set_open_files_wide(
+	          cache_set,
+	          filenames,
+	          1,
+	          LIBWTCDB_OPEN_READ,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_cache_set_get_number_of_files(
+	          cache_set,
+	          &number_of_files,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_files",
+	 number_of_files,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_cache_set_open_files_wide(
+	          NULL,
+	          filenames,
+	          1,
+	          LIBWTCDB_OPEN_READ,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_cache_set_open_files_wide(
+	          cache_set,
+	          NULL,
+	          1,
+	          LIBWTCDB_OPEN_READ,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwtcdb_cache_set_free(
+	          &cache_set,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "cache_set",
+	 cache_set );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache_set != NULL )
+	{
+		libwtcdb_cache_set_free(
+		 &cache_set,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Tests the libwtcdb_cache_set_close function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_cache_set_close(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libwtcdb_cache_set_close(
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_cache_set_signal_abort function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_cache_set_signal_abort(
+     libwtcdb_cache_set_t *cache_set )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_cache_set_signal_abort(
+	          cache_set,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_cache_set_signal_abort(
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_cache_set_get_file_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_cache_set_get_file_by_index(
+     libwtcdb_cache_set_t *cache_set )
+{
+	libcerror_error_t *error = NULL;
+	libwtcdb_file_t *file    = NULL;
+	uint8_t file_type        = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_cache_set_get_file_by_index(
+	          cache_set,
+	          0,
+	          &file,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_file_get_type(
+	          file,
+	          &file_type,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	file = NULL;
+
+	result = libwtcdb_cache_set_get_file_by_index(
+	          NULL,
+	          0,
+	          &file,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_cache_set_get_file_by_index(
+	          cache_set,
+	          -1,
+	          &file,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_cache_set_get_file_by_index(
+	          cache_set,
+	          0,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_cache_set_get_number_of_items and libwtcdb_cache_set_get_item functions
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_cache_set_get_item(
+     libwtcdb_cache_set_t *cache_set )
+{
+	libcerror_error_t *error = NULL;
+	libwtcdb_file_t *file    = NULL;
+	libwtcdb_item_t *item    = NULL;
+	int file_number_of_items = 0;
+	int number_of_items      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_cache_set_get_number_of_items(
+	          cache_set,
+	          &number_of_items,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_cache_set_get_file_by_index(
+	          cache_set,
+	          0,
+	          &file,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_file_get_number_of_items(
+	          file,
+	          &file_number_of_items,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The cache set contains the source file twice
+	 */
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_items",
+	 number_of_items,
+	 2 * file_number_of_items );
+
+	if( number_of_items > 0 )
+	{
+		/* Retrieve the first item of the second file
+		 */
+		result = libwtcdb_cache_set_get_item(
+		          cache_set,
+		          file_number_of_items,
+		          &item,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NOT_NULL(
+		 "item",
+		 item );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libwtcdb_item_free(
+		          &item,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libwtcdb_cache_set_get_number_of_items(
+	          NULL,
+	          &number_of_items,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_cache_set_get_number_of_items(
+	          cache_set,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_cache_set_get_item(
+	          NULL,
+	          0,
+	          &item,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "item",
+	 item );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_cache_set_get_item(
+	          cache_set,
+	          -1,
+	          &item,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "item",
+	 item );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_cache_set_get_item(
+	          cache_set,
+	          number_of_items,
+	          &item,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "item",
+	 item );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_cache_set_get_item(
+	          cache_set,
+	          0,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item != NULL )
+	{
+		libwtcdb_item_free(
+		 &item,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_cache_set_get_items_by_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_cache_set_get_items_by_hash(
+     libwtcdb_cache_set_t *cache_set )
+{
+	libcerror_error_t *error     = NULL;
+	libwtcdb_file_t *file        = NULL;
+	libwtcdb_item_t *item        = NULL;
+	libwtcdb_item_t **items      = NULL;
+	uint64_t hash                = 0;
+	uint8_t file_type            = 0;
+	int expected_number_of_items = 0;
+	int file_number_of_items     = 0;
+	int item_index               = 0;
+	int items_size               = 0;
+	int number_of_items          = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = libwtcdb_cache_set_get_file_by_index(
+	          cache_set,
+	          0,
+	          &file,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_file_get_type(
+	          file,
+	          &file_type,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_file_get_number_of_items(
+	          file,
+	          &file_number_of_items,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( file_number_of_items == 0 )
+	{
+		return( 1 );
+	}
+	/* The cache set contains the source file twice and only the items
+	 * of cache files are in the hash index
+	 */
+	if( file_type == LIBWTCDB_FILE_TYPE_CACHE )
+	{
+		expected_number_of_items = 2;
+	}
+	result = libwtcdb_file_get_item(
+	          file,
+	          0,
+	          &item,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_item_get_hash(
+	          item,
+	          &hash,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_item_free(
+	          &item,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_cache_set_get_number_of_items_by_hash(
+	          cache_set,
+	          hash,
+	          &number_of_items,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_items",
+	 number_of_items,
+	 expected_number_of_items - 1 );
+
+	items_size = number_of_items + 1;
+
+	items = (libwtcdb_item_t **) memory_allocate(
+	                              sizeof( libwtcdb_item_t * ) * items_size );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "items",
+	 items );
+
+	memory_set(
+	 items,
+	 0,
+	 sizeof( libwtcdb_item_t * ) * items_size );
+
+	result = libwtcdb_cache_set_get_items_by_hash(
+	          cache_set,
+	          hash,
+	          items,
+	          items_size,
+	          &number_of_items,
+	          &error );
+
+	WTCDB_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_items",
+	 number_of_items,
+	 expected_number_of_items - 1 );
+
+	for( item_index = 0;
+	     item_index < number_of_items;
+	     item_index++ )
+	{
+		result = libwtcdb_item_get_hash(
+		          items[ item_index ],
+		          &hash,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libwtcdb_item_free(
+		          &( items[ item_index ] ),
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libwtcdb_cache_set_get_items_by_hash(
+	          NULL,
+	          hash,
+	          items,
+	          items_size,
+	          &number_of_items,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_cache_set_get_items_by_hash(
+	          cache_set,
+	          hash,
+	          NULL,
+	          items_size,
+	          &number_of_items,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_cache_set_get_items_by_hash(
+	          cache_set,
+	          hash,
+	          items,
+	          -1,
+	          &number_of_items,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_cache_set_get_items_by_hash(
+	          cache_set,
+	          hash,
+	          items,
+	          items_size,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( number_of_items > 1 )
+	{
+		result = libwtcdb_cache_set_get_items_by_hash(
+		          cache_set,
+		          hash,
+		          items,
+		          number_of_items - 1,
+		          &number_of_items,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		WTCDB_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	result = libwtcdb_cache_set_get_number_of_items_by_hash(
+	          NULL,
+	          hash,
+	          &number_of_items,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_cache_set_get_number_of_items_by_hash(
+	          cache_set,
+	          hash,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 items );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( items != NULL )
+	{
+		for( item_index = 0;
+		     item_index < items_size;
+		     item_index++ )
+		{
+			if( items[ item_index ] != NULL )
+			{
+				libwtcdb_item_free(
+				 &( items[ item_index ] ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 items );
+	}
+	if( item != NULL )
+	{
+		libwtcdb_item_free(
+		 &item,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+
+/* Tests the libwtcdb_cache_set_select_cache_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_cache_set_select_cache_entries(
+     void )
+{
+	libcdata_array_t *files_array   = NULL;
+	libcerror_error_t *error        = NULL;
+	libwtcdb_cache_set_t *cache_set = NULL;
+	libwtcdb_file_t *file           = NULL;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libwtcdb_cache_set_initialize(
+	          &cache_set,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_set",
+	 cache_set );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_cache_set_set_read_mode(
+	          cache_set,
+	          LIBWTCDB_CACHE_SET_READ_MODE_INDEXED,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_initialize(
+	          &files_array,
+	          0,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_file_initialize(
+	          &file,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test select without an index file, which reads all the cache entries
+	 */
+	result = libwtcdb_cache_set_select_cache_entries(
+	          (libwtcdb_internal_cache_set_t *) cache_set,
+	          files_array,
+	          2,
+	          file,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "file->cache_entry_offsets",
+	 ( (libwtcdb_internal_file_t *) file )->cache_entry_offsets );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_cache_set_select_cache_entries(
+	          NULL,
+	          files_array,
+	          2,
+	          file,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwtcdb_file_free(
+	          &file,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_free(
+	          &files_array,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_cache_set_free(
+	          &cache_set,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libwtcdb_file_free(
+		 &file,
+		 NULL );
+	}
+	if( files_array != NULL )
+	{
+		libcdata_array_free(
+		 &files_array,
+		 NULL,
+		 NULL );
+	}
+	if( cache_set != NULL )
+	{
+		libwtcdb_cache_set_free(
+		 &cache_set,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	char narrow_source[ 256 ];
+
+	char *filenames[ 2 ]             = { NULL, NULL };
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libwtcdb_cache_set_t *cache_set  = NULL;
+	system_character_t *source       = NULL;
+	system_integer_t option          = 0;
+	size_t string_length             = 0;
+	int result                       = 0;
+
+	while( ( option = wtcdb_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( WTCDB_TEST_CACHE_SET_VERBOSE )
+	libwtcdb_notify_set_verbose(
+	 1 );
+	libwtcdb_notify_set_stream(
+	 stderr,
+	 NULL );
+#endif
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_cache_set_initialize",
+	 wtcdb_test_cache_set_initialize );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_cache_set_free",
+	 wtcdb_test_cache_set_free );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_cache_set_set_maximum_number_of_threads",
+	 wtcdb_test_cache_set_settings );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_cache_set_open",
+	 wtcdb_test_cache_set_open );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_cache_set_close",
+	 wtcdb_test_cache_set_close );
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_cache_set_select_cache_entries",
+	 wtcdb_test_cache_set_select_cache_entries );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+	if( source != NULL )
+	{
+		result = libbfio_file_initialize(
+		          &file_io_handle,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+	        WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	         "file_io_handle",
+	         file_io_handle );
+
+	        WTCDB_TEST_ASSERT_IS_NULL(
+	         "error",
+	         error );
+
+		string_length = system_string_length(
+		                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libbfio_file_set_name_wide(
+		          file_io_handle,
+		          source,
+		          string_length,
+		          &error );
+#else
+		result = libbfio_file_set_name(
+		          file_io_handle,
+		          source,
+		          string_length,
+		          &error );
+#endif
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+	        WTCDB_TEST_ASSERT_IS_NULL(
+	         "error",
+	         error );
+
+		result = libwtcdb_check_file_signature_file_io_handle(
+		          file_io_handle,
+		          &error );
+
+		WTCDB_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	if( result != 0 )
+	{
+		WTCDB_TEST_RUN_WITH_ARGS(
+		 "libwtcdb_cache_set_open_files",
+		 wtcdb_test_cache_set_open_files,
+		 source );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+		WTCDB_TEST_RUN_WITH_ARGS(
+		 "libwtcdb_cache_set_open_files_wide",
+		 wtcdb_test_cache_set_open_files_wide,
+		 source );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+		/* Initialize cache set for tests
+		 */
+		result = wtcdb_test_get_narrow_source(
+		          source,
+		          narrow_source,
+		          256,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		filenames[ 0 ] = narrow_source;
+		filenames[ 1 ] = narrow_source;
+
+		result = libwtcdb_cache_set_initialize(
+		          &cache_set,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NOT_NULL(
+		 "cache_set",
+		 cache_set );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libwtcdb_cache_set_open_files(
+		          cache_set,
+		          filenames,
+		          2,
+		          LIBWTCDB_OPEN_READ,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		WTCDB_TEST_RUN_WITH_ARGS(
+		 "libwtcdb_cache_set_signal_abort",
+		 wtcdb_test_cache_set_signal_abort,
+		 cache_set );
+
+		WTCDB_TEST_RUN_WITH_ARGS(
+		 "libwtcdb_cache_set_get_file_by_index",
+		 wtcdb_test_cache_set_get_file_by_index,
+		 cache_set );
+
+		WTCDB_TEST_RUN_WITH_ARGS(
+		 "libwtcdb_cache_set_get_item",
+		 wtcdb_test_cache_set_get_item,
+		 cache_set );
+
+		WTCDB_TEST_RUN_WITH_ARGS(
+		 "libwtcdb_cache_set_get_items_by_hash",
+		 wtcdb_test_cache_set_get_items_by_hash,
+		 cache_set );
+
+		/* Clean up
+		 */
+		result = libwtcdb_cache_set_close(
+		          cache_set,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libwtcdb_cache_set_free(
+		          &cache_set,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "cache_set",
+		 cache_set );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	if( file_io_handle != NULL )
+	{
+		result = libbfio_handle_free(
+		          &file_io_handle,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+	         "file_io_handle",
+	         file_io_handle );
+
+	        WTCDB_TEST_ASSERT_IS_NULL(
+	         "error",
+	         error );
+	}
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache_set != NULL )
+	{
+		libwtcdb_cache_set_free(
+		 &cache_set,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1952 @@
+/*
+ * Library chunk cache type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "wtcdb_test_functions.h"
+#include "wtcdb_test_getopt.h"
+#include "wtcdb_test_libbfio.h"
+#include "wtcdb_test_libcerror.h"
+#include "wtcdb_test_libwtcdb.h"
+#include "wtcdb_test_macros.h"
+#include "wtcdb_test_memory.h"
+#include "wtcdb_test_unused.h"
+
+#include "../libwtcdb/libwtcdb_cache_entry.h"
+#include "../libwtcdb/libwtcdb_chunk_cache.h"
+
+#if !defined( LIBWTCDB_HAVE_BFIO )
+
+LIBWTCDB_EXTERN \
+int libwtcdb_check_file_signature_file_io_handle(
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+#endif /* !defined( LIBWTCDB_HAVE_BFIO ) */
+
+/* Tests the libwtcdb_chunk_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_chunk_cache_initialize(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libwtcdb_chunk_cache_t *chunk_cache = NULL;
+	size_t chunk_size                   = 0;
+	int result                          = 0;
+
+#if defined( HAVE_WTCDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests       = 2;
+	int number_of_memset_fail_tests       = 1;
+	int test_number                       = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_chunk_cache_initialize(
+	          &chunk_cache,
+	          0,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "chunk_cache",
+	 chunk_cache );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_chunk_cache_get_chunk_size(
+	          chunk_cache,
+	          &chunk_size,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_SIZE(
+	 "chunk_size",
+	 chunk_size,
+	 (size_t) 1024 * 1024 );
+
+	result = libwtcdb_chunk_cache_free(
+	          &chunk_cache,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "chunk_cache",
+	 chunk_cache );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_chunk_cache_initialize(
+	          &chunk_cache,
+	          65536,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "chunk_cache",
+	 chunk_cache );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_chunk_cache_get_chunk_size(
+	          chunk_cache,
+	          &chunk_size,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_SIZE(
+	 "chunk_size",
+	 chunk_size,
+	 (size_t) 65536 );
+
+	result = libwtcdb_chunk_cache_free(
+	          &chunk_cache,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "chunk_cache",
+	 chunk_cache );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_chunk_cache_initialize(
+	          NULL,
+	          0,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	chunk_cache = (libwtcdb_chunk_cache_t *) 0x12345678UL;
+
+	result = libwtcdb_chunk_cache_initialize(
+	          &chunk_cache,
+	          0,
+	          &error );
+
+	chunk_cache = NULL;
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_chunk_cache_initialize(
+	          &chunk_cache,
+	          16,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "chunk_cache",
+	 chunk_cache );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_WTCDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libwtcdb_chunk_cache_initialize with malloc failing
+		 */
+		wtcdb_test_malloc_attempts_before_fail = test_number;
+
+		result = libwtcdb_chunk_cache_initialize(
+		          &chunk_cache,
+		          0,
+		          &error );
+
+		if( wtcdb_test_malloc_attempts_before_fail != -1 )
+		{
+			wtcdb_test_malloc_attempts_before_fail = -1;
+
+			if( chunk_cache != NULL )
+			{
+				libwtcdb_chunk_cache_free(
+				 &chunk_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			WTCDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			WTCDB_TEST_ASSERT_IS_NULL(
+			 "chunk_cache",
+			 chunk_cache );
+
+			WTCDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libwtcdb_chunk_cache_initialize with memset failing
+		 */
+		wtcdb_test_memset_attempts_before_fail = test_number;
+
+		result = libwtcdb_chunk_cache_initialize(
+		          &chunk_cache,
+		          0,
+		          &error );
+
+		if( wtcdb_test_memset_attempts_before_fail != -1 )
+		{
+			wtcdb_test_memset_attempts_before_fail = -1;
+
+			if( chunk_cache != NULL )
+			{
+				libwtcdb_chunk_cache_free(
+				 &chunk_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			WTCDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			WTCDB_TEST_ASSERT_IS_NULL(
+			 "chunk_cache",
+			 chunk_cache );
+
+			WTCDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_WTCDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk_cache != NULL )
+	{
+		libwtcdb_chunk_cache_free(
+		 &chunk_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_chunk_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_chunk_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libwtcdb_chunk_cache_free(
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_chunk_cache_get_number_of_sources, libwtcdb_chunk_cache_get_number_of_read_entries
+ * and libwtcdb_chunk_cache_get_number_of_reused_entries functions
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_chunk_cache_get_number_of_entries(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libwtcdb_chunk_cache_t *chunk_cache = NULL;
+	size_t chunk_size                   = 0;
+	int number_of_read_entries          = 0;
+	int number_of_reused_entries        = 0;
+	int number_of_sources               = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libwtcdb_chunk_cache_initialize(
+	          &chunk_cache,
+	          0,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "chunk_cache",
+	 chunk_cache );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_chunk_cache_get_number_of_sources(
+	          chunk_cache,
+	          &number_of_sources,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sources",
+	 number_of_sources,
+	 0 );
+
+	result = libwtcdb_chunk_cache_get_number_of_read_entries(
+	          chunk_cache,
+	          &number_of_read_entries,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_read_entries",
+	 number_of_read_entries,
+	 0 );
+
+	result = libwtcdb_chunk_cache_get_number_of_reused_entries(
+	          chunk_cache,
+	          &number_of_reused_entries,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_reused_entries",
+	 number_of_reused_entries,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_chunk_cache_get_chunk_size(
+	          NULL,
+	          &chunk_size,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_chunk_cache_get_chunk_size(
+	          chunk_cache,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_chunk_cache_get_number_of_sources(
+	          NULL,
+	          &number_of_sources,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_chunk_cache_get_number_of_sources(
+	          chunk_cache,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_chunk_cache_get_number_of_read_entries(
+	          NULL,
+	          &number_of_read_entries,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_chunk_cache_get_number_of_read_entries(
+	          chunk_cache,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_chunk_cache_get_number_of_reused_entries(
+	          NULL,
+	          &number_of_reused_entries,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_chunk_cache_get_number_of_reused_entries(
+	          chunk_cache,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwtcdb_chunk_cache_free(
+	          &chunk_cache,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "chunk_cache",
+	 chunk_cache );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk_cache != NULL )
+	{
+		libwtcdb_chunk_cache_free(
+		 &chunk_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_chunk_cache_get_maximum_number_of_sources and libwtcdb_chunk_cache_set_maximum_number_of_sources functions
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_chunk_cache_maximum_number_of_sources(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libwtcdb_chunk_cache_t *chunk_cache = NULL;
+	int maximum_number_of_sources       = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libwtcdb_chunk_cache_initialize(
+	          &chunk_cache,
+	          0,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "chunk_cache",
+	 chunk_cache );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_chunk_cache_get_maximum_number_of_sources(
+	          chunk_cache,
+	          &maximum_number_of_sources,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "maximum_number_of_sources",
+	 maximum_number_of_sources,
+	 16 );
+
+	result = libwtcdb_chunk_cache_set_maximum_number_of_sources(
+	          chunk_cache,
+	          2,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_chunk_cache_get_maximum_number_of_sources(
+	          chunk_cache,
+	          &maximum_number_of_sources,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "maximum_number_of_sources",
+	 maximum_number_of_sources,
+	 2 );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_chunk_cache_get_maximum_number_of_sources(
+	          NULL,
+	          &maximum_number_of_sources,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_chunk_cache_get_maximum_number_of_sources(
+	          chunk_cache,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_chunk_cache_set_maximum_number_of_sources(
+	          NULL,
+	          2,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_chunk_cache_set_maximum_number_of_sources(
+	          chunk_cache,
+	          0,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwtcdb_chunk_cache_free(
+	          &chunk_cache,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "chunk_cache",
+	 chunk_cache );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk_cache != NULL )
+	{
+		libwtcdb_chunk_cache_free(
+		 &chunk_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+
+/* Tests the libwtcdb_chunk_cache_source_calculate_fingerprint function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_chunk_cache_source_calculate_fingerprint(
+     void )
+{
+	uint8_t data[ 67 ];
+	uint64_t fingerprint[ 2 ];
+	uint64_t other_fingerprint[ 2 ];
+
+	libcerror_error_t *error = NULL;
+	size_t data_offset       = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < 67;
+	     data_offset++ )
+	{
+		data[ data_offset ] = (uint8_t) ( data_offset * 7 );
+	}
+	/* Test regular cases
+	 */
+	result = libwtcdb_chunk_cache_source_calculate_fingerprint(
+	          data,
+	          67,
+	          fingerprint,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_chunk_cache_source_calculate_fingerprint(
+	          data,
+	          67,
+	          other_fingerprint,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT64(
+	 "fingerprint[ 0 ]",
+	 other_fingerprint[ 0 ],
+	 fingerprint[ 0 ] );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT64(
+	 "fingerprint[ 1 ]",
+	 other_fingerprint[ 1 ],
+	 fingerprint[ 1 ] );
+
+	/* Test that a different size or a change in the trailing bytes results in a different fingerprint
+	 */
+	result = libwtcdb_chunk_cache_source_calculate_fingerprint(
+	          data,
+	          66,
+	          other_fingerprint,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "fingerprint[ 0 ]",
+	 (int64_t) other_fingerprint[ 0 ],
+	 (int64_t) fingerprint[ 0 ] );
+
+	data[ 66 ] ^= 0x01;
+
+	result = libwtcdb_chunk_cache_source_calculate_fingerprint(
+	          data,
+	          67,
+	          other_fingerprint,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	data[ 66 ] ^= 0x01;
+
+	WTCDB_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "fingerprint[ 1 ]",
+	 (int64_t) other_fingerprint[ 1 ],
+	 (int64_t) fingerprint[ 1 ] );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_chunk_cache_source_calculate_fingerprint(
+	          NULL,
+	          67,
+	          fingerprint,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_chunk_cache_source_calculate_fingerprint(
+	          data,
+	          (size_t) SSIZE_MAX + 1,
+	          fingerprint,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_chunk_cache_source_calculate_fingerprint(
+	          data,
+	          67,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_chunk_cache_source_get_entry function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_chunk_cache_source_get_entry(
+     void )
+{
+	libcerror_error_t *error                     = NULL;
+	libwtcdb_cache_entry_t *cache_entry          = NULL;
+	libwtcdb_cache_entry_t *matching_cache_entry = NULL;
+	libwtcdb_chunk_cache_source_t *other_source  = NULL;
+	libwtcdb_chunk_cache_source_t *source        = NULL;
+	int chunk_index                              = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libwtcdb_chunk_cache_source_initialize(
+	          &source,
+	          8192,
+	          4096,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "source",
+	 source );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_chunk_cache_source_initialize(
+	          &other_source,
+	          8192,
+	          4096,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "other_source",
+	 other_source );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_cache_entry_initialize(
+	          &matching_cache_entry,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "matching_cache_entry",
+	 matching_cache_entry );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	other_source->cache_entries = (libwtcdb_cache_entry_t **) memory_allocate(
+	                                                           sizeof( libwtcdb_cache_entry_t * ) );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "other_source->cache_entries",
+	 other_source->cache_entries );
+
+	other_source->cache_entries[ 0 ]      = matching_cache_entry;
+	other_source->number_of_cache_entries = 1;
+
+	for( chunk_index = 0;
+	     chunk_index < 2;
+	     chunk_index++ )
+	{
+		source->fingerprints[ chunk_index * 2 ]               = (uint64_t) chunk_index;
+		source->fingerprints[ ( chunk_index * 2 ) + 1 ]       = (uint64_t) chunk_index;
+		other_source->fingerprints[ chunk_index * 2 ]         = (uint64_t) chunk_index;
+		other_source->fingerprints[ ( chunk_index * 2 ) + 1 ] = (uint64_t) chunk_index;
+	}
+	source->matching_sources[ 0 ] = other_source;
+
+	matching_cache_entry->file_offset        = 24;
+	matching_cache_entry->cached_data_offset = 112;
+	matching_cache_entry->cached_data_size   = 8080;
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_chunk_cache_source_get_entry(
+	          source,
+	          24,
+	          0,
+	          &cache_entry,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_entry",
+	 cache_entry );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT64(
+	 "cache_entry->file_offset",
+	 (int64_t) cache_entry->file_offset,
+	 (int64_t) 24 );
+
+	/* Test with a file offset without a matching cache entry
+	 */
+	cache_entry = NULL;
+
+	result = libwtcdb_chunk_cache_source_get_entry(
+	          source,
+	          32,
+	          0,
+	          &cache_entry,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "cache_entry",
+	 cache_entry );
+
+	/* Test with cached data that exceeds the file of the source
+	 */
+	matching_cache_entry->cached_data_size = 8081;
+
+	result = libwtcdb_chunk_cache_source_get_entry(
+	          source,
+	          24,
+	          0,
+	          &cache_entry,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "cache_entry",
+	 cache_entry );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_chunk_cache_source_get_entry(
+	          NULL,
+	          24,
+	          0,
+	          &cache_entry,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_chunk_cache_source_get_entry(
+	          source,
+	          -1,
+	          0,
+	          &cache_entry,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_chunk_cache_source_get_entry(
+	          source,
+	          24,
+	          0,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwtcdb_chunk_cache_source_free(
+	          &source,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "source",
+	 source );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_chunk_cache_source_free(
+	          &other_source,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "other_source",
+	 other_source );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_cache_entry_free(
+	          &matching_cache_entry,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "matching_cache_entry",
+	 matching_cache_entry );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( source != NULL )
+	{
+		libwtcdb_chunk_cache_source_free(
+		 &source,
+		 NULL );
+	}
+	if( other_source != NULL )
+	{
+		libwtcdb_chunk_cache_source_free(
+		 &other_source,
+		 NULL );
+	}
+	if( matching_cache_entry != NULL )
+	{
+		libwtcdb_cache_entry_free(
+		 &matching_cache_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+
+/* Tests opening multiple versions of a file with a chunk cache
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_chunk_cache_open_files(
+     const system_character_t *source )
+{
+	char narrow_source[ 256 ];
+
+	libcerror_error_t *error             = NULL;
+	libwtcdb_chunk_cache_t *chunk_cache  = NULL;
+	libwtcdb_file_t *files[ 2 ]          = { NULL, NULL };
+	libwtcdb_item_t *items[ 2 ]          = { NULL, NULL };
+	uint64_t hashes[ 2 ]                 = { 0, 0 };
+	uint8_t file_type                    = 0;
+	int expected_number_of_read_entries  = 0;
+	int expected_number_of_reused_entries = 0;
+	int expected_number_of_sources       = 0;
+	int file_index                       = 0;
+	int item_index                       = 0;
+	int number_of_items[ 2 ]             = { 0, 0 };
+	int number_of_read_entries           = 0;
+	int number_of_reused_entries         = 0;
+	int number_of_sources                = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = wtcdb_test_get_narrow_source(
+	          source,
+	          narrow_source,
+	          256,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Use a small chunk size so that the entries are spread over multiple chunks
+	 */
+	result = libwtcdb_chunk_cache_initialize(
+	          &chunk_cache,
+	          4096,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "chunk_cache",
+	 chunk_cache );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( file_index = 0;
+	     file_index < 2;
+	     file_index++ )
+	{
+		result = libwtcdb_file_initialize(
+		          &( files[ file_index ] ),
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libwtcdb_file_set_chunk_cache(
+		          files[ file_index ],
+		          chunk_cache,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libwtcdb_file_open(
+		          files[ file_index ],
+		          narrow_source,
+		          LIBWTCDB_OPEN_READ,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libwtcdb_file_get_number_of_items(
+		          files[ file_index ],
+		          &( number_of_items[ file_index ] ),
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libwtcdb_file_get_type(
+	          files[ 0 ],
+	          &file_type,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Only cache files are read with the chunk cache, the entries of the second
+	 * file are all reused since it is the same as the first file
+	 */
+	if( file_type == LIBWTCDB_FILE_TYPE_CACHE )
+	{
+		expected_number_of_sources        = 2;
+		expected_number_of_read_entries   = number_of_items[ 0 ];
+		expected_number_of_reused_entries = number_of_items[ 1 ];
+	}
+	result = libwtcdb_chunk_cache_get_number_of_sources(
+	          chunk_cache,
+	          &number_of_sources,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sources",
+	 number_of_sources,
+	 expected_number_of_sources );
+
+	result = libwtcdb_chunk_cache_get_number_of_read_entries(
+	          chunk_cache,
+	          &number_of_read_entries,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_read_entries",
+	 number_of_read_entries,
+	 expected_number_of_read_entries );
+
+	result = libwtcdb_chunk_cache_get_number_of_reused_entries(
+	          chunk_cache,
+	          &number_of_reused_entries,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_reused_entries",
+	 number_of_reused_entries,
+	 expected_number_of_reused_entries );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_items[ 1 ]",
+	 number_of_items[ 1 ],
+	 number_of_items[ 0 ] );
+
+	for( item_index = 0;
+	     item_index < number_of_items[ 0 ];
+	     item_index++ )
+	{
+		for( file_index = 0;
+		     file_index < 2;
+		     file_index++ )
+		{
+			result = libwtcdb_file_get_item(
+			          files[ file_index ],
+			          item_index,
+			          &( items[ file_index ] ),
+			          &error );
+
+			WTCDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			WTCDB_TEST_ASSERT_IS_NOT_NULL(
+			 "items[ file_index ]",
+			 items[ file_index ] );
+
+			WTCDB_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libwtcdb_item_get_hash(
+			          items[ file_index ],
+			          &( hashes[ file_index ] ),
+			          &error );
+
+			WTCDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			WTCDB_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libwtcdb_item_free(
+			          &( items[ file_index ] ),
+			          &error );
+
+			WTCDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			WTCDB_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		WTCDB_TEST_ASSERT_EQUAL_UINT64(
+		 "hashes[ 1 ]",
+		 hashes[ 1 ],
+		 hashes[ 0 ] );
+	}
+	/* Test that the oldest sources are removed when the maximum number of sources is exceeded
+	 */
+	result = libwtcdb_chunk_cache_set_maximum_number_of_sources(
+	          chunk_cache,
+	          1,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_file_close(
+	          files[ 0 ],
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_file_open(
+	          files[ 0 ],
+	          narrow_source,
+	          LIBWTCDB_OPEN_READ,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( file_type == LIBWTCDB_FILE_TYPE_CACHE )
+	{
+		expected_number_of_sources = 1;
+	}
+	result = libwtcdb_chunk_cache_get_number_of_sources(
+	          chunk_cache,
+	          &number_of_sources,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sources",
+	 number_of_sources,
+	 expected_number_of_sources );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_file_set_chunk_cache(
+	          NULL,
+	          chunk_cache,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	for( file_index = 0;
+	     file_index < 2;
+	     file_index++ )
+	{
+		result = libwtcdb_file_close(
+		          files[ file_index ],
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libwtcdb_file_free(
+		          &( files[ file_index ] ),
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "files[ file_index ]",
+		 files[ file_index ] );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libwtcdb_chunk_cache_free(
+	          &chunk_cache,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "chunk_cache",
+	 chunk_cache );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( file_index = 0;
+	     file_index < 2;
+	     file_index++ )
+	{
+		if( items[ file_index ] != NULL )
+		{
+			libwtcdb_item_free(
+			 &( items[ file_index ] ),
+			 NULL );
+		}
+		if( files[ file_index ] != NULL )
+		{
+			libwtcdb_file_free(
+			 &( files[ file_index ] ),
+			 NULL );
+		}
+	}
+	if( chunk_cache != NULL )
+	{
+		libwtcdb_chunk_cache_free(
+		 &chunk_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	system_character_t *source       = NULL;
+	system_integer_t option          = 0;
+	size_t string_length             = 0;
+	int result                       = 0;
+
+	while( ( option = wtcdb_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
+	WTCDB_TEST_RUN(
+	 "libwtcdb_chunk_cache_initialize",
+	 wtcdb_test_chunk_cache_initialize );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_chunk_cache_free",
+	 wtcdb_test_chunk_cache_free );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_chunk_cache_get_number_of_entries",
+	 wtcdb_test_chunk_cache_get_number_of_entries );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_chunk_cache_maximum_number_of_sources",
+	 wtcdb_test_chunk_cache_maximum_number_of_sources );
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_chunk_cache_source_calculate_fingerprint",
+	 wtcdb_test_chunk_cache_source_calculate_fingerprint );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_chunk_cache_source_get_entry",
+	 wtcdb_test_chunk_cache_source_get_entry );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+	if( source != NULL )
+	{
+		result = libbfio_file_initialize(
+		          &file_io_handle,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NOT_NULL(
+		 "file_io_handle",
+		 file_io_handle );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		string_length = system_string_length(
+		                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libbfio_file_set_name_wide(
+		          file_io_handle,
+		          source,
+		          string_length,
+		          &error );
+#else
+		result = libbfio_file_set_name(
+		          file_io_handle,
+		          source,
+		          string_length,
+		          &error );
+#endif
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libwtcdb_check_file_signature_file_io_handle(
+		          file_io_handle,
+		          &error );
+
+		WTCDB_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	if( result != 0 )
+	{
+		WTCDB_TEST_RUN_WITH_ARGS(
+		 "libwtcdb_chunk_cache_open_files",
+		 wtcdb_test_chunk_cache_open_files,
+		 source );
+	}
+	if( file_io_handle != NULL )
+	{
+		result = libbfio_handle_free(
+		          &file_io_handle,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "file_io_handle",
+		 file_io_handle );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1705 @@
+/*
+ * Library diff type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "wtcdb_test_functions.h"
+#include "wtcdb_test_getopt.h"
+#include "wtcdb_test_libbfio.h"
+#include "wtcdb_test_libcerror.h"
+#include "wtcdb_test_libwtcdb.h"
+#include "wtcdb_test_macros.h"
+#include "wtcdb_test_memory.h"
+#include "wtcdb_test_unused.h"
+
+#include "../libwtcdb/libwtcdb_diff.h"
+
+#if !defined( LIBWTCDB_HAVE_BFIO )
+
+LIBWTCDB_EXTERN \
+int libwtcdb_check_file_signature_file_io_handle(
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+LIBWTCDB_EXTERN \
+int libwtcdb_file_open_file_io_handle(
+     libwtcdb_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libwtcdb_error_t **error );
+
+#endif /* !defined( LIBWTCDB_HAVE_BFIO ) */
+
+/* The size of the synthetic cache files
+ */
+#define WTCDB_TEST_DIFF_FILE_DATA_SIZE		1024
+
+typedef struct wtcdb_test_diff_entry wtcdb_test_diff_entry_t;
+
+/* A cache entry of a synthetic cache file
+ */
+struct wtcdb_test_diff_entry
+{
+	/* The entry hash
+	 */
+	uint64_t hash;
+
+	/* The data checksum
+	 */
+	uint64_t data_checksum;
+
+	/* The cached data, which consists of 8 bytes
+	 */
+	const char *data;
+};
+
+/* The entries of the old version of the synthetic cache file
+ * 0x30 and 0x60 are duplicate hashes
+ */
+wtcdb_test_diff_entry_t wtcdb_test_diff_old_entries[ 6 ] = {
+	{ 0x40, 1, "dddddddd" },
+	{ 0x10, 1, "aaaaaaaa" },
+	{ 0x30, 1, "cccccccc" },
+	{ 0x20, 1, "bbbbbbbb" },
+	{ 0x30, 1, "cccc1111" },
+	{ 0x60, 1, "ffffffff" } };
+
+/* The entries of the new version of the synthetic cache file
+ * The second entry with hash 0x30 only differs in its data
+ */
+wtcdb_test_diff_entry_t wtcdb_test_diff_new_entries[ 7 ] = {
+	{ 0x60, 1, "ffffffff" },
+	{ 0x50, 1, "eeeeeeee" },
+	{ 0x30, 1, "cccccccc" },
+	{ 0x20, 1, "bbbbbbbb" },
+	{ 0x40, 2, "dddddddd" },
+	{ 0x30, 1, "cccc2222" },
+	{ 0x60, 1, "ffffffff" } };
+
+/* The changes expected without and with comparing the data
+ */
+libwtcdb_diff_change_t wtcdb_test_diff_expected_changes[ 5 ] = {
+	{ 0x10, 1, -1, LIBWTCDB_CHANGE_TYPE_REMOVED },
+	{ 0x30, 4, 5, LIBWTCDB_CHANGE_TYPE_MODIFIED },
+	{ 0x40, 0, 4, LIBWTCDB_CHANGE_TYPE_MODIFIED },
+	{ 0x50, -1, 1, LIBWTCDB_CHANGE_TYPE_ADDED },
+	{ 0x60, -1, 6, LIBWTCDB_CHANGE_TYPE_ADDED } };
+
+/* Builds a Windows 7 cache file from synthetic cache entries
+ * Returns the size of the file or 0 on error
+ */
+size_t wtcdb_test_diff_build_file(
+        wtcdb_test_diff_entry_t *entries,
+        int number_of_entries,
+        uint8_t *data,
+        size_t data_size )
+{
+	size_t data_offset = 24;
+	int entry_index    = 0;
+
+	if( ( data_offset + ( (size_t) number_of_entries * 56 ) ) > data_size )
+	{
+		return( 0 );
+	}
+	memory_set(
+	 data,
+	 0,
+	 data_size );
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		memory_copy(
+		 &( data[ data_offset ] ),
+		 "CMMM",
+		 4 );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( data[ data_offset + 4 ] ),
+		 56 );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( data[ data_offset + 8 ] ),
+		 entries[ entry_index ].hash );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( data[ data_offset + 24 ] ),
+		 8 );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( data[ data_offset + 32 ] ),
+		 entries[ entry_index ].data_checksum );
+
+		memory_copy(
+		 &( data[ data_offset + 48 ] ),
+		 entries[ entry_index ].data,
+		 8 );
+
+		data_offset += 56;
+	}
+	memory_copy(
+	 data,
+	 "CMMM",
+	 4 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 4 ] ),
+	 21 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 8 ] ),
+	 1 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 12 ] ),
+	 24 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 16 ] ),
+	 (uint32_t) data_offset );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 20 ] ),
+	 (uint32_t) number_of_entries );
+
+	return( data_offset );
+}
+
+/* Tests the libwtcdb_diff_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_diff_initialize(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libwtcdb_diff_t *diff    = NULL;
+	int result               = 0;
+
+#if defined( HAVE_WTCDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_diff_initialize(
+	          &diff,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "diff",
+	 diff );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_diff_free(
+	          &diff,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "diff",
+	 diff );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_diff_initialize(
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	diff = (libwtcdb_diff_t *) 0x12345678UL;
+
+	result = libwtcdb_diff_initialize(
+	          &diff,
+	          &error );
+
+	diff = NULL;
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_WTCDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libwtcdb_diff_initialize with malloc failing
+		 */
+		wtcdb_test_malloc_attempts_before_fail = test_number;
+
+		result = libwtcdb_diff_initialize(
+		          &diff,
+		          &error );
+
+		if( wtcdb_test_malloc_attempts_before_fail != -1 )
+		{
+			wtcdb_test_malloc_attempts_before_fail = -1;
+
+			if( diff != NULL )
+			{
+				libwtcdb_diff_free(
+				 &diff,
+				 NULL );
+			}
+		}
+		else
+		{
+			WTCDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			WTCDB_TEST_ASSERT_IS_NULL(
+			 "diff",
+			 diff );
+
+			WTCDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libwtcdb_diff_initialize with memset failing
+		 */
+		wtcdb_test_memset_attempts_before_fail = test_number;
+
+		result = libwtcdb_diff_initialize(
+		          &diff,
+		          &error );
+
+		if( wtcdb_test_memset_attempts_before_fail != -1 )
+		{
+			wtcdb_test_memset_attempts_before_fail = -1;
+
+			if( diff != NULL )
+			{
+				libwtcdb_diff_free(
+				 &diff,
+				 NULL );
+			}
+		}
+		else
+		{
+			WTCDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			WTCDB_TEST_ASSERT_IS_NULL(
+			 "diff",
+			 diff );
+
+			WTCDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_WTCDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( diff != NULL )
+	{
+		libwtcdb_diff_free(
+		 &diff,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_diff_free function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_diff_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libwtcdb_diff_free(
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+
+/* Tests the libwtcdb_diff_get_number_of_changes and libwtcdb_diff_get_change functions
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_diff_get_change(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libwtcdb_diff_t *diff    = NULL;
+	uint64_t hash            = 0;
+	uint8_t change_type      = 0;
+	int new_item_index       = 0;
+	int number_of_changes    = 0;
+	int old_item_index       = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libwtcdb_diff_initialize(
+	          &diff,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_diff_get_number_of_changes(
+	          diff,
+	          &number_of_changes,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_changes",
+	 number_of_changes,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_internal_diff_append_change(
+	          (libwtcdb_internal_diff_t *) diff,
+	          LIBWTCDB_CHANGE_TYPE_REMOVED,
+	          0x0123456789abcdefUL,
+	          3,
+	          -1,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_internal_diff_append_change(
+	          (libwtcdb_internal_diff_t *) diff,
+	          LIBWTCDB_CHANGE_TYPE_MODIFIED,
+	          0x89abcdef01234567UL,
+	          5,
+	          7,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_diff_get_number_of_changes(
+	          diff,
+	          &number_of_changes,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_changes",
+	 number_of_changes,
+	 2 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_diff_get_change(
+	          diff,
+	          1,
+	          &change_type,
+	          &hash,
+	          &old_item_index,
+	          &new_item_index,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT8(
+	 "change_type",
+	 change_type,
+	 LIBWTCDB_CHANGE_TYPE_MODIFIED );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT64(
+	 "hash",
+	 hash,
+	 (uint64_t) 0x89abcdef01234567UL );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "old_item_index",
+	 old_item_index,
+	 5 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "new_item_index",
+	 new_item_index,
+	 7 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_diff_get_number_of_changes(
+	          NULL,
+	          &number_of_changes,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_diff_get_number_of_changes(
+	          diff,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_diff_get_change(
+	          NULL,
+	          0,
+	          &change_type,
+	          &hash,
+	          &old_item_index,
+	          &new_item_index,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_diff_get_change(
+	          diff,
+	          -1,
+	          &change_type,
+	          &hash,
+	          &old_item_index,
+	          &new_item_index,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_diff_get_change(
+	          diff,
+	          2,
+	          &change_type,
+	          &hash,
+	          &old_item_index,
+	          &new_item_index,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_diff_get_change(
+	          diff,
+	          0,
+	          NULL,
+	          &hash,
+	          &old_item_index,
+	          &new_item_index,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_diff_get_change(
+	          diff,
+	          0,
+	          &change_type,
+	          NULL,
+	          &old_item_index,
+	          &new_item_index,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_diff_get_change(
+	          diff,
+	          0,
+	          &change_type,
+	          &hash,
+	          NULL,
+	          &new_item_index,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_diff_get_change(
+	          diff,
+	          0,
+	          &change_type,
+	          &hash,
+	          &old_item_index,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_internal_diff_append_change(
+	          NULL,
+	          LIBWTCDB_CHANGE_TYPE_ADDED,
+	          0,
+	          -1,
+	          0,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwtcdb_diff_free(
+	          &diff,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( diff != NULL )
+	{
+		libwtcdb_diff_free(
+		 &diff,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+
+/* Tests the libwtcdb_diff_compare_files function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_diff_compare_files(
+     const system_character_t *source )
+{
+	char narrow_source[ 256 ];
+
+	libcerror_error_t *error       = NULL;
+	libwtcdb_diff_t *diff          = NULL;
+	libwtcdb_file_t *files[ 2 ]    = { NULL, NULL };
+	libwtcdb_file_t *unopened_file = NULL;
+	uint8_t file_type              = 0;
+	int expected_result            = 0;
+	int file_index                 = 0;
+	int number_of_changes          = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = wtcdb_test_get_narrow_source(
+	          source,
+	          narrow_source,
+	          256,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( file_index = 0;
+	     file_index < 2;
+	     file_index++ )
+	{
+		result = libwtcdb_file_initialize(
+		          &( files[ file_index ] ),
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libwtcdb_file_open(
+		          files[ file_index ],
+		          narrow_source,
+		          LIBWTCDB_OPEN_READ,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libwtcdb_file_get_type(
+	          files[ 0 ],
+	          &file_type,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_file_initialize(
+	          &unopened_file,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_diff_initialize(
+	          &diff,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Only cache files can be compared
+	 */
+	if( file_type == LIBWTCDB_FILE_TYPE_CACHE )
+	{
+		expected_result = 1;
+	}
+	else
+	{
+		expected_result = -1;
+	}
+	/* Test regular cases
+	 */
+	result = libwtcdb_diff_compare_files(
+	          diff,
+	          files[ 0 ],
+	          files[ 1 ],
+	          0,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 expected_result );
+
+	if( expected_result == 1 )
+	{
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Both files contain the same items, hence there are no changes
+		 */
+		result = libwtcdb_diff_get_number_of_changes(
+		          diff,
+		          &number_of_changes,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "number_of_changes",
+		 number_of_changes,
+		 0 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libwtcdb_diff_compare_files(
+		          diff,
+		          files[ 0 ],
+		          files[ 1 ],
+		          LIBWTCDB_DIFF_FLAG_COMPARE_DATA,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libwtcdb_diff_get_number_of_changes(
+		          diff,
+		          &number_of_changes,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "number_of_changes",
+		 number_of_changes,
+		 0 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	else
+	{
+		WTCDB_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test error cases
+	 */
+	result = libwtcdb_diff_compare_files(
+	          NULL,
+	          files[ 0 ],
+	          files[ 1 ],
+	          0,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_diff_compare_files(
+	          diff,
+	          NULL,
+	          files[ 1 ],
+	          0,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_diff_compare_files(
+	          diff,
+	          files[ 0 ],
+	          NULL,
+	          0,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_diff_compare_files(
+	          diff,
+	          files[ 0 ],
+	          unopened_file,
+	          0,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_diff_compare_files(
+	          diff,
+	          files[ 0 ],
+	          files[ 1 ],
+	          0xff,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwtcdb_diff_free(
+	          &diff,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_file_free(
+	          &unopened_file,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( file_index = 0;
+	     file_index < 2;
+	     file_index++ )
+	{
+		result = libwtcdb_file_close(
+		          files[ file_index ],
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libwtcdb_file_free(
+		          &( files[ file_index ] ),
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( diff != NULL )
+	{
+		libwtcdb_diff_free(
+		 &diff,
+		 NULL );
+	}
+	if( unopened_file != NULL )
+	{
+		libwtcdb_file_free(
+		 &unopened_file,
+		 NULL );
+	}
+	for( file_index = 0;
+	     file_index < 2;
+	     file_index++ )
+	{
+		if( files[ file_index ] != NULL )
+		{
+			libwtcdb_file_free(
+			 &( files[ file_index ] ),
+			 NULL );
+		}
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_diff_compare_files function on synthetic cache files
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_diff_compare_files_with_changes(
+     void )
+{
+	uint8_t file_data[ 2 ][ WTCDB_TEST_DIFF_FILE_DATA_SIZE ];
+
+	libbfio_handle_t *file_io_handles[ 2 ] = { NULL, NULL };
+	libcerror_error_t *error               = NULL;
+	libwtcdb_diff_t *diff                  = NULL;
+	libwtcdb_file_t *files[ 2 ]            = { NULL, NULL };
+	uint64_t hash                          = 0;
+	size_t file_data_size[ 2 ]             = { 0, 0 };
+	uint8_t change_type                    = 0;
+	uint8_t flags                          = 0;
+	int change_index                       = 0;
+	int expected_change_index              = 0;
+	int expected_number_of_changes         = 0;
+	int file_index                         = 0;
+	int new_item_index                     = 0;
+	int number_of_changes                  = 0;
+	int old_item_index                     = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	file_data_size[ 0 ] = wtcdb_test_diff_build_file(
+	                       wtcdb_test_diff_old_entries,
+	                       6,
+	                       file_data[ 0 ],
+	                       WTCDB_TEST_DIFF_FILE_DATA_SIZE );
+
+	WTCDB_TEST_ASSERT_EQUAL_SIZE(
+	 "file_data_size[ 0 ]",
+	 file_data_size[ 0 ],
+	 (size_t) 360 );
+
+	file_data_size[ 1 ] = wtcdb_test_diff_build_file(
+	                       wtcdb_test_diff_new_entries,
+	                       7,
+	                       file_data[ 1 ],
+	                       WTCDB_TEST_DIFF_FILE_DATA_SIZE );
+
+	WTCDB_TEST_ASSERT_EQUAL_SIZE(
+	 "file_data_size[ 1 ]",
+	 file_data_size[ 1 ],
+	 (size_t) 416 );
+
+	for( file_index = 0;
+	     file_index < 2;
+	     file_index++ )
+	{
+		result = wtcdb_test_open_file_io_handle(
+		          &( file_io_handles[ file_index ] ),
+		          file_data[ file_index ],
+		          file_data_size[ file_index ],
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libwtcdb_file_initialize(
+		          &( files[ file_index ] ),
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libwtcdb_file_open_file_io_handle(
+		          files[ file_index ],
+		          file_io_handles[ file_index ],
+		          LIBWTCDB_OPEN_READ,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libwtcdb_diff_initialize(
+	          &diff,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * Without comparing the data the change of the duplicate hash 0x30 is not detected
+	 */
+	for( flags = 0;
+	     flags <= LIBWTCDB_DIFF_FLAG_COMPARE_DATA;
+	     flags++ )
+	{
+		result = libwtcdb_diff_compare_files(
+		          diff,
+		          files[ 0 ],
+		          files[ 1 ],
+		          flags,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( flags == 0 )
+		{
+			expected_number_of_changes = 4;
+		}
+		else
+		{
+			expected_number_of_changes = 5;
+		}
+		result = libwtcdb_diff_get_number_of_changes(
+		          diff,
+		          &number_of_changes,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "number_of_changes",
+		 number_of_changes,
+		 expected_number_of_changes );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		expected_change_index = 0;
+
+		for( change_index = 0;
+		     change_index < number_of_changes;
+		     change_index++ )
+		{
+			if( ( flags == 0 )
+			 && ( expected_change_index == 1 ) )
+			{
+				expected_change_index++;
+			}
+			result = libwtcdb_diff_get_change(
+			          diff,
+			          change_index,
+			          &change_type,
+			          &hash,
+			          &old_item_index,
+			          &new_item_index,
+			          &error );
+
+			WTCDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			WTCDB_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			WTCDB_TEST_ASSERT_EQUAL_UINT8(
+			 "change_type",
+			 change_type,
+			 wtcdb_test_diff_expected_changes[ expected_change_index ].change_type );
+
+			WTCDB_TEST_ASSERT_EQUAL_UINT64(
+			 "hash",
+			 hash,
+			 wtcdb_test_diff_expected_changes[ expected_change_index ].hash );
+
+			WTCDB_TEST_ASSERT_EQUAL_INT(
+			 "old_item_index",
+			 old_item_index,
+			 wtcdb_test_diff_expected_changes[ expected_change_index ].old_item_index );
+
+			WTCDB_TEST_ASSERT_EQUAL_INT(
+			 "new_item_index",
+			 new_item_index,
+			 wtcdb_test_diff_expected_changes[ expected_change_index ].new_item_index );
+
+			expected_change_index++;
+		}
+	}
+	/* Test that comparing a file with itself results in no changes
+	 */
+	result = libwtcdb_diff_compare_files(
+	          diff,
+	          files[ 1 ],
+	          files[ 1 ],
+	          LIBWTCDB_DIFF_FLAG_COMPARE_DATA,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_diff_get_number_of_changes(
+	          diff,
+	          &number_of_changes,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_changes",
+	 number_of_changes,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libwtcdb_diff_free(
+	          &diff,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( file_index = 0;
+	     file_index < 2;
+	     file_index++ )
+	{
+		result = libwtcdb_file_close(
+		          files[ file_index ],
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libwtcdb_file_free(
+		          &( files[ file_index ] ),
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = wtcdb_test_close_file_io_handle(
+		          &( file_io_handles[ file_index ] ),
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( diff != NULL )
+	{
+		libwtcdb_diff_free(
+		 &diff,
+		 NULL );
+	}
+	for( file_index = 0;
+	     file_index < 2;
+	     file_index++ )
+	{
+		if( files[ file_index ] != NULL )
+		{
+			libwtcdb_file_free(
+			 &( files[ file_index ] ),
+			 NULL );
+		}
+		if( file_io_handles[ file_index ] != NULL )
+		{
+			libbfio_handle_free(
+			 &( file_io_handles[ file_index ] ),
+			 NULL );
+		}
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	system_character_t *source       = NULL;
+	system_integer_t option          = 0;
+	size_t string_length             = 0;
+	int result                       = 0;
+
+	while( ( option = wtcdb_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
+	WTCDB_TEST_RUN(
+	 "libwtcdb_diff_initialize",
+	 wtcdb_test_diff_initialize );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_diff_free",
+	 wtcdb_test_diff_free );
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_diff_get_change",
+	 wtcdb_test_diff_get_change );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_diff_compare_files",
+	 wtcdb_test_diff_compare_files_with_changes );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+	if( source != NULL )
+	{
+		result = libbfio_file_initialize(
+		          &file_io_handle,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NOT_NULL(
+		 "file_io_handle",
+		 file_io_handle );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		string_length = system_string_length(
+		                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libbfio_file_set_name_wide(
+		          file_io_handle,
+		          source,
+		          string_length,
+		          &error );
+#else
+		result = libbfio_file_set_name(
+		          file_io_handle,
+		          source,
+		          string_length,
+		          &error );
+#endif
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libwtcdb_check_file_signature_file_io_handle(
+		          file_io_handle,
+		          &error );
+
+		WTCDB_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	if( result != 0 )
+	{
+		WTCDB_TEST_RUN_WITH_ARGS(
+		 "libwtcdb_diff_compare_files",
+		 wtcdb_test_diff_compare_files,
+		 source );
+	}
+	if( file_io_handle != NULL )
+	{
+		result = libbfio_handle_free(
+		          &file_io_handle,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "file_io_handle",
+		 file_io_handle );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1754 @@
+/*
+ * Library entries_reader type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "wtcdb_test_functions.h"
+#include "wtcdb_test_libbfio.h"
+#include "wtcdb_test_libcerror.h"
+#include "wtcdb_test_libwtcdb.h"
+#include "wtcdb_test_macros.h"
+#include "wtcdb_test_memory.h"
+#include "wtcdb_test_unused.h"
+
+#include "../libwtcdb/libwtcdb_cache_entry.h"
+#include "../libwtcdb/libwtcdb_entries_reader.h"
+#include "../libwtcdb/libwtcdb_index_entry.h"
+#include "../libwtcdb/libwtcdb_io_handle.h"
+#include "../libwtcdb/libwtcdb_libcdata.h"
+#include "../libwtcdb/libwtcdb_progress.h"
+
+/* Windows Vista cache entry
+ */
+uint8_t wtcdb_test_entries_reader_data1[ 88 ] = {
+	0x43, 0x4d, 0x4d, 0x4d, 0x58, 0x00, 0x00, 0x00, 0x16, 0xd7, 0xf9, 0x93, 0xb2, 0x27, 0x26, 0xd5,
+	0x6c, 0x00, 0x6e, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x74, 0xf9, 0xe6, 0x9c, 0x7c, 0x32, 0x07, 0xf0, 0x35, 0x00, 0x33, 0x00, 0x36, 0x00, 0x31, 0x00,
+	0x38, 0x00, 0x64, 0x00, 0x61, 0x00, 0x38, 0x00, 0x32, 0x00, 0x62, 0x00, 0x65, 0x00, 0x64, 0x00,
+	0x37, 0x00, 0x38, 0x00, 0x66, 0x00, 0x62, 0x00 };
+
+/* Windows 7 index entry
+ */
+uint8_t wtcdb_test_entries_reader_data2[ 32 ] = {
+	0x2b, 0x0d, 0x06, 0xc0, 0x7b, 0x75, 0x1e, 0xa1, 0x02, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0x17, 0x80, 0x67, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff };
+
+/* The number of copies of the cache entry used to test reading with multiple tasks
+ */
+#define WTCDB_TEST_ENTRIES_READER_NUMBER_OF_ENTRIES	130
+
+/* The number of copies of the index entry used to test reading with multiple tasks
+ */
+#define WTCDB_TEST_ENTRIES_READER_NUMBER_OF_INDEX_ENTRIES	9000
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+
+/* Test progress callback
+ * Returns 1 to continue
+ */
+int wtcdb_test_entries_reader_progress_callback(
+     int phase WTCDB_TEST_ATTRIBUTE_UNUSED,
+     uint64_t bytes_scanned WTCDB_TEST_ATTRIBUTE_UNUSED,
+     uint64_t file_size WTCDB_TEST_ATTRIBUTE_UNUSED,
+     int number_of_entries WTCDB_TEST_ATTRIBUTE_UNUSED,
+     void *user_data WTCDB_TEST_ATTRIBUTE_UNUSED )
+{
+	WTCDB_TEST_UNREFERENCED_PARAMETER( phase )
+	WTCDB_TEST_UNREFERENCED_PARAMETER( bytes_scanned )
+	WTCDB_TEST_UNREFERENCED_PARAMETER( file_size )
+	WTCDB_TEST_UNREFERENCED_PARAMETER( number_of_entries )
+	WTCDB_TEST_UNREFERENCED_PARAMETER( user_data )
+
+	return( 1 );
+}
+
+/* Tests the libwtcdb_entries_reader_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_entries_reader_initialize(
+     void )
+{
+	libcerror_error_t *error                  = NULL;
+	libwtcdb_entries_reader_t *entries_reader = NULL;
+	libwtcdb_io_handle_t *io_handle           = NULL;
+	int result                                = 0;
+
+#if defined( HAVE_WTCDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests           = 1;
+	int number_of_memset_fail_tests           = 1;
+	int test_number                           = 0;
+#endif
+
+	/* Initialize test
+	 */
+	result = libwtcdb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_entries_reader_initialize(
+	          &entries_reader,
+	          io_handle,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "entries_reader",
+	 entries_reader );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_entries_reader_free(
+	          &entries_reader,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "entries_reader",
+	 entries_reader );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_entries_reader_initialize(
+	          NULL,
+	          io_handle,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	entries_reader = (libwtcdb_entries_reader_t *) 0x12345678UL;
+
+	result = libwtcdb_entries_reader_initialize(
+	          &entries_reader,
+	          io_handle,
+	          NULL,
+	          &error );
+
+	entries_reader = NULL;
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_entries_reader_initialize(
+	          &entries_reader,
+	          NULL,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_WTCDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libwtcdb_entries_reader_initialize with malloc failing
+		 */
+		wtcdb_test_malloc_attempts_before_fail = test_number;
+
+		result = libwtcdb_entries_reader_initialize(
+		          &entries_reader,
+		          io_handle,
+		          NULL,
+		          &error );
+
+		if( wtcdb_test_malloc_attempts_before_fail != -1 )
+		{
+			wtcdb_test_malloc_attempts_before_fail = -1;
+
+			if( entries_reader != NULL )
+			{
+				libwtcdb_entries_reader_free(
+				 &entries_reader,
+				 NULL );
+			}
+		}
+		else
+		{
+			WTCDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			WTCDB_TEST_ASSERT_IS_NULL(
+			 "entries_reader",
+			 entries_reader );
+
+			WTCDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libwtcdb_entries_reader_initialize with memset failing
+		 */
+		wtcdb_test_memset_attempts_before_fail = test_number;
+
+		result = libwtcdb_entries_reader_initialize(
+		          &entries_reader,
+		          io_handle,
+		          NULL,
+		          &error );
+
+		if( wtcdb_test_memset_attempts_before_fail != -1 )
+		{
+			wtcdb_test_memset_attempts_before_fail = -1;
+
+			if( entries_reader != NULL )
+			{
+				libwtcdb_entries_reader_free(
+				 &entries_reader,
+				 NULL );
+			}
+		}
+		else
+		{
+			WTCDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			WTCDB_TEST_ASSERT_IS_NULL(
+			 "entries_reader",
+			 entries_reader );
+
+			WTCDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_WTCDB_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libwtcdb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( entries_reader != NULL )
+	{
+		libwtcdb_entries_reader_free(
+		 &entries_reader,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libwtcdb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_entries_reader_free function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_entries_reader_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libwtcdb_entries_reader_free(
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_entries_reader_check_cache_entry_header function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_entries_reader_check_cache_entry_header(
+     void )
+{
+	uint8_t data[ 88 ];
+
+	libcerror_error_t *error                  = NULL;
+	libwtcdb_entries_reader_t *entries_reader = NULL;
+	libwtcdb_io_handle_t *io_handle           = NULL;
+	uint32_t cache_entry_size                 = 0;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	result = libwtcdb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->file_type      = LIBWTCDB_FILE_TYPE_CACHE;
+	io_handle->format_version = 20;
+
+	result = libwtcdb_entries_reader_initialize(
+	          &entries_reader,
+	          io_handle,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_entries_reader_check_cache_entry_header(
+	          entries_reader,
+	          wtcdb_test_entries_reader_data1,
+	          88,
+	          &cache_entry_size,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT32(
+	 "cache_entry_size",
+	 cache_entry_size,
+	 (uint32_t) 88 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a size that does not match the identifier, padding and data sizes
+	 */
+	result = memory_copy(
+	          data,
+	          wtcdb_test_entries_reader_data1,
+	          88 ) != NULL;
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	data[ 4 ] = 0x60;
+
+	result = libwtcdb_entries_reader_check_cache_entry_header(
+	          entries_reader,
+	          data,
+	          88,
+	          &cache_entry_size,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a header checksum that does not match
+	 */
+	data[ 4 ]  = 0x58;
+	data[ 48 ] = 0x01;
+
+	result = libwtcdb_entries_reader_check_cache_entry_header(
+	          entries_reader,
+	          data,
+	          88,
+	          &cache_entry_size,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_entries_reader_check_cache_entry_header(
+	          NULL,
+	          wtcdb_test_entries_reader_data1,
+	          88,
+	          &cache_entry_size,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_entries_reader_check_cache_entry_header(
+	          entries_reader,
+	          NULL,
+	          88,
+	          &cache_entry_size,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_entries_reader_check_cache_entry_header(
+	          entries_reader,
+	          wtcdb_test_entries_reader_data1,
+	          8,
+	          &cache_entry_size,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_entries_reader_check_cache_entry_header(
+	          entries_reader,
+	          wtcdb_test_entries_reader_data1,
+	          88,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwtcdb_entries_reader_free(
+	          &entries_reader,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( entries_reader != NULL )
+	{
+		libwtcdb_entries_reader_free(
+		 &entries_reader,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libwtcdb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_entries_reader_scan_cache_entry_offsets function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_entries_reader_scan_cache_entry_offsets(
+     void )
+{
+	int number_of_regions[ 4 ] = { 1, 2, 3, 7 };
+
+	libbfio_handle_t *file_io_handle          = NULL;
+	libcerror_error_t *error                  = NULL;
+	libwtcdb_entries_reader_t *entries_reader = NULL;
+	libwtcdb_io_handle_t *io_handle           = NULL;
+	libwtcdb_progress_t *progress             = NULL;
+	uint8_t *data                             = NULL;
+	size_t data_size                          = 0;
+	int entry_index                           = 0;
+	int result                                = 0;
+	int test_index                            = 0;
+
+	/* Initialize test
+	 */
+	data_size = 88 * WTCDB_TEST_ENTRIES_READER_NUMBER_OF_ENTRIES;
+
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	for( entry_index = 0;
+	     entry_index < WTCDB_TEST_ENTRIES_READER_NUMBER_OF_ENTRIES;
+	     entry_index++ )
+	{
+		result = memory_copy(
+		          &( data[ entry_index * 88 ] ),
+		          wtcdb_test_entries_reader_data1,
+		          88 ) != NULL;
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	result = libwtcdb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->file_type      = LIBWTCDB_FILE_TYPE_CACHE;
+	io_handle->format_version = 20;
+
+	/* The progress file size exceeds the data size so that bytes reported more than once are detected
+	 */
+	result = libwtcdb_progress_initialize(
+	          &progress,
+	          &wtcdb_test_entries_reader_progress_callback,
+	          NULL,
+	          0,
+	          (uint64_t) data_size * 2,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->progress = progress;
+
+	result = wtcdb_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          data_size,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( test_index = 0;
+	     test_index < 4;
+	     test_index++ )
+	{
+		progress->bytes_scanned = 0;
+
+		result = libwtcdb_entries_reader_initialize(
+		          &entries_reader,
+		          io_handle,
+		          file_io_handle,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libwtcdb_entries_reader_scan_cache_entry_offsets(
+		          entries_reader,
+		          0,
+		          number_of_regions[ test_index ],
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "entries_reader->number_of_entry_offsets",
+		 entries_reader->number_of_entry_offsets,
+		 WTCDB_TEST_ENTRIES_READER_NUMBER_OF_ENTRIES );
+
+		for( entry_index = 0;
+		     entry_index < WTCDB_TEST_ENTRIES_READER_NUMBER_OF_ENTRIES;
+		     entry_index++ )
+		{
+			WTCDB_TEST_ASSERT_EQUAL_INT64(
+			 "entries_reader->entry_offsets[ entry_index ]",
+			 (int64_t) entries_reader->entry_offsets[ entry_index ],
+			 (int64_t) entry_index * 88 );
+		}
+		WTCDB_TEST_ASSERT_EQUAL_UINT64(
+		 "progress->bytes_scanned",
+		 progress->bytes_scanned,
+		 (uint64_t) data_size );
+
+		result = libwtcdb_entries_reader_free(
+		          &entries_reader,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libwtcdb_entries_reader_scan_cache_entry_offsets(
+	          NULL,
+	          0,
+	          3,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_entries_reader_initialize(
+	          &entries_reader,
+	          io_handle,
+	          file_io_handle,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_entries_reader_scan_cache_entry_offsets(
+	          entries_reader,
+	          0,
+	          0,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an invalid signature in the chain of the last region
+	 */
+	data[ 100 * 88 ] = 0xff;
+
+	result = libwtcdb_entries_reader_scan_cache_entry_offsets(
+	          entries_reader,
+	          0,
+	          3,
+	          &error );
+
+	data[ 100 * 88 ] = 0x43;
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwtcdb_entries_reader_free(
+	          &entries_reader,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wtcdb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->progress = NULL;
+
+	result = libwtcdb_progress_free(
+	          &progress,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( entries_reader != NULL )
+	{
+		libwtcdb_entries_reader_free(
+		 &entries_reader,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		io_handle->progress = NULL;
+
+		libwtcdb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	if( progress != NULL )
+	{
+		libwtcdb_progress_free(
+		 &progress,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Tests reading the cache entries with a specific maximum number of threads
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_entries_reader_read_cache_entries_with_threads(
+     int maximum_number_of_threads )
+{
+	libbfio_handle_t *file_io_handle          = NULL;
+	libcdata_array_t *entries_array           = NULL;
+	libcerror_error_t *error                  = NULL;
+	libwtcdb_entries_reader_t *entries_reader = NULL;
+	libwtcdb_io_handle_t *io_handle           = NULL;
+	uint8_t *data                             = NULL;
+	size_t data_size                          = 0;
+	int entry_index                           = 0;
+	int number_of_entries                     = 0;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	data_size = 88 * WTCDB_TEST_ENTRIES_READER_NUMBER_OF_ENTRIES;
+
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	for( entry_index = 0;
+	     entry_index < WTCDB_TEST_ENTRIES_READER_NUMBER_OF_ENTRIES;
+	     entry_index++ )
+	{
+		result = memory_copy(
+		          &( data[ entry_index * 88 ] ),
+		          wtcdb_test_entries_reader_data1,
+		          88 ) != NULL;
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	result = libwtcdb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->file_type      = LIBWTCDB_FILE_TYPE_CACHE;
+	io_handle->format_version = 20;
+
+	result = wtcdb_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          data_size,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_initialize(
+	          &entries_array,
+	          0,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_entries_reader_initialize(
+	          &entries_reader,
+	          io_handle,
+	          file_io_handle,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_entries_reader_read_cache_entry_offsets(
+	          entries_reader,
+	          0,
+	          maximum_number_of_threads,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "entries_reader->number_of_entry_offsets",
+	 entries_reader->number_of_entry_offsets,
+	 WTCDB_TEST_ENTRIES_READER_NUMBER_OF_ENTRIES );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT64(
+	 "entries_reader->entry_offsets[ 1 ]",
+	 (int64_t) entries_reader->entry_offsets[ 1 ],
+	 (int64_t) 88 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_entries_reader_read_entries(
+	          entries_reader,
+	          maximum_number_of_threads,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_entries_reader_append_entries(
+	          entries_reader,
+	          entries_array,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_get_number_of_entries(
+	          entries_array,
+	          &number_of_entries,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 WTCDB_TEST_ENTRIES_READER_NUMBER_OF_ENTRIES );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_entries_reader_read_entries(
+	          entries_reader,
+	          maximum_number_of_threads,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_entries_reader_read_cache_entry_offsets(
+	          NULL,
+	          0,
+	          maximum_number_of_threads,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_entries_reader_read_entries(
+	          NULL,
+	          maximum_number_of_threads,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_entries_reader_append_entries(
+	          NULL,
+	          entries_array,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwtcdb_entries_reader_free(
+	          &entries_reader,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_free(
+	          &entries_array,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libwtcdb_cache_entry_free,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wtcdb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( entries_reader != NULL )
+	{
+		libwtcdb_entries_reader_free(
+		 &entries_reader,
+		 NULL );
+	}
+	if( entries_array != NULL )
+	{
+		libcdata_array_free(
+		 &entries_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libwtcdb_cache_entry_free,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libwtcdb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Tests reading the index entries with a specific maximum number of threads
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_entries_reader_read_index_entries_with_threads(
+     int maximum_number_of_threads )
+{
+	libbfio_handle_t *file_io_handle          = NULL;
+	libcdata_array_t *entries_array           = NULL;
+	libcerror_error_t *error                  = NULL;
+	libwtcdb_entries_reader_t *entries_reader = NULL;
+	libwtcdb_io_handle_t *io_handle           = NULL;
+	uint8_t *data                             = NULL;
+	size_t data_size                          = 0;
+	int entry_index                           = 0;
+	int number_of_entries                     = 0;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	data_size = 16 + ( 32 * WTCDB_TEST_ENTRIES_READER_NUMBER_OF_INDEX_ENTRIES );
+
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	result = memory_set(
+	          data,
+	          0,
+	          16 ) != NULL;
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	for( entry_index = 0;
+	     entry_index < WTCDB_TEST_ENTRIES_READER_NUMBER_OF_INDEX_ENTRIES;
+	     entry_index++ )
+	{
+		result = memory_copy(
+		          &( data[ 16 + ( entry_index * 32 ) ] ),
+		          wtcdb_test_entries_reader_data2,
+		          32 ) != NULL;
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	result = libwtcdb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->file_type      = LIBWTCDB_FILE_TYPE_INDEX_V20;
+	io_handle->format_version = 21;
+
+	result = wtcdb_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          data_size,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_initialize(
+	          &entries_array,
+	          0,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_entries_reader_initialize(
+	          &entries_reader,
+	          io_handle,
+	          file_io_handle,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_entries_reader_determine_number_of_index_entries(
+	          entries_reader,
+	          16,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "entries_reader->number_of_entries",
+	 entries_reader->number_of_entries,
+	 WTCDB_TEST_ENTRIES_READER_NUMBER_OF_INDEX_ENTRIES );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_entries_reader_read_entries(
+	          entries_reader,
+	          maximum_number_of_threads,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_entries_reader_append_entries(
+	          entries_reader,
+	          entries_array,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_get_number_of_entries(
+	          entries_array,
+	          &number_of_entries,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 WTCDB_TEST_ENTRIES_READER_NUMBER_OF_INDEX_ENTRIES );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_entries_reader_determine_number_of_index_entries(
+	          NULL,
+	          16,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an incomplete last index entry
+	 */
+	result = libwtcdb_entries_reader_determine_number_of_index_entries(
+	          entries_reader,
+	          8,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwtcdb_entries_reader_free(
+	          &entries_reader,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_free(
+	          &entries_array,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libwtcdb_index_entry_free,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wtcdb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( entries_reader != NULL )
+	{
+		libwtcdb_entries_reader_free(
+		 &entries_reader,
+		 NULL );
+	}
+	if( entries_array != NULL )
+	{
+		libcdata_array_free(
+		 &entries_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libwtcdb_index_entry_free,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libwtcdb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_entries_reader_read_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_entries_reader_read_entries(
+     void )
+{
+	int result = 0;
+
+	result = wtcdb_test_entries_reader_read_cache_entries_with_threads(
+	          1 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = wtcdb_test_entries_reader_read_cache_entries_with_threads(
+	          4 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = wtcdb_test_entries_reader_read_index_entries_with_threads(
+	          1 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = wtcdb_test_entries_reader_read_index_entries_with_threads(
+	          4 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc WTCDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] WTCDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc WTCDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] WTCDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	WTCDB_TEST_UNREFERENCED_PARAMETER( argc )
+	WTCDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_entries_reader_initialize",
+	 wtcdb_test_entries_reader_initialize );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_entries_reader_free",
+	 wtcdb_test_entries_reader_free );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_entries_reader_check_cache_entry_header",
+	 wtcdb_test_entries_reader_check_cache_entry_header );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_entries_reader_scan_cache_entry_offsets",
+	 wtcdb_test_entries_reader_scan_cache_entry_offsets );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_entries_reader_read_entries",
+	 wtcdb_test_entries_reader_read_entries );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
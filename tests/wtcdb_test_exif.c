@@ -0,0 +1,1561 @@
+/*
+ * Library exif type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "wtcdb_test_functions.h"
+#include "wtcdb_test_libbfio.h"
+#include "wtcdb_test_libcerror.h"
+#include "wtcdb_test_libwtcdb.h"
+#include "wtcdb_test_macros.h"
+#include "wtcdb_test_memory.h"
+#include "wtcdb_test_unused.h"
+
+#include "../libwtcdb/libwtcdb_exif.h"
+
+/* Little-endian TIFF data with a primary IFD containing make, orientation and
+ * an EXIF IFD pointer, and an EXIF IFD containing the original date and time
+ */
+uint8_t wtcdb_test_exif_tiff_data1[ 94 ] = {
+0x49, 0x49, 0x2a, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0f, 0x01, 0x02, 0x00, 0x05, 0x00,
+	0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x12, 0x01, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x69, 0x87, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x54, 0x65, 0x73, 0x74, 0x00, 0x00, 0x01, 0x00, 0x03, 0x90, 0x02, 0x00, 0x14, 0x00,
+	0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x30, 0x32, 0x34, 0x3a, 0x30,
+	0x31, 0x3a, 0x30, 0x32, 0x20, 0x30, 0x33, 0x3a, 0x30, 0x34, 0x3a, 0x30, 0x35, 0x00 };
+
+/* JPEG data with an EXIF APP1 segment containing the TIFF data
+ */
+uint8_t wtcdb_test_exif_jpeg_data1[ 108 ] = {
+	0xff, 0xd8, 0xff, 0xe1, 0x00, 0x66, 0x45, 0x78, 0x69, 0x66, 0x00, 0x00, 0x49, 0x49, 0x2a, 0x00,
+	0x08, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0f, 0x01, 0x02, 0x00, 0x05, 0x00, 0x00, 0x00, 0x32, 0x00,
+	0x00, 0x00, 0x12, 0x01, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x69, 0x87,
+	0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x65,
+	0x73, 0x74, 0x00, 0x00, 0x01, 0x00, 0x03, 0x90, 0x02, 0x00, 0x14, 0x00, 0x00, 0x00, 0x4a, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x30, 0x32, 0x34, 0x3a, 0x30, 0x31, 0x3a, 0x30, 0x32,
+	0x20, 0x30, 0x33, 0x3a, 0x30, 0x34, 0x3a, 0x30, 0x35, 0x00, 0xff, 0xd9 };
+
+/* JPEG data without an EXIF APP1 segment
+ */
+uint8_t wtcdb_test_exif_jpeg_data2[ 24 ] = {
+	0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+	0x00, 0x01, 0x00, 0x00, 0xff, 0xda, 0x00, 0x08 };
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+
+typedef struct wtcdb_test_exif_values wtcdb_test_exif_values_t;
+
+struct wtcdb_test_exif_values
+{
+	/* The number of values
+	 */
+	int number_of_values;
+
+	/* The maximum number of values before stopping
+	 */
+	int maximum_number_of_values;
+
+	/* The last IFD
+	 */
+	int last_ifd;
+
+	/* The last tag
+	 */
+	uint16_t last_tag;
+
+	/* The last value data size
+	 */
+	size_t last_value_data_size;
+};
+
+/* Callback function to collect EXIF values
+ * Returns 1 to continue, 0 to stop or -1 on error
+ */
+int wtcdb_test_exif_value_callback(
+     int ifd,
+     uint16_t tag,
+     uint16_t value_type WTCDB_TEST_ATTRIBUTE_UNUSED,
+     uint32_t number_of_values WTCDB_TEST_ATTRIBUTE_UNUSED,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     uint8_t byte_order WTCDB_TEST_ATTRIBUTE_UNUSED,
+     void *user_data )
+{
+	wtcdb_test_exif_values_t *values = NULL;
+
+	WTCDB_TEST_UNREFERENCED_PARAMETER( value_type )
+	WTCDB_TEST_UNREFERENCED_PARAMETER( number_of_values )
+	WTCDB_TEST_UNREFERENCED_PARAMETER( byte_order )
+
+	if( ( value_data == NULL )
+	 || ( user_data == NULL ) )
+	{
+		return( -1 );
+	}
+	values = (wtcdb_test_exif_values_t *) user_data;
+
+	values->number_of_values     += 1;
+	values->last_ifd              = ifd;
+	values->last_tag              = tag;
+	values->last_value_data_size  = value_data_size;
+
+	if( ( values->maximum_number_of_values > 0 )
+	 && ( values->number_of_values >= values->maximum_number_of_values ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Callback function that fails
+ * Returns -1
+ */
+int wtcdb_test_exif_value_error_callback(
+     int ifd WTCDB_TEST_ATTRIBUTE_UNUSED,
+     uint16_t tag WTCDB_TEST_ATTRIBUTE_UNUSED,
+     uint16_t value_type WTCDB_TEST_ATTRIBUTE_UNUSED,
+     uint32_t number_of_values WTCDB_TEST_ATTRIBUTE_UNUSED,
+     const uint8_t *value_data WTCDB_TEST_ATTRIBUTE_UNUSED,
+     size_t value_data_size WTCDB_TEST_ATTRIBUTE_UNUSED,
+     uint8_t byte_order WTCDB_TEST_ATTRIBUTE_UNUSED,
+     void *user_data WTCDB_TEST_ATTRIBUTE_UNUSED )
+{
+	WTCDB_TEST_UNREFERENCED_PARAMETER( ifd )
+	WTCDB_TEST_UNREFERENCED_PARAMETER( tag )
+	WTCDB_TEST_UNREFERENCED_PARAMETER( value_type )
+	WTCDB_TEST_UNREFERENCED_PARAMETER( number_of_values )
+	WTCDB_TEST_UNREFERENCED_PARAMETER( value_data )
+	WTCDB_TEST_UNREFERENCED_PARAMETER( value_data_size )
+	WTCDB_TEST_UNREFERENCED_PARAMETER( byte_order )
+	WTCDB_TEST_UNREFERENCED_PARAMETER( user_data )
+
+	return( -1 );
+}
+
+/* Tests the libwtcdb_exif_get_value_type_size function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_exif_get_value_type_size(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t value_type_size   = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_exif_get_value_type_size(
+	          LIBWTCDB_EXIF_VALUE_TYPE_ASCII,
+	          &value_type_size,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_SIZE(
+	 "value_type_size",
+	 value_type_size,
+	 (size_t) 1 );
+
+	result = libwtcdb_exif_get_value_type_size(
+	          LIBWTCDB_EXIF_VALUE_TYPE_SHORT,
+	          &value_type_size,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_SIZE(
+	 "value_type_size",
+	 value_type_size,
+	 (size_t) 2 );
+
+	result = libwtcdb_exif_get_value_type_size(
+	          LIBWTCDB_EXIF_VALUE_TYPE_LONG,
+	          &value_type_size,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_SIZE(
+	 "value_type_size",
+	 value_type_size,
+	 (size_t) 4 );
+
+	result = libwtcdb_exif_get_value_type_size(
+	          LIBWTCDB_EXIF_VALUE_TYPE_RATIONAL,
+	          &value_type_size,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_SIZE(
+	 "value_type_size",
+	 value_type_size,
+	 (size_t) 8 );
+
+	/* Test with an unsupported value type
+	 */
+	result = libwtcdb_exif_get_value_type_size(
+	          0,
+	          &value_type_size,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_exif_get_value_type_size(
+	          LIBWTCDB_EXIF_VALUE_TYPE_BYTE,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_exif_get_ifd_number_of_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_exif_get_ifd_number_of_entries(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	uint16_t number_of_entries = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_exif_get_ifd_number_of_entries(
+	          wtcdb_test_exif_tiff_data1,
+	          94,
+	          LIBWTCDB_EXIF_BYTE_ORDER_LITTLE_ENDIAN,
+	          8,
+	          &number_of_entries,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT16(
+	 "number_of_entries",
+	 number_of_entries,
+	 3 );
+
+	/* Test with an IFD offset out of bounds
+	 */
+	result = libwtcdb_exif_get_ifd_number_of_entries(
+	          wtcdb_test_exif_tiff_data1,
+	          94,
+	          LIBWTCDB_EXIF_BYTE_ORDER_LITTLE_ENDIAN,
+	          93,
+	          &number_of_entries,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a number of entries that does not fit in the data
+	 */
+	result = libwtcdb_exif_get_ifd_number_of_entries(
+	          wtcdb_test_exif_tiff_data1,
+	          40,
+	          LIBWTCDB_EXIF_BYTE_ORDER_LITTLE_ENDIAN,
+	          8,
+	          &number_of_entries,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_exif_get_ifd_number_of_entries(
+	          NULL,
+	          94,
+	          LIBWTCDB_EXIF_BYTE_ORDER_LITTLE_ENDIAN,
+	          8,
+	          &number_of_entries,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_exif_get_ifd_number_of_entries(
+	          wtcdb_test_exif_tiff_data1,
+	          94,
+	          0,
+	          8,
+	          &number_of_entries,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_exif_get_ifd_number_of_entries(
+	          wtcdb_test_exif_tiff_data1,
+	          94,
+	          LIBWTCDB_EXIF_BYTE_ORDER_LITTLE_ENDIAN,
+	          8,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_exif_read_ifd_data function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_exif_read_ifd_data(
+     void )
+{
+	wtcdb_test_exif_values_t values;
+
+	libcerror_error_t *error = NULL;
+	uint32_t exif_ifd_offset = 0;
+	uint32_t gps_ifd_offset  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	values.number_of_values         = 0;
+	values.maximum_number_of_values = 0;
+	values.last_ifd                 = -1;
+	values.last_tag                 = 0;
+	values.last_value_data_size     = 0;
+
+	result = libwtcdb_exif_read_ifd_data(
+	          wtcdb_test_exif_tiff_data1,
+	          94,
+	          LIBWTCDB_EXIF_BYTE_ORDER_LITTLE_ENDIAN,
+	          8,
+	          LIBWTCDB_EXIF_IFD_PRIMARY,
+	          NULL,
+	          0,
+	          &wtcdb_test_exif_value_callback,
+	          &values,
+	          &exif_ifd_offset,
+	          &gps_ifd_offset,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "values.number_of_values",
+	 values.number_of_values,
+	 3 );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT32(
+	 "exif_ifd_offset",
+	 exif_ifd_offset,
+	 56 );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT32(
+	 "gps_ifd_offset",
+	 gps_ifd_offset,
+	 0 );
+
+	/* Test with the callback function requesting to stop
+	 */
+	values.number_of_values         = 0;
+	values.maximum_number_of_values = 1;
+	values.last_ifd                 = -1;
+	values.last_tag                 = 0;
+	values.last_value_data_size     = 0;
+
+	result = libwtcdb_exif_read_ifd_data(
+	          wtcdb_test_exif_tiff_data1,
+	          94,
+	          LIBWTCDB_EXIF_BYTE_ORDER_LITTLE_ENDIAN,
+	          8,
+	          LIBWTCDB_EXIF_IFD_PRIMARY,
+	          NULL,
+	          0,
+	          &wtcdb_test_exif_value_callback,
+	          &values,
+	          &exif_ifd_offset,
+	          &gps_ifd_offset,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "values.number_of_values",
+	 values.number_of_values,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_exif_read_ifd_data(
+	          NULL,
+	          94,
+	          LIBWTCDB_EXIF_BYTE_ORDER_LITTLE_ENDIAN,
+	          8,
+	          LIBWTCDB_EXIF_IFD_PRIMARY,
+	          NULL,
+	          0,
+	          &wtcdb_test_exif_value_callback,
+	          &values,
+	          &exif_ifd_offset,
+	          &gps_ifd_offset,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_exif_read_ifd_data(
+	          wtcdb_test_exif_tiff_data1,
+	          1,
+	          LIBWTCDB_EXIF_BYTE_ORDER_LITTLE_ENDIAN,
+	          8,
+	          LIBWTCDB_EXIF_IFD_PRIMARY,
+	          NULL,
+	          0,
+	          &wtcdb_test_exif_value_callback,
+	          &values,
+	          &exif_ifd_offset,
+	          &gps_ifd_offset,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_exif_read_ifd_data(
+	          wtcdb_test_exif_tiff_data1,
+	          94,
+	          0,
+	          8,
+	          LIBWTCDB_EXIF_IFD_PRIMARY,
+	          NULL,
+	          0,
+	          &wtcdb_test_exif_value_callback,
+	          &values,
+	          &exif_ifd_offset,
+	          &gps_ifd_offset,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_exif_read_ifd_data(
+	          wtcdb_test_exif_tiff_data1,
+	          94,
+	          LIBWTCDB_EXIF_BYTE_ORDER_LITTLE_ENDIAN,
+	          93,
+	          LIBWTCDB_EXIF_IFD_PRIMARY,
+	          NULL,
+	          0,
+	          &wtcdb_test_exif_value_callback,
+	          &values,
+	          &exif_ifd_offset,
+	          &gps_ifd_offset,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_exif_read_ifd_data(
+	          wtcdb_test_exif_tiff_data1,
+	          94,
+	          LIBWTCDB_EXIF_BYTE_ORDER_LITTLE_ENDIAN,
+	          8,
+	          LIBWTCDB_EXIF_IFD_PRIMARY,
+	          NULL,
+	          0,
+	          NULL,
+	          &values,
+	          &exif_ifd_offset,
+	          &gps_ifd_offset,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a number of entries that exceeds the data size
+	 */
+	result = libwtcdb_exif_read_ifd_data(
+	          wtcdb_test_exif_tiff_data1,
+	          40,
+	          LIBWTCDB_EXIF_BYTE_ORDER_LITTLE_ENDIAN,
+	          8,
+	          LIBWTCDB_EXIF_IFD_PRIMARY,
+	          NULL,
+	          0,
+	          &wtcdb_test_exif_value_callback,
+	          &values,
+	          &exif_ifd_offset,
+	          &gps_ifd_offset,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a failing callback function
+	 */
+	result = libwtcdb_exif_read_ifd_data(
+	          wtcdb_test_exif_tiff_data1,
+	          94,
+	          LIBWTCDB_EXIF_BYTE_ORDER_LITTLE_ENDIAN,
+	          8,
+	          LIBWTCDB_EXIF_IFD_PRIMARY,
+	          NULL,
+	          0,
+	          &wtcdb_test_exif_value_error_callback,
+	          &values,
+	          &exif_ifd_offset,
+	          &gps_ifd_offset,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_exif_read_tiff_data function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_exif_read_tiff_data(
+     void )
+{
+	wtcdb_test_exif_values_t values;
+
+	uint8_t tiff_data[ 94 ];
+
+	uint16_t tags[ 2 ]       = { LIBWTCDB_EXIF_TAG_MAKE, LIBWTCDB_EXIF_TAG_DATE_TIME_ORIGINAL };
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	values.number_of_values         = 0;
+	values.maximum_number_of_values = 0;
+	values.last_ifd                 = -1;
+	values.last_tag                 = 0;
+	values.last_value_data_size     = 0;
+
+	result = libwtcdb_exif_read_tiff_data(
+	          wtcdb_test_exif_tiff_data1,
+	          94,
+	          NULL,
+	          0,
+	          &wtcdb_test_exif_value_callback,
+	          &values,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "values.number_of_values",
+	 values.number_of_values,
+	 4 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "values.last_ifd",
+	 values.last_ifd,
+	 LIBWTCDB_EXIF_IFD_EXIF );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT16(
+	 "values.last_tag",
+	 values.last_tag,
+	 LIBWTCDB_EXIF_TAG_DATE_TIME_ORIGINAL );
+
+	WTCDB_TEST_ASSERT_EQUAL_SIZE(
+	 "values.last_value_data_size",
+	 values.last_value_data_size,
+	 (size_t) 20 );
+
+	/* Test with a selected tag set
+	 */
+	values.number_of_values         = 0;
+	values.maximum_number_of_values = 0;
+	values.last_ifd                 = -1;
+	values.last_tag                 = 0;
+	values.last_value_data_size     = 0;
+
+	result = libwtcdb_exif_read_tiff_data(
+	          wtcdb_test_exif_tiff_data1,
+	          94,
+	          tags,
+	          2,
+	          &wtcdb_test_exif_value_callback,
+	          &values,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "values.number_of_values",
+	 values.number_of_values,
+	 2 );
+
+	/* Test with an EXIF IFD offset out of bounds
+	 */
+	memory_copy(
+	 tiff_data,
+	 wtcdb_test_exif_tiff_data1,
+	 94 );
+
+	tiff_data[ 42 ] = 0xff;
+
+	values.number_of_values         = 0;
+	values.maximum_number_of_values = 0;
+	values.last_ifd                 = -1;
+	values.last_tag                 = 0;
+	values.last_value_data_size     = 0;
+
+	result = libwtcdb_exif_read_tiff_data(
+	          tiff_data,
+	          94,
+	          NULL,
+	          0,
+	          &wtcdb_test_exif_value_callback,
+	          &values,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "values.number_of_values",
+	 values.number_of_values,
+	 3 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "values.last_ifd",
+	 values.last_ifd,
+	 LIBWTCDB_EXIF_IFD_PRIMARY );
+
+	/* Test with an EXIF IFD number of entries that does not fit in the data
+	 */
+	tiff_data[ 42 ] = 0x38;
+	tiff_data[ 56 ] = 0xff;
+
+	values.number_of_values         = 0;
+	values.maximum_number_of_values = 0;
+	values.last_ifd                 = -1;
+	values.last_tag                 = 0;
+	values.last_value_data_size     = 0;
+
+	result = libwtcdb_exif_read_tiff_data(
+	          tiff_data,
+	          94,
+	          NULL,
+	          0,
+	          &wtcdb_test_exif_value_callback,
+	          &values,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "values.number_of_values",
+	 values.number_of_values,
+	 3 );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_exif_read_tiff_data(
+	          NULL,
+	          94,
+	          NULL,
+	          0,
+	          &wtcdb_test_exif_value_callback,
+	          &values,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_exif_read_tiff_data(
+	          wtcdb_test_exif_tiff_data1,
+	          7,
+	          NULL,
+	          0,
+	          &wtcdb_test_exif_value_callback,
+	          &values,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_exif_read_tiff_data(
+	          wtcdb_test_exif_tiff_data1,
+	          94,
+	          NULL,
+	          0,
+	          NULL,
+	          &values,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an unsupported byte order
+	 */
+	result = libwtcdb_exif_read_tiff_data(
+	          &( wtcdb_test_exif_tiff_data1[ 2 ] ),
+	          92,
+	          NULL,
+	          0,
+	          &wtcdb_test_exif_value_callback,
+	          &values,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_exif_find_app1_segment_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_exif_find_app1_segment_file_io_handle(
+     void )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	uint32_t segment_offset          = 0;
+	uint16_t segment_size            = 0;
+	int result                       = 0;
+
+	/* Initialize file IO handle
+	 */
+	result = wtcdb_test_open_file_io_handle(
+	          &file_io_handle,
+	          wtcdb_test_exif_jpeg_data1,
+	          108,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_exif_find_app1_segment_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          0,
+	          108,
+	          &segment_offset,
+	          &segment_size,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT32(
+	 "segment_offset",
+	 segment_offset,
+	 6 );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT16(
+	 "segment_size",
+	 segment_size,
+	 100 );
+
+	/* Test with the APP1 segment beyond the data size
+	 */
+	result = libwtcdb_exif_find_app1_segment_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          0,
+	          64,
+	          &segment_offset,
+	          &segment_size,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_exif_find_app1_segment_file_io_handle(
+	          NULL,
+	          NULL,
+	          0,
+	          108,
+	          &segment_offset,
+	          &segment_size,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_exif_find_app1_segment_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          -1,
+	          108,
+	          &segment_offset,
+	          &segment_size,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_exif_find_app1_segment_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          0,
+	          108,
+	          NULL,
+	          &segment_size,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_exif_find_app1_segment_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          0,
+	          108,
+	          &segment_offset,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up file IO handle
+	 */
+	result = wtcdb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test JPEG data without an EXIF APP1 segment
+	 */
+	result = wtcdb_test_open_file_io_handle(
+	          &file_io_handle,
+	          wtcdb_test_exif_jpeg_data2,
+	          24,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	result = libwtcdb_exif_find_app1_segment_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          0,
+	          24,
+	          &segment_offset,
+	          &segment_size,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wtcdb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_exif_read_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_exif_read_file_io_handle(
+     void )
+{
+	wtcdb_test_exif_values_t values;
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	int result                       = 0;
+
+	/* Initialize file IO handle
+	 */
+	result = wtcdb_test_open_file_io_handle(
+	          &file_io_handle,
+	          wtcdb_test_exif_jpeg_data1,
+	          108,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	/* Test regular cases
+	 */
+	values.number_of_values         = 0;
+	values.maximum_number_of_values = 0;
+	values.last_ifd                 = -1;
+	values.last_tag                 = 0;
+	values.last_value_data_size     = 0;
+
+	result = libwtcdb_exif_read_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          0,
+	          108,
+	          NULL,
+	          0,
+	          &wtcdb_test_exif_value_callback,
+	          &values,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "values.number_of_values",
+	 values.number_of_values,
+	 4 );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_exif_read_file_io_handle(
+	          NULL,
+	          NULL,
+	          0,
+	          108,
+	          NULL,
+	          0,
+	          &wtcdb_test_exif_value_callback,
+	          &values,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_exif_read_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          -1,
+	          108,
+	          NULL,
+	          0,
+	          &wtcdb_test_exif_value_callback,
+	          &values,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_exif_read_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          0,
+	          108,
+	          NULL,
+	          0,
+	          NULL,
+	          &values,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_exif_read_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          0,
+	          108,
+	          NULL,
+	          0,
+	          &wtcdb_test_exif_value_error_callback,
+	          &values,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up file IO handle
+	 */
+	result = wtcdb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test JPEG data without an EXIF APP1 segment
+	 */
+	result = wtcdb_test_open_file_io_handle(
+	          &file_io_handle,
+	          wtcdb_test_exif_jpeg_data2,
+	          24,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+
+	values.number_of_values         = 0;
+	values.maximum_number_of_values = 0;
+	values.last_ifd                 = -1;
+	values.last_tag                 = 0;
+	values.last_value_data_size     = 0;
+
+	result = libwtcdb_exif_read_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          0,
+	          24,
+	          NULL,
+	          0,
+	          &wtcdb_test_exif_value_callback,
+	          &values,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "values.number_of_values",
+	 values.number_of_values,
+	 0 );
+
+	result = wtcdb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc WTCDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] WTCDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc WTCDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] WTCDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	WTCDB_TEST_UNREFERENCED_PARAMETER( argc )
+	WTCDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_exif_get_value_type_size",
+	 wtcdb_test_exif_get_value_type_size );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_exif_get_ifd_number_of_entries",
+	 wtcdb_test_exif_get_ifd_number_of_entries );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_exif_read_ifd_data",
+	 wtcdb_test_exif_read_ifd_data );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_exif_read_tiff_data",
+	 wtcdb_test_exif_read_tiff_data );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_exif_find_app1_segment_file_io_handle",
+	 wtcdb_test_exif_find_app1_segment_file_io_handle );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_exif_read_file_io_handle",
+	 wtcdb_test_exif_read_file_io_handle );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
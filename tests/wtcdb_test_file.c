@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -38,7 +39,11 @@
 #include "wtcdb_test_macros.h"
 #include "wtcdb_test_memory.h"
 
+#include "../libwtcdb/libwtcdb_cache_entry.h"
+#include "../libwtcdb/libwtcdb_definitions.h"
 #include "../libwtcdb/libwtcdb_file.h"
+#include "../libwtcdb/libwtcdb_item.h"
+#include "../libwtcdb/libwtcdb_snapshot.h"
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER ) && SIZEOF_WCHAR_T != 2 && SIZEOF_WCHAR_T != 4
 #error Unsupported size of wchar_t
@@ -64,6 +69,257 @@ int libwtcdb_file_open_file_io_handle(
 
 #endif /* !defined( LIBWTCDB_HAVE_BFIO ) */
 
+/* The maximum number of workers used by the tests
+ */
+#define WTCDB_TEST_FILE_MAXIMUM_NUMBER_OF_WORKERS	4
+
+typedef struct wtcdb_test_file_item_counts wtcdb_test_file_item_counts_t;
+
+/* The item counts are updated by the item callback per worker
+ */
+struct wtcdb_test_file_item_counts
+{
+	/* The number of items per worker
+	 */
+	int number_of_items[ WTCDB_TEST_FILE_MAXIMUM_NUMBER_OF_WORKERS ];
+
+	/* The sum of the item indexes per worker
+	 */
+	int64_t sum_of_item_indexes[ WTCDB_TEST_FILE_MAXIMUM_NUMBER_OF_WORKERS ];
+
+	/* The index of the item at which the callback stops or -1 if not set
+	 */
+	int stop_item_index;
+
+	/* The index of the item at which the callback fails or -1 if not set
+	 */
+	int error_item_index;
+};
+
+typedef struct wtcdb_test_file_progress wtcdb_test_file_progress_t;
+
+/* The progress is updated by the progress callback
+ */
+struct wtcdb_test_file_progress
+{
+	/* The number of times the callback was called
+	 */
+	int number_of_calls;
+
+	/* The last reported phase
+	 */
+	int phase;
+
+	/* The last reported number of bytes scanned
+	 */
+	uint64_t bytes_scanned;
+
+	/* The last reported file size
+	 */
+	uint64_t file_size;
+
+	/* The last reported number of entries
+	 */
+	int number_of_entries;
+
+	/* The phase at which the callback aborts or 0 if not set
+	 */
+	int abort_phase;
+};
+
+typedef struct wtcdb_test_file_executor wtcdb_test_file_executor_t;
+
+/* The executor runs the submitted tasks when waited for
+ */
+struct wtcdb_test_file_executor
+{
+	/* The task functions
+	 */
+	libwtcdb_executor_task_function_t task_functions[ WTCDB_TEST_FILE_MAXIMUM_NUMBER_OF_WORKERS ];
+
+	/* The task data
+	 */
+	void *task_data[ WTCDB_TEST_FILE_MAXIMUM_NUMBER_OF_WORKERS ];
+
+	/* The number of submitted tasks
+	 */
+	int number_of_tasks;
+
+	/* The number of completed tasks
+	 */
+	int number_of_completed_tasks;
+};
+
+/* Clears the item counts
+ */
+void wtcdb_test_file_item_counts_clear(
+      wtcdb_test_file_item_counts_t *item_counts )
+{
+	memory_set(
+	 item_counts,
+	 0,
+	 sizeof( wtcdb_test_file_item_counts_t ) );
+
+	item_counts->stop_item_index  = -1;
+	item_counts->error_item_index = -1;
+}
+
+/* Retrieves the number of items of all workers
+ */
+int wtcdb_test_file_item_counts_get_number_of_items(
+     wtcdb_test_file_item_counts_t *item_counts )
+{
+	int number_of_items = 0;
+	int worker_index    = 0;
+
+	for( worker_index = 0;
+	     worker_index < WTCDB_TEST_FILE_MAXIMUM_NUMBER_OF_WORKERS;
+	     worker_index++ )
+	{
+		number_of_items += item_counts->number_of_items[ worker_index ];
+	}
+	return( number_of_items );
+}
+
+/* Retrieves the sum of the item indexes of all workers
+ */
+int64_t wtcdb_test_file_item_counts_get_sum_of_item_indexes(
+         wtcdb_test_file_item_counts_t *item_counts )
+{
+	int64_t sum_of_item_indexes = 0;
+	int worker_index            = 0;
+
+	for( worker_index = 0;
+	     worker_index < WTCDB_TEST_FILE_MAXIMUM_NUMBER_OF_WORKERS;
+	     worker_index++ )
+	{
+		sum_of_item_indexes += item_counts->sum_of_item_indexes[ worker_index ];
+	}
+	return( sum_of_item_indexes );
+}
+
+/* The item callback used by the tests
+ * Returns 1 to continue, 0 to stop or -1 on error
+ */
+int wtcdb_test_file_item_callback(
+     libwtcdb_item_t *item,
+     int item_index,
+     int worker_index,
+     void *user_data )
+{
+	wtcdb_test_file_item_counts_t *item_counts = NULL;
+
+	if( ( item == NULL )
+	 || ( user_data == NULL ) )
+	{
+		return( -1 );
+	}
+	if( ( worker_index < 0 )
+	 || ( worker_index >= WTCDB_TEST_FILE_MAXIMUM_NUMBER_OF_WORKERS ) )
+	{
+		return( -1 );
+	}
+	item_counts = (wtcdb_test_file_item_counts_t *) user_data;
+
+	if( item_index == item_counts->error_item_index )
+	{
+		return( -1 );
+	}
+	item_counts->number_of_items[ worker_index ] += 1;
+	item_counts->sum_of_item_indexes[ worker_index ] += item_index;
+
+	if( item_index == item_counts->stop_item_index )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Submits a task to the test executor
+ * Returns 1 if successful or -1 on error
+ */
+int wtcdb_test_file_executor_submit(
+     libwtcdb_executor_task_function_t task_function,
+     void *task_data,
+     void *executor_data )
+{
+	wtcdb_test_file_executor_t *executor = NULL;
+
+	if( executor_data == NULL )
+	{
+		return( -1 );
+	}
+	executor = (wtcdb_test_file_executor_t *) executor_data;
+
+	if( executor->number_of_tasks >= WTCDB_TEST_FILE_MAXIMUM_NUMBER_OF_WORKERS )
+	{
+		return( -1 );
+	}
+	executor->task_functions[ executor->number_of_tasks ] = task_function;
+	executor->task_data[ executor->number_of_tasks ]      = task_data;
+
+	executor->number_of_tasks += 1;
+
+	return( 1 );
+}
+
+/* Runs the submitted tasks of the test executor in reverse order
+ * Returns 1 if successful or -1 on error
+ */
+int wtcdb_test_file_executor_wait(
+     void *executor_data )
+{
+	wtcdb_test_file_executor_t *executor = NULL;
+
+	if( executor_data == NULL )
+	{
+		return( -1 );
+	}
+	executor = (wtcdb_test_file_executor_t *) executor_data;
+
+	while( executor->number_of_tasks > 0 )
+	{
+		executor->number_of_tasks -= 1;
+
+		executor->task_functions[ executor->number_of_tasks ](
+		 executor->task_data[ executor->number_of_tasks ] );
+
+		executor->number_of_completed_tasks += 1;
+	}
+	return( 1 );
+}
+
+/* The progress callback used by the tests
+ * Returns 1 to continue or 0 to abort
+ */
+int wtcdb_test_file_progress_callback(
+     int phase,
+     uint64_t bytes_scanned,
+     uint64_t file_size,
+     int number_of_entries,
+     void *user_data )
+{
+	wtcdb_test_file_progress_t *progress = NULL;
+
+	if( user_data == NULL )
+	{
+		return( 0 );
+	}
+	progress = (wtcdb_test_file_progress_t *) user_data;
+
+	progress->number_of_calls  += 1;
+	progress->phase             = phase;
+	progress->bytes_scanned     = bytes_scanned;
+	progress->file_size         = file_size;
+	progress->number_of_entries = number_of_entries;
+
+	if( phase == progress->abort_phase )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
 /* Creates and opens a source file
  * Returns 1 if successful or -1 on error
  */
@@ -611,6 +867,10 @@ int wtcdb_test_file_open_wide(
 	libwtcdb_file_t *file    = NULL;
 	int result               = 0;
 
+#if defined( HAVE_PREAD )
+	int io_backend           = 0;
+#endif
+
 	/* Initialize test
 	 */
 	result = wtcdb_test_get_wide_source(
@@ -662,6 +922,30 @@ int wtcdb_test_file_open_wide(
 	 "error",
 	 error );
 
+#if defined( HAVE_PREAD )
+	/* Test that the IO backend is used when the file is opened by wide filename
+	 */
+	result = libwtcdb_file_get_io_backend(
+	          file,
+	          &io_backend,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_NOT_EQUAL_INT(
+	 "io_backend",
+	 io_backend,
+	 LIBWTCDB_IO_BACKEND_BFIO );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* defined( HAVE_PREAD ) */
+
 	/* Test error cases
 	 */
 	result = libwtcdb_file_open_wide(
@@ -1186,6 +1470,8 @@ on_error:
 int wtcdb_test_file_signal_abort(
      libwtcdb_file_t *file )
 {
+	wtcdb_test_file_item_counts_t item_counts;
+
 	libcerror_error_t *error = NULL;
 	int result               = 0;
 
@@ -1204,6 +1490,32 @@ int wtcdb_test_file_signal_abort(
 	 "error",
 	 error );
 
+	/* Test that the abort is not cleared by a parallel walk of the items
+	 */
+	wtcdb_test_file_item_counts_clear(
+	 &item_counts );
+
+	result = libwtcdb_file_for_each_item_parallel(
+	          file,
+	          &wtcdb_test_file_item_callback,
+	          &item_counts,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_processed_items",
+	 wtcdb_test_file_item_counts_get_number_of_items( &item_counts ),
+	 0 );
+
 	/* Test error cases
 	 */
 	result = libwtcdb_file_signal_abort(
@@ -1508,87 +1820,2762 @@ on_error:
 	return( 0 );
 }
 
-/* The main program
+/* Tests the libwtcdb_file_get_item_by_offset function
+ * Returns 1 if successful or 0 if not
  */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain(
-     int argc,
-     wchar_t * const argv[] )
-#else
-int main(
-     int argc,
-     char * const argv[] )
-#endif
+int wtcdb_test_file_get_item_by_offset(
+     libwtcdb_file_t *file )
 {
-	libbfio_handle_t *file_io_handle = NULL;
-	libcerror_error_t *error         = NULL;
-	libwtcdb_file_t *file            = NULL;
-	system_character_t *source       = NULL;
-	system_integer_t option          = 0;
-	size_t string_length             = 0;
-	int result                       = 0;
-
-	while( ( option = wtcdb_test_getopt(
-	                   argc,
-	                   argv,
-	                   _SYSTEM_STRING( "" ) ) ) != (system_integer_t) -1 )
-	{
-		switch( option )
-		{
-			case (system_integer_t) '?':
-			default:
-				fprintf(
-				 stderr,
-				 "Invalid argument: %" PRIs_SYSTEM ".\n",
-				 argv[ optind - 1 ] );
+	libcerror_error_t *error = NULL;
+	libwtcdb_item_t *item    = NULL;
+	int result               = 0;
 
-				return( EXIT_FAILURE );
-		}
-	}
-	if( optind < argc )
-	{
-		source = argv[ optind ];
-	}
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( WTCDB_TEST_FILE_VERBOSE )
-	libwtcdb_notify_set_verbose(
-	 1 );
-	libwtcdb_notify_set_stream(
-	 stderr,
-	 NULL );
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+	libwtcdb_item_t *offset_item = NULL;
+	off64_t file_offset          = 0;
+	uint8_t file_type            = 0;
+	int item_index               = 0;
+	int number_of_items          = 0;
 #endif
 
-	WTCDB_TEST_RUN(
-	 "libwtcdb_file_initialize",
-	 wtcdb_test_file_initialize );
-
-	WTCDB_TEST_RUN(
-	 "libwtcdb_file_free",
-	 wtcdb_test_file_free );
+	/* Test regular cases
+	 */
+	result = libwtcdb_file_get_item_by_offset(
+	          file,
+	          0,
+	          &item,
+	          &error );
 
-#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
-	if( source != NULL )
-	{
-		result = libbfio_file_initialize(
-		          &file_io_handle,
-		          &error );
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-		WTCDB_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "item",
+	 item );
 
-	        WTCDB_TEST_ASSERT_IS_NOT_NULL(
-	         "file_io_handle",
-	         file_io_handle );
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	        WTCDB_TEST_ASSERT_IS_NULL(
-	         "error",
-	         error );
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+	result = libwtcdb_file_get_type(
+	          file,
+	          &file_type,
+	          &error );
 
-		string_length = system_string_length(
-		                 source );
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_file_get_number_of_items(
+	          file,
+	          &number_of_items,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( file_type != LIBWTCDB_FILE_TYPE_CACHE )
+	{
+		number_of_items = 0;
+	}
+	for( item_index = 0;
+	     item_index < number_of_items;
+	     item_index++ )
+	{
+		result = libwtcdb_file_get_item(
+		          file,
+		          item_index,
+		          &item,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		file_offset = ( (libwtcdb_cache_entry_t *) ( (libwtcdb_internal_item_t *) item )->entry )->file_offset;
+
+		result = libwtcdb_file_get_item_by_offset(
+		          file,
+		          file_offset,
+		          &offset_item,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "offset_item->item_index",
+		 ( (libwtcdb_internal_item_t *) offset_item )->item_index,
+		 item_index );
+
+		result = libwtcdb_item_free(
+		          &offset_item,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The offset within a cache entry does not resolve to an item
+		 */
+		result = libwtcdb_file_get_item_by_offset(
+		          file,
+		          file_offset + 1,
+		          &offset_item,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "offset_item",
+		 offset_item );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libwtcdb_item_free(
+		          &item,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+
+	/* Test error cases
+	 */
+	result = libwtcdb_file_get_item_by_offset(
+	          NULL,
+	          0,
+	          &item,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "item",
+	 item );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_file_get_item_by_offset(
+	          file,
+	          0,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+	if( offset_item != NULL )
+	{
+		libwtcdb_item_free(
+		 &offset_item,
+		 NULL );
+	}
+#endif
+	if( item != NULL )
+	{
+		libwtcdb_item_free(
+		 &item,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+
+/* Tests the libwtcdb_file_get_snapshot_item function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_file_get_snapshot_item(
+     libwtcdb_file_t *file )
+{
+	libcerror_error_t *error                = NULL;
+	libwtcdb_internal_snapshot_t *snapshot  = NULL;
+	libwtcdb_internal_snapshot_t *unrelated = NULL;
+	libwtcdb_item_t *item                   = NULL;
+	int number_of_items                     = 0;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libwtcdb_file_get_snapshot(
+	          file,
+	          (libwtcdb_snapshot_t **) &snapshot,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "snapshot",
+	 snapshot );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_file_get_number_of_items(
+	          file,
+	          &number_of_items,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	if( number_of_items > 0 )
+	{
+		result = libwtcdb_file_get_snapshot_item(
+		          file,
+		          snapshot,
+		          number_of_items - 1,
+		          &item,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NOT_NULL(
+		 "item",
+		 item );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "item->item_index",
+		 ( (libwtcdb_internal_item_t *) item )->item_index,
+		 number_of_items - 1 );
+
+		result = libwtcdb_item_free(
+		          &item,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libwtcdb_file_get_snapshot_item(
+	          NULL,
+	          snapshot,
+	          0,
+	          &item,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_file_get_snapshot_item(
+	          file,
+	          NULL,
+	          0,
+	          &item,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_file_get_snapshot_item(
+	          file,
+	          snapshot,
+	          number_of_items,
+	          &item,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "item",
+	 item );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_file_get_snapshot_item(
+	          file,
+	          snapshot,
+	          0,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the snapshot is not the snapshot of the file
+	 */
+	result = libwtcdb_snapshot_initialize(
+	          &unrelated,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_file_get_snapshot_item(
+	          file,
+	          unrelated,
+	          0,
+	          &item,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "item",
+	 item );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_snapshot_free(
+	          (libwtcdb_snapshot_t **) &unrelated,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libwtcdb_snapshot_free(
+	          (libwtcdb_snapshot_t **) &snapshot,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item != NULL )
+	{
+		libwtcdb_item_free(
+		 &item,
+		 NULL );
+	}
+	if( unrelated != NULL )
+	{
+		libwtcdb_snapshot_free(
+		 (libwtcdb_snapshot_t **) &unrelated,
+		 NULL );
+	}
+	if( snapshot != NULL )
+	{
+		libwtcdb_snapshot_free(
+		 (libwtcdb_snapshot_t **) &snapshot,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+
+/* Tests the libwtcdb_file_for_each_item_parallel function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_file_for_each_item_parallel(
+     libwtcdb_file_t *file )
+{
+	libwtcdb_parallel_options_t options;
+	wtcdb_test_file_executor_t executor;
+	wtcdb_test_file_item_counts_t item_counts;
+
+	libcerror_error_t *error      = NULL;
+	int64_t expected_sum          = 0;
+	int expected_number_of_tasks  = 0;
+	int number_of_items           = 0;
+	int number_of_processed_items = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = libwtcdb_file_get_number_of_items(
+	          file,
+	          &number_of_items,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	expected_sum = ( (int64_t) number_of_items * ( number_of_items - 1 ) ) / 2;
+
+	expected_number_of_tasks = number_of_items;
+
+	if( expected_number_of_tasks > WTCDB_TEST_FILE_MAXIMUM_NUMBER_OF_WORKERS )
+	{
+		expected_number_of_tasks = WTCDB_TEST_FILE_MAXIMUM_NUMBER_OF_WORKERS;
+	}
+
+	/* Test regular cases
+	 */
+	wtcdb_test_file_item_counts_clear(
+	 &item_counts );
+
+	result = libwtcdb_file_for_each_item_parallel(
+	          file,
+	          &wtcdb_test_file_item_callback,
+	          &item_counts,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_processed_items",
+	 wtcdb_test_file_item_counts_get_number_of_items( &item_counts ),
+	 number_of_items );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT64(
+	 "sum_of_item_indexes",
+	 wtcdb_test_file_item_counts_get_sum_of_item_indexes( &item_counts ),
+	 expected_sum );
+
+	/* Test with multiple workers run by the library
+	 */
+	wtcdb_test_file_item_counts_clear(
+	 &item_counts );
+
+	memory_set(
+	 &options,
+	 0,
+	 sizeof( libwtcdb_parallel_options_t ) );
+
+	options.number_of_workers = WTCDB_TEST_FILE_MAXIMUM_NUMBER_OF_WORKERS;
+
+	result = libwtcdb_file_for_each_item_parallel(
+	          file,
+	          &wtcdb_test_file_item_callback,
+	          &item_counts,
+	          &options,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_processed_items",
+	 wtcdb_test_file_item_counts_get_number_of_items( &item_counts ),
+	 number_of_items );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT64(
+	 "sum_of_item_indexes",
+	 wtcdb_test_file_item_counts_get_sum_of_item_indexes( &item_counts ),
+	 expected_sum );
+
+	/* Test with multiple workers run by an executor
+	 */
+	wtcdb_test_file_item_counts_clear(
+	 &item_counts );
+
+	memory_set(
+	 &executor,
+	 0,
+	 sizeof( wtcdb_test_file_executor_t ) );
+
+	options.executor_submit = &wtcdb_test_file_executor_submit;
+	options.executor_wait   = &wtcdb_test_file_executor_wait;
+	options.executor_data   = &executor;
+
+	result = libwtcdb_file_for_each_item_parallel(
+	          file,
+	          &wtcdb_test_file_item_callback,
+	          &item_counts,
+	          &options,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_processed_items",
+	 wtcdb_test_file_item_counts_get_number_of_items( &item_counts ),
+	 number_of_items );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT64(
+	 "sum_of_item_indexes",
+	 wtcdb_test_file_item_counts_get_sum_of_item_indexes( &item_counts ),
+	 expected_sum );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "executor.number_of_completed_tasks",
+	 executor.number_of_completed_tasks,
+	 expected_number_of_tasks );
+
+	/* Test with the callback stopping at the first item
+	 */
+	if( number_of_items > 0 )
+	{
+		wtcdb_test_file_item_counts_clear(
+		 &item_counts );
+
+		item_counts.stop_item_index = 0;
+
+		options.number_of_workers = 1;
+		options.executor_submit   = NULL;
+		options.executor_wait     = NULL;
+		options.executor_data     = NULL;
+
+		result = libwtcdb_file_for_each_item_parallel(
+		          file,
+		          &wtcdb_test_file_item_callback,
+		          &item_counts,
+		          &options,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		number_of_processed_items = wtcdb_test_file_item_counts_get_number_of_items(
+		                             &item_counts );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "number_of_processed_items",
+		 number_of_processed_items,
+		 1 );
+	}
+	/* Test error cases
+	 */
+	wtcdb_test_file_item_counts_clear(
+	 &item_counts );
+
+	result = libwtcdb_file_for_each_item_parallel(
+	          NULL,
+	          &wtcdb_test_file_item_callback,
+	          &item_counts,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_file_for_each_item_parallel(
+	          file,
+	          NULL,
+	          &item_counts,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	options.number_of_workers = -1;
+
+	result = libwtcdb_file_for_each_item_parallel(
+	          file,
+	          &wtcdb_test_file_item_callback,
+	          &item_counts,
+	          &options,
+	          &error );
+
+	options.number_of_workers = 1;
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	options.executor_submit = &wtcdb_test_file_executor_submit;
+
+	result = libwtcdb_file_for_each_item_parallel(
+	          file,
+	          &wtcdb_test_file_item_callback,
+	          &item_counts,
+	          &options,
+	          &error );
+
+	options.executor_submit = NULL;
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the callback fails
+	 */
+	if( number_of_items > 0 )
+	{
+		item_counts.error_item_index = number_of_items - 1;
+
+		result = libwtcdb_file_for_each_item_parallel(
+		          file,
+		          &wtcdb_test_file_item_callback,
+		          &item_counts,
+		          NULL,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		WTCDB_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_file_get_number_of_read_ahead_items and libwtcdb_file_set_number_of_read_ahead_items functions
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_file_number_of_read_ahead_items(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libwtcdb_file_t *file          = NULL;
+	int number_of_read_ahead_items = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libwtcdb_file_initialize(
+	          &file,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_file_get_number_of_read_ahead_items(
+	          file,
+	          &number_of_read_ahead_items,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_read_ahead_items",
+	 number_of_read_ahead_items,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_file_set_number_of_read_ahead_items(
+	          file,
+	          4,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_file_get_number_of_read_ahead_items(
+	          file,
+	          &number_of_read_ahead_items,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_read_ahead_items",
+	 number_of_read_ahead_items,
+	 4 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_file_get_number_of_read_ahead_items(
+	          NULL,
+	          &number_of_read_ahead_items,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_file_get_number_of_read_ahead_items(
+	          file,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_file_set_number_of_read_ahead_items(
+	          NULL,
+	          4,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_file_set_number_of_read_ahead_items(
+	          file,
+	          -1,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_file_set_number_of_read_ahead_items(
+	          file,
+	          LIBWTCDB_MAXIMUM_NUMBER_OF_READ_AHEAD_ITEMS + 1,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwtcdb_file_free(
+	          &file,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libwtcdb_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_file_get_io_backend and libwtcdb_file_set_io_backend functions
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_file_io_backend(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libwtcdb_file_t *file    = NULL;
+	int io_backend           = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libwtcdb_file_initialize(
+	          &file,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_file_get_io_backend(
+	          file,
+	          &io_backend,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "io_backend",
+	 io_backend,
+	 LIBWTCDB_IO_BACKEND_DEFAULT );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_file_set_io_backend(
+	          file,
+	          LIBWTCDB_IO_BACKEND_BFIO,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_file_get_io_backend(
+	          file,
+	          &io_backend,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "io_backend",
+	 io_backend,
+	 LIBWTCDB_IO_BACKEND_BFIO );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_file_get_io_backend(
+	          NULL,
+	          &io_backend,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_file_get_io_backend(
+	          file,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_file_set_io_backend(
+	          NULL,
+	          LIBWTCDB_IO_BACKEND_BFIO,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_file_set_io_backend(
+	          file,
+	          -1,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwtcdb_file_free(
+	          &file,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libwtcdb_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests opening a file with a specific IO backend requested
+ * The items are compared with those read using the file IO handle
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_file_open_with_io_backend(
+     const system_character_t *source,
+     int requested_io_backend )
+{
+	char narrow_source[ 256 ];
+
+	libcerror_error_t *error    = NULL;
+	libwtcdb_file_t *bfio_file  = NULL;
+	libwtcdb_file_t *file       = NULL;
+	libwtcdb_item_t *bfio_item  = NULL;
+	libwtcdb_item_t *item       = NULL;
+	size_t bfio_identifier_size = 0;
+	size_t identifier_size      = 0;
+	int bfio_number_of_items    = 0;
+	int io_backend              = 0;
+	int item_index              = 0;
+	int number_of_items         = 0;
+	int result                  = 0;
+
+	/* Initialize test
+	 */
+	result = wtcdb_test_get_narrow_source(
+	          source,
+	          narrow_source,
+	          256,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_file_initialize(
+	          &bfio_file,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_file_set_io_backend(
+	          bfio_file,
+	          LIBWTCDB_IO_BACKEND_BFIO,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_file_open(
+	          bfio_file,
+	          narrow_source,
+	          LIBWTCDB_OPEN_READ,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_file_initialize(
+	          &file,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open
+	 */
+	result = libwtcdb_file_set_io_backend(
+	          file,
+	          requested_io_backend,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_file_open(
+	          file,
+	          narrow_source,
+	          LIBWTCDB_OPEN_READ,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* io_uring and pread are not available on every system, in which case
+	 * pread or the file IO handle is used
+	 */
+	result = libwtcdb_file_get_io_backend(
+	          file,
+	          &io_backend,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( ( io_backend != requested_io_backend )
+	 && ( io_backend != LIBWTCDB_IO_BACKEND_PREAD ) )
+	{
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "io_backend",
+		 io_backend,
+		 LIBWTCDB_IO_BACKEND_BFIO );
+	}
+#if defined( HAVE_PREAD )
+	if( requested_io_backend == LIBWTCDB_IO_BACKEND_PREAD )
+	{
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "io_backend",
+		 io_backend,
+		 LIBWTCDB_IO_BACKEND_PREAD );
+	}
+#endif
+	/* Test that the items are the same as read using the file IO handle
+	 */
+	result = libwtcdb_file_get_number_of_items(
+	          bfio_file,
+	          &bfio_number_of_items,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_file_get_number_of_items(
+	          file,
+	          &number_of_items,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_items",
+	 number_of_items,
+	 bfio_number_of_items );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( item_index = 0;
+	     item_index < number_of_items;
+	     item_index++ )
+	{
+		result = libwtcdb_file_get_item(
+		          bfio_file,
+		          item_index,
+		          &bfio_item,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libwtcdb_file_get_item(
+		          file,
+		          item_index,
+		          &item,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		bfio_identifier_size = 0;
+		identifier_size      = 0;
+
+		result = libwtcdb_item_get_utf8_identifier_size(
+		          bfio_item,
+		          &bfio_identifier_size,
+		          &error );
+
+		WTCDB_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libwtcdb_item_get_utf8_identifier_size(
+		          item,
+		          &identifier_size,
+		          &error );
+
+		WTCDB_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		WTCDB_TEST_ASSERT_EQUAL_SIZE(
+		 "identifier_size",
+		 identifier_size,
+		 bfio_identifier_size );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libwtcdb_item_free(
+		          &item,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libwtcdb_item_free(
+		          &bfio_item,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	result = libwtcdb_file_free(
+	          &file,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_file_free(
+	          &bfio_file,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item != NULL )
+	{
+		libwtcdb_item_free(
+		 &item,
+		 NULL );
+	}
+	if( bfio_item != NULL )
+	{
+		libwtcdb_item_free(
+		 &bfio_item,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libwtcdb_file_free(
+		 &file,
+		 NULL );
+	}
+	if( bfio_file != NULL )
+	{
+		libwtcdb_file_free(
+		 &bfio_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests opening a file with the io_uring and pread IO backends requested
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_file_open_io_backend(
+     const system_character_t *source )
+{
+	if( wtcdb_test_file_open_with_io_backend(
+	     source,
+	     LIBWTCDB_IO_BACKEND_IO_URING ) != 1 )
+	{
+		return( 0 );
+	}
+	if( wtcdb_test_file_open_with_io_backend(
+	     source,
+	     LIBWTCDB_IO_BACKEND_PREAD ) != 1 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Tests opening a file with a progress callback
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_file_set_progress_callback(
+     const system_character_t *source )
+{
+	char narrow_source[ 256 ];
+
+	wtcdb_test_file_progress_t progress;
+
+	libcerror_error_t *error = NULL;
+	libwtcdb_file_t *file    = NULL;
+	int number_of_items      = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = wtcdb_test_get_narrow_source(
+	          source,
+	          narrow_source,
+	          256,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_file_initialize(
+	          &file,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_set(
+	 &progress,
+	 0,
+	 sizeof( wtcdb_test_file_progress_t ) );
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_file_set_progress_callback(
+	          file,
+	          &wtcdb_test_file_progress_callback,
+	          (void *) &progress,
+	          0,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_file_open(
+	          file,
+	          narrow_source,
+	          LIBWTCDB_OPEN_READ,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_file_get_number_of_items(
+	          file,
+	          &number_of_items,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The phases are reported regardless of the interval
+	 */
+	WTCDB_TEST_ASSERT_GREATER_THAN_INT(
+	 "progress.number_of_calls",
+	 progress.number_of_calls,
+	 3 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "progress.phase",
+	 progress.phase,
+	 LIBWTCDB_PROGRESS_PHASE_COMPLETED );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT64(
+	 "progress.bytes_scanned",
+	 progress.bytes_scanned,
+	 progress.file_size );
+
+	/* Entries without a hash are read but are not items
+	 */
+	WTCDB_TEST_ASSERT_GREATER_THAN_INT(
+	 "progress.number_of_entries",
+	 progress.number_of_entries,
+	 number_of_items - 1 );
+
+	result = libwtcdb_file_close(
+	          file,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a callback that aborts reading the entries
+	 */
+	memory_set(
+	 &progress,
+	 0,
+	 sizeof( wtcdb_test_file_progress_t ) );
+
+	progress.abort_phase = LIBWTCDB_PROGRESS_PHASE_READ_ENTRIES;
+
+	result = libwtcdb_file_open(
+	          file,
+	          narrow_source,
+	          LIBWTCDB_OPEN_READ,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "progress.phase",
+	 progress.phase,
+	 LIBWTCDB_PROGRESS_PHASE_READ_ENTRIES );
+
+	/* Test that the file can be opened again after an abort without a callback
+	 */
+	result = libwtcdb_file_set_progress_callback(
+	          file,
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_file_open(
+	          file,
+	          narrow_source,
+	          LIBWTCDB_OPEN_READ,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_file_close(
+	          file,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_file_set_progress_callback(
+	          NULL,
+	          &wtcdb_test_file_progress_callback,
+	          (void *) &progress,
+	          0,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwtcdb_file_free(
+	          &file,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libwtcdb_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_file_set_cache_entry_offsets function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_file_set_cache_entry_offsets(
+     const system_character_t *source )
+{
+	char narrow_source[ 256 ];
+
+	libcerror_error_t *error      = NULL;
+	libwtcdb_file_t *file         = NULL;
+	libwtcdb_item_t *item         = NULL;
+	uint32_t *cache_entry_offsets = NULL;
+	uint8_t file_type             = 0;
+	int item_index                = 0;
+	int number_of_items           = 0;
+	int number_of_selected_items  = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = wtcdb_test_get_narrow_source(
+	          source,
+	          narrow_source,
+	          256,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_file_initialize(
+	          &file,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_file_open(
+	          file,
+	          narrow_source,
+	          LIBWTCDB_OPEN_READ,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_file_get_type(
+	          file,
+	          &file_type,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_file_get_number_of_items(
+	          file,
+	          &number_of_items,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	cache_entry_offsets = (uint32_t *) memory_allocate(
+	                                    sizeof( uint32_t ) * ( (size_t) number_of_items + 1 ) );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_entry_offsets",
+	 cache_entry_offsets );
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+	if( file_type == LIBWTCDB_FILE_TYPE_CACHE )
+	{
+		for( item_index = 0;
+		     item_index < number_of_items;
+		     item_index++ )
+		{
+			result = libwtcdb_file_get_item(
+			          file,
+			          item_index,
+			          &item,
+			          &error );
+
+			WTCDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			WTCDB_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			cache_entry_offsets[ number_of_items - 1 - item_index ] = (uint32_t) ( (libwtcdb_cache_entry_t *) ( (libwtcdb_internal_item_t *) item )->entry )->file_offset;
+
+			result = libwtcdb_item_free(
+			          &item,
+			          &error );
+
+			WTCDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			WTCDB_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+
+	result = libwtcdb_file_close(
+	          file,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_file_set_cache_entry_offsets(
+	          file,
+	          cache_entry_offsets,
+	          0,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_file_open(
+	          file,
+	          narrow_source,
+	          LIBWTCDB_OPEN_READ,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_file_get_number_of_items(
+	          file,
+	          &number_of_selected_items,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( file_type == LIBWTCDB_FILE_TYPE_CACHE )
+	{
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "number_of_selected_items",
+		 number_of_selected_items,
+		 0 );
+	}
+	else
+	{
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "number_of_selected_items",
+		 number_of_selected_items,
+		 number_of_items );
+	}
+
+	result = libwtcdb_file_close(
+	          file,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+	if( ( file_type == LIBWTCDB_FILE_TYPE_CACHE )
+	 && ( number_of_items > 0 ) )
+	{
+		/* Test a selection in reverse order that contains every offset twice
+		 */
+		cache_entry_offsets[ number_of_items ] = cache_entry_offsets[ 0 ];
+
+		result = libwtcdb_file_set_cache_entry_offsets(
+		          file,
+		          cache_entry_offsets,
+		          number_of_items + 1,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libwtcdb_file_open(
+		          file,
+		          narrow_source,
+		          LIBWTCDB_OPEN_READ,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libwtcdb_file_get_number_of_items(
+		          file,
+		          &number_of_selected_items,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "number_of_selected_items",
+		 number_of_selected_items,
+		 number_of_items );
+
+		result = libwtcdb_file_close(
+		          file,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test a selection with an offset that does not refer to a cache entry
+		 */
+		cache_entry_offsets[ 0 ] += 1;
+
+		result = libwtcdb_file_set_cache_entry_offsets(
+		          file,
+		          cache_entry_offsets,
+		          1,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libwtcdb_file_open(
+		          file,
+		          narrow_source,
+		          LIBWTCDB_OPEN_READ,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		WTCDB_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+
+	/* Test that clearing the selection reads all the cache entries
+	 */
+	result = libwtcdb_file_set_cache_entry_offsets(
+	          file,
+	          NULL,
+	          0,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_file_open(
+	          file,
+	          narrow_source,
+	          LIBWTCDB_OPEN_READ,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_file_get_number_of_items(
+	          file,
+	          &number_of_selected_items,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_selected_items",
+	 number_of_selected_items,
+	 number_of_items );
+
+	result = libwtcdb_file_close(
+	          file,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_file_set_cache_entry_offsets(
+	          NULL,
+	          cache_entry_offsets,
+	          0,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_file_set_cache_entry_offsets(
+	          file,
+	          cache_entry_offsets,
+	          -1,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 cache_entry_offsets );
+
+	cache_entry_offsets = NULL;
+
+	result = libwtcdb_file_free(
+	          &file,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item != NULL )
+	{
+		libwtcdb_item_free(
+		 &item,
+		 NULL );
+	}
+	if( cache_entry_offsets != NULL )
+	{
+		memory_free(
+		 cache_entry_offsets );
+	}
+	if( file != NULL )
+	{
+		libwtcdb_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests reading the cached data of the items with read-ahead
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_file_read_ahead(
+     libbfio_handle_t *file_io_handle,
+     libwtcdb_file_t *file )
+{
+	libcerror_error_t *error         = NULL;
+	libwtcdb_file_t *read_ahead_file = NULL;
+	libwtcdb_item_t *item            = NULL;
+	libwtcdb_item_t *read_ahead_item = NULL;
+	uint8_t *data                    = NULL;
+	uint8_t *read_ahead_data         = NULL;
+	size_t data_size                 = 0;
+	size_t read_ahead_data_size      = 0;
+	int item_index                   = 0;
+	int number_of_items              = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libwtcdb_file_initialize(
+	          &read_ahead_file,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_file_set_number_of_read_ahead_items(
+	          read_ahead_file,
+	          4,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_file_open_file_io_handle(
+	          read_ahead_file,
+	          file_io_handle,
+	          LIBWTCDB_OPEN_READ,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_file_get_number_of_items(
+	          file,
+	          &number_of_items,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The cached data read with read-ahead must match the cached data read without
+	 */
+	for( item_index = 0;
+	     item_index < number_of_items;
+	     item_index++ )
+	{
+		result = libwtcdb_file_get_item(
+		          file,
+		          item_index,
+		          &item,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libwtcdb_file_get_item(
+		          read_ahead_file,
+		          item_index,
+		          &read_ahead_item,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libwtcdb_item_get_data_size(
+		          item,
+		          &data_size,
+		          &error );
+
+		WTCDB_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( result != 0 )
+		{
+			result = libwtcdb_item_get_data_size(
+			          read_ahead_item,
+			          &read_ahead_data_size,
+			          &error );
+
+			WTCDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			WTCDB_TEST_ASSERT_EQUAL_SIZE(
+			 "read_ahead_data_size",
+			 read_ahead_data_size,
+			 data_size );
+
+			WTCDB_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			data = (uint8_t *) memory_allocate(
+			                    sizeof( uint8_t ) * ( data_size + 1 ) );
+
+			WTCDB_TEST_ASSERT_IS_NOT_NULL(
+			 "data",
+			 data );
+
+			read_ahead_data = (uint8_t *) memory_allocate(
+			                               sizeof( uint8_t ) * ( data_size + 1 ) );
+
+			WTCDB_TEST_ASSERT_IS_NOT_NULL(
+			 "read_ahead_data",
+			 read_ahead_data );
+
+			result = libwtcdb_item_copy_data(
+			          item,
+			          data,
+			          data_size + 1,
+			          &error );
+
+			WTCDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			WTCDB_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libwtcdb_item_copy_data(
+			          read_ahead_item,
+			          read_ahead_data,
+			          data_size + 1,
+			          &error );
+
+			WTCDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			WTCDB_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = memory_compare(
+			          read_ahead_data,
+			          data,
+			          data_size );
+
+			WTCDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+
+			/* Test error case where the data is too small
+			 */
+			if( data_size > 0 )
+			{
+				result = libwtcdb_item_copy_data(
+				          read_ahead_item,
+				          read_ahead_data,
+				          data_size - 1,
+				          &error );
+
+				WTCDB_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 -1 );
+
+				WTCDB_TEST_ASSERT_IS_NOT_NULL(
+				 "error",
+				 error );
+
+				libcerror_error_free(
+				 &error );
+			}
+			memory_free(
+			 read_ahead_data );
+
+			read_ahead_data = NULL;
+
+			memory_free(
+			 data );
+
+			data = NULL;
+		}
+		result = libwtcdb_item_free(
+		          &read_ahead_item,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libwtcdb_item_free(
+		          &item,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	result = libwtcdb_file_close(
+	          read_ahead_file,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_file_free(
+	          &read_ahead_file,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_ahead_data != NULL )
+	{
+		memory_free(
+		 read_ahead_data );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	if( read_ahead_item != NULL )
+	{
+		libwtcdb_item_free(
+		 &read_ahead_item,
+		 NULL );
+	}
+	if( item != NULL )
+	{
+		libwtcdb_item_free(
+		 &item,
+		 NULL );
+	}
+	if( read_ahead_file != NULL )
+	{
+		libwtcdb_file_free(
+		 &read_ahead_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libwtcdb_file_t *file            = NULL;
+	system_character_t *source       = NULL;
+	system_integer_t option          = 0;
+	size_t string_length             = 0;
+	int result                       = 0;
+
+	while( ( option = wtcdb_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( WTCDB_TEST_FILE_VERBOSE )
+	libwtcdb_notify_set_verbose(
+	 1 );
+	libwtcdb_notify_set_stream(
+	 stderr,
+	 NULL );
+#endif
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_file_initialize",
+	 wtcdb_test_file_initialize );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_file_free",
+	 wtcdb_test_file_free );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_file_get_number_of_read_ahead_items",
+	 wtcdb_test_file_number_of_read_ahead_items );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_file_get_io_backend",
+	 wtcdb_test_file_io_backend );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+	if( source != NULL )
+	{
+		result = libbfio_file_initialize(
+		          &file_io_handle,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+	        WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	         "file_io_handle",
+	         file_io_handle );
+
+	        WTCDB_TEST_ASSERT_IS_NULL(
+	         "error",
+	         error );
+
+		string_length = system_string_length(
+		                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 		result = libbfio_file_set_name_wide(
 		          file_io_handle,
 		          source,
@@ -1653,6 +4640,21 @@ int main(
 		 wtcdb_test_file_open_close,
 		 source );
 
+		WTCDB_TEST_RUN_WITH_ARGS(
+		 "libwtcdb_file_set_io_backend",
+		 wtcdb_test_file_open_io_backend,
+		 source );
+
+		WTCDB_TEST_RUN_WITH_ARGS(
+		 "libwtcdb_file_set_progress_callback",
+		 wtcdb_test_file_set_progress_callback,
+		 source );
+
+		WTCDB_TEST_RUN_WITH_ARGS(
+		 "libwtcdb_file_set_cache_entry_offsets",
+		 wtcdb_test_file_set_cache_entry_offsets,
+		 source );
+
 		/* Initialize file for tests
 		 */
 		result = wtcdb_test_file_open_source(
@@ -1673,11 +4675,6 @@ int main(
 		 "error",
 		 error );
 
-		WTCDB_TEST_RUN_WITH_ARGS(
-		 "libwtcdb_file_signal_abort",
-		 wtcdb_test_file_signal_abort,
-		 file );
-
 #if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
 
 		/* TODO: add tests for libwtcdb_file_open_read */
@@ -1703,6 +4700,38 @@ int main(
 		 file );
 */
 
+		WTCDB_TEST_RUN_WITH_ARGS(
+		 "libwtcdb_file_get_item_by_offset",
+		 wtcdb_test_file_get_item_by_offset,
+		 file );
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+
+		WTCDB_TEST_RUN_WITH_ARGS(
+		 "libwtcdb_file_get_snapshot_item",
+		 wtcdb_test_file_get_snapshot_item,
+		 file );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+
+		WTCDB_TEST_RUN_WITH_ARGS(
+		 "libwtcdb_file_for_each_item_parallel",
+		 wtcdb_test_file_for_each_item_parallel,
+		 file );
+
+		WTCDB_TEST_RUN_WITH_ARGS(
+		 "libwtcdb_file_read_ahead",
+		 wtcdb_test_file_read_ahead,
+		 file_io_handle,
+		 file );
+
+		/* Run last since the file remains aborted
+		 */
+		WTCDB_TEST_RUN_WITH_ARGS(
+		 "libwtcdb_file_signal_abort",
+		 wtcdb_test_file_signal_abort,
+		 file );
+
 		/* Clean up
 		 */
 		result = wtcdb_test_file_close_source(
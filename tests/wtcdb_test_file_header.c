@@ -606,6 +606,7 @@ int wtcdb_test_file_header_read_file_io_handle(
 	 */
 	result = libwtcdb_file_header_read_file_io_handle(
 	          file_header,
+	          NULL,
 	          file_io_handle,
 	          &error );
 
@@ -621,6 +622,7 @@ int wtcdb_test_file_header_read_file_io_handle(
 	/* Test error cases
 	 */
 	result = libwtcdb_file_header_read_file_io_handle(
+	          NULL,
 	          NULL,
 	          file_io_handle,
 	          &error );
@@ -640,6 +642,7 @@ int wtcdb_test_file_header_read_file_io_handle(
 	result = libwtcdb_file_header_read_file_io_handle(
 	          file_header,
 	          NULL,
+	          NULL,
 	          &error );
 
 	WTCDB_TEST_ASSERT_EQUAL_INT(
@@ -692,6 +695,7 @@ int wtcdb_test_file_header_read_file_io_handle(
 
 	result = libwtcdb_file_header_read_file_io_handle(
 	          file_header,
+	          NULL,
 	          file_io_handle,
 	          &error );
 
@@ -743,6 +747,7 @@ int wtcdb_test_file_header_read_file_io_handle(
 
 	result = libwtcdb_file_header_read_file_io_handle(
 	          file_header,
+	          NULL,
 	          file_io_handle,
 	          &error );
 
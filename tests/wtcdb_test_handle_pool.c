@@ -0,0 +1,1088 @@
+/*
+ * Library handle_pool type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "wtcdb_test_libbfio.h"
+#include "wtcdb_test_libcerror.h"
+#include "wtcdb_test_libwtcdb.h"
+#include "wtcdb_test_macros.h"
+#include "wtcdb_test_memory.h"
+#include "wtcdb_test_unused.h"
+
+#include "../libwtcdb/libwtcdb_handle_pool.h"
+
+uint8_t wtcdb_test_handle_pool_data[ 16 ] = {
+	0x43, 0x4d, 0x4d, 0x4d, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* Tests the libwtcdb_handle_pool_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_handle_pool_initialize(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libwtcdb_handle_pool_t *handle_pool = NULL;
+	int result                          = 0;
+
+#if defined( HAVE_WTCDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests     = 1;
+	int number_of_memset_fail_tests     = 1;
+	int test_number                     = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_handle_pool_initialize(
+	          &handle_pool,
+	          4,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "handle_pool",
+	 handle_pool );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_handle_pool_free(
+	          &handle_pool,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "handle_pool",
+	 handle_pool );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_handle_pool_initialize(
+	          NULL,
+	          4,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	handle_pool = (libwtcdb_handle_pool_t *) 0x12345678UL;
+
+	result = libwtcdb_handle_pool_initialize(
+	          &handle_pool,
+	          4,
+	          &error );
+
+	handle_pool = NULL;
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_handle_pool_initialize(
+	          &handle_pool,
+	          0,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "handle_pool",
+	 handle_pool );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_WTCDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libwtcdb_handle_pool_initialize with malloc failing
+		 */
+		wtcdb_test_malloc_attempts_before_fail = test_number;
+
+		result = libwtcdb_handle_pool_initialize(
+		          &handle_pool,
+		          4,
+		          &error );
+
+		if( wtcdb_test_malloc_attempts_before_fail != -1 )
+		{
+			wtcdb_test_malloc_attempts_before_fail = -1;
+
+			if( handle_pool != NULL )
+			{
+				libwtcdb_handle_pool_free(
+				 &handle_pool,
+				 NULL );
+			}
+		}
+		else
+		{
+			WTCDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			WTCDB_TEST_ASSERT_IS_NULL(
+			 "handle_pool",
+			 handle_pool );
+
+			WTCDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libwtcdb_handle_pool_initialize with memset failing
+		 */
+		wtcdb_test_memset_attempts_before_fail = test_number;
+
+		result = libwtcdb_handle_pool_initialize(
+		          &handle_pool,
+		          4,
+		          &error );
+
+		if( wtcdb_test_memset_attempts_before_fail != -1 )
+		{
+			wtcdb_test_memset_attempts_before_fail = -1;
+
+			if( handle_pool != NULL )
+			{
+				libwtcdb_handle_pool_free(
+				 &handle_pool,
+				 NULL );
+			}
+		}
+		else
+		{
+			WTCDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			WTCDB_TEST_ASSERT_IS_NULL(
+			 "handle_pool",
+			 handle_pool );
+
+			WTCDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_WTCDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle_pool != NULL )
+	{
+		libwtcdb_handle_pool_free(
+		 &handle_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_handle_pool_free function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_handle_pool_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libwtcdb_handle_pool_free(
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_handle_pool_get_maximum_number_of_open_handles and
+ * libwtcdb_handle_pool_set_maximum_number_of_open_handles functions
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_handle_pool_maximum_number_of_open_handles(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libwtcdb_handle_pool_t *handle_pool = NULL;
+	int maximum_number_of_open_handles  = 0;
+	int number_of_open_handles          = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libwtcdb_handle_pool_initialize(
+	          &handle_pool,
+	          4,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "handle_pool",
+	 handle_pool );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_handle_pool_get_maximum_number_of_open_handles(
+	          handle_pool,
+	          &maximum_number_of_open_handles,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "maximum_number_of_open_handles",
+	 maximum_number_of_open_handles,
+	 4 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_handle_pool_set_maximum_number_of_open_handles(
+	          handle_pool,
+	          2,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_handle_pool_get_maximum_number_of_open_handles(
+	          handle_pool,
+	          &maximum_number_of_open_handles,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "maximum_number_of_open_handles",
+	 maximum_number_of_open_handles,
+	 2 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_handle_pool_get_number_of_open_handles(
+	          handle_pool,
+	          &number_of_open_handles,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_open_handles",
+	 number_of_open_handles,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_handle_pool_get_maximum_number_of_open_handles(
+	          NULL,
+	          &maximum_number_of_open_handles,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_handle_pool_get_maximum_number_of_open_handles(
+	          handle_pool,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_handle_pool_set_maximum_number_of_open_handles(
+	          NULL,
+	          2,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_handle_pool_set_maximum_number_of_open_handles(
+	          handle_pool,
+	          0,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_handle_pool_get_number_of_open_handles(
+	          NULL,
+	          &number_of_open_handles,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_handle_pool_get_number_of_open_handles(
+	          handle_pool,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwtcdb_handle_pool_free(
+	          &handle_pool,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "handle_pool",
+	 handle_pool );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle_pool != NULL )
+	{
+		libwtcdb_handle_pool_free(
+		 &handle_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+
+/* Tests the libwtcdb_handle_pool_append_handle, libwtcdb_handle_pool_grab_handle,
+ * libwtcdb_handle_pool_release_handle and libwtcdb_handle_pool_remove_handle functions
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_handle_pool_grab_handle(
+     void )
+{
+	libbfio_handle_t *file_io_handles[ 2 ]       = { NULL, NULL };
+	libcerror_error_t *error                     = NULL;
+	libwtcdb_handle_pool_entry_t *entries[ 2 ]   = { NULL, NULL };
+	libwtcdb_handle_pool_t *handle_pool          = NULL;
+	uint8_t data[ 4 ];
+	ssize_t read_count                           = 0;
+	int handle_index                             = 0;
+	int number_of_open_handles                   = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libwtcdb_handle_pool_initialize(
+	          &handle_pool,
+	          1,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "handle_pool",
+	 handle_pool );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( handle_index = 0;
+	     handle_index < 2;
+	     handle_index++ )
+	{
+		result = libbfio_memory_range_initialize(
+		          &( file_io_handles[ handle_index ] ),
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_memory_range_set(
+		          file_io_handles[ handle_index ],
+		          wtcdb_test_handle_pool_data,
+		          16,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libwtcdb_handle_pool_append_handle(
+		          handle_pool,
+		          file_io_handles[ handle_index ],
+		          LIBBFIO_ACCESS_FLAG_READ,
+		          &( entries[ handle_index ] ),
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NOT_NULL(
+		 "entry",
+		 entries[ handle_index ] );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	result = libwtcdb_handle_pool_grab_handle(
+	          handle_pool,
+	          entries[ 0 ],
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handles[ 0 ],
+	              data,
+	              4,
+	              0,
+	              &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 4 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Removing a handle that is in use should fail
+	 */
+	result = libwtcdb_handle_pool_remove_handle(
+	          handle_pool,
+	          &( entries[ 0 ] ),
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Grabbing a second handle while the first is in use exceeds the maximum temporarily
+	 */
+	result = libwtcdb_handle_pool_grab_handle(
+	          handle_pool,
+	          entries[ 1 ],
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_handle_pool_get_number_of_open_handles(
+	          handle_pool,
+	          &number_of_open_handles,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_open_handles",
+	 number_of_open_handles,
+	 2 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Releasing the first handle closes it since it is the least recently used idle handle
+	 */
+	result = libwtcdb_handle_pool_release_handle(
+	          handle_pool,
+	          entries[ 0 ],
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_is_open(
+	          file_io_handles[ 0 ],
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_handle_pool_release_handle(
+	          handle_pool,
+	          entries[ 1 ],
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_handle_pool_get_number_of_open_handles(
+	          handle_pool,
+	          &number_of_open_handles,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_open_handles",
+	 number_of_open_handles,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Grabbing the first handle again reopens it and closes the idle second handle
+	 */
+	result = libwtcdb_handle_pool_grab_handle(
+	          handle_pool,
+	          entries[ 0 ],
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_is_open(
+	          file_io_handles[ 1 ],
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handles[ 0 ],
+	              data,
+	              4,
+	              0,
+	              &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 4 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_handle_pool_release_handle(
+	          handle_pool,
+	          entries[ 0 ],
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_handle_pool_release_handle(
+	          handle_pool,
+	          entries[ 0 ],
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_handle_pool_grab_handle(
+	          NULL,
+	          entries[ 0 ],
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_handle_pool_grab_handle(
+	          handle_pool,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_handle_pool_append_handle(
+	          handle_pool,
+	          NULL,
+	          LIBBFIO_ACCESS_FLAG_READ,
+	          &( entries[ 0 ] ),
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Freeing a handle pool with registered handles should fail
+	 */
+	result = libwtcdb_handle_pool_free(
+	          &handle_pool,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "handle_pool",
+	 handle_pool );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	for( handle_index = 0;
+	     handle_index < 2;
+	     handle_index++ )
+	{
+		result = libwtcdb_handle_pool_remove_handle(
+		          handle_pool,
+		          &( entries[ handle_index ] ),
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "entry",
+		 entries[ handle_index ] );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_handle_free(
+		          &( file_io_handles[ handle_index ] ),
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libwtcdb_handle_pool_get_number_of_open_handles(
+	          handle_pool,
+	          &number_of_open_handles,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_open_handles",
+	 number_of_open_handles,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_handle_pool_free(
+	          &handle_pool,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( handle_index = 0;
+	     handle_index < 2;
+	     handle_index++ )
+	{
+		if( entries[ handle_index ] != NULL )
+		{
+			entries[ handle_index ]->number_of_users = 0;
+
+			libwtcdb_handle_pool_remove_handle(
+			 handle_pool,
+			 &( entries[ handle_index ] ),
+			 NULL );
+		}
+		if( file_io_handles[ handle_index ] != NULL )
+		{
+			libbfio_handle_free(
+			 &( file_io_handles[ handle_index ] ),
+			 NULL );
+		}
+	}
+	if( handle_pool != NULL )
+	{
+		libwtcdb_handle_pool_free(
+		 &handle_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc WTCDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] WTCDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc WTCDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] WTCDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	WTCDB_TEST_UNREFERENCED_PARAMETER( argc )
+	WTCDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_handle_pool_initialize",
+	 wtcdb_test_handle_pool_initialize );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_handle_pool_free",
+	 wtcdb_test_handle_pool_free );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_handle_pool_get_maximum_number_of_open_handles",
+	 wtcdb_test_handle_pool_maximum_number_of_open_handles );
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_handle_pool_grab_handle",
+	 wtcdb_test_handle_pool_grab_handle );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
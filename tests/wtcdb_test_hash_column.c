@@ -0,0 +1,791 @@
+/*
+ * Library hash_column type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "wtcdb_test_libcerror.h"
+#include "wtcdb_test_libwtcdb.h"
+#include "wtcdb_test_macros.h"
+#include "wtcdb_test_memory.h"
+#include "wtcdb_test_unused.h"
+
+#include "../libwtcdb/libwtcdb_cache_entry.h"
+#include "../libwtcdb/libwtcdb_definitions.h"
+#include "../libwtcdb/libwtcdb_hash_column.h"
+#include "../libwtcdb/libwtcdb_libcdata.h"
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+
+/* Tests the libwtcdb_hash_column_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_hash_column_initialize(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libwtcdb_hash_column_t *hash_column = NULL;
+	int result                          = 0;
+
+#if defined( HAVE_WTCDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests     = 3;
+	int number_of_memset_fail_tests     = 1;
+	int test_number                     = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_hash_column_initialize(
+	          &hash_column,
+	          4,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "hash_column",
+	 hash_column );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "hash_column->number_of_entries",
+	 hash_column->number_of_entries,
+	 4 );
+
+	result = libwtcdb_hash_column_free(
+	          &hash_column,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "hash_column",
+	 hash_column );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with no entries
+	 */
+	result = libwtcdb_hash_column_initialize(
+	          &hash_column,
+	          0,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "hash_column",
+	 hash_column );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_hash_column_free(
+	          &hash_column,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_hash_column_initialize(
+	          NULL,
+	          4,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	hash_column = (libwtcdb_hash_column_t *) 0x12345678UL;
+
+	result = libwtcdb_hash_column_initialize(
+	          &hash_column,
+	          4,
+	          &error );
+
+	hash_column = NULL;
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_hash_column_initialize(
+	          &hash_column,
+	          -1,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_WTCDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libwtcdb_hash_column_initialize with malloc failing
+		 */
+		wtcdb_test_malloc_attempts_before_fail = test_number;
+
+		result = libwtcdb_hash_column_initialize(
+		          &hash_column,
+		          4,
+		          &error );
+
+		if( wtcdb_test_malloc_attempts_before_fail != -1 )
+		{
+			wtcdb_test_malloc_attempts_before_fail = -1;
+
+			if( hash_column != NULL )
+			{
+				libwtcdb_hash_column_free(
+				 &hash_column,
+				 NULL );
+			}
+		}
+		else
+		{
+			WTCDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			WTCDB_TEST_ASSERT_IS_NULL(
+			 "hash_column",
+			 hash_column );
+
+			WTCDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libwtcdb_hash_column_initialize with memset failing
+		 */
+		wtcdb_test_memset_attempts_before_fail = test_number;
+
+		result = libwtcdb_hash_column_initialize(
+		          &hash_column,
+		          4,
+		          &error );
+
+		if( wtcdb_test_memset_attempts_before_fail != -1 )
+		{
+			wtcdb_test_memset_attempts_before_fail = -1;
+
+			if( hash_column != NULL )
+			{
+				libwtcdb_hash_column_free(
+				 &hash_column,
+				 NULL );
+			}
+		}
+		else
+		{
+			WTCDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			WTCDB_TEST_ASSERT_IS_NULL(
+			 "hash_column",
+			 hash_column );
+
+			WTCDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_WTCDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hash_column != NULL )
+	{
+		libwtcdb_hash_column_free(
+		 &hash_column,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_hash_column_free function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_hash_column_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libwtcdb_hash_column_free(
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_hash_column_read_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_hash_column_read_entries(
+     void )
+{
+	libcdata_array_t *entries_array     = NULL;
+	libcerror_error_t *error            = NULL;
+	libwtcdb_cache_entry_t *cache_entry = NULL;
+	libwtcdb_hash_column_t *hash_column = NULL;
+	int entry_index                     = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libcdata_array_initialize(
+	          &entries_array,
+	          0,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( entry_index = 0;
+	     entry_index < 3;
+	     entry_index++ )
+	{
+		result = libwtcdb_cache_entry_initialize(
+		          &cache_entry,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		cache_entry->hash = 0x1000000000000000ULL - (uint64_t) entry_index;
+
+		result = libcdata_array_append_entry(
+		          entries_array,
+		          &entry_index,
+		          (intptr_t *) cache_entry,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		cache_entry = NULL;
+	}
+	result = libwtcdb_hash_column_initialize(
+	          &hash_column,
+	          3,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_hash_column_read_entries(
+	          hash_column,
+	          entries_array,
+	          LIBWTCDB_FILE_TYPE_CACHE,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( entry_index = 0;
+	     entry_index < 3;
+	     entry_index++ )
+	{
+		WTCDB_TEST_ASSERT_EQUAL_UINT64(
+		 "hash_column->hashes[ entry_index ]",
+		 hash_column->hashes[ entry_index ],
+		 (uint64_t) ( 0x1000000000000000ULL - (uint64_t) entry_index ) );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "hash_column->entry_indexes[ entry_index ]",
+		 hash_column->entry_indexes[ entry_index ],
+		 entry_index );
+	}
+	result = libwtcdb_hash_column_sort(
+	          hash_column,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "hash_column->entry_indexes[ 0 ]",
+	 hash_column->entry_indexes[ 0 ],
+	 2 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "hash_column->entry_indexes[ 2 ]",
+	 hash_column->entry_indexes[ 2 ],
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_hash_column_read_entries(
+	          NULL,
+	          entries_array,
+	          LIBWTCDB_FILE_TYPE_CACHE,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_hash_column_read_entries(
+	          hash_column,
+	          NULL,
+	          LIBWTCDB_FILE_TYPE_CACHE,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a number of entries that does not match
+	 */
+	hash_column->number_of_entries = 2;
+
+	result = libwtcdb_hash_column_read_entries(
+	          hash_column,
+	          entries_array,
+	          LIBWTCDB_FILE_TYPE_CACHE,
+	          &error );
+
+	hash_column->number_of_entries = 3;
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwtcdb_hash_column_free(
+	          &hash_column,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_free(
+	          &entries_array,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libwtcdb_cache_entry_free,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hash_column != NULL )
+	{
+		libwtcdb_hash_column_free(
+		 &hash_column,
+		 NULL );
+	}
+	if( cache_entry != NULL )
+	{
+		libwtcdb_cache_entry_free(
+		 &cache_entry,
+		 NULL );
+	}
+	if( entries_array != NULL )
+	{
+		libcdata_array_free(
+		 &entries_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libwtcdb_cache_entry_free,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_hash_column_sort function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_hash_column_sort(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libwtcdb_hash_column_t *hash_column = NULL;
+	uint64_t hash                       = 0;
+	uint64_t previous_hash              = 0;
+	uint32_t seed                       = 0x2545f491UL;
+	int entry_index                     = 0;
+	int previous_entry_index            = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libwtcdb_hash_column_initialize(
+	          &hash_column,
+	          1024,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Use hashes that differ in every byte and contain duplicates
+	 */
+	for( entry_index = 0;
+	     entry_index < 1024;
+	     entry_index++ )
+	{
+		if( ( entry_index % 4 ) != 3 )
+		{
+			seed ^= seed << 13;
+			seed ^= seed >> 17;
+			seed ^= seed << 5;
+
+			hash = ( (uint64_t) seed << 32 ) | ( seed ^ 0xa5a5a5a5UL );
+		}
+		hash_column->hashes[ entry_index ]        = hash;
+		hash_column->entry_indexes[ entry_index ] = entry_index;
+	}
+	/* Test regular cases
+	 */
+	result = libwtcdb_hash_column_sort(
+	          hash_column,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	previous_hash        = hash_column->hashes[ 0 ];
+	previous_entry_index = hash_column->entry_indexes[ 0 ];
+
+	for( entry_index = 1;
+	     entry_index < 1024;
+	     entry_index++ )
+	{
+		hash = hash_column->hashes[ entry_index ];
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "hash >= previous_hash",
+		 (int) ( hash >= previous_hash ),
+		 1 );
+
+		/* Entries with the same hash must remain in entry order
+		 */
+		if( hash == previous_hash )
+		{
+			WTCDB_TEST_ASSERT_GREATER_THAN_INT(
+			 "hash_column->entry_indexes[ entry_index ]",
+			 hash_column->entry_indexes[ entry_index ],
+			 previous_entry_index );
+		}
+		previous_hash        = hash;
+		previous_entry_index = hash_column->entry_indexes[ entry_index ];
+	}
+	/* Test sorting a sorted hash column
+	 */
+	result = libwtcdb_hash_column_sort(
+	          hash_column,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT64(
+	 "hash_column->hashes[ 1023 ]",
+	 hash_column->hashes[ 1023 ],
+	 previous_hash );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_hash_column_sort(
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwtcdb_hash_column_free(
+	          &hash_column,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hash_column != NULL )
+	{
+		libwtcdb_hash_column_free(
+		 &hash_column,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc WTCDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] WTCDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc WTCDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] WTCDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	WTCDB_TEST_UNREFERENCED_PARAMETER( argc )
+	WTCDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_hash_column_initialize",
+	 wtcdb_test_hash_column_initialize );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_hash_column_free",
+	 wtcdb_test_hash_column_free );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_hash_column_read_entries",
+	 wtcdb_test_hash_column_read_entries );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_hash_column_sort",
+	 wtcdb_test_hash_column_sort );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,679 @@
+/*
+ * Library hash_index type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "wtcdb_test_libcerror.h"
+#include "wtcdb_test_libwtcdb.h"
+#include "wtcdb_test_macros.h"
+#include "wtcdb_test_memory.h"
+#include "wtcdb_test_unused.h"
+
+#include "../libwtcdb/libwtcdb_hash_index.h"
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+
+/* Tests the libwtcdb_hash_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_hash_index_initialize(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libwtcdb_hash_index_t *hash_index = NULL;
+	int result                        = 0;
+
+#if defined( HAVE_WTCDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests   = 2;
+	int number_of_memset_fail_tests   = 1;
+	int test_number                   = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_hash_index_initialize(
+	          &hash_index,
+	          8,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "hash_index",
+	 hash_index );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_hash_index_free(
+	          &hash_index,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "hash_index",
+	 hash_index );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_hash_index_initialize(
+	          NULL,
+	          8,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	hash_index = (libwtcdb_hash_index_t *) 0x12345678UL;
+
+	result = libwtcdb_hash_index_initialize(
+	          &hash_index,
+	          8,
+	          &error );
+
+	hash_index = NULL;
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_hash_index_initialize(
+	          &hash_index,
+	          -1,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "hash_index",
+	 hash_index );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_WTCDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libwtcdb_hash_index_initialize with malloc failing
+		 */
+		wtcdb_test_malloc_attempts_before_fail = test_number;
+
+		result = libwtcdb_hash_index_initialize(
+		          &hash_index,
+		          8,
+		          &error );
+
+		if( wtcdb_test_malloc_attempts_before_fail != -1 )
+		{
+			wtcdb_test_malloc_attempts_before_fail = -1;
+
+			if( hash_index != NULL )
+			{
+				libwtcdb_hash_index_free(
+				 &hash_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			WTCDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			WTCDB_TEST_ASSERT_IS_NULL(
+			 "hash_index",
+			 hash_index );
+
+			WTCDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libwtcdb_hash_index_initialize with memset failing
+		 */
+		wtcdb_test_memset_attempts_before_fail = test_number;
+
+		result = libwtcdb_hash_index_initialize(
+		          &hash_index,
+		          8,
+		          &error );
+
+		if( wtcdb_test_memset_attempts_before_fail != -1 )
+		{
+			wtcdb_test_memset_attempts_before_fail = -1;
+
+			if( hash_index != NULL )
+			{
+				libwtcdb_hash_index_free(
+				 &hash_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			WTCDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			WTCDB_TEST_ASSERT_IS_NULL(
+			 "hash_index",
+			 hash_index );
+
+			WTCDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_WTCDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hash_index != NULL )
+	{
+		libwtcdb_hash_index_free(
+		 &hash_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_hash_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_hash_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libwtcdb_hash_index_free(
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_hash_index_get_records_by_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_hash_index_get_records_by_hash(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libwtcdb_hash_index_t *hash_index = NULL;
+	int first_record_index            = 0;
+	int number_of_records             = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libwtcdb_hash_index_initialize(
+	          &hash_index,
+	          4,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "hash_index",
+	 hash_index );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_hash_index_append_record(
+	          hash_index,
+	          0x3f00000000000002UL,
+	          2,
+	          7,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_hash_index_append_record(
+	          hash_index,
+	          0x0100000000000000UL,
+	          1,
+	          3,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_hash_index_append_record(
+	          hash_index,
+	          0x3f00000000000002UL,
+	          0,
+	          5,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_hash_index_append_record(
+	          hash_index,
+	          0x3f00000000000002UL,
+	          1,
+	          0,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_hash_index_sort(
+	          hash_index,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_hash_index_get_records_by_hash(
+	          hash_index,
+	          0x3f00000000000002UL,
+	          &first_record_index,
+	          &number_of_records,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "first_record_index",
+	 first_record_index,
+	 1 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 3 );
+
+	/* The records of a hash are sorted by file index
+	 */
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "hash_index->records[ 1 ].file_index",
+	 hash_index->records[ 1 ].file_index,
+	 0 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "hash_index->records[ 2 ].entry_index",
+	 hash_index->records[ 2 ].entry_index,
+	 0 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "hash_index->records[ 3 ].file_index",
+	 hash_index->records[ 3 ].file_index,
+	 2 );
+
+	result = libwtcdb_hash_index_get_records_by_hash(
+	          hash_index,
+	          0x0100000000000000UL,
+	          &first_record_index,
+	          &number_of_records,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "first_record_index",
+	 first_record_index,
+	 0 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 1 );
+
+	result = libwtcdb_hash_index_get_records_by_hash(
+	          hash_index,
+	          0x0000000000000001UL,
+	          &first_record_index,
+	          &number_of_records,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_hash_index_get_records_by_hash(
+	          hash_index,
+	          0xffffffffffffffffUL,
+	          &first_record_index,
+	          &number_of_records,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_hash_index_append_record(
+	          hash_index,
+	          0x0100000000000000UL,
+	          3,
+	          0,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_hash_index_get_records_by_hash(
+	          NULL,
+	          0x0100000000000000UL,
+	          &first_record_index,
+	          &number_of_records,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_hash_index_get_records_by_hash(
+	          hash_index,
+	          0x0100000000000000UL,
+	          NULL,
+	          &number_of_records,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_hash_index_get_records_by_hash(
+	          hash_index,
+	          0x0100000000000000UL,
+	          &first_record_index,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_hash_index_sort(
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwtcdb_hash_index_free(
+	          &hash_index,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "hash_index",
+	 hash_index );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hash_index != NULL )
+	{
+		libwtcdb_hash_index_free(
+		 &hash_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc WTCDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] WTCDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc WTCDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] WTCDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	WTCDB_TEST_UNREFERENCED_PARAMETER( argc )
+	WTCDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_hash_index_initialize",
+	 wtcdb_test_hash_index_initialize );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_hash_index_free",
+	 wtcdb_test_hash_index_free );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_hash_index_get_records_by_hash",
+	 wtcdb_test_hash_index_get_records_by_hash );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
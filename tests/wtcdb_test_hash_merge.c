@@ -0,0 +1,1263 @@
+/*
+ * Library hash_merge type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "wtcdb_test_functions.h"
+#include "wtcdb_test_getopt.h"
+#include "wtcdb_test_libbfio.h"
+#include "wtcdb_test_libcerror.h"
+#include "wtcdb_test_libwtcdb.h"
+#include "wtcdb_test_macros.h"
+#include "wtcdb_test_memory.h"
+#include "wtcdb_test_unused.h"
+
+#include "../libwtcdb/libwtcdb_hash_merge.h"
+
+#if !defined( LIBWTCDB_HAVE_BFIO )
+
+LIBWTCDB_EXTERN \
+int libwtcdb_check_file_signature_file_io_handle(
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+#endif /* !defined( LIBWTCDB_HAVE_BFIO ) */
+
+/* Retrieves all the items of a hash merge and checks they are in hash order
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int wtcdb_test_hash_merge_get_items(
+     libwtcdb_hash_merge_t *hash_merge,
+     int *number_of_items,
+     libcerror_error_t **error )
+{
+	libwtcdb_item_t *item      = NULL;
+	uint64_t hash              = 0;
+	uint64_t previous_hash     = 0;
+	int input_index            = 0;
+	int previous_input_index   = 0;
+	int result                 = 0;
+
+	*number_of_items = 0;
+
+	do
+	{
+		result = libwtcdb_hash_merge_get_next_item(
+		          hash_merge,
+		          &hash,
+		          &input_index,
+		          &item,
+		          error );
+
+		if( result != 1 )
+		{
+			break;
+		}
+		if( item == NULL )
+		{
+			return( 0 );
+		}
+		if( libwtcdb_item_free(
+		     &item,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		if( *number_of_items > 0 )
+		{
+			if( hash < previous_hash )
+			{
+				return( 0 );
+			}
+			if( ( hash == previous_hash )
+			 && ( input_index < previous_input_index ) )
+			{
+				return( 0 );
+			}
+		}
+		previous_hash        = hash;
+		previous_input_index = input_index;
+
+		*number_of_items += 1;
+	}
+	while( result == 1 );
+
+	if( result == -1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Tests the libwtcdb_hash_merge_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_hash_merge_initialize(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libwtcdb_hash_merge_t *hash_merge = NULL;
+	int result                        = 0;
+
+#if defined( HAVE_WTCDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests   = 1;
+	int number_of_memset_fail_tests   = 1;
+	int test_number                   = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_hash_merge_initialize(
+	          &hash_merge,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "hash_merge",
+	 hash_merge );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_hash_merge_free(
+	          &hash_merge,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "hash_merge",
+	 hash_merge );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_hash_merge_initialize(
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	hash_merge = (libwtcdb_hash_merge_t *) 0x12345678UL;
+
+	result = libwtcdb_hash_merge_initialize(
+	          &hash_merge,
+	          &error );
+
+	hash_merge = NULL;
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_WTCDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libwtcdb_hash_merge_initialize with malloc failing
+		 */
+		wtcdb_test_malloc_attempts_before_fail = test_number;
+
+		result = libwtcdb_hash_merge_initialize(
+		          &hash_merge,
+		          &error );
+
+		if( wtcdb_test_malloc_attempts_before_fail != -1 )
+		{
+			wtcdb_test_malloc_attempts_before_fail = -1;
+
+			if( hash_merge != NULL )
+			{
+				libwtcdb_hash_merge_free(
+				 &hash_merge,
+				 NULL );
+			}
+		}
+		else
+		{
+			WTCDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			WTCDB_TEST_ASSERT_IS_NULL(
+			 "hash_merge",
+			 hash_merge );
+
+			WTCDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libwtcdb_hash_merge_initialize with memset failing
+		 */
+		wtcdb_test_memset_attempts_before_fail = test_number;
+
+		result = libwtcdb_hash_merge_initialize(
+		          &hash_merge,
+		          &error );
+
+		if( wtcdb_test_memset_attempts_before_fail != -1 )
+		{
+			wtcdb_test_memset_attempts_before_fail = -1;
+
+			if( hash_merge != NULL )
+			{
+				libwtcdb_hash_merge_free(
+				 &hash_merge,
+				 NULL );
+			}
+		}
+		else
+		{
+			WTCDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			WTCDB_TEST_ASSERT_IS_NULL(
+			 "hash_merge",
+			 hash_merge );
+
+			WTCDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_WTCDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hash_merge != NULL )
+	{
+		libwtcdb_hash_merge_free(
+		 &hash_merge,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_hash_merge_free function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_hash_merge_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libwtcdb_hash_merge_free(
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_hash_merge_append_file and libwtcdb_hash_merge_get_next_item functions
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_hash_merge_append_file(
+     const system_character_t *source )
+{
+	char narrow_source[ 256 ];
+
+	libcerror_error_t *error          = NULL;
+	libwtcdb_file_t *files[ 2 ]       = { NULL, NULL };
+	libwtcdb_file_t *unopened_file    = NULL;
+	libwtcdb_hash_merge_t *hash_merge = NULL;
+	libwtcdb_item_t *item             = NULL;
+	uint64_t hash                     = 0;
+	int file_index                    = 0;
+	int input_index                   = 0;
+	int number_of_inputs              = 0;
+	int number_of_items               = 0;
+	int number_of_merged_items        = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = wtcdb_test_get_narrow_source(
+	          source,
+	          narrow_source,
+	          256,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( file_index = 0;
+	     file_index < 2;
+	     file_index++ )
+	{
+		result = libwtcdb_file_initialize(
+		          &( files[ file_index ] ),
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libwtcdb_file_open(
+		          files[ file_index ],
+		          narrow_source,
+		          LIBWTCDB_OPEN_READ,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libwtcdb_file_get_number_of_items(
+	          files[ 0 ],
+	          &number_of_items,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_file_initialize(
+	          &unopened_file,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_hash_merge_initialize(
+	          &hash_merge,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( file_index = 0;
+	     file_index < 2;
+	     file_index++ )
+	{
+		result = libwtcdb_hash_merge_append_file(
+		          hash_merge,
+		          files[ file_index ],
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libwtcdb_hash_merge_get_number_of_inputs(
+	          hash_merge,
+	          &number_of_inputs,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_inputs",
+	 number_of_inputs,
+	 2 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Both files contain the same items, hence every hash is returned twice
+	 */
+	result = wtcdb_test_hash_merge_get_items(
+	          hash_merge,
+	          &number_of_merged_items,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_merged_items",
+	 number_of_merged_items,
+	 2 * number_of_items );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_hash_merge_get_next_item(
+	          hash_merge,
+	          &hash,
+	          &input_index,
+	          &item,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "item",
+	 item );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_hash_merge_append_file(
+	          NULL,
+	          files[ 0 ],
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_hash_merge_append_file(
+	          hash_merge,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_hash_merge_append_file(
+	          hash_merge,
+	          unopened_file,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test appending a file after the iteration has started
+	 */
+	result = libwtcdb_hash_merge_append_file(
+	          hash_merge,
+	          files[ 0 ],
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_hash_merge_get_next_item(
+	          NULL,
+	          &hash,
+	          &input_index,
+	          &item,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_hash_merge_get_next_item(
+	          hash_merge,
+	          NULL,
+	          &input_index,
+	          &item,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_hash_merge_get_next_item(
+	          hash_merge,
+	          &hash,
+	          NULL,
+	          &item,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_hash_merge_get_next_item(
+	          hash_merge,
+	          &hash,
+	          &input_index,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_hash_merge_get_number_of_inputs(
+	          NULL,
+	          &number_of_inputs,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_hash_merge_get_number_of_inputs(
+	          hash_merge,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwtcdb_hash_merge_free(
+	          &hash_merge,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_file_free(
+	          &unopened_file,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( file_index = 0;
+	     file_index < 2;
+	     file_index++ )
+	{
+		result = libwtcdb_file_close(
+		          files[ file_index ],
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libwtcdb_file_free(
+		          &( files[ file_index ] ),
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item != NULL )
+	{
+		libwtcdb_item_free(
+		 &item,
+		 NULL );
+	}
+	if( hash_merge != NULL )
+	{
+		libwtcdb_hash_merge_free(
+		 &hash_merge,
+		 NULL );
+	}
+	if( unopened_file != NULL )
+	{
+		libwtcdb_file_free(
+		 &unopened_file,
+		 NULL );
+	}
+	for( file_index = 0;
+	     file_index < 2;
+	     file_index++ )
+	{
+		if( files[ file_index ] != NULL )
+		{
+			libwtcdb_file_free(
+			 &( files[ file_index ] ),
+			 NULL );
+		}
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_hash_merge_append_cache_set function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_hash_merge_append_cache_set(
+     const system_character_t *source )
+{
+	char narrow_source[ 256 ];
+
+	char *filenames[ 2 ]              = { NULL, NULL };
+	libcerror_error_t *error          = NULL;
+	libwtcdb_cache_set_t *cache_set   = NULL;
+	libwtcdb_file_t *file             = NULL;
+	libwtcdb_hash_merge_t *hash_merge = NULL;
+	uint8_t file_type                 = 0;
+	int expected_number_of_inputs     = 0;
+	int number_of_inputs              = 0;
+	int number_of_items               = 0;
+	int number_of_merged_items        = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = wtcdb_test_get_narrow_source(
+	          source,
+	          narrow_source,
+	          256,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	filenames[ 0 ] = narrow_source;
+	filenames[ 1 ] = narrow_source;
+
+	result = libwtcdb_cache_set_initialize(
+	          &cache_set,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_cache_set_open_files(
+	          cache_set,
+	          filenames,
+	          2,
+	          LIBWTCDB_OPEN_READ,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_cache_set_get_file_by_index(
+	          cache_set,
+	          0,
+	          &file,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_file_get_type(
+	          file,
+	          &file_type,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Only cache files are merged
+	 */
+	if( file_type == LIBWTCDB_FILE_TYPE_CACHE )
+	{
+		result = libwtcdb_file_get_number_of_items(
+		          file,
+		          &number_of_items,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		expected_number_of_inputs = 2;
+	}
+	result = libwtcdb_hash_merge_initialize(
+	          &hash_merge,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_hash_merge_append_cache_set(
+	          hash_merge,
+	          cache_set,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_hash_merge_get_number_of_inputs(
+	          hash_merge,
+	          &number_of_inputs,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_inputs",
+	 number_of_inputs,
+	 expected_number_of_inputs );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wtcdb_test_hash_merge_get_items(
+	          hash_merge,
+	          &number_of_merged_items,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_merged_items",
+	 number_of_merged_items,
+	 2 * number_of_items );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_hash_merge_append_cache_set(
+	          NULL,
+	          cache_set,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_hash_merge_append_cache_set(
+	          hash_merge,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwtcdb_hash_merge_free(
+	          &hash_merge,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_cache_set_close(
+	          cache_set,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_cache_set_free(
+	          &cache_set,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hash_merge != NULL )
+	{
+		libwtcdb_hash_merge_free(
+		 &hash_merge,
+		 NULL );
+	}
+	if( cache_set != NULL )
+	{
+		libwtcdb_cache_set_free(
+		 &cache_set,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	system_character_t *source       = NULL;
+	system_integer_t option          = 0;
+	size_t string_length             = 0;
+	int result                       = 0;
+
+	while( ( option = wtcdb_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
+	WTCDB_TEST_RUN(
+	 "libwtcdb_hash_merge_initialize",
+	 wtcdb_test_hash_merge_initialize );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_hash_merge_free",
+	 wtcdb_test_hash_merge_free );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+	if( source != NULL )
+	{
+		result = libbfio_file_initialize(
+		          &file_io_handle,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NOT_NULL(
+		 "file_io_handle",
+		 file_io_handle );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		string_length = system_string_length(
+		                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libbfio_file_set_name_wide(
+		          file_io_handle,
+		          source,
+		          string_length,
+		          &error );
+#else
+		result = libbfio_file_set_name(
+		          file_io_handle,
+		          source,
+		          string_length,
+		          &error );
+#endif
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libwtcdb_check_file_signature_file_io_handle(
+		          file_io_handle,
+		          &error );
+
+		WTCDB_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	if( result != 0 )
+	{
+		WTCDB_TEST_RUN_WITH_ARGS(
+		 "libwtcdb_hash_merge_append_file",
+		 wtcdb_test_hash_merge_append_file,
+		 source );
+
+		WTCDB_TEST_RUN_WITH_ARGS(
+		 "libwtcdb_hash_merge_append_cache_set",
+		 wtcdb_test_hash_merge_append_cache_set,
+		 source );
+	}
+	if( file_io_handle != NULL )
+	{
+		result = libbfio_handle_free(
+		          &file_io_handle,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "file_io_handle",
+		 file_io_handle );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
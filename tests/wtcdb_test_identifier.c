@@ -0,0 +1,1091 @@
+/*
+ * Library identifier functions test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "wtcdb_test_libcerror.h"
+#include "wtcdb_test_libwtcdb.h"
+#include "wtcdb_test_macros.h"
+#include "wtcdb_test_unused.h"
+
+#include "../libwtcdb/libwtcdb_identifier.h"
+
+/* UTF-16 little-endian identifier of 40 ASCII characters
+ */
+uint8_t wtcdb_test_identifier_utf16_stream1[ 80 ] = {
+	0x30, 0x00, 0x31, 0x00, 0x32, 0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36, 0x00, 0x37, 0x00,
+	0x38, 0x00, 0x39, 0x00, 0x61, 0x00, 0x62, 0x00, 0x63, 0x00, 0x64, 0x00, 0x65, 0x00, 0x66, 0x00,
+	0x30, 0x00, 0x31, 0x00, 0x32, 0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36, 0x00, 0x37, 0x00,
+	0x38, 0x00, 0x39, 0x00, 0x61, 0x00, 0x62, 0x00, 0x63, 0x00, 0x64, 0x00, 0x65, 0x00, 0x66, 0x00,
+	0x30, 0x00, 0x31, 0x00, 0x32, 0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36, 0x00, 0x37, 0x00 };
+
+/* UTF-16 little-endian identifier with a non-ASCII character: "abc\u00e9def"
+ */
+uint8_t wtcdb_test_identifier_utf16_stream2[ 14 ] = {
+	0x61, 0x00, 0x62, 0x00, 0x63, 0x00, 0xe9, 0x00, 0x64, 0x00, 0x65, 0x00, 0x66, 0x00 };
+
+/* UTF-16 little-endian identifier with an end-of-string character: "8bad"
+ */
+uint8_t wtcdb_test_identifier_utf16_stream3[ 12 ] = {
+	0x38, 0x00, 0x62, 0x00, 0x61, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* UTF-8 string of identifier 2
+ */
+uint8_t wtcdb_test_identifier_utf8_string2[ 9 ] = {
+	'a', 'b', 'c', 0xc3, 0xa9, 'd', 'e', 'f', 0 };
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+
+/* Tests the libwtcdb_identifier_get_ascii_length function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_identifier_get_ascii_length(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t ascii_length      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_identifier_get_ascii_length(
+	          wtcdb_test_identifier_utf16_stream1,
+	          80,
+	          &ascii_length,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_SIZE(
+	 "ascii_length",
+	 ascii_length,
+	 (size_t) 40 );
+
+	result = libwtcdb_identifier_get_ascii_length(
+	          wtcdb_test_identifier_utf16_stream2,
+	          14,
+	          &ascii_length,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_SIZE(
+	 "ascii_length",
+	 ascii_length,
+	 (size_t) 3 );
+
+	result = libwtcdb_identifier_get_ascii_length(
+	          wtcdb_test_identifier_utf16_stream3,
+	          12,
+	          &ascii_length,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_SIZE(
+	 "ascii_length",
+	 ascii_length,
+	 (size_t) 4 );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_identifier_get_ascii_length(
+	          NULL,
+	          80,
+	          &ascii_length,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_identifier_get_ascii_length(
+	          wtcdb_test_identifier_utf16_stream1,
+	          (size_t) SSIZE_MAX + 1,
+	          &ascii_length,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_identifier_get_ascii_length(
+	          wtcdb_test_identifier_utf16_stream1,
+	          80,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_identifier_copy_ascii function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_identifier_copy_ascii(
+     void )
+{
+	uint8_t ascii_string[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	size_t ascii_length      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_identifier_copy_ascii(
+	          wtcdb_test_identifier_utf16_stream1,
+	          80,
+	          ascii_string,
+	          64,
+	          &ascii_length,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_SIZE(
+	 "ascii_length",
+	 ascii_length,
+	 (size_t) 40 );
+
+	result = memory_compare(
+	          ascii_string,
+	          "0123456789abcdef0123456789abcdef01234567",
+	          40 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test with an ASCII string that is too small to contain all the characters
+	 */
+	result = libwtcdb_identifier_copy_ascii(
+	          wtcdb_test_identifier_utf16_stream1,
+	          80,
+	          ascii_string,
+	          20,
+	          &ascii_length,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_SIZE(
+	 "ascii_length",
+	 ascii_length,
+	 (size_t) 20 );
+
+	/* Test with a non-ASCII character
+	 */
+	result = libwtcdb_identifier_copy_ascii(
+	          wtcdb_test_identifier_utf16_stream2,
+	          14,
+	          ascii_string,
+	          64,
+	          &ascii_length,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_SIZE(
+	 "ascii_length",
+	 ascii_length,
+	 (size_t) 3 );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_identifier_copy_ascii(
+	          NULL,
+	          80,
+	          ascii_string,
+	          64,
+	          &ascii_length,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_identifier_copy_ascii(
+	          wtcdb_test_identifier_utf16_stream1,
+	          80,
+	          NULL,
+	          64,
+	          &ascii_length,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_identifier_copy_ascii(
+	          wtcdb_test_identifier_utf16_stream1,
+	          80,
+	          ascii_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &ascii_length,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_identifier_copy_ascii(
+	          wtcdb_test_identifier_utf16_stream1,
+	          80,
+	          ascii_string,
+	          64,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_identifier_get_utf8_string_size function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_identifier_get_utf8_string_size(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_size  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_identifier_get_utf8_string_size(
+	          wtcdb_test_identifier_utf16_stream1,
+	          80,
+	          &utf8_string_size,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 41 );
+
+	result = libwtcdb_identifier_get_utf8_string_size(
+	          wtcdb_test_identifier_utf16_stream2,
+	          14,
+	          &utf8_string_size,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 9 );
+
+	result = libwtcdb_identifier_get_utf8_string_size(
+	          wtcdb_test_identifier_utf16_stream3,
+	          12,
+	          &utf8_string_size,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 5 );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_identifier_get_utf8_string_size(
+	          NULL,
+	          80,
+	          &utf8_string_size,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_identifier_get_utf8_string_size(
+	          wtcdb_test_identifier_utf16_stream1,
+	          79,
+	          &utf8_string_size,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_identifier_get_utf8_string_size(
+	          wtcdb_test_identifier_utf16_stream1,
+	          80,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_identifier_copy_to_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_identifier_copy_to_utf8_string(
+     void )
+{
+	uint8_t utf8_string[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_identifier_copy_to_utf8_string(
+	          wtcdb_test_identifier_utf16_stream1,
+	          80,
+	          utf8_string,
+	          64,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "0123456789abcdef0123456789abcdef01234567",
+	          41 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libwtcdb_identifier_copy_to_utf8_string(
+	          wtcdb_test_identifier_utf16_stream2,
+	          14,
+	          utf8_string,
+	          64,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          wtcdb_test_identifier_utf8_string2,
+	          9 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libwtcdb_identifier_copy_to_utf8_string(
+	          wtcdb_test_identifier_utf16_stream3,
+	          12,
+	          utf8_string,
+	          64,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "8bad",
+	          5 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_identifier_copy_to_utf8_string(
+	          NULL,
+	          80,
+	          utf8_string,
+	          64,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_identifier_copy_to_utf8_string(
+	          wtcdb_test_identifier_utf16_stream1,
+	          79,
+	          utf8_string,
+	          64,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_identifier_copy_to_utf8_string(
+	          wtcdb_test_identifier_utf16_stream1,
+	          80,
+	          NULL,
+	          64,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_identifier_copy_to_utf8_string(
+	          wtcdb_test_identifier_utf16_stream1,
+	          80,
+	          utf8_string,
+	          0,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an UTF-8 string that is too small
+	 */
+	result = libwtcdb_identifier_copy_to_utf8_string(
+	          wtcdb_test_identifier_utf16_stream1,
+	          80,
+	          utf8_string,
+	          40,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_identifier_copy_to_utf8_string(
+	          wtcdb_test_identifier_utf16_stream2,
+	          14,
+	          utf8_string,
+	          8,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_identifier_get_utf16_string_size function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_identifier_get_utf16_string_size(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t utf16_string_size = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_identifier_get_utf16_string_size(
+	          wtcdb_test_identifier_utf16_stream1,
+	          80,
+	          &utf16_string_size,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_size",
+	 utf16_string_size,
+	 (size_t) 41 );
+
+	result = libwtcdb_identifier_get_utf16_string_size(
+	          wtcdb_test_identifier_utf16_stream2,
+	          14,
+	          &utf16_string_size,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_size",
+	 utf16_string_size,
+	 (size_t) 8 );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_identifier_get_utf16_string_size(
+	          NULL,
+	          80,
+	          &utf16_string_size,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_identifier_get_utf16_string_size(
+	          wtcdb_test_identifier_utf16_stream1,
+	          79,
+	          &utf16_string_size,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_identifier_get_utf16_string_size(
+	          wtcdb_test_identifier_utf16_stream1,
+	          80,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_identifier_copy_to_utf16_string function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_identifier_copy_to_utf16_string(
+     void )
+{
+	uint16_t utf16_string[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_identifier_copy_to_utf16_string(
+	          wtcdb_test_identifier_utf16_stream1,
+	          80,
+	          utf16_string,
+	          64,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT16(
+	 "utf16_string[ 39 ]",
+	 utf16_string[ 39 ],
+	 (uint16_t) '7' );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT16(
+	 "utf16_string[ 40 ]",
+	 utf16_string[ 40 ],
+	 0 );
+
+	result = libwtcdb_identifier_copy_to_utf16_string(
+	          wtcdb_test_identifier_utf16_stream2,
+	          14,
+	          utf16_string,
+	          64,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT16(
+	 "utf16_string[ 3 ]",
+	 utf16_string[ 3 ],
+	 0x00e9 );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT16(
+	 "utf16_string[ 7 ]",
+	 utf16_string[ 7 ],
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_identifier_copy_to_utf16_string(
+	          NULL,
+	          80,
+	          utf16_string,
+	          64,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_identifier_copy_to_utf16_string(
+	          wtcdb_test_identifier_utf16_stream1,
+	          79,
+	          utf16_string,
+	          64,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_identifier_copy_to_utf16_string(
+	          wtcdb_test_identifier_utf16_stream1,
+	          80,
+	          NULL,
+	          64,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_identifier_copy_to_utf16_string(
+	          wtcdb_test_identifier_utf16_stream1,
+	          80,
+	          utf16_string,
+	          0,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_identifier_copy_to_utf16_string(
+	          wtcdb_test_identifier_utf16_stream1,
+	          80,
+	          utf16_string,
+	          40,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc WTCDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] WTCDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc WTCDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] WTCDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	WTCDB_TEST_UNREFERENCED_PARAMETER( argc )
+	WTCDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_identifier_get_ascii_length",
+	 wtcdb_test_identifier_get_ascii_length );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_identifier_copy_ascii",
+	 wtcdb_test_identifier_copy_ascii );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_identifier_get_utf8_string_size",
+	 wtcdb_test_identifier_get_utf8_string_size );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_identifier_copy_to_utf8_string",
+	 wtcdb_test_identifier_copy_to_utf8_string );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_identifier_get_utf16_string_size",
+	 wtcdb_test_identifier_get_utf16_string_size );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_identifier_copy_to_utf16_string",
+	 wtcdb_test_identifier_copy_to_utf16_string );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1253 @@
+/*
+ * Library image_header type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "wtcdb_test_functions.h"
+#include "wtcdb_test_libbfio.h"
+#include "wtcdb_test_libcerror.h"
+#include "wtcdb_test_libwtcdb.h"
+#include "wtcdb_test_macros.h"
+#include "wtcdb_test_memory.h"
+#include "wtcdb_test_unused.h"
+
+#include "../libwtcdb/libwtcdb_image_header.h"
+
+/* BMP image header of 96 x 64 pixels top-down with 24 bits per pixel
+ */
+uint8_t wtcdb_test_image_header_bmp_data1[ 32 ] = {
+	0x42, 0x4d, 0x36, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x28, 0x00,
+	0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xc0, 0xff, 0xff, 0xff, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00 };
+
+/* BMP image header of 96 x 2147483648 pixels top-down with 24 bits per pixel
+ */
+uint8_t wtcdb_test_image_header_bmp_data2[ 32 ] = {
+	0x42, 0x4d, 0x36, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x28, 0x00,
+	0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00 };
+
+/* JPEG image of 128 x 96 pixels with 3 components of 8 bits
+ */
+uint8_t wtcdb_test_image_header_jpeg_data1[ 41 ] = {
+	0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+	0x00, 0x01, 0x00, 0x00, 0xff, 0xc0, 0x00, 0x11, 0x08, 0x00, 0x60, 0x00, 0x80, 0x03, 0x01, 0x22,
+	0x00, 0x02, 0x11, 0x01, 0x03, 0x11, 0x01, 0xff, 0xd9 };
+
+/* Progressive JPEG image of 64 x 32 pixels with 1 component of 8 bits
+ * The start of frame segment is preceded by a define Huffman table segment
+ */
+uint8_t wtcdb_test_image_header_jpeg_data2[ 23 ] = {
+	0xff, 0xd8, 0xff, 0xc4, 0x00, 0x04, 0x00, 0x00, 0xff, 0xc2, 0x00, 0x0b, 0x08, 0x00, 0x20, 0x00,
+	0x40, 0x01, 0x01, 0x11, 0x00, 0xff, 0xd9 };
+
+/* JPEG image without a start of frame segment
+ */
+uint8_t wtcdb_test_image_header_jpeg_error_data1[ 24 ] = {
+	0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+	0x00, 0x01, 0x00, 0x00, 0xff, 0xda, 0x00, 0x08 };
+
+/* PNG image header of 256 x 192 pixels RGBA with 8 bits per sample
+ */
+uint8_t wtcdb_test_image_header_png_data1[ 32 ] = {
+	0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x08, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+
+/* Tests the libwtcdb_image_header_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_image_header_initialize(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libwtcdb_image_header_t *image_header = NULL;
+	int result                            = 0;
+
+#if defined( HAVE_WTCDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests       = 1;
+	int number_of_memset_fail_tests       = 1;
+	int test_number                       = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_image_header_initialize(
+	          &image_header,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "image_header",
+	 image_header );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_image_header_free(
+	          &image_header,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "image_header",
+	 image_header );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_image_header_initialize(
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	image_header = (libwtcdb_image_header_t *) 0x12345678UL;
+
+	result = libwtcdb_image_header_initialize(
+	          &image_header,
+	          &error );
+
+	image_header = NULL;
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_WTCDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libwtcdb_image_header_initialize with malloc failing
+		 */
+		wtcdb_test_malloc_attempts_before_fail = test_number;
+
+		result = libwtcdb_image_header_initialize(
+		          &image_header,
+		          &error );
+
+		if( wtcdb_test_malloc_attempts_before_fail != -1 )
+		{
+			wtcdb_test_malloc_attempts_before_fail = -1;
+
+			if( image_header != NULL )
+			{
+				libwtcdb_image_header_free(
+				 &image_header,
+				 NULL );
+			}
+		}
+		else
+		{
+			WTCDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			WTCDB_TEST_ASSERT_IS_NULL(
+			 "image_header",
+			 image_header );
+
+			WTCDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libwtcdb_image_header_initialize with memset failing
+		 */
+		wtcdb_test_memset_attempts_before_fail = test_number;
+
+		result = libwtcdb_image_header_initialize(
+		          &image_header,
+		          &error );
+
+		if( wtcdb_test_memset_attempts_before_fail != -1 )
+		{
+			wtcdb_test_memset_attempts_before_fail = -1;
+
+			if( image_header != NULL )
+			{
+				libwtcdb_image_header_free(
+				 &image_header,
+				 NULL );
+			}
+		}
+		else
+		{
+			WTCDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			WTCDB_TEST_ASSERT_IS_NULL(
+			 "image_header",
+			 image_header );
+
+			WTCDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_WTCDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( image_header != NULL )
+	{
+		libwtcdb_image_header_free(
+		 &image_header,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_image_header_free function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_image_header_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libwtcdb_image_header_free(
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_image_header_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_image_header_read_data(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libwtcdb_image_header_t *image_header = NULL;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libwtcdb_image_header_initialize(
+	          &image_header,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "image_header",
+	 image_header );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_image_header_read_data(
+	          image_header,
+	          wtcdb_test_image_header_png_data1,
+	          32,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT8(
+	 "image_header->format",
+	 image_header->format,
+	 LIBWTCDB_IMAGE_FORMAT_PNG );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT32(
+	 "image_header->width",
+	 image_header->width,
+	 256 );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT32(
+	 "image_header->height",
+	 image_header->height,
+	 192 );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT16(
+	 "image_header->bits_per_pixel",
+	 image_header->bits_per_pixel,
+	 32 );
+
+	result = libwtcdb_image_header_read_data(
+	          image_header,
+	          wtcdb_test_image_header_bmp_data1,
+	          32,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT8(
+	 "image_header->format",
+	 image_header->format,
+	 LIBWTCDB_IMAGE_FORMAT_BMP );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT32(
+	 "image_header->width",
+	 image_header->width,
+	 96 );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT32(
+	 "image_header->height",
+	 image_header->height,
+	 64 );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT16(
+	 "image_header->bits_per_pixel",
+	 image_header->bits_per_pixel,
+	 24 );
+
+	/* Test with the most negative height
+	 */
+	result = libwtcdb_image_header_read_data(
+	          image_header,
+	          wtcdb_test_image_header_bmp_data2,
+	          32,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT32(
+	 "image_header->height",
+	 image_header->height,
+	 0x80000000UL );
+
+	result = libwtcdb_image_header_read_data(
+	          image_header,
+	          wtcdb_test_image_header_jpeg_data1,
+	          32,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT8(
+	 "image_header->format",
+	 image_header->format,
+	 LIBWTCDB_IMAGE_FORMAT_JPEG );
+
+	/* Test with unsupported data
+	 */
+	result = libwtcdb_image_header_read_data(
+	          image_header,
+	          &( wtcdb_test_image_header_png_data1[ 1 ] ),
+	          31,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT8(
+	 "image_header->format",
+	 image_header->format,
+	 LIBWTCDB_IMAGE_FORMAT_UNKNOWN );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_image_header_read_data(
+	          NULL,
+	          wtcdb_test_image_header_png_data1,
+	          32,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_image_header_read_data(
+	          image_header,
+	          NULL,
+	          32,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_image_header_read_data(
+	          image_header,
+	          wtcdb_test_image_header_png_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwtcdb_image_header_free(
+	          &image_header,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "image_header",
+	 image_header );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( image_header != NULL )
+	{
+		libwtcdb_image_header_free(
+		 &image_header,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_image_header_read_jpeg_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_image_header_read_jpeg_file_io_handle(
+     void )
+{
+	libbfio_handle_t *file_io_handle      = NULL;
+	libcerror_error_t *error              = NULL;
+	libwtcdb_image_header_t *image_header = NULL;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libwtcdb_image_header_initialize(
+	          &image_header,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "image_header",
+	 image_header );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = wtcdb_test_open_file_io_handle(
+	          &file_io_handle,
+	          wtcdb_test_image_header_jpeg_data1,
+	          41,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_image_header_read_jpeg_file_io_handle(
+	          image_header,
+	          NULL,
+	          file_io_handle,
+	          0,
+	          41,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT32(
+	 "image_header->width",
+	 image_header->width,
+	 128 );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT32(
+	 "image_header->height",
+	 image_header->height,
+	 96 );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT16(
+	 "image_header->bits_per_pixel",
+	 image_header->bits_per_pixel,
+	 24 );
+
+	/* Test with the start of frame segment beyond the data size
+	 */
+	result = libwtcdb_image_header_read_jpeg_file_io_handle(
+	          image_header,
+	          NULL,
+	          file_io_handle,
+	          0,
+	          22,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_image_header_read_jpeg_file_io_handle(
+	          NULL,
+	          NULL,
+	          file_io_handle,
+	          0,
+	          41,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_image_header_read_jpeg_file_io_handle(
+	          image_header,
+	          NULL,
+	          NULL,
+	          0,
+	          41,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_image_header_read_jpeg_file_io_handle(
+	          image_header,
+	          NULL,
+	          file_io_handle,
+	          -1,
+	          41,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = wtcdb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a progressive start of frame segment that follows a define Huffman table segment
+	 */
+	result = wtcdb_test_open_file_io_handle(
+	          &file_io_handle,
+	          wtcdb_test_image_header_jpeg_data2,
+	          23,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_image_header_read_jpeg_file_io_handle(
+	          image_header,
+	          NULL,
+	          file_io_handle,
+	          0,
+	          23,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT32(
+	 "image_header->width",
+	 image_header->width,
+	 64 );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT32(
+	 "image_header->height",
+	 image_header->height,
+	 32 );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT16(
+	 "image_header->bits_per_pixel",
+	 image_header->bits_per_pixel,
+	 8 );
+
+	result = wtcdb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test JPEG image without a start of frame segment
+	 */
+	result = wtcdb_test_open_file_io_handle(
+	          &file_io_handle,
+	          wtcdb_test_image_header_jpeg_error_data1,
+	          24,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_image_header_read_jpeg_file_io_handle(
+	          image_header,
+	          NULL,
+	          file_io_handle,
+	          0,
+	          24,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wtcdb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libwtcdb_image_header_free(
+	          &image_header,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "image_header",
+	 image_header );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( image_header != NULL )
+	{
+		libwtcdb_image_header_free(
+		 &image_header,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_image_header_read_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_image_header_read_file_io_handle(
+     void )
+{
+	libbfio_handle_t *file_io_handle      = NULL;
+	libcerror_error_t *error              = NULL;
+	libwtcdb_image_header_t *image_header = NULL;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libwtcdb_image_header_initialize(
+	          &image_header,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "image_header",
+	 image_header );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize file IO handle
+	 */
+	result = wtcdb_test_open_file_io_handle(
+	          &file_io_handle,
+	          wtcdb_test_image_header_jpeg_data1,
+	          41,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_image_header_read_file_io_handle(
+	          image_header,
+	          NULL,
+	          file_io_handle,
+	          0,
+	          41,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT8(
+	 "image_header->format",
+	 image_header->format,
+	 LIBWTCDB_IMAGE_FORMAT_JPEG );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT32(
+	 "image_header->width",
+	 image_header->width,
+	 128 );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT32(
+	 "image_header->height",
+	 image_header->height,
+	 96 );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT16(
+	 "image_header->bits_per_pixel",
+	 image_header->bits_per_pixel,
+	 24 );
+
+	/* Test with the start of frame segment beyond the data size
+	 */
+	result = libwtcdb_image_header_read_file_io_handle(
+	          image_header,
+	          NULL,
+	          file_io_handle,
+	          0,
+	          22,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_image_header_read_file_io_handle(
+	          NULL,
+	          NULL,
+	          file_io_handle,
+	          0,
+	          41,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_image_header_read_file_io_handle(
+	          image_header,
+	          NULL,
+	          NULL,
+	          0,
+	          41,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_image_header_read_file_io_handle(
+	          image_header,
+	          NULL,
+	          file_io_handle,
+	          -1,
+	          41,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test data too small
+	 */
+	result = libwtcdb_image_header_read_file_io_handle(
+	          image_header,
+	          NULL,
+	          file_io_handle,
+	          32,
+	          41,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up file IO handle
+	 */
+	result = wtcdb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test JPEG image without a start of frame segment
+	 */
+	result = wtcdb_test_open_file_io_handle(
+	          &file_io_handle,
+	          wtcdb_test_image_header_jpeg_error_data1,
+	          24,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_image_header_read_file_io_handle(
+	          image_header,
+	          NULL,
+	          file_io_handle,
+	          0,
+	          24,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wtcdb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libwtcdb_image_header_free(
+	          &image_header,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "image_header",
+	 image_header );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( image_header != NULL )
+	{
+		libwtcdb_image_header_free(
+		 &image_header,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc WTCDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] WTCDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc WTCDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] WTCDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	WTCDB_TEST_UNREFERENCED_PARAMETER( argc )
+	WTCDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_image_header_initialize",
+	 wtcdb_test_image_header_initialize );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_image_header_free",
+	 wtcdb_test_image_header_free );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_image_header_read_data",
+	 wtcdb_test_image_header_read_data );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_image_header_read_jpeg_file_io_handle",
+	 wtcdb_test_image_header_read_jpeg_file_io_handle );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_image_header_read_file_io_handle",
+	 wtcdb_test_image_header_read_file_io_handle );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -350,6 +350,26 @@ int wtcdb_test_index_entry_read_data(
 	 "error",
 	 error );
 
+	WTCDB_TEST_ASSERT_EQUAL_UINT32(
+	 "index_entry->flags",
+	 index_entry->flags,
+	 (uint32_t) 0x00000001UL );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "index_entry->number_of_cache_entry_offsets",
+	 index_entry->number_of_cache_entry_offsets,
+	 5 );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT32(
+	 "index_entry->cache_entry_offsets[ 0 ]",
+	 index_entry->cache_entry_offsets[ 0 ],
+	 (uint32_t) 0xffffffffUL );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT32(
+	 "index_entry->cache_entry_offsets[ 2 ]",
+	 index_entry->cache_entry_offsets[ 2 ],
+	 (uint32_t) 0x00129c95UL );
+
 	io_handle->file_type      = LIBWTCDB_FILE_TYPE_INDEX;
 	io_handle->format_version = 21;
 
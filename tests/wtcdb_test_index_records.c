@@ -0,0 +1,954 @@
+/*
+ * Library index_records type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "wtcdb_test_libcerror.h"
+#include "wtcdb_test_libwtcdb.h"
+#include "wtcdb_test_macros.h"
+#include "wtcdb_test_memory.h"
+#include "wtcdb_test_unused.h"
+
+#include "../libwtcdb/libwtcdb_index_records.h"
+#include "../libwtcdb/libwtcdb_io_handle.h"
+
+/* The number of records is not a multiple of 4 to test decoding the remaining records
+ */
+#define WTCDB_TEST_INDEX_RECORDS_NUMBER_OF_RECORDS	13
+
+uint8_t wtcdb_test_index_records_data1[ 40 ] = {
+	0x94, 0x53, 0xb1, 0x8f, 0xf9, 0x50, 0x45, 0x5c, 0x00, 0x4a, 0x6e, 0x27, 0x50, 0x63, 0xc5, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x95, 0x9c, 0x12, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff };
+
+uint8_t wtcdb_test_index_records_data2[ 32 ] = {
+	0x2b, 0x0d, 0x06, 0xc0, 0x7b, 0x75, 0x1e, 0xa1, 0x02, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0x17, 0x80, 0x67, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff };
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+
+/* Tests the libwtcdb_index_records_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_index_records_initialize(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libwtcdb_index_records_t *index_records = NULL;
+	int result                              = 0;
+
+#if defined( HAVE_WTCDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests         = 1;
+	int number_of_memset_fail_tests         = 1;
+	int test_number                         = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_index_records_initialize(
+	          &index_records,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "index_records",
+	 index_records );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_index_records_free(
+	          &index_records,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "index_records",
+	 index_records );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_index_records_initialize(
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	index_records = (libwtcdb_index_records_t *) 0x12345678UL;
+
+	result = libwtcdb_index_records_initialize(
+	          &index_records,
+	          &error );
+
+	index_records = NULL;
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_WTCDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libwtcdb_index_records_initialize with malloc failing
+		 */
+		wtcdb_test_malloc_attempts_before_fail = test_number;
+
+		result = libwtcdb_index_records_initialize(
+		          &index_records,
+		          &error );
+
+		if( wtcdb_test_malloc_attempts_before_fail != -1 )
+		{
+			wtcdb_test_malloc_attempts_before_fail = -1;
+
+			if( index_records != NULL )
+			{
+				libwtcdb_index_records_free(
+				 &index_records,
+				 NULL );
+			}
+		}
+		else
+		{
+			WTCDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			WTCDB_TEST_ASSERT_IS_NULL(
+			 "index_records",
+			 index_records );
+
+			WTCDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libwtcdb_index_records_initialize with memset failing
+		 */
+		wtcdb_test_memset_attempts_before_fail = test_number;
+
+		result = libwtcdb_index_records_initialize(
+		          &index_records,
+		          &error );
+
+		if( wtcdb_test_memset_attempts_before_fail != -1 )
+		{
+			wtcdb_test_memset_attempts_before_fail = -1;
+
+			if( index_records != NULL )
+			{
+				libwtcdb_index_records_free(
+				 &index_records,
+				 NULL );
+			}
+		}
+		else
+		{
+			WTCDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			WTCDB_TEST_ASSERT_IS_NULL(
+			 "index_records",
+			 index_records );
+
+			WTCDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_WTCDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index_records != NULL )
+	{
+		libwtcdb_index_records_free(
+		 &index_records,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_index_records_free function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_index_records_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libwtcdb_index_records_free(
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_index_records_get_record_layout function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_index_records_get_record_layout(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	size_t cache_entry_offsets_offset = 0;
+	size_t flags_offset               = 0;
+	size_t record_size                = 0;
+	int number_of_cache_entry_offsets = 0;
+	int result                        = 0;
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_index_records_get_record_layout(
+	          20,
+	          &record_size,
+	          &flags_offset,
+	          &cache_entry_offsets_offset,
+	          &number_of_cache_entry_offsets,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_EQUAL_SIZE(
+	 "record_size",
+	 record_size,
+	 (size_t) 40 );
+
+	WTCDB_TEST_ASSERT_EQUAL_SIZE(
+	 "flags_offset",
+	 flags_offset,
+	 (size_t) 16 );
+
+	WTCDB_TEST_ASSERT_EQUAL_SIZE(
+	 "cache_entry_offsets_offset",
+	 cache_entry_offsets_offset,
+	 (size_t) 20 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_cache_entry_offsets",
+	 number_of_cache_entry_offsets,
+	 5 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_index_records_get_record_layout(
+	          32,
+	          &record_size,
+	          &flags_offset,
+	          &cache_entry_offsets_offset,
+	          &number_of_cache_entry_offsets,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_EQUAL_SIZE(
+	 "record_size",
+	 record_size,
+	 (size_t) 72 );
+
+	WTCDB_TEST_ASSERT_EQUAL_SIZE(
+	 "flags_offset",
+	 flags_offset,
+	 (size_t) 8 );
+
+	WTCDB_TEST_ASSERT_EQUAL_SIZE(
+	 "cache_entry_offsets_offset",
+	 cache_entry_offsets_offset,
+	 (size_t) 16 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_cache_entry_offsets",
+	 number_of_cache_entry_offsets,
+	 14 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_index_records_get_record_layout(
+	          0xffffffffUL,
+	          &record_size,
+	          &flags_offset,
+	          &cache_entry_offsets_offset,
+	          &number_of_cache_entry_offsets,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_index_records_get_record_layout(
+	          20,
+	          NULL,
+	          &flags_offset,
+	          &cache_entry_offsets_offset,
+	          &number_of_cache_entry_offsets,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_index_records_get_record_layout(
+	          20,
+	          &record_size,
+	          NULL,
+	          &cache_entry_offsets_offset,
+	          &number_of_cache_entry_offsets,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_index_records_get_record_layout(
+	          20,
+	          &record_size,
+	          &flags_offset,
+	          NULL,
+	          &number_of_cache_entry_offsets,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_index_records_get_record_layout(
+	          20,
+	          &record_size,
+	          &flags_offset,
+	          &cache_entry_offsets_offset,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_index_records_read_data function with a specific format version
+ * The number of records is chosen so that both the vectorized and remaining records are decoded
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_index_records_read_data_with_format_version(
+     libwtcdb_io_handle_t *io_handle,
+     uint32_t format_version,
+     const uint8_t *record_data,
+     size_t record_size,
+     uint64_t expected_modification_time,
+     uint32_t expected_flags,
+     uint32_t expected_cache_entry_offset )
+{
+	uint8_t data[ WTCDB_TEST_INDEX_RECORDS_NUMBER_OF_RECORDS * 40 ];
+
+	libcerror_error_t *error                = NULL;
+	libwtcdb_index_records_t *index_records = NULL;
+	uint64_t expected_hash                  = 0;
+	int offset_index                        = 0;
+	int record_index                        = 0;
+	int result                              = 0;
+
+	io_handle->format_version = format_version;
+
+	for( record_index = 0;
+	     record_index < WTCDB_TEST_INDEX_RECORDS_NUMBER_OF_RECORDS;
+	     record_index++ )
+	{
+		memory_copy(
+		 &( data[ record_index * record_size ] ),
+		 record_data,
+		 record_size );
+
+		data[ record_index * record_size ] = (uint8_t) record_index;
+	}
+	result = libwtcdb_index_records_initialize(
+	          &index_records,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "index_records",
+	 index_records );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_index_records_read_data(
+	          index_records,
+	          io_handle,
+	          data,
+	          record_size * WTCDB_TEST_INDEX_RECORDS_NUMBER_OF_RECORDS,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "index_records->number_of_records",
+	 index_records->number_of_records,
+	 WTCDB_TEST_INDEX_RECORDS_NUMBER_OF_RECORDS );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "index_records->number_of_cache_entry_offsets",
+	 index_records->number_of_cache_entry_offsets,
+	 5 );
+
+	for( record_index = 0;
+	     record_index < WTCDB_TEST_INDEX_RECORDS_NUMBER_OF_RECORDS;
+	     record_index++ )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ record_index * record_size ] ),
+		 expected_hash );
+
+		WTCDB_TEST_ASSERT_EQUAL_UINT64(
+		 "index_records->hashes[ record_index ]",
+		 index_records->hashes[ record_index ],
+		 expected_hash );
+
+		WTCDB_TEST_ASSERT_EQUAL_UINT64(
+		 "index_records->modification_times[ record_index ]",
+		 index_records->modification_times[ record_index ],
+		 expected_modification_time );
+
+		WTCDB_TEST_ASSERT_EQUAL_UINT32(
+		 "index_records->flags[ record_index ]",
+		 index_records->flags[ record_index ],
+		 expected_flags );
+
+		for( offset_index = 0;
+		     offset_index < 5;
+		     offset_index++ )
+		{
+			if( offset_index == 2 )
+			{
+				WTCDB_TEST_ASSERT_EQUAL_UINT32(
+				 "index_records->cache_entry_offsets[ offset_index ]",
+				 index_records->cache_entry_offsets[ ( record_index * 5 ) + offset_index ],
+				 expected_cache_entry_offset );
+			}
+			else
+			{
+				WTCDB_TEST_ASSERT_EQUAL_UINT32(
+				 "index_records->cache_entry_offsets[ offset_index ]",
+				 index_records->cache_entry_offsets[ ( record_index * 5 ) + offset_index ],
+				 (uint32_t) 0xffffffffUL );
+			}
+		}
+	}
+	/* Test error cases
+	 */
+	result = libwtcdb_index_records_read_data(
+	          index_records,
+	          io_handle,
+	          data,
+	          record_size - 1,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwtcdb_index_records_free(
+	          &index_records,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "index_records",
+	 index_records );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index_records != NULL )
+	{
+		libwtcdb_index_records_free(
+		 &index_records,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_index_records_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_index_records_read_data(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libwtcdb_index_records_t *index_records = NULL;
+	libwtcdb_io_handle_t *io_handle         = NULL;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libwtcdb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->file_type = LIBWTCDB_FILE_TYPE_INDEX;
+
+	/* Test regular cases
+	 */
+	result = wtcdb_test_index_records_read_data_with_format_version(
+	          io_handle,
+	          20,
+	          wtcdb_test_index_records_data1,
+	          40,
+	          0x01c56350276e4a00ULL,
+	          0x00000001UL,
+	          0x00129c95UL );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = wtcdb_test_index_records_read_data_with_format_version(
+	          io_handle,
+	          21,
+	          wtcdb_test_index_records_data2,
+	          32,
+	          0,
+	          0x80000002UL,
+	          0x00678017UL );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libwtcdb_index_records_initialize(
+	          &index_records,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "index_records",
+	 index_records );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_index_records_read_data(
+	          NULL,
+	          io_handle,
+	          wtcdb_test_index_records_data2,
+	          32,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_index_records_read_data(
+	          index_records,
+	          NULL,
+	          wtcdb_test_index_records_data2,
+	          32,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_index_records_read_data(
+	          index_records,
+	          io_handle,
+	          NULL,
+	          32,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_index_records_read_data(
+	          index_records,
+	          io_handle,
+	          wtcdb_test_index_records_data2,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the format version is not supported
+	 */
+	io_handle->format_version = 0xffffffffUL;
+
+	result = libwtcdb_index_records_read_data(
+	          index_records,
+	          io_handle,
+	          wtcdb_test_index_records_data2,
+	          32,
+	          &error );
+
+	io_handle->format_version = 21;
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwtcdb_index_records_free(
+	          &index_records,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "index_records",
+	 index_records );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index_records != NULL )
+	{
+		libwtcdb_index_records_free(
+		 &index_records,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libwtcdb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc WTCDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] WTCDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc WTCDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] WTCDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	WTCDB_TEST_UNREFERENCED_PARAMETER( argc )
+	WTCDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_index_records_initialize",
+	 wtcdb_test_index_records_initialize );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_index_records_free",
+	 wtcdb_test_index_records_free );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_index_records_get_record_layout",
+	 wtcdb_test_index_records_get_record_layout );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_index_records_read_data",
+	 wtcdb_test_index_records_read_data );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
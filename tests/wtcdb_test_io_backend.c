@@ -0,0 +1,1032 @@
+/*
+ * Library io_backend type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "wtcdb_test_functions.h"
+#include "wtcdb_test_libbfio.h"
+#include "wtcdb_test_libcerror.h"
+#include "wtcdb_test_libwtcdb.h"
+#include "wtcdb_test_macros.h"
+#include "wtcdb_test_memory.h"
+#include "wtcdb_test_unused.h"
+
+#include "../libwtcdb/libwtcdb_definitions.h"
+#include "../libwtcdb/libwtcdb_io_backend.h"
+
+uint8_t wtcdb_test_io_backend_data1[ 32 ] = {
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+	0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f };
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+
+/* Tests the libwtcdb_io_backend_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_io_backend_initialize(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libwtcdb_io_backend_t *io_backend = NULL;
+	int result                        = 0;
+
+#if defined( HAVE_WTCDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests   = 1;
+	int number_of_memset_fail_tests   = 1;
+	int test_number                   = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_io_backend_initialize(
+	          &io_backend,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_backend",
+	 io_backend );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "io_backend->type",
+	 io_backend->type,
+	 LIBWTCDB_IO_BACKEND_BFIO );
+
+	result = libwtcdb_io_backend_free(
+	          &io_backend,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "io_backend",
+	 io_backend );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_io_backend_initialize(
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	io_backend = (libwtcdb_io_backend_t *) 0x12345678UL;
+
+	result = libwtcdb_io_backend_initialize(
+	          &io_backend,
+	          &error );
+
+	io_backend = NULL;
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_WTCDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libwtcdb_io_backend_initialize with malloc failing
+		 */
+		wtcdb_test_malloc_attempts_before_fail = test_number;
+
+		result = libwtcdb_io_backend_initialize(
+		          &io_backend,
+		          &error );
+
+		if( wtcdb_test_malloc_attempts_before_fail != -1 )
+		{
+			wtcdb_test_malloc_attempts_before_fail = -1;
+
+			if( io_backend != NULL )
+			{
+				libwtcdb_io_backend_free(
+				 &io_backend,
+				 NULL );
+			}
+		}
+		else
+		{
+			WTCDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			WTCDB_TEST_ASSERT_IS_NULL(
+			 "io_backend",
+			 io_backend );
+
+			WTCDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libwtcdb_io_backend_initialize with memset failing
+		 */
+		wtcdb_test_memset_attempts_before_fail = test_number;
+
+		result = libwtcdb_io_backend_initialize(
+		          &io_backend,
+		          &error );
+
+		if( wtcdb_test_memset_attempts_before_fail != -1 )
+		{
+			wtcdb_test_memset_attempts_before_fail = -1;
+
+			if( io_backend != NULL )
+			{
+				libwtcdb_io_backend_free(
+				 &io_backend,
+				 NULL );
+			}
+		}
+		else
+		{
+			WTCDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			WTCDB_TEST_ASSERT_IS_NULL(
+			 "io_backend",
+			 io_backend );
+
+			WTCDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_WTCDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_backend != NULL )
+	{
+		libwtcdb_io_backend_free(
+		 &io_backend,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_io_backend_free function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_io_backend_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libwtcdb_io_backend_free(
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_io_backend_open function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_io_backend_open(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libwtcdb_io_backend_t *io_backend = NULL;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libwtcdb_io_backend_initialize(
+	          &io_backend,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_backend",
+	 io_backend );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_io_backend_open(
+	          io_backend,
+	          "nonexistent",
+	          LIBWTCDB_IO_BACKEND_BFIO,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "io_backend->type",
+	 io_backend->type,
+	 LIBWTCDB_IO_BACKEND_BFIO );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_io_backend_open(
+	          NULL,
+	          "nonexistent",
+	          LIBWTCDB_IO_BACKEND_DEFAULT,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_io_backend_open(
+	          io_backend,
+	          NULL,
+	          LIBWTCDB_IO_BACKEND_DEFAULT,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_io_backend_open(
+	          io_backend,
+	          "nonexistent",
+	          -1,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwtcdb_io_backend_free(
+	          &io_backend,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "io_backend",
+	 io_backend );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_backend != NULL )
+	{
+		libwtcdb_io_backend_free(
+		 &io_backend,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_LIBWTCDB_IO_BACKEND_FILE_DESCRIPTOR )
+
+/* Tests the libwtcdb_io_backend_read_batch_pread function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_io_backend_read_batch_pread(
+     void )
+{
+	libwtcdb_io_backend_read_t reads[ 1 ];
+
+	uint8_t data[ 8 ];
+
+	libcerror_error_t *error          = NULL;
+	libwtcdb_io_backend_t *io_backend = NULL;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libwtcdb_io_backend_initialize(
+	          &io_backend,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_backend",
+	 io_backend );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	reads[ 0 ].file_offset = 0;
+	reads[ 0 ].data        = data;
+	reads[ 0 ].data_size   = 8;
+	reads[ 0 ].read_count  = 0;
+
+	/* Test error cases
+	 */
+	result = libwtcdb_io_backend_read_batch_pread(
+	          NULL,
+	          reads,
+	          1,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test read batch without an open file descriptor
+	 */
+	result = libwtcdb_io_backend_read_batch_pread(
+	          io_backend,
+	          reads,
+	          1,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwtcdb_io_backend_free(
+	          &io_backend,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "io_backend",
+	 io_backend );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_backend != NULL )
+	{
+		libwtcdb_io_backend_free(
+		 &io_backend,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_LIBWTCDB_IO_BACKEND_FILE_DESCRIPTOR ) */
+
+/* Tests the libwtcdb_io_backend_read_batch function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_io_backend_read_batch(
+     void )
+{
+	libwtcdb_io_backend_read_t reads[ 3 ];
+
+	uint8_t data[ 3 ][ 8 ];
+
+	libbfio_handle_t *file_io_handle  = NULL;
+	libcerror_error_t *error          = NULL;
+	libwtcdb_io_backend_t *io_backend = NULL;
+	int read_index                    = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libwtcdb_io_backend_initialize(
+	          &io_backend,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_backend",
+	 io_backend );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wtcdb_test_open_file_io_handle(
+	          &file_io_handle,
+	          wtcdb_test_io_backend_data1,
+	          32,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( read_index = 0;
+	     read_index < 3;
+	     read_index++ )
+	{
+		reads[ read_index ].file_offset = (off64_t) ( 24 - ( read_index * 8 ) );
+		reads[ read_index ].data        = data[ read_index ];
+		reads[ read_index ].data_size   = 8;
+		reads[ read_index ].read_count  = 0;
+	}
+	/* Test regular cases
+	 */
+	result = libwtcdb_io_backend_read_batch(
+	          io_backend,
+	          file_io_handle,
+	          reads,
+	          3,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( read_index = 0;
+	     read_index < 3;
+	     read_index++ )
+	{
+		WTCDB_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 reads[ read_index ].read_count,
+		 (ssize_t) 8 );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "data[ 0 ]",
+		 (int) data[ read_index ][ 0 ],
+		 24 - ( read_index * 8 ) );
+	}
+	/* Test read batch without an IO backend
+	 */
+	result = libwtcdb_io_backend_read_batch(
+	          NULL,
+	          file_io_handle,
+	          reads,
+	          3,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 reads[ 0 ].read_count,
+	 (ssize_t) 8 );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_io_backend_read_batch(
+	          io_backend,
+	          NULL,
+	          reads,
+	          3,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_io_backend_read_batch(
+	          io_backend,
+	          file_io_handle,
+	          NULL,
+	          3,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_io_backend_read_batch(
+	          io_backend,
+	          file_io_handle,
+	          reads,
+	          -1,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = wtcdb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_io_backend_free(
+	          &io_backend,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "io_backend",
+	 io_backend );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		wtcdb_test_close_file_io_handle(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( io_backend != NULL )
+	{
+		libwtcdb_io_backend_free(
+		 &io_backend,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_io_backend_read_buffer_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_io_backend_read_buffer_at_offset(
+     void )
+{
+	uint8_t data[ 8 ];
+
+	libbfio_handle_t *file_io_handle  = NULL;
+	libcerror_error_t *error          = NULL;
+	libwtcdb_io_backend_t *io_backend = NULL;
+	ssize_t read_count                = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libwtcdb_io_backend_initialize(
+	          &io_backend,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_backend",
+	 io_backend );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wtcdb_test_open_file_io_handle(
+	          &file_io_handle,
+	          wtcdb_test_io_backend_data1,
+	          32,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	read_count = libwtcdb_io_backend_read_buffer_at_offset(
+	              io_backend,
+	              file_io_handle,
+	              data,
+	              8,
+	              16,
+	              &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 8 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "data[ 0 ]",
+	 (int) data[ 0 ],
+	 16 );
+
+	/* Test read without an IO backend
+	 */
+	read_count = libwtcdb_io_backend_read_buffer_at_offset(
+	              NULL,
+	              file_io_handle,
+	              data,
+	              8,
+	              8,
+	              &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 8 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "data[ 0 ]",
+	 (int) data[ 0 ],
+	 8 );
+
+	/* Test read beyond the end of the data
+	 */
+	read_count = libwtcdb_io_backend_read_buffer_at_offset(
+	              io_backend,
+	              file_io_handle,
+	              data,
+	              8,
+	              28,
+	              &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 4 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libwtcdb_io_backend_read_buffer_at_offset(
+	              io_backend,
+	              NULL,
+	              data,
+	              8,
+	              0,
+	              &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = wtcdb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_io_backend_free(
+	          &io_backend,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "io_backend",
+	 io_backend );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		wtcdb_test_close_file_io_handle(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( io_backend != NULL )
+	{
+		libwtcdb_io_backend_free(
+		 &io_backend,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc WTCDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] WTCDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc WTCDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] WTCDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	WTCDB_TEST_UNREFERENCED_PARAMETER( argc )
+	WTCDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_io_backend_initialize",
+	 wtcdb_test_io_backend_initialize );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_io_backend_free",
+	 wtcdb_test_io_backend_free );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_io_backend_open",
+	 wtcdb_test_io_backend_open );
+
+#if defined( HAVE_LIBWTCDB_IO_BACKEND_FILE_DESCRIPTOR )
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_io_backend_read_batch_pread",
+	 wtcdb_test_io_backend_read_batch_pread );
+
+#endif /* defined( HAVE_LIBWTCDB_IO_BACKEND_FILE_DESCRIPTOR ) */
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_io_backend_read_batch",
+	 wtcdb_test_io_backend_read_batch );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_io_backend_read_buffer_at_offset",
+	 wtcdb_test_io_backend_read_buffer_at_offset );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,392 @@
+/*
+ * Library item_worker type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "wtcdb_test_libcerror.h"
+#include "wtcdb_test_libwtcdb.h"
+#include "wtcdb_test_macros.h"
+#include "wtcdb_test_memory.h"
+#include "wtcdb_test_unused.h"
+
+#include "../libwtcdb/libwtcdb_io_handle.h"
+#include "../libwtcdb/libwtcdb_item_worker.h"
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+
+/* The item callback used by the tests
+ * Returns 1 to continue or -1 on error
+ */
+int wtcdb_test_item_worker_item_callback(
+     libwtcdb_item_t *item WTCDB_TEST_ATTRIBUTE_UNUSED,
+     int item_index WTCDB_TEST_ATTRIBUTE_UNUSED,
+     int worker_index WTCDB_TEST_ATTRIBUTE_UNUSED,
+     void *user_data WTCDB_TEST_ATTRIBUTE_UNUSED )
+{
+	WTCDB_TEST_UNREFERENCED_PARAMETER( item )
+	WTCDB_TEST_UNREFERENCED_PARAMETER( item_index )
+	WTCDB_TEST_UNREFERENCED_PARAMETER( worker_index )
+	WTCDB_TEST_UNREFERENCED_PARAMETER( user_data )
+
+	return( -1 );
+}
+
+/* Tests the libwtcdb_item_worker_run function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_item_worker_run(
+     void )
+{
+	libwtcdb_item_worker_t item_worker;
+
+	libcerror_error_t *error        = NULL;
+	libwtcdb_io_handle_t *io_handle = NULL;
+	int result                      = 0;
+	int stop                        = 0;
+
+	/* Initialize test
+	 */
+	result = libwtcdb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_set(
+	 &item_worker,
+	 0,
+	 sizeof( libwtcdb_item_worker_t ) );
+
+	item_worker.io_handle = io_handle;
+	item_worker.callback  = &wtcdb_test_item_worker_item_callback;
+	item_worker.stop      = &stop;
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_item_worker_run(
+	          &item_worker,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with stop set
+	 */
+	item_worker.number_of_items = 1;
+
+	stop = 1;
+
+	result = libwtcdb_item_worker_run(
+	          &item_worker,
+	          &error );
+
+	stop = 0;
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with abort set
+	 */
+	io_handle->abort = 1;
+
+	result = libwtcdb_item_worker_run(
+	          &item_worker,
+	          &error );
+
+	io_handle->abort = 0;
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_item_worker_run(
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the entries are missing
+	 */
+	result = libwtcdb_item_worker_run(
+	          &item_worker,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "stop",
+	 stop,
+	 1 );
+
+	stop = 0;
+
+	item_worker.io_handle = NULL;
+
+	result = libwtcdb_item_worker_run(
+	          &item_worker,
+	          &error );
+
+	item_worker.io_handle = io_handle;
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	item_worker.callback = NULL;
+
+	result = libwtcdb_item_worker_run(
+	          &item_worker,
+	          &error );
+
+	item_worker.callback = &wtcdb_test_item_worker_item_callback;
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	item_worker.stop = NULL;
+
+	result = libwtcdb_item_worker_run(
+	          &item_worker,
+	          &error );
+
+	item_worker.stop = &stop;
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	item_worker.first_item_index = -1;
+
+	result = libwtcdb_item_worker_run(
+	          &item_worker,
+	          &error );
+
+	item_worker.first_item_index = 0;
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwtcdb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libwtcdb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_item_worker_task_function function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_item_worker_task_function(
+     void )
+{
+	libwtcdb_item_worker_t item_worker;
+
+	/* Test error cases
+	 */
+	memory_set(
+	 &item_worker,
+	 0,
+	 sizeof( libwtcdb_item_worker_t ) );
+
+	libwtcdb_item_worker_task_function(
+	 NULL );
+
+	libwtcdb_item_worker_task_function(
+	 (void *) &item_worker );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "item_worker.result",
+	 item_worker.result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "item_worker.error",
+	 item_worker.error );
+
+	libcerror_error_free(
+	 &( item_worker.error ) );
+
+	return( 1 );
+
+on_error:
+	if( item_worker.error != NULL )
+	{
+		libcerror_error_free(
+		 &( item_worker.error ) );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc WTCDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] WTCDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc WTCDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] WTCDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	WTCDB_TEST_UNREFERENCED_PARAMETER( argc )
+	WTCDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_item_worker_run",
+	 wtcdb_test_item_worker_run );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_item_worker_task_function",
+	 wtcdb_test_item_worker_task_function );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
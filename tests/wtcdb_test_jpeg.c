@@ -0,0 +1,389 @@
+/*
+ * Library JPEG functions test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "wtcdb_test_functions.h"
+#include "wtcdb_test_libbfio.h"
+#include "wtcdb_test_libcerror.h"
+#include "wtcdb_test_libwtcdb.h"
+#include "wtcdb_test_macros.h"
+#include "wtcdb_test_memory.h"
+#include "wtcdb_test_unused.h"
+
+#include "../libwtcdb/libwtcdb_jpeg.h"
+
+/* JPEG data with a fill byte, an APP0 segment, a RST0 marker, a SOF0 segment and a SOS segment
+ */
+uint8_t wtcdb_test_jpeg_data1[ 54 ] = {
+	0xff, 0xd8, 0xff, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00,
+	0x01, 0x00, 0x01, 0x00, 0x00, 0xff, 0xd0, 0xff, 0xc0, 0x00, 0x11, 0x08, 0x00, 0x20, 0x00, 0x40,
+	0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11, 0x01, 0xff, 0xda, 0x00, 0x08, 0x01, 0x01,
+	0x00, 0x00, 0x3f, 0x00, 0xff, 0xd9 };
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+
+/* Tests the libwtcdb_jpeg_segment_read_next_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_jpeg_segment_read_next_file_io_handle(
+     void )
+{
+	libwtcdb_jpeg_segment_t jpeg_segment;
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = wtcdb_test_open_file_io_handle(
+	          &file_io_handle,
+	          wtcdb_test_jpeg_data1,
+	          54,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	memory_set(
+	 &jpeg_segment,
+	 0,
+	 sizeof( libwtcdb_jpeg_segment_t ) );
+
+	result = libwtcdb_jpeg_segment_read_next_file_io_handle(
+	          &jpeg_segment,
+	          NULL,
+	          file_io_handle,
+	          0,
+	          54,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT8(
+	 "jpeg_segment.marker",
+	 jpeg_segment.marker,
+	 0xe0 );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT32(
+	 "jpeg_segment.offset",
+	 jpeg_segment.offset,
+	 3 );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT16(
+	 "jpeg_segment.size",
+	 jpeg_segment.size,
+	 16 );
+
+	result = libwtcdb_jpeg_segment_read_next_file_io_handle(
+	          &jpeg_segment,
+	          NULL,
+	          file_io_handle,
+	          0,
+	          54,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT8(
+	 "jpeg_segment.marker",
+	 jpeg_segment.marker,
+	 0xc0 );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT32(
+	 "jpeg_segment.offset",
+	 jpeg_segment.offset,
+	 23 );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT16(
+	 "jpeg_segment.size",
+	 jpeg_segment.size,
+	 17 );
+
+	WTCDB_TEST_ASSERT_EQUAL_SIZE(
+	 "jpeg_segment.data_size",
+	 jpeg_segment.data_size,
+	 (size_t) 10 );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT8(
+	 "jpeg_segment.data[ 9 ]",
+	 jpeg_segment.data[ 9 ],
+	 0x03 );
+
+	/* The marker chain ends at the SOS segment
+	 */
+	result = libwtcdb_jpeg_segment_read_next_file_io_handle(
+	          &jpeg_segment,
+	          NULL,
+	          file_io_handle,
+	          0,
+	          54,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a segment that exceeds the data ends the marker chain
+	 */
+	memory_set(
+	 &jpeg_segment,
+	 0,
+	 sizeof( libwtcdb_jpeg_segment_t ) );
+
+	result = libwtcdb_jpeg_segment_read_next_file_io_handle(
+	          &jpeg_segment,
+	          NULL,
+	          file_io_handle,
+	          0,
+	          30,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_jpeg_segment_read_next_file_io_handle(
+	          &jpeg_segment,
+	          NULL,
+	          file_io_handle,
+	          0,
+	          30,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT8(
+	 "jpeg_segment.marker",
+	 jpeg_segment.marker,
+	 0xc0 );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT32(
+	 "jpeg_segment.next_offset",
+	 jpeg_segment.next_offset,
+	 30 );
+
+	result = libwtcdb_jpeg_segment_read_next_file_io_handle(
+	          &jpeg_segment,
+	          NULL,
+	          file_io_handle,
+	          0,
+	          30,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test data that does not start with the SOI marker
+	 */
+	memory_set(
+	 &jpeg_segment,
+	 0,
+	 sizeof( libwtcdb_jpeg_segment_t ) );
+
+	result = libwtcdb_jpeg_segment_read_next_file_io_handle(
+	          &jpeg_segment,
+	          NULL,
+	          file_io_handle,
+	          2,
+	          52,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	memory_set(
+	 &jpeg_segment,
+	 0,
+	 sizeof( libwtcdb_jpeg_segment_t ) );
+
+	result = libwtcdb_jpeg_segment_read_next_file_io_handle(
+	          NULL,
+	          NULL,
+	          file_io_handle,
+	          0,
+	          54,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_jpeg_segment_read_next_file_io_handle(
+	          &jpeg_segment,
+	          NULL,
+	          file_io_handle,
+	          -1,
+	          54,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = wtcdb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		wtcdb_test_close_file_io_handle(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc WTCDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] WTCDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc WTCDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] WTCDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	WTCDB_TEST_UNREFERENCED_PARAMETER( argc )
+	WTCDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_jpeg_segment_read_next_file_io_handle",
+	 wtcdb_test_jpeg_segment_read_next_file_io_handle );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+}
+
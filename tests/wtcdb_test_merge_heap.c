@@ -0,0 +1,376 @@
+/*
+ * Library merge heap functions test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "wtcdb_test_libcerror.h"
+#include "wtcdb_test_libwtcdb.h"
+#include "wtcdb_test_macros.h"
+#include "wtcdb_test_memory.h"
+#include "wtcdb_test_unused.h"
+
+#include "../libwtcdb/libwtcdb_libcdata.h"
+#include "../libwtcdb/libwtcdb_merge_heap.h"
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+
+/* Compares two 64-bit key values
+ * Returns LIBCDATA_COMPARE_LESS, LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ */
+int wtcdb_test_merge_heap_value_compare(
+     intptr_t *first_value,
+     intptr_t *second_value,
+     libcerror_error_t **error WTCDB_TEST_ATTRIBUTE_UNUSED )
+{
+	uint64_t first_key  = 0;
+	uint64_t second_key = 0;
+
+	WTCDB_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( ( first_value == NULL )
+	 || ( second_value == NULL ) )
+	{
+		return( -1 );
+	}
+	first_key  = *( (uint64_t *) first_value );
+	second_key = *( (uint64_t *) second_value );
+
+	if( first_key < second_key )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( first_key > second_key )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	return( LIBCDATA_COMPARE_EQUAL );
+}
+
+/* Tests the libwtcdb_merge_heap_build, libwtcdb_merge_heap_sift_down and libwtcdb_merge_heap_remove_first functions
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_merge_heap(
+     void )
+{
+	uint64_t keys[ 64 ];
+	intptr_t *values[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	intptr_t *first_value    = NULL;
+	uint64_t key             = 0;
+	uint64_t previous_key    = 0;
+	uint32_t seed            = 0x2545f491UL;
+	int number_of_values     = 0;
+	int number_of_updates    = 0;
+	int result               = 0;
+	int value_index          = 0;
+
+	/* Initialize test
+	 */
+	for( value_index = 0;
+	     value_index < 64;
+	     value_index++ )
+	{
+		if( ( value_index % 4 ) != 3 )
+		{
+			seed ^= seed << 13;
+			seed ^= seed >> 17;
+			seed ^= seed << 5;
+
+			key = (uint64_t) seed;
+		}
+		keys[ value_index ]   = key;
+		values[ value_index ] = (intptr_t *) &( keys[ value_index ] );
+	}
+	number_of_values = 64;
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_merge_heap_build(
+	          values,
+	          number_of_values,
+	          &wtcdb_test_merge_heap_value_compare,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Increase the first key a number of times, which is what a merge does
+	 * when advancing an input, and remove the first value otherwise
+	 */
+	previous_key = 0;
+
+	while( number_of_values > 0 )
+	{
+		key = *( (uint64_t *) values[ 0 ] );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "key >= previous_key",
+		 (int) ( key >= previous_key ),
+		 1 );
+
+		previous_key = key;
+
+		if( ( number_of_updates < 32 )
+		 && ( key < 0xffffffffUL ) )
+		{
+			*( (uint64_t *) values[ 0 ] ) = key + 0x01000000UL;
+
+			number_of_updates++;
+
+			result = libwtcdb_merge_heap_sift_down(
+			          values,
+			          number_of_values,
+			          0,
+			          &wtcdb_test_merge_heap_value_compare,
+			          &error );
+		}
+		else
+		{
+			result = libwtcdb_merge_heap_remove_first(
+			          values,
+			          &number_of_values,
+			          &wtcdb_test_merge_heap_value_compare,
+			          &error );
+		}
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test building a heap without values
+	 */
+	result = libwtcdb_merge_heap_build(
+	          NULL,
+	          0,
+	          &wtcdb_test_merge_heap_value_compare,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_merge_heap_build(
+	          NULL,
+	          64,
+	          &wtcdb_test_merge_heap_value_compare,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_merge_heap_build(
+	          values,
+	          -1,
+	          &wtcdb_test_merge_heap_value_compare,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_merge_heap_sift_down(
+	          values,
+	          64,
+	          64,
+	          &wtcdb_test_merge_heap_value_compare,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_merge_heap_sift_down(
+	          values,
+	          64,
+	          0,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a comparison that fails, which must keep every value in the heap
+	 */
+	first_value = values[ 0 ];
+	values[ 1 ] = NULL;
+
+	result = libwtcdb_merge_heap_sift_down(
+	          values,
+	          3,
+	          0,
+	          &wtcdb_test_merge_heap_value_compare,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "values[ 0 ] == first_value",
+	 (int) ( values[ 0 ] == first_value ),
+	 1 );
+
+	number_of_values = 0;
+
+	result = libwtcdb_merge_heap_remove_first(
+	          values,
+	          &number_of_values,
+	          &wtcdb_test_merge_heap_value_compare,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_merge_heap_remove_first(
+	          values,
+	          NULL,
+	          &wtcdb_test_merge_heap_value_compare,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc WTCDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] WTCDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc WTCDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] WTCDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	WTCDB_TEST_UNREFERENCED_PARAMETER( argc )
+	WTCDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_merge_heap",
+	 wtcdb_test_merge_heap );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,916 @@
+/*
+ * Library progress type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "wtcdb_test_libcerror.h"
+#include "wtcdb_test_libwtcdb.h"
+#include "wtcdb_test_macros.h"
+#include "wtcdb_test_memory.h"
+#include "wtcdb_test_unused.h"
+
+#include "../libwtcdb/libwtcdb_definitions.h"
+#include "../libwtcdb/libwtcdb_progress.h"
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+
+/* The values reported to the test progress callback
+ */
+typedef struct wtcdb_test_progress_values wtcdb_test_progress_values_t;
+
+struct wtcdb_test_progress_values
+{
+	int number_of_calls;
+	int phase;
+	uint64_t bytes_scanned;
+	int number_of_entries;
+	int result;
+};
+
+/* Test progress callback
+ * Returns the result stored in the values
+ */
+int wtcdb_test_progress_callback(
+     int phase,
+     uint64_t bytes_scanned,
+     uint64_t file_size WTCDB_TEST_ATTRIBUTE_UNUSED,
+     int number_of_entries,
+     void *user_data )
+{
+	wtcdb_test_progress_values_t *values = NULL;
+
+	WTCDB_TEST_UNREFERENCED_PARAMETER( file_size )
+
+	values = (wtcdb_test_progress_values_t *) user_data;
+
+	values->number_of_calls  += 1;
+	values->phase             = phase;
+	values->bytes_scanned     = bytes_scanned;
+	values->number_of_entries = number_of_entries;
+
+	return( values->result );
+}
+
+/* Tests the libwtcdb_progress_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_progress_initialize(
+     void )
+{
+	wtcdb_test_progress_values_t values;
+
+	libcerror_error_t *error        = NULL;
+	libwtcdb_progress_t *progress   = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_WTCDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_progress_initialize(
+	          &progress,
+	          &wtcdb_test_progress_callback,
+	          (void *) &values,
+	          100,
+	          4096,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "progress",
+	 progress );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_progress_free(
+	          &progress,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "progress",
+	 progress );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_progress_initialize(
+	          NULL,
+	          &wtcdb_test_progress_callback,
+	          (void *) &values,
+	          100,
+	          4096,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	progress = (libwtcdb_progress_t *) 0x12345678UL;
+
+	result = libwtcdb_progress_initialize(
+	          &progress,
+	          &wtcdb_test_progress_callback,
+	          (void *) &values,
+	          100,
+	          4096,
+	          &error );
+
+	progress = NULL;
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_progress_initialize(
+	          &progress,
+	          NULL,
+	          (void *) &values,
+	          100,
+	          4096,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_WTCDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libwtcdb_progress_initialize with malloc failing
+		 */
+		wtcdb_test_malloc_attempts_before_fail = test_number;
+
+		result = libwtcdb_progress_initialize(
+		          &progress,
+		          &wtcdb_test_progress_callback,
+		          (void *) &values,
+		          100,
+		          4096,
+		          &error );
+
+		if( wtcdb_test_malloc_attempts_before_fail != -1 )
+		{
+			wtcdb_test_malloc_attempts_before_fail = -1;
+
+			if( progress != NULL )
+			{
+				libwtcdb_progress_free(
+				 &progress,
+				 NULL );
+			}
+		}
+		else
+		{
+			WTCDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			WTCDB_TEST_ASSERT_IS_NULL(
+			 "progress",
+			 progress );
+
+			WTCDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libwtcdb_progress_initialize with memset failing
+		 */
+		wtcdb_test_memset_attempts_before_fail = test_number;
+
+		result = libwtcdb_progress_initialize(
+		          &progress,
+		          &wtcdb_test_progress_callback,
+		          (void *) &values,
+		          100,
+		          4096,
+		          &error );
+
+		if( wtcdb_test_memset_attempts_before_fail != -1 )
+		{
+			wtcdb_test_memset_attempts_before_fail = -1;
+
+			if( progress != NULL )
+			{
+				libwtcdb_progress_free(
+				 &progress,
+				 NULL );
+			}
+		}
+		else
+		{
+			WTCDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			WTCDB_TEST_ASSERT_IS_NULL(
+			 "progress",
+			 progress );
+
+			WTCDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_WTCDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( progress != NULL )
+	{
+		libwtcdb_progress_free(
+		 &progress,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_progress_free function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_progress_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libwtcdb_progress_free(
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_progress_get_current_time function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_progress_get_current_time(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t current_time    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_progress_get_current_time(
+	          &current_time,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_progress_get_current_time(
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_progress_set_phase function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_progress_set_phase(
+     void )
+{
+	wtcdb_test_progress_values_t values;
+
+	libcerror_error_t *error      = NULL;
+	libwtcdb_progress_t *progress = NULL;
+	int result                    = 0;
+
+	values.number_of_calls   = 0;
+	values.phase             = 0;
+	values.bytes_scanned     = 0;
+	values.number_of_entries = 0;
+	values.result            = 1;
+
+	/* Initialize test
+	 */
+	result = libwtcdb_progress_initialize(
+	          &progress,
+	          &wtcdb_test_progress_callback,
+	          (void *) &values,
+	          0xffffffffUL,
+	          4096,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "progress",
+	 progress );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_progress_set_phase(
+	          progress,
+	          LIBWTCDB_PROGRESS_PHASE_SCAN_ENTRIES,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "values.number_of_calls",
+	 values.number_of_calls,
+	 1 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "values.phase",
+	 values.phase,
+	 LIBWTCDB_PROGRESS_PHASE_SCAN_ENTRIES );
+
+	result = libwtcdb_progress_set_phase(
+	          progress,
+	          LIBWTCDB_PROGRESS_PHASE_COMPLETED,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "values.number_of_calls",
+	 values.number_of_calls,
+	 2 );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT64(
+	 "values.bytes_scanned",
+	 values.bytes_scanned,
+	 (uint64_t) 4096 );
+
+	/* Test a callback that requests an abort
+	 */
+	values.result = 0;
+
+	result = libwtcdb_progress_set_phase(
+	          progress,
+	          LIBWTCDB_PROGRESS_PHASE_READ_ENTRIES,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_progress_set_phase(
+	          NULL,
+	          LIBWTCDB_PROGRESS_PHASE_SCAN_ENTRIES,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwtcdb_progress_free(
+	          &progress,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "progress",
+	 progress );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( progress != NULL )
+	{
+		libwtcdb_progress_free(
+		 &progress,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_progress_update function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_progress_update(
+     void )
+{
+	wtcdb_test_progress_values_t values;
+
+	libcerror_error_t *error      = NULL;
+	libwtcdb_progress_t *progress = NULL;
+	int result                    = 0;
+
+	values.number_of_calls   = 0;
+	values.phase             = 0;
+	values.bytes_scanned     = 0;
+	values.number_of_entries = 0;
+	values.result            = 1;
+
+	/* Test regular cases with an interval of 0 that reports every update
+	 */
+	result = libwtcdb_progress_initialize(
+	          &progress,
+	          &wtcdb_test_progress_callback,
+	          (void *) &values,
+	          0,
+	          4096,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "progress",
+	 progress );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_progress_update(
+	          progress,
+	          1024,
+	          2,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_progress_update(
+	          progress,
+	          1024,
+	          3,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "values.number_of_calls",
+	 values.number_of_calls,
+	 2 );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT64(
+	 "values.bytes_scanned",
+	 values.bytes_scanned,
+	 (uint64_t) 2048 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "values.number_of_entries",
+	 values.number_of_entries,
+	 5 );
+
+	/* Test that the bytes scanned do not exceed the file size
+	 */
+	result = libwtcdb_progress_update(
+	          progress,
+	          8192,
+	          0,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT64(
+	 "values.bytes_scanned",
+	 values.bytes_scanned,
+	 (uint64_t) 4096 );
+
+	/* Test a callback that requests an abort
+	 */
+	values.result = 0;
+
+	result = libwtcdb_progress_update(
+	          progress,
+	          0,
+	          1,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "values.number_of_calls",
+	 values.number_of_calls,
+	 4 );
+
+	/* Test that the callback is no longer called after it requested an abort
+	 */
+	values.result = 1;
+
+	result = libwtcdb_progress_update(
+	          progress,
+	          0,
+	          1,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "values.number_of_calls",
+	 values.number_of_calls,
+	 4 );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_progress_update(
+	          NULL,
+	          0,
+	          1,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_progress_update(
+	          progress,
+	          0,
+	          -1,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwtcdb_progress_free(
+	          &progress,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "progress",
+	 progress );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases with an interval that has not elapsed
+	 */
+	values.number_of_calls = 0;
+	values.result          = 1;
+
+	result = libwtcdb_progress_initialize(
+	          &progress,
+	          &wtcdb_test_progress_callback,
+	          (void *) &values,
+	          0xffffffffUL,
+	          4096,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "progress",
+	 progress );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_progress_update(
+	          progress,
+	          1024,
+	          1,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "values.number_of_calls",
+	 values.number_of_calls,
+	 0 );
+
+	/* Clean up
+	 */
+	result = libwtcdb_progress_free(
+	          &progress,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "progress",
+	 progress );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( progress != NULL )
+	{
+		libwtcdb_progress_free(
+		 &progress,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc WTCDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] WTCDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc WTCDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] WTCDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	WTCDB_TEST_UNREFERENCED_PARAMETER( argc )
+	WTCDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_progress_initialize",
+	 wtcdb_test_progress_initialize );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_progress_free",
+	 wtcdb_test_progress_free );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_progress_get_current_time",
+	 wtcdb_test_progress_get_current_time );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_progress_set_phase",
+	 wtcdb_test_progress_set_phase );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_progress_update",
+	 wtcdb_test_progress_update );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+}
+
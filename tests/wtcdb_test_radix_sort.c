@@ -0,0 +1,290 @@
+/*
+ * Library radix sort functions test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "wtcdb_test_libcerror.h"
+#include "wtcdb_test_libwtcdb.h"
+#include "wtcdb_test_macros.h"
+#include "wtcdb_test_memory.h"
+#include "wtcdb_test_unused.h"
+
+#include "../libwtcdb/libwtcdb_radix_sort.h"
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+
+/* Tests the libwtcdb_radix_sort_keys function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_radix_sort_keys(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t *keys           = NULL;
+	uint64_t key             = 0;
+	uint64_t previous_key    = 0;
+	uint32_t seed            = 0x2545f491UL;
+	int *entry_indexes       = NULL;
+	int entry_index          = 0;
+	int previous_entry_index = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	keys = (uint64_t *) memory_allocate(
+	                     sizeof( uint64_t ) * 1024 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "keys",
+	 keys );
+
+	entry_indexes = (int *) memory_allocate(
+	                         sizeof( int ) * 1024 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "entry_indexes",
+	 entry_indexes );
+
+	/* Use keys that differ in every byte and contain duplicates
+	 */
+	for( entry_index = 0;
+	     entry_index < 1024;
+	     entry_index++ )
+	{
+		if( ( entry_index % 4 ) != 3 )
+		{
+			seed ^= seed << 13;
+			seed ^= seed >> 17;
+			seed ^= seed << 5;
+
+			key = ( (uint64_t) seed << 32 ) | ( seed ^ 0xa5a5a5a5UL );
+		}
+		keys[ entry_index ]          = key;
+		entry_indexes[ entry_index ] = entry_index;
+	}
+	/* Test regular cases
+	 */
+	result = libwtcdb_radix_sort_keys(
+	          &keys,
+	          &entry_indexes,
+	          1024,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	previous_key         = keys[ 0 ];
+	previous_entry_index = entry_indexes[ 0 ];
+
+	for( entry_index = 1;
+	     entry_index < 1024;
+	     entry_index++ )
+	{
+		key = keys[ entry_index ];
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "key >= previous_key",
+		 (int) ( key >= previous_key ),
+		 1 );
+
+		/* Entries with the same key must remain in their original order
+		 */
+		if( key == previous_key )
+		{
+			WTCDB_TEST_ASSERT_GREATER_THAN_INT(
+			 "entry_indexes[ entry_index ]",
+			 entry_indexes[ entry_index ],
+			 previous_entry_index );
+		}
+		previous_key         = key;
+		previous_entry_index = entry_indexes[ entry_index ];
+	}
+	/* Test sorting sorted keys
+	 */
+	result = libwtcdb_radix_sort_keys(
+	          &keys,
+	          &entry_indexes,
+	          1024,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT64(
+	 "keys[ 1023 ]",
+	 keys[ 1023 ],
+	 previous_key );
+
+	/* Test sorting a single key
+	 */
+	result = libwtcdb_radix_sort_keys(
+	          &keys,
+	          &entry_indexes,
+	          1,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_radix_sort_keys(
+	          NULL,
+	          &entry_indexes,
+	          1024,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_radix_sort_keys(
+	          &keys,
+	          NULL,
+	          1024,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_radix_sort_keys(
+	          &keys,
+	          &entry_indexes,
+	          -1,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 entry_indexes );
+
+	entry_indexes = NULL;
+
+	memory_free(
+	 keys );
+
+	keys = NULL;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( entry_indexes != NULL )
+	{
+		memory_free(
+		 entry_indexes );
+	}
+	if( keys != NULL )
+	{
+		memory_free(
+		 keys );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc WTCDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] WTCDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc WTCDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] WTCDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	WTCDB_TEST_UNREFERENCED_PARAMETER( argc )
+	WTCDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_radix_sort_keys",
+	 wtcdb_test_radix_sort_keys );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1408 @@
+/*
+ * Library read_ahead type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "wtcdb_test_functions.h"
+#include "wtcdb_test_libbfio.h"
+#include "wtcdb_test_libcerror.h"
+#include "wtcdb_test_libwtcdb.h"
+#include "wtcdb_test_macros.h"
+#include "wtcdb_test_memory.h"
+#include "wtcdb_test_unused.h"
+
+#include "../libwtcdb/libwtcdb_cache_entry.h"
+#include "../libwtcdb/libwtcdb_definitions.h"
+#include "../libwtcdb/libwtcdb_libcdata.h"
+#include "../libwtcdb/libwtcdb_read_ahead.h"
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) && defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+
+/* The offsets and sizes of the cached data of the test entries
+ * The cached data of the last entry exceeds the test data
+ */
+off64_t wtcdb_test_read_ahead_cached_data_offsets[ 4 ] = {
+	0, 16, 32, 48 };
+
+uint32_t wtcdb_test_read_ahead_cached_data_sizes[ 4 ] = {
+	16, 16, 0, 32 };
+
+/* Creates the test entries
+ * Returns 1 if successful or -1 on error
+ */
+int wtcdb_test_read_ahead_entries_initialize(
+     libcdata_array_t **entries,
+     libcerror_error_t **error )
+{
+	libwtcdb_cache_entry_t *cache_entry = NULL;
+	static char *function               = "wtcdb_test_read_ahead_entries_initialize";
+	int entry_index                     = 0;
+	int item_index                      = 0;
+
+	if( libcdata_array_initialize(
+	     entries,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create entries array.",
+		 function );
+
+		goto on_error;
+	}
+	for( item_index = 0;
+	     item_index < 4;
+	     item_index++ )
+	{
+		if( libwtcdb_cache_entry_initialize(
+		     &cache_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create cache entry.",
+			 function );
+
+			goto on_error;
+		}
+		cache_entry->cached_data_offset = wtcdb_test_read_ahead_cached_data_offsets[ item_index ];
+		cache_entry->cached_data_size   = wtcdb_test_read_ahead_cached_data_sizes[ item_index ];
+
+		if( libcdata_array_append_entry(
+		     *entries,
+		     &entry_index,
+		     (intptr_t *) cache_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append cache entry to array.",
+			 function );
+
+			goto on_error;
+		}
+		cache_entry = NULL;
+	}
+	return( 1 );
+
+on_error:
+	if( cache_entry != NULL )
+	{
+		libwtcdb_cache_entry_free(
+		 &cache_entry,
+		 NULL );
+	}
+	if( *entries != NULL )
+	{
+		libcdata_array_free(
+		 entries,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libwtcdb_cache_entry_free,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the libwtcdb_read_ahead_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_read_ahead_initialize(
+     libbfio_handle_t *file_io_handle,
+     libcdata_array_t *entries )
+{
+	libcerror_error_t *error          = NULL;
+	libwtcdb_read_ahead_t *read_ahead = NULL;
+	int result                        = 0;
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_read_ahead_initialize(
+	          &read_ahead,
+	          NULL,
+	          file_io_handle,
+	          entries,
+	          2,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "read_ahead",
+	 read_ahead );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "read_ahead->number_of_items",
+	 read_ahead->number_of_items,
+	 4 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "read_ahead->number_of_buffers",
+	 read_ahead->number_of_buffers,
+	 3 );
+
+	result = libwtcdb_read_ahead_free(
+	          &read_ahead,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "read_ahead",
+	 read_ahead );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_read_ahead_initialize(
+	          NULL,
+	          NULL,
+	          file_io_handle,
+	          entries,
+	          2,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_ahead = (libwtcdb_read_ahead_t *) 0x12345678UL;
+
+	result = libwtcdb_read_ahead_initialize(
+	          &read_ahead,
+	          NULL,
+	          file_io_handle,
+	          entries,
+	          2,
+	          &error );
+
+	read_ahead = NULL;
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_read_ahead_initialize(
+	          &read_ahead,
+	          NULL,
+	          file_io_handle,
+	          NULL,
+	          2,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "read_ahead",
+	 read_ahead );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_read_ahead_initialize(
+	          &read_ahead,
+	          NULL,
+	          file_io_handle,
+	          entries,
+	          0,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "read_ahead",
+	 read_ahead );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_read_ahead_initialize(
+	          &read_ahead,
+	          NULL,
+	          file_io_handle,
+	          entries,
+	          LIBWTCDB_MAXIMUM_NUMBER_OF_READ_AHEAD_ITEMS + 1,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "read_ahead",
+	 read_ahead );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_WTCDB_TEST_MEMORY )
+
+	/* Test libwtcdb_read_ahead_initialize with malloc failing
+	 */
+	wtcdb_test_malloc_attempts_before_fail = 0;
+
+	result = libwtcdb_read_ahead_initialize(
+	          &read_ahead,
+	          NULL,
+	          file_io_handle,
+	          entries,
+	          2,
+	          &error );
+
+	if( wtcdb_test_malloc_attempts_before_fail != -1 )
+	{
+		wtcdb_test_malloc_attempts_before_fail = -1;
+
+		if( read_ahead != NULL )
+		{
+			libwtcdb_read_ahead_free(
+			 &read_ahead,
+			 NULL );
+		}
+	}
+	else
+	{
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "read_ahead",
+		 read_ahead );
+
+		WTCDB_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_WTCDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_ahead != NULL )
+	{
+		libwtcdb_read_ahead_free(
+		 &read_ahead,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_read_ahead_free function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_read_ahead_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libwtcdb_read_ahead_free(
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_read_ahead_read_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_read_ahead_read_buffer(
+     libwtcdb_read_ahead_t *read_ahead,
+     const uint8_t *data )
+{
+	libwtcdb_read_ahead_buffer_t buffer;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	memory_set(
+	 &buffer,
+	 0,
+	 sizeof( libwtcdb_read_ahead_buffer_t ) );
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_read_ahead_read_buffer(
+	          read_ahead,
+	          &buffer,
+	          1,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_SIZE(
+	 "buffer.data_size",
+	 buffer.data_size,
+	 (size_t) 16 );
+
+	result = memory_compare(
+	          buffer.data,
+	          &( data[ 16 ] ),
+	          16 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libwtcdb_read_ahead_read_buffer(
+	          read_ahead,
+	          &buffer,
+	          2,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_SIZE(
+	 "buffer.data_size",
+	 buffer.data_size,
+	 (size_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_read_ahead_read_buffer(
+	          NULL,
+	          &buffer,
+	          1,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_read_ahead_read_buffer(
+	          read_ahead,
+	          NULL,
+	          1,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_read_ahead_read_buffer(
+	          read_ahead,
+	          &buffer,
+	          -1,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the cached data exceeds the file
+	 */
+	result = libwtcdb_read_ahead_read_buffer(
+	          read_ahead,
+	          &buffer,
+	          3,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 buffer.data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( buffer.data != NULL )
+	{
+		memory_free(
+		 buffer.data );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_read_ahead_copy_data function
+ * This test must be run before the position is set so that the helper thread does not modify the buffers
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_read_ahead_copy_data(
+     libwtcdb_read_ahead_t *read_ahead,
+     const uint8_t *data )
+{
+	uint8_t item_data[ 32 ];
+
+	libwtcdb_read_ahead_buffer_t *buffer = NULL;
+	libcerror_error_t *error             = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	buffer = &( read_ahead->buffers[ 1 % read_ahead->number_of_buffers ] );
+
+	result = libwtcdb_read_ahead_read_buffer(
+	          read_ahead,
+	          buffer,
+	          1,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	buffer->item_index = 1;
+	buffer->state      = LIBWTCDB_READ_AHEAD_BUFFER_STATE_READ;
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_read_ahead_copy_data(
+	          read_ahead,
+	          1,
+	          item_data,
+	          32,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          item_data,
+	          &( data[ 16 ] ),
+	          16 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test copy of an item that was not read ahead
+	 */
+	result = libwtcdb_read_ahead_copy_data(
+	          read_ahead,
+	          0,
+	          item_data,
+	          32,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_read_ahead_copy_data(
+	          NULL,
+	          1,
+	          item_data,
+	          32,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_read_ahead_copy_data(
+	          read_ahead,
+	          -1,
+	          item_data,
+	          32,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_read_ahead_copy_data(
+	          read_ahead,
+	          1,
+	          NULL,
+	          32,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_read_ahead_copy_data(
+	          read_ahead,
+	          1,
+	          item_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_read_ahead_copy_data(
+	          read_ahead,
+	          1,
+	          item_data,
+	          8,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_read_ahead_set_position function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_read_ahead_set_position(
+     libwtcdb_read_ahead_t *read_ahead,
+     const uint8_t *data )
+{
+	uint8_t item_data[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	int item_index           = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 * The cached data is either copied from the read-ahead buffer or not read ahead yet
+	 */
+	for( item_index = 0;
+	     item_index < 3;
+	     item_index++ )
+	{
+		result = libwtcdb_read_ahead_set_position(
+		          read_ahead,
+		          item_index,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libwtcdb_read_ahead_copy_data(
+		          read_ahead,
+		          item_index,
+		          item_data,
+		          32,
+		          &error );
+
+		WTCDB_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( ( result == 1 )
+		 && ( wtcdb_test_read_ahead_cached_data_sizes[ item_index ] > 0 ) )
+		{
+			result = memory_compare(
+			          item_data,
+			          &( data[ wtcdb_test_read_ahead_cached_data_offsets[ item_index ] ] ),
+			          (size_t) wtcdb_test_read_ahead_cached_data_sizes[ item_index ] );
+
+			WTCDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+	}
+	/* Test the item of which the cached data cannot be read
+	 */
+	result = libwtcdb_read_ahead_set_position(
+	          read_ahead,
+	          3,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_read_ahead_copy_data(
+	          read_ahead,
+	          3,
+	          item_data,
+	          32,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_read_ahead_set_position(
+	          NULL,
+	          0,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_read_ahead_set_position(
+	          read_ahead,
+	          -1,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_read_ahead_set_position(
+	          read_ahead,
+	          4,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_read_ahead_thread_callback function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_read_ahead_thread_callback(
+     libbfio_handle_t *file_io_handle,
+     libcdata_array_t *entries,
+     const uint8_t *data )
+{
+	libcerror_error_t *error          = NULL;
+	libwtcdb_read_ahead_t *read_ahead = NULL;
+	int buffer_index                  = 0;
+	int number_of_read_buffers        = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 * The read-ahead is created without a helper thread so that the callback can be tested directly
+	 */
+	read_ahead = memory_allocate_structure(
+	              libwtcdb_read_ahead_t );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "read_ahead",
+	 read_ahead );
+
+	memory_set(
+	 read_ahead,
+	 0,
+	 sizeof( libwtcdb_read_ahead_t ) );
+
+	read_ahead->file_io_handle    = file_io_handle;
+	read_ahead->entries           = entries;
+	read_ahead->number_of_items   = 4;
+	read_ahead->number_of_buffers = 4;
+
+	read_ahead->buffers = (libwtcdb_read_ahead_buffer_t *) memory_allocate(
+	                                                        sizeof( libwtcdb_read_ahead_buffer_t ) * 4 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "read_ahead->buffers",
+	 read_ahead->buffers );
+
+	memory_set(
+	 read_ahead->buffers,
+	 0,
+	 sizeof( libwtcdb_read_ahead_buffer_t ) * 4 );
+
+	for( buffer_index = 0;
+	     buffer_index < 4;
+	     buffer_index++ )
+	{
+		read_ahead->buffers[ buffer_index ].item_index = -1;
+	}
+	result = libcthreads_mutex_initialize(
+	          &( read_ahead->mutex ),
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_condition_initialize(
+	          &( read_ahead->condition ),
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The callback returns directly when the read-ahead is stopped
+	 */
+	read_ahead->next_item_index = 0;
+	read_ahead->end_item_index  = 4;
+	read_ahead->stop            = 1;
+
+	result = libwtcdb_read_ahead_thread_callback(
+	          read_ahead );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "read_ahead->next_item_index",
+	 read_ahead->next_item_index,
+	 0 );
+
+	/* The callback reads the items up to the end item index and waits until it is stopped
+	 */
+	read_ahead->stop = 0;
+
+	result = libcthreads_thread_create(
+	          &( read_ahead->thread ),
+	          NULL,
+	          (int (*)(void *)) &libwtcdb_read_ahead_thread_callback,
+	          (void *) read_ahead,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_mutex_grab(
+	          read_ahead->mutex,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	while( number_of_read_buffers < 4 )
+	{
+		number_of_read_buffers = 0;
+
+		for( buffer_index = 0;
+		     buffer_index < 4;
+		     buffer_index++ )
+		{
+			if( ( read_ahead->buffers[ buffer_index ].state == LIBWTCDB_READ_AHEAD_BUFFER_STATE_READ )
+			 || ( read_ahead->buffers[ buffer_index ].state == LIBWTCDB_READ_AHEAD_BUFFER_STATE_FAILED ) )
+			{
+				number_of_read_buffers++;
+			}
+		}
+		if( number_of_read_buffers < 4 )
+		{
+			result = libcthreads_condition_wait(
+			          read_ahead->condition,
+			          read_ahead->mutex,
+			          &error );
+
+			if( result != 1 )
+			{
+				libcthreads_mutex_release(
+				 read_ahead->mutex,
+				 NULL );
+			}
+			WTCDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			WTCDB_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	result = libcthreads_mutex_release(
+	          read_ahead->mutex,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "read_ahead->next_item_index",
+	 read_ahead->next_item_index,
+	 4 );
+
+	for( buffer_index = 0;
+	     buffer_index < 3;
+	     buffer_index++ )
+	{
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "read_ahead->buffers[ buffer_index ].item_index",
+		 read_ahead->buffers[ buffer_index ].item_index,
+		 buffer_index );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "read_ahead->buffers[ buffer_index ].state",
+		 read_ahead->buffers[ buffer_index ].state,
+		 LIBWTCDB_READ_AHEAD_BUFFER_STATE_READ );
+
+		WTCDB_TEST_ASSERT_EQUAL_SIZE(
+		 "read_ahead->buffers[ buffer_index ].data_size",
+		 read_ahead->buffers[ buffer_index ].data_size,
+		 (size_t) wtcdb_test_read_ahead_cached_data_sizes[ buffer_index ] );
+	}
+	result = memory_compare(
+	          read_ahead->buffers[ 1 ].data,
+	          &( data[ 16 ] ),
+	          16 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The cached data of the last item cannot be read
+	 */
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "read_ahead->buffers[ 3 ].state",
+	 read_ahead->buffers[ 3 ].state,
+	 LIBWTCDB_READ_AHEAD_BUFFER_STATE_FAILED );
+
+	/* Clean up
+	 * Freeing the read-ahead stops and joins the helper thread
+	 */
+	result = libwtcdb_read_ahead_free(
+	          &read_ahead,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "read_ahead",
+	 read_ahead );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_read_ahead_thread_callback(
+	          NULL );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_ahead != NULL )
+	{
+		if( read_ahead->buffers == NULL )
+		{
+			memory_free(
+			 read_ahead );
+		}
+		else
+		{
+			libwtcdb_read_ahead_free(
+			 &read_ahead,
+			 NULL );
+		}
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) && defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc WTCDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] WTCDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc WTCDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] WTCDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) && defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+	uint8_t data[ 64 ];
+
+	libbfio_handle_t *file_io_handle  = NULL;
+	libcdata_array_t *entries         = NULL;
+	libcerror_error_t *error          = NULL;
+	libwtcdb_read_ahead_t *read_ahead = NULL;
+	size_t data_offset                = 0;
+	int result                        = 0;
+#endif
+
+	WTCDB_TEST_UNREFERENCED_PARAMETER( argc )
+	WTCDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) && defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+
+	for( data_offset = 0;
+	     data_offset < 64;
+	     data_offset++ )
+	{
+		data[ data_offset ] = (uint8_t) data_offset;
+	}
+	/* Initialize test
+	 */
+	result = wtcdb_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          64,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wtcdb_test_read_ahead_entries_initialize(
+	          &entries,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_RUN_WITH_ARGS(
+	 "libwtcdb_read_ahead_initialize",
+	 wtcdb_test_read_ahead_initialize,
+	 file_io_handle,
+	 entries );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_read_ahead_free",
+	 wtcdb_test_read_ahead_free );
+
+	WTCDB_TEST_RUN_WITH_ARGS(
+	 "libwtcdb_read_ahead_thread_callback",
+	 wtcdb_test_read_ahead_thread_callback,
+	 file_io_handle,
+	 entries,
+	 data );
+
+	result = libwtcdb_read_ahead_initialize(
+	          &read_ahead,
+	          NULL,
+	          file_io_handle,
+	          entries,
+	          2,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_RUN_WITH_ARGS(
+	 "libwtcdb_read_ahead_read_buffer",
+	 wtcdb_test_read_ahead_read_buffer,
+	 read_ahead,
+	 data );
+
+	WTCDB_TEST_RUN_WITH_ARGS(
+	 "libwtcdb_read_ahead_copy_data",
+	 wtcdb_test_read_ahead_copy_data,
+	 read_ahead,
+	 data );
+
+	WTCDB_TEST_RUN_WITH_ARGS(
+	 "libwtcdb_read_ahead_set_position",
+	 wtcdb_test_read_ahead_set_position,
+	 read_ahead,
+	 data );
+
+	/* Clean up
+	 */
+	result = libwtcdb_read_ahead_free(
+	          &read_ahead,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_free(
+	          &entries,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libwtcdb_cache_entry_free,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wtcdb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) && defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) && defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT )
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_ahead != NULL )
+	{
+		libwtcdb_read_ahead_free(
+		 &read_ahead,
+		 NULL );
+	}
+	if( entries != NULL )
+	{
+		libcdata_array_free(
+		 &entries,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libwtcdb_cache_entry_free,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		wtcdb_test_close_file_io_handle(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) && defined( HAVE_LIBWTCDB_MULTI_THREAD_SUPPORT ) */
+}
+
@@ -0,0 +1,1171 @@
+/*
+ * Library read_queue type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "wtcdb_test_functions.h"
+#include "wtcdb_test_libbfio.h"
+#include "wtcdb_test_libcerror.h"
+#include "wtcdb_test_libwtcdb.h"
+#include "wtcdb_test_macros.h"
+#include "wtcdb_test_memory.h"
+#include "wtcdb_test_unused.h"
+
+#include "../libwtcdb/libwtcdb_cache_entry.h"
+#include "../libwtcdb/libwtcdb_definitions.h"
+#include "../libwtcdb/libwtcdb_io_backend.h"
+#include "../libwtcdb/libwtcdb_io_handle.h"
+#include "../libwtcdb/libwtcdb_item.h"
+#include "../libwtcdb/libwtcdb_read_queue.h"
+
+/* Tests the libwtcdb_read_queue_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_read_queue_initialize(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libwtcdb_read_queue_t *read_queue = NULL;
+	int result                        = 0;
+
+#if defined( HAVE_WTCDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests   = 3;
+	int number_of_memset_fail_tests   = 2;
+	int test_number                   = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_read_queue_initialize(
+	          &read_queue,
+	          4,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "read_queue",
+	 read_queue );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_read_queue_free(
+	          &read_queue,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "read_queue",
+	 read_queue );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_read_queue_initialize(
+	          NULL,
+	          4,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_queue = (libwtcdb_read_queue_t *) 0x12345678UL;
+
+	result = libwtcdb_read_queue_initialize(
+	          &read_queue,
+	          4,
+	          &error );
+
+	read_queue = NULL;
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_read_queue_initialize(
+	          &read_queue,
+	          0,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "read_queue",
+	 read_queue );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_read_queue_initialize(
+	          &read_queue,
+	          LIBWTCDB_MAXIMUM_READ_QUEUE_DEPTH + 1,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "read_queue",
+	 read_queue );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_WTCDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libwtcdb_read_queue_initialize with malloc failing
+		 */
+		wtcdb_test_malloc_attempts_before_fail = test_number;
+
+		result = libwtcdb_read_queue_initialize(
+		          &read_queue,
+		          4,
+		          &error );
+
+		if( wtcdb_test_malloc_attempts_before_fail != -1 )
+		{
+			wtcdb_test_malloc_attempts_before_fail = -1;
+
+			if( read_queue != NULL )
+			{
+				libwtcdb_read_queue_free(
+				 &read_queue,
+				 NULL );
+			}
+		}
+		else
+		{
+			WTCDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			WTCDB_TEST_ASSERT_IS_NULL(
+			 "read_queue",
+			 read_queue );
+
+			WTCDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libwtcdb_read_queue_initialize with memset failing
+		 */
+		wtcdb_test_memset_attempts_before_fail = test_number;
+
+		result = libwtcdb_read_queue_initialize(
+		          &read_queue,
+		          4,
+		          &error );
+
+		if( wtcdb_test_memset_attempts_before_fail != -1 )
+		{
+			wtcdb_test_memset_attempts_before_fail = -1;
+
+			if( read_queue != NULL )
+			{
+				libwtcdb_read_queue_free(
+				 &read_queue,
+				 NULL );
+			}
+		}
+		else
+		{
+			WTCDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			WTCDB_TEST_ASSERT_IS_NULL(
+			 "read_queue",
+			 read_queue );
+
+			WTCDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_WTCDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_queue != NULL )
+	{
+		libwtcdb_read_queue_free(
+		 &read_queue,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_read_queue_free function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_read_queue_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libwtcdb_read_queue_free(
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+
+/* Tests the libwtcdb_read_queue_submit, libwtcdb_read_queue_get_completion and
+ * libwtcdb_read_queue_wait_for_completion functions
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_read_queue_submit(
+     libwtcdb_item_t *item,
+     libwtcdb_item_t *invalid_item,
+     const uint8_t *file_data )
+{
+	uint8_t data1[ 16 ];
+	uint8_t data2[ 16 ];
+
+	libcerror_error_t *error          = NULL;
+	libwtcdb_read_queue_t *read_queue = NULL;
+	intptr_t *tag                     = NULL;
+	ssize_t read_count                = 0;
+	int number_of_requests            = 0;
+	int result                        = 0;
+	int tag_value                     = 0;
+	int tags_found                    = 0;
+
+	/* Initialize test
+	 */
+	result = libwtcdb_read_queue_initialize(
+	          &read_queue,
+	          2,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_read_queue_submit(
+	          read_queue,
+	          item,
+	          0,
+	          data1,
+	          16,
+	          (intptr_t *) 1,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_read_queue_submit(
+	          read_queue,
+	          item,
+	          16,
+	          data2,
+	          16,
+	          (intptr_t *) 2,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test submit on a full queue
+	 */
+	result = libwtcdb_read_queue_submit(
+	          read_queue,
+	          item,
+	          0,
+	          data1,
+	          16,
+	          (intptr_t *) 3,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_read_queue_get_number_of_requests(
+	          read_queue,
+	          &number_of_requests,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_requests",
+	 number_of_requests,
+	 2 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The read requests can complete in any order
+	 */
+	while( tags_found != 3 )
+	{
+		result = libwtcdb_read_queue_wait_for_completion(
+		          read_queue,
+		          &tag,
+		          &read_count,
+		          &error );
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		WTCDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		WTCDB_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 16 );
+
+		tag_value = (int) (intptr_t) tag;
+
+		WTCDB_TEST_ASSERT_EQUAL_INT(
+		 "tags_found",
+		 ( tags_found & tag_value ),
+		 0 );
+
+		tags_found |= tag_value;
+	}
+	result = memory_compare(
+	          data1,
+	          &( file_data[ 8 ] ),
+	          16 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          data2,
+	          &( file_data[ 24 ] ),
+	          16 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test retrieving a completion when no read requests were submitted
+	 */
+	result = libwtcdb_read_queue_wait_for_completion(
+	          read_queue,
+	          &tag,
+	          &read_count,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_read_queue_get_completion(
+	          read_queue,
+	          &tag,
+	          &read_count,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read request of cached data that exceeds the file
+	 */
+	result = libwtcdb_read_queue_submit(
+	          read_queue,
+	          invalid_item,
+	          0,
+	          data1,
+	          16,
+	          (intptr_t *) 4,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_read_queue_wait_for_completion(
+	          read_queue,
+	          &tag,
+	          &read_count,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INTPTR(
+	 "tag",
+	 tag,
+	 (intptr_t *) 4 );
+
+	WTCDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_read_queue_submit(
+	          NULL,
+	          item,
+	          0,
+	          data1,
+	          16,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_read_queue_submit(
+	          read_queue,
+	          NULL,
+	          0,
+	          data1,
+	          16,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_read_queue_submit(
+	          read_queue,
+	          item,
+	          0,
+	          NULL,
+	          16,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_read_queue_submit(
+	          read_queue,
+	          item,
+	          0,
+	          data1,
+	          (size_t) SSIZE_MAX + 1,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_read_queue_submit(
+	          read_queue,
+	          item,
+	          -1,
+	          data1,
+	          16,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_read_queue_submit(
+	          read_queue,
+	          item,
+	          24,
+	          data1,
+	          16,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_read_queue_get_number_of_requests(
+	          NULL,
+	          &number_of_requests,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_read_queue_get_number_of_requests(
+	          read_queue,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_read_queue_get_completion(
+	          NULL,
+	          &tag,
+	          &read_count,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_read_queue_get_completion(
+	          read_queue,
+	          NULL,
+	          &read_count,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_read_queue_wait_for_completion(
+	          read_queue,
+	          &tag,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test free with a submitted read request
+	 */
+	result = libwtcdb_read_queue_submit(
+	          read_queue,
+	          item,
+	          0,
+	          data1,
+	          16,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libwtcdb_read_queue_free(
+	          &read_queue,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_queue != NULL )
+	{
+		libwtcdb_read_queue_free(
+		 &read_queue,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc WTCDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] WTCDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc WTCDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] WTCDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+	uint8_t file_data[ 64 ];
+
+	libbfio_handle_t *file_io_handle            = NULL;
+	libcerror_error_t *error                    = NULL;
+	libwtcdb_cache_entry_t *cache_entry         = NULL;
+	libwtcdb_cache_entry_t *invalid_cache_entry = NULL;
+	libwtcdb_io_backend_t *io_backend           = NULL;
+	libwtcdb_io_handle_t *io_handle             = NULL;
+	libwtcdb_item_t *invalid_item               = NULL;
+	libwtcdb_item_t *item                       = NULL;
+	size_t data_offset                          = 0;
+	int result                                  = 0;
+#endif
+
+	WTCDB_TEST_UNREFERENCED_PARAMETER( argc )
+	WTCDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_read_queue_initialize",
+	 wtcdb_test_read_queue_initialize );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_read_queue_free",
+	 wtcdb_test_read_queue_free );
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+
+	for( data_offset = 0;
+	     data_offset < 64;
+	     data_offset++ )
+	{
+		file_data[ data_offset ] = (uint8_t) data_offset;
+	}
+	/* Initialize test
+	 */
+	result = wtcdb_test_open_file_io_handle(
+	          &file_io_handle,
+	          file_data,
+	          64,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->file_type = LIBWTCDB_FILE_TYPE_CACHE;
+
+	result = libwtcdb_cache_entry_initialize(
+	          &cache_entry,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	cache_entry->cached_data_offset = 8;
+	cache_entry->cached_data_size   = 32;
+
+	result = libwtcdb_cache_entry_initialize(
+	          &invalid_cache_entry,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	invalid_cache_entry->cached_data_offset = 56;
+	invalid_cache_entry->cached_data_size   = 32;
+
+	result = libwtcdb_item_initialize(
+	          &item,
+	          io_handle,
+	          file_io_handle,
+	          (intptr_t *) cache_entry,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_item_initialize(
+	          &invalid_item,
+	          io_handle,
+	          file_io_handle,
+	          (intptr_t *) invalid_cache_entry,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_RUN_WITH_ARGS(
+	 "libwtcdb_read_queue_submit",
+	 wtcdb_test_read_queue_submit,
+	 item,
+	 invalid_item,
+	 file_data );
+
+	/* Test the read requests of a file with an IO backend, which are read in a batch
+	 */
+	result = libwtcdb_io_backend_initialize(
+	          &io_backend,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->io_backend = io_backend;
+
+	WTCDB_TEST_RUN_WITH_ARGS(
+	 "libwtcdb_read_queue_submit",
+	 wtcdb_test_read_queue_submit,
+	 item,
+	 invalid_item,
+	 file_data );
+
+	io_handle->io_backend = NULL;
+
+	result = libwtcdb_io_backend_free(
+	          &io_backend,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libwtcdb_item_free(
+	          &invalid_item,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_item_free(
+	          &item,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_cache_entry_free(
+	          &invalid_cache_entry,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_cache_entry_free(
+	          &cache_entry,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wtcdb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( invalid_item != NULL )
+	{
+		libwtcdb_item_free(
+		 &invalid_item,
+		 NULL );
+	}
+	if( item != NULL )
+	{
+		libwtcdb_item_free(
+		 &item,
+		 NULL );
+	}
+	if( invalid_cache_entry != NULL )
+	{
+		libwtcdb_cache_entry_free(
+		 &invalid_cache_entry,
+		 NULL );
+	}
+	if( io_backend != NULL )
+	{
+		if( io_handle != NULL )
+		{
+			io_handle->io_backend = NULL;
+		}
+		libwtcdb_io_backend_free(
+		 &io_backend,
+		 NULL );
+	}
+	if( cache_entry != NULL )
+	{
+		libwtcdb_cache_entry_free(
+		 &cache_entry,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libwtcdb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		wtcdb_test_close_file_io_handle(
+		 &file_io_handle,
+		 NULL );
+	}
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,696 @@
+/*
+ * Library snapshot type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "wtcdb_test_libcerror.h"
+#include "wtcdb_test_libwtcdb.h"
+#include "wtcdb_test_macros.h"
+#include "wtcdb_test_memory.h"
+#include "wtcdb_test_unused.h"
+
+#include "../libwtcdb/libwtcdb_definitions.h"
+#include "../libwtcdb/libwtcdb_snapshot.h"
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+
+/* Tests the libwtcdb_snapshot_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_snapshot_initialize(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libwtcdb_internal_snapshot_t *snapshot = NULL;
+	int result                             = 0;
+
+#if defined( HAVE_WTCDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests        = 1;
+	int number_of_memset_fail_tests        = 1;
+	int test_number                        = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_snapshot_initialize(
+	          &snapshot,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "snapshot",
+	 snapshot );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libwtcdb_snapshot_free(
+	          (libwtcdb_snapshot_t **) &snapshot,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "snapshot",
+	 snapshot );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_snapshot_initialize(
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	snapshot = (libwtcdb_internal_snapshot_t *) 0x12345678UL;
+
+	result = libwtcdb_snapshot_initialize(
+	          &snapshot,
+	          &error );
+
+	snapshot = NULL;
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_WTCDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libwtcdb_snapshot_initialize with malloc failing
+		 */
+		wtcdb_test_malloc_attempts_before_fail = test_number;
+
+		result = libwtcdb_snapshot_initialize(
+		          &snapshot,
+		          &error );
+
+		if( wtcdb_test_malloc_attempts_before_fail != -1 )
+		{
+			wtcdb_test_malloc_attempts_before_fail = -1;
+
+			if( snapshot != NULL )
+			{
+				libwtcdb_snapshot_free(
+				 (libwtcdb_snapshot_t **) &snapshot,
+				 NULL );
+			}
+		}
+		else
+		{
+			WTCDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			WTCDB_TEST_ASSERT_IS_NULL(
+			 "snapshot",
+			 snapshot );
+
+			WTCDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libwtcdb_snapshot_initialize with memset failing
+		 */
+		wtcdb_test_memset_attempts_before_fail = test_number;
+
+		result = libwtcdb_snapshot_initialize(
+		          &snapshot,
+		          &error );
+
+		if( wtcdb_test_memset_attempts_before_fail != -1 )
+		{
+			wtcdb_test_memset_attempts_before_fail = -1;
+
+			if( snapshot != NULL )
+			{
+				libwtcdb_snapshot_free(
+				 (libwtcdb_snapshot_t **) &snapshot,
+				 NULL );
+			}
+		}
+		else
+		{
+			WTCDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			WTCDB_TEST_ASSERT_IS_NULL(
+			 "snapshot",
+			 snapshot );
+
+			WTCDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_WTCDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( snapshot != NULL )
+	{
+		libwtcdb_snapshot_free(
+		 (libwtcdb_snapshot_t **) &snapshot,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_snapshot_free function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_snapshot_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libwtcdb_snapshot_free(
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_snapshot_add_reference function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_snapshot_add_reference(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libwtcdb_internal_snapshot_t *reference = NULL;
+	libwtcdb_internal_snapshot_t *snapshot  = NULL;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libwtcdb_snapshot_initialize(
+	          &snapshot,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "snapshot",
+	 snapshot );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_snapshot_add_reference(
+	          snapshot,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "snapshot->number_of_references",
+	 snapshot->number_of_references,
+	 2 );
+
+	reference = snapshot;
+
+	result = libwtcdb_snapshot_free(
+	          (libwtcdb_snapshot_t **) &reference,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "reference",
+	 reference );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "snapshot->number_of_references",
+	 snapshot->number_of_references,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_snapshot_add_reference(
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwtcdb_snapshot_free(
+	          (libwtcdb_snapshot_t **) &snapshot,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "snapshot",
+	 snapshot );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( snapshot != NULL )
+	{
+		libwtcdb_snapshot_free(
+		 (libwtcdb_snapshot_t **) &snapshot,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_snapshot_get_type function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_snapshot_get_type(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libwtcdb_internal_snapshot_t *snapshot = NULL;
+	uint8_t type                           = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libwtcdb_snapshot_initialize(
+	          &snapshot,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "snapshot",
+	 snapshot );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	snapshot->file_type = LIBWTCDB_FILE_TYPE_CACHE;
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_snapshot_get_type(
+	          (libwtcdb_snapshot_t *) snapshot,
+	          &type,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_EQUAL_UINT8(
+	 "type",
+	 type,
+	 (uint8_t) LIBWTCDB_FILE_TYPE_CACHE );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_snapshot_get_type(
+	          NULL,
+	          &type,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_snapshot_get_type(
+	          (libwtcdb_snapshot_t *) snapshot,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwtcdb_snapshot_free(
+	          (libwtcdb_snapshot_t **) &snapshot,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "snapshot",
+	 snapshot );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( snapshot != NULL )
+	{
+		libwtcdb_snapshot_free(
+		 (libwtcdb_snapshot_t **) &snapshot,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libwtcdb_snapshot_get_number_of_items function
+ * Returns 1 if successful or 0 if not
+ */
+int wtcdb_test_snapshot_get_number_of_items(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libwtcdb_internal_snapshot_t *snapshot = NULL;
+	int number_of_items                    = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libwtcdb_snapshot_initialize(
+	          &snapshot,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "snapshot",
+	 snapshot );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libwtcdb_snapshot_get_number_of_items(
+	          (libwtcdb_snapshot_t *) snapshot,
+	          &number_of_items,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_items",
+	 number_of_items,
+	 0 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libwtcdb_snapshot_get_number_of_items(
+	          NULL,
+	          &number_of_items,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libwtcdb_snapshot_get_number_of_items(
+	          (libwtcdb_snapshot_t *) snapshot,
+	          NULL,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	WTCDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libwtcdb_snapshot_free(
+	          (libwtcdb_snapshot_t **) &snapshot,
+	          &error );
+
+	WTCDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "snapshot",
+	 snapshot );
+
+	WTCDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( snapshot != NULL )
+	{
+		libwtcdb_snapshot_free(
+		 (libwtcdb_snapshot_t **) &snapshot,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc WTCDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] WTCDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc WTCDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] WTCDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	WTCDB_TEST_UNREFERENCED_PARAMETER( argc )
+	WTCDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT )
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_snapshot_initialize",
+	 wtcdb_test_snapshot_initialize );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_snapshot_free",
+	 wtcdb_test_snapshot_free );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_snapshot_add_reference",
+	 wtcdb_test_snapshot_add_reference );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_snapshot_get_type",
+	 wtcdb_test_snapshot_get_type );
+
+	WTCDB_TEST_RUN(
+	 "libwtcdb_snapshot_get_number_of_items",
+	 wtcdb_test_snapshot_get_number_of_items );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBWTCDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,681 @@
+/*
+ * Diff handle
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#include "diff_handle.h"
+#include "wtcdbtools_libcerror.h"
+#include "wtcdbtools_libwtcdb.h"
+
+#define DIFF_HANDLE_NOTIFY_STREAM	stdout
+
+/* Creates a diff handle
+ * Make sure the value diff_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int diff_handle_initialize(
+     diff_handle_t **diff_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "diff_handle_initialize";
+
+	if( diff_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *diff_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid diff handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*diff_handle = memory_allocate_structure(
+	                diff_handle_t );
+
+	if( *diff_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create diff handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *diff_handle,
+	     0,
+	     sizeof( diff_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear diff handle.",
+		 function );
+
+		memory_free(
+		 *diff_handle );
+
+		*diff_handle = NULL;
+
+		return( -1 );
+	}
+	if( libwtcdb_file_initialize(
+	     &( ( *diff_handle )->old_input_file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize old input file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libwtcdb_file_initialize(
+	     &( ( *diff_handle )->new_input_file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize new input file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libwtcdb_chunk_cache_initialize(
+	     &( ( *diff_handle )->chunk_cache ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize chunk cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( libwtcdb_file_set_chunk_cache(
+	     ( *diff_handle )->old_input_file,
+	     ( *diff_handle )->chunk_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set chunk cache of old input file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libwtcdb_file_set_chunk_cache(
+	     ( *diff_handle )->new_input_file,
+	     ( *diff_handle )->chunk_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set chunk cache of new input file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libwtcdb_diff_initialize(
+	     &( ( *diff_handle )->diff ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize diff.",
+		 function );
+
+		goto on_error;
+	}
+	( *diff_handle )->notify_stream = DIFF_HANDLE_NOTIFY_STREAM;
+
+	return( 1 );
+
+on_error:
+	if( *diff_handle != NULL )
+	{
+		if( ( *diff_handle )->chunk_cache != NULL )
+		{
+			libwtcdb_chunk_cache_free(
+			 &( ( *diff_handle )->chunk_cache ),
+			 NULL );
+		}
+		if( ( *diff_handle )->new_input_file != NULL )
+		{
+			libwtcdb_file_free(
+			 &( ( *diff_handle )->new_input_file ),
+			 NULL );
+		}
+		if( ( *diff_handle )->old_input_file != NULL )
+		{
+			libwtcdb_file_free(
+			 &( ( *diff_handle )->old_input_file ),
+			 NULL );
+		}
+		memory_free(
+		 *diff_handle );
+
+		*diff_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a diff handle
+ * Returns 1 if successful or -1 on error
+ */
+int diff_handle_free(
+     diff_handle_t **diff_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "diff_handle_free";
+	int result            = 1;
+
+	if( diff_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *diff_handle != NULL )
+	{
+		if( ( *diff_handle )->diff != NULL )
+		{
+			if( libwtcdb_diff_free(
+			     &( ( *diff_handle )->diff ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free diff.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *diff_handle )->new_input_file != NULL )
+		{
+			if( libwtcdb_file_free(
+			     &( ( *diff_handle )->new_input_file ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free new input file.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *diff_handle )->old_input_file != NULL )
+		{
+			if( libwtcdb_file_free(
+			     &( ( *diff_handle )->old_input_file ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free old input file.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *diff_handle )->chunk_cache != NULL )
+		{
+			if( libwtcdb_chunk_cache_free(
+			     &( ( *diff_handle )->chunk_cache ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free chunk cache.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *diff_handle );
+
+		*diff_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the diff handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int diff_handle_signal_abort(
+     diff_handle_t *diff_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "diff_handle_signal_abort";
+
+	if( diff_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff handle.",
+		 function );
+
+		return( -1 );
+	}
+	diff_handle->abort = 1;
+
+	if( diff_handle->old_input_file != NULL )
+	{
+		if( libwtcdb_file_signal_abort(
+		     diff_handle->old_input_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal old input file to abort.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( diff_handle->new_input_file != NULL )
+	{
+		if( libwtcdb_file_signal_abort(
+		     diff_handle->new_input_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal new input file to abort.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Sets if the cached data of items with the same hash should be compared
+ * Returns 1 if successful or -1 on error
+ */
+int diff_handle_set_compare_data(
+     diff_handle_t *diff_handle,
+     uint8_t compare_data,
+     libcerror_error_t **error )
+{
+	static char *function = "diff_handle_set_compare_data";
+
+	if( diff_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( compare_data != 0 )
+	{
+		diff_handle->diff_flags |= LIBWTCDB_DIFF_FLAG_COMPARE_DATA;
+	}
+	else
+	{
+		diff_handle->diff_flags &= ~( LIBWTCDB_DIFF_FLAG_COMPARE_DATA );
+	}
+	return( 1 );
+}
+
+/* Opens the input
+ * Returns 1 if successful or -1 on error
+ */
+int diff_handle_open_input(
+     diff_handle_t *diff_handle,
+     const system_character_t *old_filename,
+     const system_character_t *new_filename,
+     libcerror_error_t **error )
+{
+	static char *function = "diff_handle_open_input";
+
+	if( diff_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libwtcdb_file_open_wide(
+	     diff_handle->old_input_file,
+	     old_filename,
+	     LIBWTCDB_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libwtcdb_file_open(
+	     diff_handle->old_input_file,
+	     old_filename,
+	     LIBWTCDB_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open old input file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libwtcdb_file_open_wide(
+	     diff_handle->new_input_file,
+	     new_filename,
+	     LIBWTCDB_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libwtcdb_file_open(
+	     diff_handle->new_input_file,
+	     new_filename,
+	     LIBWTCDB_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open new input file.",
+		 function );
+
+		libwtcdb_file_close(
+		 diff_handle->old_input_file,
+		 NULL );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Closes the input
+ * Returns the 0 if successful or -1 on error
+ */
+int diff_handle_close_input(
+     diff_handle_t *diff_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "diff_handle_close_input";
+	int result            = 0;
+
+	if( diff_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libwtcdb_file_close(
+	     diff_handle->new_input_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close new input file.",
+		 function );
+
+		result = -1;
+	}
+	if( libwtcdb_file_close(
+	     diff_handle->old_input_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close old input file.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Compares the input files and prints the changes
+ * Returns 1 if successful or -1 on error
+ */
+int diff_handle_compare_fprint(
+     diff_handle_t *diff_handle,
+     libcerror_error_t **error )
+{
+	static char *function  = "diff_handle_compare_fprint";
+	uint64_t hash          = 0;
+	uint8_t change_type    = 0;
+	int change_index       = 0;
+	int new_item_index     = 0;
+	int number_of_added    = 0;
+	int number_of_changes  = 0;
+	int number_of_modified = 0;
+	int number_of_removed  = 0;
+	int old_item_index     = 0;
+
+	if( diff_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libwtcdb_diff_compare_files(
+	     diff_handle->diff,
+	     diff_handle->old_input_file,
+	     diff_handle->new_input_file,
+	     diff_handle->diff_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to compare input files.",
+		 function );
+
+		return( -1 );
+	}
+	if( libwtcdb_diff_get_number_of_changes(
+	     diff_handle->diff,
+	     &number_of_changes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of changes.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 diff_handle->notify_stream,
+	 "Windows Explorer thumbnail cache database differences:\n" );
+
+	for( change_index = 0;
+	     change_index < number_of_changes;
+	     change_index++ )
+	{
+		if( diff_handle->abort != 0 )
+		{
+			break;
+		}
+		if( libwtcdb_diff_get_change(
+		     diff_handle->diff,
+		     change_index,
+		     &change_type,
+		     &hash,
+		     &old_item_index,
+		     &new_item_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve change: %d.",
+			 function,
+			 change_index );
+
+			return( -1 );
+		}
+		switch( change_type )
+		{
+			case LIBWTCDB_CHANGE_TYPE_ADDED:
+				fprintf(
+				 diff_handle->notify_stream,
+				 "\tAdded:\t\t0x%016" PRIx64 "\t(new item: %d)\n",
+				 hash,
+				 new_item_index );
+
+				number_of_added++;
+
+				break;
+
+			case LIBWTCDB_CHANGE_TYPE_REMOVED:
+				fprintf(
+				 diff_handle->notify_stream,
+				 "\tRemoved:\t0x%016" PRIx64 "\t(old item: %d)\n",
+				 hash,
+				 old_item_index );
+
+				number_of_removed++;
+
+				break;
+
+			case LIBWTCDB_CHANGE_TYPE_MODIFIED:
+				fprintf(
+				 diff_handle->notify_stream,
+				 "\tModified:\t0x%016" PRIx64 "\t(old item: %d, new item: %d)\n",
+				 hash,
+				 old_item_index,
+				 new_item_index );
+
+				number_of_modified++;
+
+				break;
+
+			default:
+				break;
+		}
+	}
+	if( number_of_changes > 0 )
+	{
+		fprintf(
+		 diff_handle->notify_stream,
+		 "\n" );
+	}
+	fprintf(
+	 diff_handle->notify_stream,
+	 "\tNumber of added items:\t\t%d\n",
+	 number_of_added );
+
+	fprintf(
+	 diff_handle->notify_stream,
+	 "\tNumber of removed items:\t%d\n",
+	 number_of_removed );
+
+	fprintf(
+	 diff_handle->notify_stream,
+	 "\tNumber of modified items:\t%d\n",
+	 number_of_modified );
+
+	fprintf(
+	 diff_handle->notify_stream,
+	 "\n" );
+
+	return( 1 );
+}
+
@@ -0,0 +1,106 @@
+/*
+ * Diff handle
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _DIFF_HANDLE_H )
+#define _DIFF_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "wtcdbtools_libcerror.h"
+#include "wtcdbtools_libwtcdb.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct diff_handle diff_handle_t;
+
+struct diff_handle
+{
+	/* The libwtcdb old input file
+	 */
+	libwtcdb_file_t *old_input_file;
+
+	/* The libwtcdb new input file
+	 */
+	libwtcdb_file_t *new_input_file;
+
+	/* The libwtcdb chunk cache, used to reuse the entries of the old input file
+	 * for the parts of the new input file that are the same
+	 */
+	libwtcdb_chunk_cache_t *chunk_cache;
+
+	/* The libwtcdb diff
+	 */
+	libwtcdb_diff_t *diff;
+
+	/* The diff flags
+	 */
+	uint8_t diff_flags;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int diff_handle_initialize(
+     diff_handle_t **diff_handle,
+     libcerror_error_t **error );
+
+int diff_handle_free(
+     diff_handle_t **diff_handle,
+     libcerror_error_t **error );
+
+int diff_handle_signal_abort(
+     diff_handle_t *diff_handle,
+     libcerror_error_t **error );
+
+int diff_handle_set_compare_data(
+     diff_handle_t *diff_handle,
+     uint8_t compare_data,
+     libcerror_error_t **error );
+
+int diff_handle_open_input(
+     diff_handle_t *diff_handle,
+     const system_character_t *old_filename,
+     const system_character_t *new_filename,
+     libcerror_error_t **error );
+
+int diff_handle_close_input(
+     diff_handle_t *diff_handle,
+     libcerror_error_t **error );
+
+int diff_handle_compare_fprint(
+     diff_handle_t *diff_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _DIFF_HANDLE_H ) */
+
@@ -199,6 +199,22 @@ int export_handle_signal_abort(
 	}
 	export_handle->abort = 1;
 
+	if( export_handle->input_file != NULL )
+	{
+		if( libwtcdb_file_signal_abort(
+		     export_handle->input_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal input file to abort.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	return( 1 );
 }
 
@@ -726,6 +742,10 @@ int export_handle_export_file(
 	     item_index < number_of_items;
 	     item_index++ )
 	{
+		if( export_handle->abort != 0 )
+		{
+			break;
+		}
 		if( libwtcdb_file_get_item(
 		     export_handle->input_file,
 		     item_index,
@@ -162,6 +162,22 @@ int info_handle_free(
 				result = -1;
 			}
 		}
+		if( ( *info_handle )->input_cache_sets != NULL )
+		{
+			if( info_handle_close_input_cache_sets(
+			     *info_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free input cache sets.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 *info_handle );
 
@@ -178,6 +194,7 @@ int info_handle_signal_abort(
      libcerror_error_t **error )
 {
 	static char *function = "info_handle_signal_abort";
+	int cache_set_index   = 0;
 
 	if( info_handle == NULL )
 	{
@@ -208,6 +225,32 @@ int info_handle_signal_abort(
 			return( -1 );
 		}
 	}
+	if( info_handle->input_cache_sets != NULL )
+	{
+		for( cache_set_index = 0;
+		     cache_set_index < info_handle->number_of_input_cache_sets;
+		     cache_set_index++ )
+		{
+			if( info_handle->input_cache_sets[ cache_set_index ] == NULL )
+			{
+				continue;
+			}
+			if( libwtcdb_cache_set_signal_abort(
+			     info_handle->input_cache_sets[ cache_set_index ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to signal input cache set: %d to abort.",
+				 function,
+				 cache_set_index );
+
+				return( -1 );
+			}
+		}
+	}
 	return( 1 );
 }
 
@@ -335,6 +378,231 @@ int info_handle_close_input(
 	return( 0 );
 }
 
+/* Opens the input cache sets
+ * Every directory name refers to a directory that contains the thumbcache files of a single cache set
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_open_input_cache_sets(
+     info_handle_t *info_handle,
+     system_character_t * const *directory_names,
+     int number_of_directory_names,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_open_input_cache_sets";
+	size_t array_size     = 0;
+	int cache_set_index   = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->input_cache_sets != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid info handle - input cache sets value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_names == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory names.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_directory_names <= 0 )
+	 || ( (size_t) number_of_directory_names > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libwtcdb_cache_set_t * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of directory names value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	array_size = sizeof( libwtcdb_cache_set_t * ) * number_of_directory_names;
+
+	info_handle->input_cache_sets = (libwtcdb_cache_set_t **) memory_allocate(
+	                                                           array_size );
+
+	if( info_handle->input_cache_sets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create input cache sets.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     info_handle->input_cache_sets,
+	     0,
+	     array_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear input cache sets.",
+		 function );
+
+		memory_free(
+		 info_handle->input_cache_sets );
+
+		info_handle->input_cache_sets = NULL;
+
+		goto on_error;
+	}
+	info_handle->input_directory_names      = directory_names;
+	info_handle->number_of_input_cache_sets = number_of_directory_names;
+
+	for( cache_set_index = 0;
+	     cache_set_index < number_of_directory_names;
+	     cache_set_index++ )
+	{
+		if( libwtcdb_cache_set_initialize(
+		     &( info_handle->input_cache_sets[ cache_set_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize input cache set: %d.",
+			 function,
+			 cache_set_index );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		if( libwtcdb_cache_set_open_wide(
+		     info_handle->input_cache_sets[ cache_set_index ],
+		     directory_names[ cache_set_index ],
+		     LIBWTCDB_OPEN_READ,
+		     error ) != 1 )
+#else
+		if( libwtcdb_cache_set_open(
+		     info_handle->input_cache_sets[ cache_set_index ],
+		     directory_names[ cache_set_index ],
+		     LIBWTCDB_OPEN_READ,
+		     error ) != 1 )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open input cache set: %d.",
+			 function,
+			 cache_set_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( info_handle->input_cache_sets != NULL )
+	{
+		info_handle_close_input_cache_sets(
+		 info_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes the input cache sets
+ * Returns the 0 if successful or -1 on error
+ */
+int info_handle_close_input_cache_sets(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_close_input_cache_sets";
+	int cache_set_index   = 0;
+	int result            = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->input_cache_sets == NULL )
+	{
+		return( 0 );
+	}
+	for( cache_set_index = 0;
+	     cache_set_index < info_handle->number_of_input_cache_sets;
+	     cache_set_index++ )
+	{
+		if( info_handle->input_cache_sets[ cache_set_index ] == NULL )
+		{
+			continue;
+		}
+		if( libwtcdb_cache_set_close(
+		     info_handle->input_cache_sets[ cache_set_index ],
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close input cache set: %d.",
+			 function,
+			 cache_set_index );
+
+			result = -1;
+		}
+		if( libwtcdb_cache_set_free(
+		     &( info_handle->input_cache_sets[ cache_set_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free input cache set: %d.",
+			 function,
+			 cache_set_index );
+
+			result = -1;
+		}
+	}
+	memory_free(
+	 info_handle->input_cache_sets );
+
+	info_handle->input_cache_sets           = NULL;
+	info_handle->input_directory_names      = NULL;
+	info_handle->number_of_input_cache_sets = 0;
+
+	return( result );
+}
+
 /* Prints a FILETIME value
  * Returns 1 if successful or -1 on error
  */
@@ -541,3 +809,438 @@ int info_handle_file_fprint(
 	return( 1 );
 }
 
+/* Prints the cache items of the current timeline entry
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_timeline_items_fprint(
+     info_handle_t *info_handle,
+     libwtcdb_timeline_t *timeline,
+     int number_of_items,
+     libcerror_error_t **error )
+{
+	libwtcdb_item_t **items = NULL;
+	static char *function   = "info_handle_timeline_items_fprint";
+	uint32_t height         = 0;
+	uint32_t width          = 0;
+	uint16_t bits_per_pixel = 0;
+	uint8_t image_format    = 0;
+	int item_index          = 0;
+	int result              = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_items < 0 )
+	 || ( (size_t) number_of_items > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libwtcdb_item_t * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of items value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_items == 0 )
+	{
+		return( 1 );
+	}
+	items = (libwtcdb_item_t **) memory_allocate(
+	                              sizeof( libwtcdb_item_t * ) * number_of_items );
+
+	if( items == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create items.",
+		 function );
+
+		return( -1 );
+	}
+	if( libwtcdb_timeline_get_items(
+	     timeline,
+	     items,
+	     number_of_items,
+	     &number_of_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve items.",
+		 function );
+
+		memory_free(
+		 items );
+
+		return( -1 );
+	}
+	for( item_index = 0;
+	     item_index < number_of_items;
+	     item_index++ )
+	{
+		if( libwtcdb_item_get_image_format(
+		     items[ item_index ],
+		     &image_format,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve image format of item: %d.",
+			 function,
+			 item_index );
+
+			goto on_error;
+		}
+		result = libwtcdb_item_get_image_dimensions(
+		          items[ item_index ],
+		          &width,
+		          &height,
+		          &bits_per_pixel,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve image dimensions of item: %d.",
+			 function,
+			 item_index );
+
+			goto on_error;
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tItem: %d\t\t\t",
+		 item_index + 1 );
+
+		switch( image_format )
+		{
+			case LIBWTCDB_IMAGE_FORMAT_BMP:
+				fprintf(
+				 info_handle->notify_stream,
+				 "BMP" );
+				break;
+
+			case LIBWTCDB_IMAGE_FORMAT_JPEG:
+				fprintf(
+				 info_handle->notify_stream,
+				 "JPEG" );
+				break;
+
+			case LIBWTCDB_IMAGE_FORMAT_PNG:
+				fprintf(
+				 info_handle->notify_stream,
+				 "PNG" );
+				break;
+
+			default:
+				fprintf(
+				 info_handle->notify_stream,
+				 "Unknown" );
+				break;
+		}
+		if( result != 0 )
+		{
+			fprintf(
+			 info_handle->notify_stream,
+			 " %" PRIu32 " x %" PRIu32 "",
+			 width,
+			 height );
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\n" );
+
+		if( libwtcdb_item_free(
+		     &( items[ item_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free item: %d.",
+			 function,
+			 item_index );
+
+			item_index++;
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 items );
+
+	return( 1 );
+
+on_error:
+	while( item_index < number_of_items )
+	{
+		if( items[ item_index ] != NULL )
+		{
+			libwtcdb_item_free(
+			 &( items[ item_index ] ),
+			 NULL );
+		}
+		item_index++;
+	}
+	memory_free(
+	 items );
+
+	return( -1 );
+}
+
+/* Prints the timeline of the modification times of the index files of the input cache sets
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_timeline_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	int *last_input_indexes       = NULL;
+	libwtcdb_timeline_t *timeline = NULL;
+	static char *function         = "info_handle_timeline_fprint";
+	uint64_t hash                 = 0;
+	uint64_t modification_time    = 0;
+	int cache_set_index           = 0;
+	int input_index               = 0;
+	int number_of_entries         = 0;
+	int number_of_inputs          = 0;
+	int number_of_items           = 0;
+	int result                    = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->input_cache_sets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid info handle - missing input cache sets.",
+		 function );
+
+		return( -1 );
+	}
+	/* The index files of every cache set are appended as consecutive inputs,
+	 * the last input index of every cache set is used to map an entry to its cache set
+	 */
+	last_input_indexes = (int *) memory_allocate(
+	                              sizeof( int ) * info_handle->number_of_input_cache_sets );
+
+	if( last_input_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create last input indexes.",
+		 function );
+
+		goto on_error;
+	}
+	if( libwtcdb_timeline_initialize(
+	     &timeline,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize timeline.",
+		 function );
+
+		goto on_error;
+	}
+	for( cache_set_index = 0;
+	     cache_set_index < info_handle->number_of_input_cache_sets;
+	     cache_set_index++ )
+	{
+		if( libwtcdb_timeline_append_cache_set(
+		     timeline,
+		     info_handle->input_cache_sets[ cache_set_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append input cache set: %d to timeline.",
+			 function,
+			 cache_set_index );
+
+			goto on_error;
+		}
+		if( libwtcdb_timeline_get_number_of_inputs(
+		     timeline,
+		     &number_of_inputs,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of timeline inputs.",
+			 function );
+
+			goto on_error;
+		}
+		last_input_indexes[ cache_set_index ] = number_of_inputs - 1;
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "Windows Explorer thumbnail cache database timeline:\n" );
+
+	while( info_handle->abort == 0 )
+	{
+		result = libwtcdb_timeline_get_next_entry(
+		          timeline,
+		          &modification_time,
+		          &hash,
+		          &input_index,
+		          &number_of_items,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next timeline entry.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		for( cache_set_index = 0;
+		     cache_set_index < ( info_handle->number_of_input_cache_sets - 1 );
+		     cache_set_index++ )
+		{
+			if( input_index <= last_input_indexes[ cache_set_index ] )
+			{
+				break;
+			}
+		}
+		if( info_handle_filetime_value_fprint(
+		     info_handle,
+		     "\tModification time\t",
+		     modification_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print modification time.",
+			 function );
+
+			goto on_error;
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tHash\t\t\t: 0x%016" PRIx64 "\n",
+		 hash );
+
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tSource\t\t\t: %" PRIs_SYSTEM "\n",
+		 info_handle->input_directory_names[ cache_set_index ] );
+
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tNumber of items\t\t: %d\n",
+		 number_of_items );
+
+		if( info_handle_timeline_items_fprint(
+		     info_handle,
+		     timeline,
+		     number_of_items,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print items.",
+			 function );
+
+			goto on_error;
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\n" );
+
+		number_of_entries++;
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of entries\t: %d\n",
+	 number_of_entries );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	if( libwtcdb_timeline_free(
+	     &timeline,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free timeline.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 last_input_indexes );
+
+	return( 1 );
+
+on_error:
+	if( timeline != NULL )
+	{
+		libwtcdb_timeline_free(
+		 &timeline,
+		 NULL );
+	}
+	if( last_input_indexes != NULL )
+	{
+		memory_free(
+		 last_input_indexes );
+	}
+	return( -1 );
+}
+
@@ -41,6 +41,18 @@ struct info_handle
 	 */
 	libwtcdb_file_t *input_file;
 
+	/* The libwtcdb input cache sets, used by the timeline
+	 */
+	libwtcdb_cache_set_t **input_cache_sets;
+
+	/* The directory names of the input cache sets
+	 */
+	system_character_t * const *input_directory_names;
+
+	/* The number of input cache sets
+	 */
+	int number_of_input_cache_sets;
+
 	/* The ascii codepage
 	 */
 	int ascii_codepage;
@@ -80,6 +92,16 @@ int info_handle_close_input(
      info_handle_t *info_handle,
      libcerror_error_t **error );
 
+int info_handle_open_input_cache_sets(
+     info_handle_t *info_handle,
+     system_character_t * const *directory_names,
+     int number_of_directory_names,
+     libcerror_error_t **error );
+
+int info_handle_close_input_cache_sets(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
 int info_handle_filetime_value_fprint(
      info_handle_t *info_handle,
      const char *value_name,
@@ -90,6 +112,16 @@ int info_handle_file_fprint(
      info_handle_t *info_handle,
      libcerror_error_t **error );
 
+int info_handle_timeline_items_fprint(
+     info_handle_t *info_handle,
+     libwtcdb_timeline_t *timeline,
+     int number_of_items,
+     libcerror_error_t **error );
+
+int info_handle_timeline_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,337 @@
+/*
+ * Shows the differences between two versions of a Windows Explorer thumbnail cache database file.
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include <stdio.h>
+
+#if defined( HAVE_FCNTL_H ) || defined( WINAPI )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_IO_H ) || defined( WINAPI )
+#include <io.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "diff_handle.h"
+#include "wtcdbtools_getopt.h"
+#include "wtcdbtools_libcerror.h"
+#include "wtcdbtools_libclocale.h"
+#include "wtcdbtools_libcnotify.h"
+#include "wtcdbtools_libwtcdb.h"
+#include "wtcdbtools_output.h"
+#include "wtcdbtools_signal.h"
+#include "wtcdbtools_unused.h"
+
+diff_handle_t *wtcdbdiff_diff_handle = NULL;
+int wtcdbdiff_abort                  = 0;
+
+/* Signal handler for wtcdbdiff
+ */
+void wtcdbdiff_signal_handler(
+      wtcdbtools_signal_t signal WTCDBTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "wtcdbdiff_signal_handler";
+
+	WTCDBTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	wtcdbdiff_abort = 1;
+
+	if( wtcdbdiff_diff_handle != NULL )
+	{
+		if( diff_handle_signal_abort(
+		     wtcdbdiff_diff_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal diff handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     0 ) != 0 )
+#else
+	if( close(
+	     0 ) != 0 )
+#endif
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	const char *description    = \
+		"Use wtcdbdiff to compare two versions of a Windows Explorer thumbnail cache database (thumbcache.db) file.";
+
+	wtcdbtools_option_t options[ ] = {
+		{ 'c', NULL, "compare the cached data of items that have the same data size and CRC" },
+		{ 'h', NULL, "shows this help" },
+		{ 'v', NULL, "verbose output to stderr" },
+		{ 'V', NULL, "print version" },
+		{ 0, "old_source", "the old version of the source file" },
+		{ 0, "new_source", "the new version of the source file" },
+	};
+	system_character_t options_string[ 32 ];
+
+	libwtcdb_error_t *error        = NULL;
+	system_character_t *new_source = NULL;
+	system_character_t *old_source = NULL;
+	char *program                  = "wtcdbdiff";
+	system_integer_t option        = 0;
+	uint8_t compare_data           = 0;
+	int number_of_options          = (int) ( sizeof( options ) / sizeof( wtcdbtools_option_t ) );
+	int verbose                    = 0;
+
+#if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
+	_setmode( _fileno( stdout ), _O_BINARY );
+	_setmode( _fileno( stderr ), _O_BINARY );
+#endif
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "wtcdbtools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( wtcdbtools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	wtcdbtools_output_version_fprint(
+	 stdout,
+	 program );
+
+	if( wtcdbtools_getopt_get_options_string(
+	     options,
+	     number_of_options,
+	     options_string,
+	     32 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine options string.\n" );
+
+		goto on_error;
+	}
+	while( ( option = wtcdbtools_getopt(
+	                   argc,
+	                   argv,
+	                   options_string ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				wtcdbtools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'c':
+				compare_data = 1;
+
+				break;
+
+			case (system_integer_t) 'h':
+				wtcdbtools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				wtcdbtools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( ( argc - optind ) < 2 )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source files.\n" );
+
+		wtcdbtools_getopt_usage_fprint(
+		 stdout,
+		 program,
+		 description,
+		 options,
+		 number_of_options );
+
+		return( EXIT_FAILURE );
+	}
+	old_source = argv[ optind ];
+	new_source = argv[ optind + 1 ];
+
+	libcnotify_verbose_set(
+	 verbose );
+	libwtcdb_notify_set_stream(
+	 stderr,
+	 NULL );
+	libwtcdb_notify_set_verbose(
+	 verbose );
+
+	if( diff_handle_initialize(
+	     &wtcdbdiff_diff_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize diff handle.\n" );
+
+		goto on_error;
+	}
+	if( diff_handle_set_compare_data(
+	     wtcdbdiff_diff_handle,
+	     compare_data,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set compare data.\n" );
+
+		goto on_error;
+	}
+	if( diff_handle_open_input(
+	     wtcdbdiff_diff_handle,
+	     old_source,
+	     new_source,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open source files.\n" );
+
+		goto on_error;
+	}
+	if( diff_handle_compare_fprint(
+	     wtcdbdiff_diff_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to compare source files.\n" );
+
+		goto on_error;
+	}
+	if( diff_handle_close_input(
+	     wtcdbdiff_diff_handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close diff handle.\n" );
+
+		goto on_error;
+	}
+	if( diff_handle_free(
+	     &wtcdbdiff_diff_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free diff handle.\n" );
+
+		goto on_error;
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( wtcdbdiff_diff_handle != NULL )
+	{
+		diff_handle_free(
+		 &wtcdbdiff_diff_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -113,9 +113,10 @@ int main( int argc, char * const argv[] )
 
 	wtcdbtools_option_t options[ ] = {
 		{ 'h', NULL, "shows this help" },
+		{ 't', NULL, "shows a timeline of the modification times of the index files, every source is a directory that contains thumbcache files" },
 		{ 'v', NULL, "verbose output to stderr" },
 		{ 'V', NULL, "print version" },
-		{ 0, "source", "the source file" },
+		{ 0, "source", "the source file or directories" },
 	};
 	system_character_t options_string[ 32 ];
 
@@ -124,6 +125,7 @@ int main( int argc, char * const argv[] )
 	char *program              = "wtcdbinfo";
 	system_integer_t option    = 0;
 	int number_of_options      = (int) ( sizeof( options ) / sizeof( wtcdbtools_option_t ) );
+	int print_timeline         = 0;
 	int verbose                = 0;
 
 #if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
@@ -206,6 +208,11 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_SUCCESS );
 
+			case (system_integer_t) 't':
+				print_timeline = 1;
+
+				break;
+
 			case (system_integer_t) 'v':
 				verbose = 1;
 
@@ -253,36 +260,74 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( info_handle_open_input(
-	     wtcdbinfo_info_handle,
-	     source,
-	     &error ) != 1 )
+	if( print_timeline != 0 )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to open source file.\n" );
+		if( info_handle_open_input_cache_sets(
+		     wtcdbinfo_info_handle,
+		     &( argv[ optind ] ),
+		     argc - optind,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open source directories.\n" );
 
-		goto on_error;
-	}
-	if( info_handle_file_fprint(
-	     wtcdbinfo_info_handle,
-	     &error ) != 1 )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to print file information.\n" );
+			goto on_error;
+		}
+		if( info_handle_timeline_fprint(
+		     wtcdbinfo_info_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print timeline.\n" );
 
-		goto on_error;
+			goto on_error;
+		}
+		if( info_handle_close_input_cache_sets(
+		     wtcdbinfo_info_handle,
+		     &error ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to close info handle.\n" );
+
+			goto on_error;
+		}
 	}
-	if( info_handle_close_input(
-	     wtcdbinfo_info_handle,
-	     &error ) != 0 )
+	else
 	{
-		fprintf(
-		 stderr,
-		 "Unable to close info handle.\n" );
+		if( info_handle_open_input(
+		     wtcdbinfo_info_handle,
+		     source,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open source file.\n" );
 
-		goto on_error;
+			goto on_error;
+		}
+		if( info_handle_file_fprint(
+		     wtcdbinfo_info_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print file information.\n" );
+
+			goto on_error;
+		}
+		if( info_handle_close_input(
+		     wtcdbinfo_info_handle,
+		     &error ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to close info handle.\n" );
+
+			goto on_error;
+		}
 	}
 	if( info_handle_free(
 	     &wtcdbinfo_info_handle,